@@ -9,6 +9,7 @@
 
 class plResource;
 class plResourceManager;
+class plRTTI;
 class plResourceTypeLoader;
 class plStreamReader;
 
@@ -139,6 +140,18 @@ enum class plResourceAcquireResult
   Final,           ///< The resource is fully available.
 };
 
+/// \brief [internal] One entry of a load-set manifest.
+///
+/// A load-set is the list of resources that another resource requested during its UpdateContent() call.
+/// \sa plResourceManager::EnableLoadSetRecording()
+struct plResourceLoadSetEntry
+{
+  const plRTTI* m_pType = nullptr;
+  plString m_sResourceID;
+
+  bool operator==(const plResourceLoadSetEntry& rhs) const { return m_pType == rhs.m_pType && m_sResourceID == rhs.m_sResourceID; }
+};
+
 enum class plResourcePriority
 {
   Critical = 0,
@@ -0,0 +1,201 @@
+#include <Core/CorePCH.h>
+
+#include <Core/ResourceManager/Implementation/ResourceManagerState.h>
+#include <Core/ResourceManager/ResourceManager.h>
+#include <Foundation/IO/FileSystem/FileReader.h>
+#include <Foundation/IO/FileSystem/FileWriter.h>
+#include <Foundation/Profiling/Profiling.h>
+#include <Foundation/Types/ScopeExit.h>
+
+enum class plResourceLoadSetVersion : plUInt8
+{
+  Version0 = 0,
+  Version1,
+
+  ENUM_COUNT,
+  Current = ENUM_COUNT - 1,
+};
+
+// the load-set that resources requested on this thread are currently recorded into (if any)
+static thread_local plHybridArray<plResourceLoadSetEntry, 8>* s_pRecordingLoadSet = nullptr;
+
+void plResourceManager::EnableLoadSetRecording(bool bEnable)
+{
+  PL_ASSERT_DEV(s_pState != nullptr, "plStartup::StartupCoreSystems() must be called before using the plResourceManager.");
+
+  PL_LOCK(s_ResourceMutex);
+  s_pState->m_bRecordLoadSets = bEnable;
+}
+
+bool plResourceManager::IsLoadSetRecordingEnabled()
+{
+  return s_pState->m_bRecordLoadSets;
+}
+
+void plResourceManager::EnableLoadSetPrefetching(bool bEnable)
+{
+  PL_ASSERT_DEV(s_pState != nullptr, "plStartup::StartupCoreSystems() must be called before using the plResourceManager.");
+
+  PL_LOCK(s_ResourceMutex);
+  s_pState->m_bPrefetchLoadSets = bEnable;
+}
+
+bool plResourceManager::IsLoadSetPrefetchingEnabled()
+{
+  return s_pState->m_bPrefetchLoadSets;
+}
+
+plResult plResourceManager::GetLoadSetManifestPath(const plResource* pResource, plStringBuilder& out_sPath)
+{
+  // only resources that are actually loaded from a file can have a manifest next to them
+  if (pResource->GetBaseResourceFlags().IsAnySet(plResourceFlags::IsCreatedResource | plResourceFlags::PreventFileReload) ||
+      !pResource->GetBaseResourceFlags().IsSet(plResourceFlags::IsReloadable))
+    return PL_FAILURE;
+
+  plFileSystem::ResolveAssetRedirection(pResource->GetResourceID(), out_sPath);
+
+  if (out_sPath.IsEmpty())
+    return PL_FAILURE;
+
+  out_sPath.Append(".plLoadSet");
+  return PL_SUCCESS;
+}
+
+void plResourceManager::ReadLoadSetManifest(const plResource* pResource, LoadSet& out_loadSet)
+{
+  out_loadSet.Clear();
+
+  plStringBuilder sManifest;
+  if (GetLoadSetManifestPath(pResource, sManifest).Failed())
+    return;
+
+  plFileReader file;
+  if (file.Open(sManifest, 1024 * 4).Failed())
+    return;
+
+  PL_PROFILE_SCOPE("ReadLoadSetManifest");
+
+  plUInt8 uiVersion = 0;
+  file >> uiVersion;
+
+  if (uiVersion == 0 || uiVersion > (plUInt8)plResourceLoadSetVersion::Current)
+  {
+    plLog::Warning("Load-set manifest '{}' has an unsupported version ({})", sManifest, uiVersion);
+    return;
+  }
+
+  plUInt32 uiCount = 0;
+  file >> uiCount;
+
+  out_loadSet.Reserve(uiCount);
+
+  plStringBuilder sTypeName;
+  plStringBuilder sResourceID;
+
+  for (plUInt32 i = 0; i < uiCount; ++i)
+  {
+    if (file.ReadString(sTypeName).Failed() || file.ReadString(sResourceID).Failed())
+    {
+      plLog::Warning("Load-set manifest '{}' is truncated", sManifest);
+      out_loadSet.Clear();
+      return;
+    }
+
+    // types may have been removed or may come from a plugin that is not loaded (yet)
+    const plRTTI* pType = plRTTI::FindTypeByName(sTypeName);
+    if (pType == nullptr || !pType->IsDerivedFrom<plResource>())
+      continue;
+
+    auto& entry = out_loadSet.ExpandAndGetRef();
+    entry.m_pType = pType;
+    entry.m_sResourceID = sResourceID;
+  }
+}
+
+void plResourceManager::WriteLoadSetManifest(const plResource* pResource, const LoadSet& loadSet)
+{
+  plStringBuilder sManifest;
+  if (GetLoadSetManifestPath(pResource, sManifest).Failed())
+    return;
+
+  PL_PROFILE_SCOPE("WriteLoadSetManifest");
+
+  plFileWriter file;
+  if (file.Open(sManifest, 1024 * 4).Failed())
+  {
+    plLog::Dev("Could not write load-set manifest '{}'", sManifest);
+    return;
+  }
+
+  file << (plUInt8)plResourceLoadSetVersion::Current;
+  file << loadSet.GetCount();
+
+  for (const auto& entry : loadSet)
+  {
+    file << entry.m_pType->GetTypeName();
+    file << entry.m_sResourceID;
+  }
+}
+
+void plResourceManager::PrefetchLoadSet(const plResource* pResource, const LoadSet& loadSet)
+{
+  if (loadSet.IsEmpty())
+    return;
+
+  PL_PROFILE_SCOPE("PrefetchLoadSet");
+
+  PL_LOCK(s_ResourceMutex);
+
+  if (s_pState->m_bShutdown)
+    return;
+
+  // this may run nested inside another resource's UpdateContent() on the same thread, which must not record these requests
+  LoadSet* pPreviousLoadSet = BeginLoadSetRecording(nullptr);
+  PL_SCOPE_EXIT(EndLoadSetRecording(pPreviousLoadSet));
+
+  for (const auto& entry : loadSet)
+  {
+    plResource* pDependency = GetResource(entry.m_pType, entry.m_sResourceID, true);
+
+    if (pDependency == nullptr || pDependency == pResource)
+      continue;
+
+    // inherit the priority of the resource that needs the dependency, so that the whole set arrives at roughly the same time
+    if (pDependency->GetLoadingState() == plResourceState::Unloaded && !IsQueuedForLoading(pDependency))
+    {
+      if (pResource->GetPriority() < pDependency->GetPriority())
+      {
+        pDependency->SetPriority(pResource->GetPriority());
+      }
+
+      PreloadResource(pDependency);
+    }
+  }
+}
+
+plResourceManager::LoadSet* plResourceManager::BeginLoadSetRecording(LoadSet* pLoadSet)
+{
+  LoadSet* pPrevious = s_pRecordingLoadSet;
+  s_pRecordingLoadSet = pLoadSet;
+  return pPrevious;
+}
+
+void plResourceManager::EndLoadSetRecording(LoadSet* pPreviousLoadSet)
+{
+  s_pRecordingLoadSet = pPreviousLoadSet;
+}
+
+void plResourceManager::RecordLoadSetDependency(const plResource* pResource)
+{
+  if (s_pRecordingLoadSet == nullptr)
+    return;
+
+  plResourceLoadSetEntry entry;
+  entry.m_pType = pResource->GetDynamicRTTI();
+  entry.m_sResourceID = pResource->GetResourceID();
+
+  if (s_pRecordingLoadSet->IndexOf(entry) == plInvalidIndex)
+  {
+    s_pRecordingLoadSet->PushBack(std::move(entry));
+  }
+}
@@ -702,7 +702,12 @@ plResource* plResourceManager::GetResource(const plRTTI* pRtti, plStringView sRe
   LoadedResources& lr = s_pState->m_LoadedResources[pRtti];
 
   if (lr.m_Resources.TryGetValue(sHashedResourceID, pResource))
+  {
+    if (bIsReloadable)
+      RecordLoadSetDependency(pResource);
+
     return pResource;
+  }
 
   plResource* pNewResource = pRtti->GetAllocator()->Allocate<plResource>();
   pNewResource->m_Priority = s_pState->m_ResourceTypePriorities.GetValueOrDefault(pRtti, plResourcePriority::Medium);
@@ -711,6 +716,9 @@ plResource* plResourceManager::GetResource(const plRTTI* pRtti, plStringView sRe
 
   lr.m_Resources.Insert(sHashedResourceID, pNewResource);
 
+  if (bIsReloadable)
+    RecordLoadSetDependency(pNewResource);
+
   return pNewResource;
 }
 
@@ -97,6 +97,11 @@ private:
   bool m_bExportMode = false;
   plUInt32 m_uiNextResourceID = 0;
 
+  // Load-set manifests
+
+  bool m_bRecordLoadSets = false;
+  bool m_bPrefetchLoadSets = false;
+
   // Resource Unloading
   plTime m_AutoFreeUnusedTimeout = plTime::MakeZero();
   plTime m_AutoFreeUnusedThreshold = plTime::MakeZero();
@@ -48,6 +48,25 @@ void plResourceManagerWorkerDataLoad::Execute()
 
   PL_ASSERT_DEV(pLoader != nullptr, "No Loader function available for Resource Type '{0}'", pResourceToLoad->GetDynamicRTTI()->GetTypeName());
 
+  bool bRecordLoadSet = false;
+  plResourceManager::LoadSet previousLoadSet;
+
+  if (pCustomLoader == nullptr)
+  {
+    bRecordLoadSet = plResourceManager::IsLoadSetRecordingEnabled();
+
+    if (bRecordLoadSet || plResourceManager::IsLoadSetPrefetchingEnabled())
+    {
+      plResourceManager::ReadLoadSetManifest(pResourceToLoad, previousLoadSet);
+
+      // queue all known dependencies before reading this resource, so that they are loaded in parallel
+      if (plResourceManager::IsLoadSetPrefetchingEnabled())
+      {
+        plResourceManager::PrefetchLoadSet(pResourceToLoad, previousLoadSet);
+      }
+    }
+  }
+
   plResourceLoadData LoaderData = pLoader->OpenDataStream(pResourceToLoad);
 
   // we need this info later to do some work in a lock, all the directly following code is outside the lock
@@ -94,6 +113,8 @@ void plResourceManagerWorkerDataLoad::Execute()
     pUpdateContentTask->m_pLoader = pLoader;
     pUpdateContentTask->m_pCustomLoader = std::move(pCustomLoader);
     pUpdateContentTask->m_pResourceToLoad = pResourceToLoad;
+    pUpdateContentTask->m_bRecordLoadSet = bRecordLoadSet;
+    pUpdateContentTask->m_PreviousLoadSet = std::move(previousLoadSet);
 
     // schedule the task to run, either on the main thread or on some other thread
     *pUpdateContentGroup = plTaskSystem::StartSingleTask(
@@ -118,7 +139,32 @@ void plResourceManagerWorkerUpdateContent::Execute()
   if (!m_LoaderData.m_sResourceDescription.IsEmpty())
     m_pResourceToLoad->SetResourceDescription(m_LoaderData.m_sResourceDescription);
 
-  m_pResourceToLoad->CallUpdateContent(m_LoaderData.m_pDataStream);
+  if (m_bRecordLoadSet)
+  {
+    plResourceManager::LoadSet loadSet;
+    plResourceManager::LoadSet* pPreviousLoadSet = plResourceManager::BeginLoadSetRecording(&loadSet);
+
+    m_pResourceToLoad->CallUpdateContent(m_LoaderData.m_pDataStream);
+
+    plResourceManager::EndLoadSetRecording(pPreviousLoadSet);
+
+    // a resource may look itself up again, that is not a dependency
+    plResourceLoadSetEntry self;
+    self.m_pType = m_pResourceToLoad->GetDynamicRTTI();
+    self.m_sResourceID = m_pResourceToLoad->GetResourceID();
+    loadSet.RemoveAndCopy(self);
+
+    if (loadSet != m_PreviousLoadSet)
+    {
+      plResourceManager::WriteLoadSetManifest(m_pResourceToLoad, loadSet);
+    }
+  }
+  else
+  {
+    m_pResourceToLoad->CallUpdateContent(m_LoaderData.m_pDataStream);
+  }
+
+  m_PreviousLoadSet.Clear();
 
   if (m_pResourceToLoad->m_uiQualityLevelsLoadable > 0)
   {
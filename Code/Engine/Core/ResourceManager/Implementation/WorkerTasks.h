@@ -2,6 +2,7 @@
 
 #include <Core/ResourceManager/Implementation/Declarations.h>
 #include <Core/ResourceManager/ResourceTypeLoader.h>
+#include <Foundation/Containers/HybridArray.h>
 #include <Foundation/Threading/TaskSystem.h>
 #include <Foundation/Types/UniquePtr.h>
 
@@ -34,6 +35,11 @@ public:
   // m_pLoader is always set, no need to go through m_pCustomLoader
   plUniquePtr<plResourceTypeLoader> m_pCustomLoader;
 
+  // whether the resources requested during UpdateContent() should be recorded into a load-set manifest
+  bool m_bRecordLoadSet = false;
+  // the load-set that was read from the manifest before loading, used to detect whether the manifest needs to be rewritten
+  plHybridArray<plResourceLoadSetEntry, 8> m_PreviousLoadSet;
+
 private:
   friend class plResourceManager;
   friend class plResourceManagerState;
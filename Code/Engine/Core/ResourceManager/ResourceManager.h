@@ -334,6 +334,33 @@ public:
   static plTypedResourceHandle<ResourceType> GetResourceHandleForExport(plStringView sResourceID);
 
 
+  ///@}
+  /// \name Load-set manifests
+  ///@{
+
+public:
+  /// \brief Enables recording of load-sets.
+  ///
+  /// While a file based resource runs UpdateContent(), all resources that it requests through LoadResource() are recorded.
+  /// After loading, this list is stored in a manifest file next to the resource ('<resource path>.plLoadSet'), if it differs from the
+  /// previously stored manifest. The data directory of the resource must be writable for this to work.
+  ///
+  /// \sa EnableLoadSetPrefetching()
+  static void EnableLoadSetRecording(bool bEnable);
+
+  /// \brief Returns whether load-set recording is active.
+  static bool IsLoadSetRecordingEnabled();
+
+  /// \brief Enables prefetching of load-sets.
+  ///
+  /// When a resource is picked up for loading, its load-set manifest is read (if available) and all the resources listed in it are
+  /// passed to PreloadResource(). Since each of those reads its own manifest once it gets loaded, the entire dependency closure is
+  /// queued for loading early on, instead of being discovered one UpdateContent() at a time.
+  static void EnableLoadSetPrefetching(bool bEnable);
+
+  /// \brief Returns whether load-set prefetching is active.
+  static bool IsLoadSetPrefetchingEnabled();
+
   ///@}
   /// \name Resource Type Overrides
   ///@{
@@ -509,6 +536,20 @@ private:
 
   /// \brief Checks whether there is a type override for pRtti given szResourceID and returns that
   static const plRTTI* FindResourceTypeOverride(const plRTTI* pRtti, plStringView sResourceID);
+
+  // Load-set manifests
+private:
+  using LoadSet = plHybridArray<plResourceLoadSetEntry, 8>;
+
+  static plResult GetLoadSetManifestPath(const plResource* pResource, plStringBuilder& out_sPath);
+  static void ReadLoadSetManifest(const plResource* pResource, LoadSet& out_loadSet);
+  static void WriteLoadSetManifest(const plResource* pResource, const LoadSet& loadSet);
+  static void PrefetchLoadSet(const plResource* pResource, const LoadSet& loadSet);
+
+  /// \brief Makes all resources requested on this thread get recorded into \a pLoadSet. Returns the previously active load-set.
+  static LoadSet* BeginLoadSetRecording(LoadSet* pLoadSet);
+  static void EndLoadSetRecording(LoadSet* pPreviousLoadSet);
+  static void RecordLoadSetDependency(const plResource* pResource);
 };
 
 #include <Core/ResourceManager/Implementation/ResourceLock.h>
@@ -29,6 +29,7 @@ PL_STATICLINK_LIBRARY(Foundation)
   PL_STATICLINK_REFERENCE(Foundation_Reflection_Implementation_StandardTypes);
   PL_STATICLINK_REFERENCE(Foundation_Serialization_Implementation_AbstractObjectGraph);
   PL_STATICLINK_REFERENCE(Foundation_Serialization_Implementation_GraphVersioning);
+  PL_STATICLINK_REFERENCE(Foundation_Serialization_Implementation_SerializationPlan);
   PL_STATICLINK_REFERENCE(Foundation_System_Implementation_StackTracer);
   PL_STATICLINK_REFERENCE(Foundation_Threading_Implementation_TaskSystem);
   PL_STATICLINK_REFERENCE(Foundation_Threading_Implementation_ThreadUtils);
@@ -36,5 +37,6 @@ PL_STATICLINK_LIBRARY(Foundation)
   PL_STATICLINK_REFERENCE(Foundation_Time_Implementation_Time);
   PL_STATICLINK_REFERENCE(Foundation_Time_Implementation_Timestamp);
   PL_STATICLINK_REFERENCE(Foundation_Types_Implementation_VarianceTypes);
+  PL_STATICLINK_REFERENCE(Foundation_Types_Implementation_VariantTypedArray);
   PL_STATICLINK_REFERENCE(Foundation_Types_Implementation_VariantTypeRegistry);
 }
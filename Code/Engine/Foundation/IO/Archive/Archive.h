@@ -12,6 +12,7 @@ enum class plArchiveCompressionMode : plUInt8
   Uncompressed,
   Compressed_zstd,
   Compressed_zip,
+  Compressed_zstd_dict, ///< zstd compressed, using the dictionary that is stored in the archive header
 };
 
 /// \brief Data for a single file entry in an plArchive file
@@ -22,6 +22,18 @@ public:
   // all the source files from disk that should be put into the plArchive
   plDeque<SourceEntry> m_Entries;
 
+  /// \brief If enabled, files with identical content (same xxHash64 and size) are only stored once and all their TOC entries reference the same data.
+  bool m_bDeduplicateContent = true;
+
+  /// \brief If enabled, a zstd dictionary is built from the small zstd compressed entries and stored in the archive header.
+  ///
+  /// The small entries are then compressed with that dictionary, which improves the compression ratio and the decompression speed
+  /// of archives with many small, similar files (configs, materials, prefabs, ...) a lot.
+  bool m_bUseCompressionDictionary = false;
+
+  /// \brief The maximum size of the compression dictionary, if m_bUseCompressionDictionary is enabled.
+  plUInt32 m_uiMaxCompressionDictionarySize = 112 * 1024;
+
   enum class InclusionMode
   {
     Exclude,               ///< Do not add this file to the archive
@@ -46,6 +58,9 @@ public:
   plResult WriteArchive(plStringView sFile) const;
 
   /// \brief Writes the previously gathered files to the file stream
+  ///
+  /// Files are read, hashed and compressed in parallel in batches of limited size, but are always written in the order of m_Entries,
+  /// so the result is deterministic. Very large files are streamed into the archive one by one.
   plResult WriteArchive(plStreamWriter& inout_stream) const;
 
 protected:
@@ -56,6 +71,7 @@ protected:
   virtual bool WriteFileProgressCallback(plUInt64 bytesWritten, plUInt64 bytesTotal) const;
 
   /// Override this to get a callback after a file has been processed. Gets additional information about the compression result and duration.
+  /// For files whose content was deduplicated, \a uiStoredSize is zero, since no additional data was written.
   virtual void WriteFileResultCallback(plUInt32 uiCurEntry, plUInt32 uiMaxEntries, plStringView sSourceFile, plUInt64 uiSourceSize, plUInt64 uiStoredSize, plTime duration) const
   {
     PL_IGNORE_UNUSED(uiCurEntry);
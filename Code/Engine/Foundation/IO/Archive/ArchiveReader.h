@@ -6,11 +6,15 @@
 
 class plRawMemoryStreamReader;
 class plStreamReader;
+class plZstdDictionary;
 
 /// \brief A utility class for reading from plArchive files
 class PL_FOUNDATION_DLL plArchiveReader
 {
 public:
+  plArchiveReader();
+  virtual ~plArchiveReader();
+
   /// \brief Opens the given file and validates that it is a valid archive file.
   plResult OpenArchive(plStringView sPath);
 
@@ -30,9 +34,17 @@ public:
   /// \brief Sets up \a memReader for reading the raw (potentially compressed) data that is stored for the given entry in the archive.
   void ConfigureRawMemoryStreamReader(plUInt32 uiEntryIdx, plRawMemoryStreamReader& ref_memReader) const;
 
+  /// \brief Returns the raw (potentially compressed) data that is stored for the given entry in the archive.
+  plConstByteArrayPtr GetStoredEntryData(plUInt32 uiEntryIdx) const;
+
   /// \brief Creates a reader that will decompress the given file entry.
   plUniquePtr<plStreamReader> CreateEntryReader(plUInt32 uiEntryIdx) const;
 
+  /// \brief Returns the pre-digested compression dictionary that entries with plArchiveCompressionMode::Compressed_zstd_dict need for decompression.
+  ///
+  /// Returns nullptr, if the archive has no dictionary.
+  const plZstdDictionary* GetCompressionDictionary() const { return m_pDictionary.Borrow(); }
+
 protected:
   /// \brief Called by ExtractAllFiles() for progress reporting. Return false to abort.
   virtual bool ExtractNextFileCallback(plUInt32 uiCurEntry, plUInt32 uiMaxEntries, plStringView sSourceFile) const;
@@ -45,4 +57,5 @@ protected:
   plUInt8 m_uiArchiveVersion = 0;
   const void* m_pDataStart = nullptr;
   plUInt64 m_uiMemFileSize = 0;
+  plUniquePtr<plZstdDictionary> m_pDictionary;
 };
@@ -10,6 +10,7 @@ class plMemoryMappedFile;
 class plArchiveTOC;
 class plArchiveEntry;
 class plRawMemoryStreamReader;
+class plZstdDictionary;
 
 /// \brief Utilities for working with plArchive files
 namespace plArchiveUtils
@@ -17,6 +18,8 @@ namespace plArchiveUtils
   using FileWriteProgressCallback = plDelegate<bool(plUInt64, plUInt64)>;
   constexpr plUInt32 ArchiveHeaderSize = 16;
   constexpr plUInt32 ArchiveTOCMetaMaxFooterSize = 14 + 12; //< note that it's the MAX size, i.e. toc meta can be smaller
+  constexpr plUInt64 SeekableEntryMinSize = 4 * 1024 * 1024;  //< zstd compressed entries of at least this size are written with seekable frames
+  constexpr plUInt32 SeekableFrameSize = 256 * 1024;           //< uncompressed size of each frame in seekable entries
 
   struct TOCMeta
   {
@@ -35,11 +38,19 @@ namespace plArchiveUtils
   PL_FOUNDATION_DLL bool IsAcceptedArchiveFileExtensions(plStringView sExtension);
 
   /// \brief Writes the header that identifies the plArchive file and version to the stream
-  PL_FOUNDATION_DLL plResult WriteHeader(plStreamWriter& inout_stream);
+  ///
+  /// If a compression dictionary is given, it is stored directly after the header. All entries that use
+  /// plArchiveCompressionMode::Compressed_zstd_dict must have been compressed with it.
+  PL_FOUNDATION_DLL plResult WriteHeader(plStreamWriter& inout_stream, plConstByteArrayPtr compressionDictionary = plConstByteArrayPtr());
 
   /// \brief Reads the plArchive header. Returns success and the version, if the stream is a valid plArchive file.
   PL_FOUNDATION_DLL plResult ReadHeader(plStreamReader& inout_stream, plUInt8& out_uiVersion);
 
+  /// \brief Reads the size of the compression dictionary that follows the header (from version 5 on). Call this directly after ReadHeader().
+  ///
+  /// The dictionary data itself follows directly after, entry data starts after the dictionary.
+  PL_FOUNDATION_DLL plResult ReadDictionarySize(plStreamReader& inout_stream, plUInt8 uiArchiveVersion, plUInt32& out_uiDictionarySize);
+
   /// \brief Writes the archive TOC to the stream. This must be the last thing in the stream, if ExtractTOC() is supposed to work.
   PL_FOUNDATION_DLL plResult AppendTOC(plStreamWriter& inout_stream, const plArchiveTOC& toc);
 
@@ -82,10 +93,15 @@ namespace plArchiveUtils
   PL_FOUNDATION_DLL void ConfigureRawMemoryStreamReader(
     const plArchiveEntry& entry, const void* pStartOfArchiveData, plRawMemoryStreamReader& ref_memReader);
 
+  /// \brief Returns the raw (potentially compressed) data that is stored for \a entry in the archive file.
+  PL_FOUNDATION_DLL plConstByteArrayPtr GetStoredEntryData(const plArchiveEntry& entry, const void* pStartOfArchiveData);
+
   /// \brief Creates a new stream reader which allows to read the uncompressed data for the given archive entry.
   ///
   /// Under the hood it may create different types of stream readers to uncompress or decode the data.
-  PL_FOUNDATION_DLL plUniquePtr<plStreamReader> CreateEntryReader(const plArchiveEntry& entry, const void* pStartOfArchiveData);
+  /// Entries that use plArchiveCompressionMode::Compressed_zstd_dict can only be read, if the archive's dictionary is passed in.
+  /// Large zstd entries that were written with seekable frames get a reader that supports cheap skipping.
+  PL_FOUNDATION_DLL plUniquePtr<plStreamReader> CreateEntryReader(const plArchiveEntry& entry, const void* pStartOfArchiveData, const plZstdDictionary* pDictionary = nullptr);
 
   PL_FOUNDATION_DLL plResult ReadZipHeader(plStreamReader& inout_stream, plUInt8& out_uiVersion);
   PL_FOUNDATION_DLL plResult ExtractZipTOC(const plMemoryMappedFile& memFile, plArchiveTOC& ref_toc);
@@ -99,12 +99,19 @@ namespace plDataDirectory
     ArchiveReaderZstd(plInt32 iDataDirUserData);
 
     virtual plUInt64 Read(void* pBuffer, plUInt64 uiBytes) override;
+    virtual plUInt64 Skip(plUInt64 uiBytes) override;
 
   protected:
     virtual plResult InternalOpen(plFileShareMode::Enum FileShareMode) override;
     virtual void InternalClose() override;
 
+    friend class ArchiveType;
+
     plCompressedStreamReaderZstd m_CompressedStreamReader;
+    plSeekableCompressedStreamReaderZstd m_SeekableStreamReader;
+    plConstByteArrayPtr m_StoredData;
+    const plZstdDictionary* m_pDictionary = nullptr; ///< Set for entries that use plArchiveCompressionMode::Compressed_zstd_dict
+    bool m_bSeekable = false;
   };
 #endif
 
@@ -117,7 +117,7 @@ struct plHashHelper<plOldTempHashedString>
 
 plResult plArchiveTOC::Deserialize(plStreamReader& inout_stream, plUInt8 uiArchiveVersion)
 {
-  PL_ASSERT_ALWAYS(uiArchiveVersion <= 4, "Unsupported archive version {}", uiArchiveVersion);
+  PL_ASSERT_ALWAYS(uiArchiveVersion <= 5, "Unsupported archive version {}", uiArchiveVersion);
 
   // we don't use the TOC version anymore, but the archive version instead
   const plTypeVersion version = inout_stream.ReadVersion(2);
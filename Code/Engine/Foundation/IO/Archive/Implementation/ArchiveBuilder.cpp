@@ -3,9 +3,13 @@
 #include <Foundation/IO/Archive/ArchiveBuilder.h>
 #include <Foundation/IO/Archive/ArchiveUtils.h>
 #include <Foundation/IO/CompressedStreamZstd.h>
+#include <Foundation/IO/FileSystem/FileReader.h>
 #include <Foundation/IO/FileSystem/FileWriter.h>
+#include <Foundation/IO/MemoryStream.h>
 #include <Foundation/IO/OSFile.h>
 #include <Foundation/Logging/Log.h>
+#include <Foundation/Profiling/Profiling.h>
+#include <Foundation/Threading/TaskSystem.h>
 #include <Foundation/Time/Stopwatch.h>
 
 void plArchiveBuilder::AddFolder(plStringView sAbsFolderPath, plArchiveCompressionMode defaultMode /*= plArchiveCompressionMode::Uncompressed*/, InclusionCallback callback /*= InclusionCallback()*/)
@@ -97,9 +101,227 @@ plResult plArchiveBuilder::WriteArchive(plStringView sFile) const
   return WriteArchive(file);
 }
 
+namespace
+{
+  /// Files larger than this are not loaded into memory, but streamed into the archive as before.
+  constexpr plUInt64 MaxInMemoryEntrySize = 64ull * 1024 * 1024;
+
+  /// How much source data to load at once, before the batch gets compressed and written to the output.
+  constexpr plUInt64 MaxBatchSize = 256ull * 1024 * 1024;
+
+  /// Only entries up to this size are compressed with the dictionary, for larger ones it makes hardly any difference.
+  constexpr plUInt64 MaxDictionaryEntrySize = 128ull * 1024;
+
+  /// How much sample data to build the dictionary from, relative to the dictionary size.
+  constexpr plUInt64 DictionarySampleFactor = 64;
+
+  struct EntryData
+  {
+    plDynamicArray<plUInt8> m_Data;       ///< The content of the source file
+    plDynamicArray<plUInt8> m_Compressed; ///< The compressed data, only filled if compression saves enough space
+    plArchiveCompressionMode m_StoredCompression = plArchiveCompressionMode::Uncompressed;
+    plUInt64 m_uiContentHash = 0;
+    plUInt32 m_uiDuplicateOf = plInvalidIndex; ///< Index of the (earlier) entry that has the exact same content
+    plTime m_Duration;
+    bool m_bStreamed = false; ///< Too large to be processed in memory
+    bool m_bFailed = false;
+  };
+
+  struct ContentKey
+  {
+    plUInt64 m_uiHash = 0;
+    plUInt64 m_uiSize = 0;
+
+    bool operator==(const ContentKey& rhs) const { return m_uiHash == rhs.m_uiHash && m_uiSize == rhs.m_uiSize; }
+  };
+
+  struct ContentKeyHashHelper
+  {
+    PL_ALWAYS_INLINE static plUInt32 Hash(const ContentKey& key) { return plHashingUtils::StringHashTo32(key.m_uiHash); }
+    PL_ALWAYS_INLINE static bool Equal(const ContentKey& a, const ContentKey& b) { return a == b; }
+  };
+} // namespace
+
+static plUInt64 GetSourceFileSize(plStringView sAbsSourcePath)
+{
+#if PL_ENABLED(PL_SUPPORTS_FILE_STATS)
+  plFileStats stats;
+  if (plOSFile::GetFileStats(sAbsSourcePath, stats).Succeeded())
+    return stats.m_uiFileSize;
+#else
+  PL_IGNORE_UNUSED(sAbsSourcePath);
+#endif
+
+  return 0;
+}
+
+static void ReadEntry(const plArchiveBuilder::SourceEntry& e, EntryData& ref_data)
+{
+  plStopwatch sw;
+
+  plFileReader file;
+  if (file.Open(e.m_sAbsSourcePath, 1024 * 1024).Failed())
+  {
+    ref_data.m_bFailed = true;
+    return;
+  }
+
+  const plUInt64 uiFileSize = file.GetFileSize();
+
+  if (uiFileSize > MaxInMemoryEntrySize)
+  {
+    ref_data.m_bStreamed = true;
+    return;
+  }
+
+  ref_data.m_Data.SetCountUninitialized(static_cast<plUInt32>(uiFileSize));
+
+  if (file.ReadBytes(ref_data.m_Data.GetData(), uiFileSize) != uiFileSize)
+  {
+    ref_data.m_bFailed = true;
+    return;
+  }
+
+  ref_data.m_uiContentHash = plHashingUtils::xxHash64(ref_data.m_Data.GetData(), ref_data.m_Data.GetCount());
+  ref_data.m_Duration = sw.GetRunningTotal();
+}
+
+static void CompressEntry(const plArchiveBuilder::SourceEntry& e, EntryData& ref_data, const plZstdDictionary* pDictionary)
+{
+  ref_data.m_StoredCompression = plArchiveCompressionMode::Uncompressed;
+
+#ifdef BUILDSYSTEM_ENABLE_ZSTD_SUPPORT
+  if (e.m_CompressionMode == plArchiveCompressionMode::Compressed_zstd && !ref_data.m_Data.IsEmpty())
+  {
+    plStopwatch sw;
+
+    if (ref_data.m_Data.GetCount() > MaxDictionaryEntrySize)
+    {
+      pDictionary = nullptr;
+    }
+
+    plMemoryStreamContainerWrapperStorage<plDynamicArray<plUInt8>> storage(&ref_data.m_Compressed);
+    plMemoryStreamWriter writer(&storage);
+
+    // entries are already compressed in parallel, so don't let zstd spawn additional threads
+    plCompressedStreamWriterZstd zstdWriter;
+    zstdWriter.SetOutputStream(&writer, 0, static_cast<plCompressedStreamWriterZstd::Compression>(e.m_iCompressionLevel), 4, pDictionary);
+
+    if (ref_data.m_Data.GetCount() >= plArchiveUtils::SeekableEntryMinSize)
+    {
+      zstdWriter.EnableSeekableFrames(plArchiveUtils::SeekableFrameSize);
+    }
+
+    if (zstdWriter.WriteBytes(ref_data.m_Data.GetData(), ref_data.m_Data.GetCount()).Succeeded() && zstdWriter.FinishCompressedStream().Succeeded())
+    {
+      // same rule as plArchiveUtils::WriteEntryOptimal(): less than 20% size saving -> go uncompressed
+      if (zstdWriter.GetWrittenBytes() * 12 < ref_data.m_Data.GetCount() * 10ull)
+      {
+        ref_data.m_StoredCompression = pDictionary != nullptr ? plArchiveCompressionMode::Compressed_zstd_dict : plArchiveCompressionMode::Compressed_zstd;
+      }
+    }
+
+    if (ref_data.m_StoredCompression == plArchiveCompressionMode::Uncompressed)
+    {
+      ref_data.m_Compressed.Clear();
+      ref_data.m_Compressed.Compact();
+    }
+
+    ref_data.m_Duration += sw.GetRunningTotal();
+  }
+#else
+  PL_IGNORE_UNUSED(e);
+  PL_IGNORE_UNUSED(pDictionary);
+#endif
+}
+
+#ifdef BUILDSYSTEM_ENABLE_ZSTD_SUPPORT
+static plResult BuildCompressionDictionary(const plDeque<plArchiveBuilder::SourceEntry>& entries, plUInt32 uiMaxDictionarySize, plDynamicArray<plUInt8>& out_dictionary)
+{
+  PL_PROFILE_SCOPE("BuildCompressionDictionary");
+
+  plDynamicArray<plUInt32> candidates;
+  plUInt64 uiCandidateBytes = 0;
+
+  for (plUInt32 i = 0; i < entries.GetCount(); ++i)
+  {
+    if (entries[i].m_CompressionMode != plArchiveCompressionMode::Compressed_zstd)
+      continue;
+
+    const plUInt64 uiSize = GetSourceFileSize(entries[i].m_sAbsSourcePath);
+    if (uiSize == 0 || uiSize > MaxDictionaryEntrySize)
+      continue;
+
+    candidates.PushBack(i);
+    uiCandidateBytes += uiSize;
+  }
+
+  // if there is too much data, only use every n-th file, so that the samples are spread across the whole archive
+  const plUInt64 uiSampleBudget = uiMaxDictionarySize * DictionarySampleFactor;
+  const plUInt32 uiStride = static_cast<plUInt32>(plMath::Max<plUInt64>(1, (uiCandidateBytes + uiSampleBudget - 1) / uiSampleBudget));
+
+  plDynamicArray<EntryData> samplesData;
+  samplesData.SetCount((candidates.GetCount() + uiStride - 1) / uiStride);
+
+  plTaskSystem::ParallelForIndexed(
+    0, samplesData.GetCount(), [&](plUInt32 uiStart, plUInt32 uiEnd)
+    {
+      for (plUInt32 i = uiStart; i < uiEnd; ++i)
+      {
+        ReadEntry(entries[candidates[i * uiStride]], samplesData[i]);
+      }
+      //
+    },
+    "ArchiveBuilder::ReadDictionarySamples");
+
+  plDynamicArray<plConstByteArrayPtr> samples;
+  samples.Reserve(samplesData.GetCount());
+
+  for (const EntryData& data : samplesData)
+  {
+    if (!data.m_bFailed && !data.m_bStreamed)
+    {
+      samples.PushBack(data.m_Data.GetArrayPtr());
+    }
+  }
+
+  return plZstdDictionary::Train(samples, uiMaxDictionarySize, out_dictionary);
+}
+#endif
+
 plResult plArchiveBuilder::WriteArchive(plStreamWriter& inout_stream) const
 {
-  PL_SUCCEED_OR_RETURN(plArchiveUtils::WriteHeader(inout_stream));
+  plDynamicArray<plUInt8> dictionaryData;
+
+  // the digested dictionary depends on the compression level
+  plMap<plInt32, plUniquePtr<plZstdDictionary>> dictionaries;
+
+#ifdef BUILDSYSTEM_ENABLE_ZSTD_SUPPORT
+  if (m_bUseCompressionDictionary)
+  {
+    if (BuildCompressionDictionary(m_Entries, m_uiMaxCompressionDictionarySize, dictionaryData).Succeeded())
+    {
+      plLog::Info("Built a compression dictionary of {}", plArgFileSize(dictionaryData.GetCount()));
+
+      for (const SourceEntry& e : m_Entries)
+      {
+        if (e.m_CompressionMode != plArchiveCompressionMode::Compressed_zstd || dictionaries.Contains(e.m_iCompressionLevel))
+          continue;
+
+        plUniquePtr<plZstdDictionary> pDictionary = PL_DEFAULT_NEW(plZstdDictionary);
+        PL_SUCCEED_OR_RETURN(pDictionary->CreateForCompression(dictionaryData, static_cast<plCompressedStreamWriterZstd::Compression>(e.m_iCompressionLevel)));
+        dictionaries[e.m_iCompressionLevel] = std::move(pDictionary);
+      }
+    }
+    else
+    {
+      dictionaryData.Clear();
+      plLog::Warning("Not enough small files to build a compression dictionary, archive will be written without one.");
+    }
+  }
+#endif
+
+  PL_SUCCEED_OR_RETURN(plArchiveUtils::WriteHeader(inout_stream, dictionaryData));
 
   plArchiveTOC toc;
 
@@ -108,27 +330,162 @@ plResult plArchiveBuilder::WriteArchive(plStreamWriter& inout_stream) const
   plUInt64 uiStreamSize = 0;
   const plUInt32 uiNumEntries = m_Entries.GetCount();
 
-  plStopwatch sw;
+  plHashTable<ContentKey, plUInt32, ContentKeyHashHelper> contentToEntry;
+  plUInt32 uiNumDeduplicated = 0;
+  plUInt64 uiDeduplicatedBytes = 0;
 
-  for (plUInt32 i = 0; i < uiNumEntries; ++i)
+  plDynamicArray<EntryData> batch;
+
+  plParallelForParams parallelParams;
+  parallelParams.m_uiBinSize = 1;
+  parallelParams.m_uiMaxTasksPerThread = 4; // file sizes vary a lot
+
+  for (plUInt32 uiBatchStart = 0; uiBatchStart < uiNumEntries;)
   {
-    const SourceEntry& e = m_Entries[i];
+    // gather as many entries as fit into the memory budget
+    plUInt32 uiBatchEnd = uiBatchStart;
+    {
+      plUInt64 uiBatchBytes = 0;
+
+      while (uiBatchEnd < uiNumEntries && (uiBatchEnd == uiBatchStart || uiBatchBytes < MaxBatchSize))
+      {
+        uiBatchBytes += plMath::Min(GetSourceFileSize(m_Entries[uiBatchEnd].m_sAbsSourcePath), MaxInMemoryEntrySize);
+        ++uiBatchEnd;
+      }
+    }
+
+    const plUInt32 uiBatchCount = uiBatchEnd - uiBatchStart;
+
+    batch.Clear();
+    batch.SetCount(uiBatchCount);
+
+    plTaskSystem::ParallelForIndexed(
+      0, uiBatchCount, [&](plUInt32 uiStart, plUInt32 uiEnd)
+      {
+        for (plUInt32 i = uiStart; i < uiEnd; ++i)
+        {
+          ReadEntry(m_Entries[uiBatchStart + i], batch[i]);
+        }
+        //
+      },
+      "ArchiveBuilder::ReadEntries", plTaskNesting::Never, parallelParams);
+
+    // find all entries whose content was already stored
+    if (m_bDeduplicateContent)
+    {
+      for (plUInt32 i = 0; i < uiBatchCount; ++i)
+      {
+        EntryData& data = batch[i];
+
+        if (data.m_bFailed || data.m_bStreamed)
+          continue;
+
+        ContentKey key;
+        key.m_uiHash = data.m_uiContentHash;
+        key.m_uiSize = data.m_Data.GetCount();
+
+        bool bExisted = false;
+        plUInt32& uiOriginal = contentToEntry.FindOrAdd(key, &bExisted);
 
-    const plUInt32 uiPathStringOffset = toc.AddPathString(e.m_sRelTargetPath);
+        if (bExisted)
+        {
+          data.m_uiDuplicateOf = uiOriginal;
+          data.m_Data.Clear();
+          data.m_Data.Compact();
+        }
+        else
+        {
+          uiOriginal = uiBatchStart + i;
+        }
+      }
+    }
+
+    plTaskSystem::ParallelForIndexed(
+      0, uiBatchCount, [&](plUInt32 uiStart, plUInt32 uiEnd)
+      {
+        for (plUInt32 i = uiStart; i < uiEnd; ++i)
+        {
+          if (batch[i].m_bFailed || batch[i].m_bStreamed || batch[i].m_uiDuplicateOf != plInvalidIndex)
+            continue;
+
+          const SourceEntry& e = m_Entries[uiBatchStart + i];
+
+          auto itDictionary = dictionaries.Find(e.m_iCompressionLevel);
+          CompressEntry(e, batch[i], itDictionary.IsValid() ? itDictionary.Value().Borrow() : nullptr);
+        }
+        //
+      },
+      "ArchiveBuilder::CompressEntries", plTaskNesting::Never, parallelParams);
+
+    // write the results in the original order, so that the output is deterministic
+    for (plUInt32 i = 0; i < uiBatchCount; ++i)
+    {
+      const plUInt32 uiEntryIdx = uiBatchStart + i;
+      const SourceEntry& e = m_Entries[uiEntryIdx];
+      EntryData& data = batch[i];
+
+      const plUInt32 uiPathStringOffset = toc.AddPathString(e.m_sRelTargetPath);
+
+      sHashablePath = e.m_sRelTargetPath;
+      sHashablePath.ToLower();
+
+      toc.m_PathToEntryIndex[plArchiveStoredString(plHashingUtils::StringHash(sHashablePath), uiPathStringOffset)] = toc.m_Entries.GetCount();
+
+      if (!WriteNextFileCallback(uiEntryIdx + 1, uiNumEntries, e.m_sAbsSourcePath))
+        return PL_FAILURE;
 
-    sHashablePath = e.m_sRelTargetPath;
-    sHashablePath.ToLower();
+      plArchiveEntry& tocEntry = toc.m_Entries.ExpandAndGetRef();
 
-    toc.m_PathToEntryIndex[plArchiveStoredString(plHashingUtils::StringHash(sHashablePath), uiPathStringOffset)] = toc.m_Entries.GetCount();
+      if (data.m_bFailed)
+      {
+        plLog::Error("Could not read file '{}'", e.m_sAbsSourcePath);
+        return PL_FAILURE;
+      }
+
+      if (data.m_bStreamed)
+      {
+        plStopwatch sw;
+        PL_SUCCEED_OR_RETURN(plArchiveUtils::WriteEntryOptimal(inout_stream, e.m_sAbsSourcePath, uiPathStringOffset, e.m_CompressionMode, e.m_iCompressionLevel, tocEntry, uiStreamSize, plMakeDelegate(&plArchiveBuilder::WriteFileProgressCallback, this)));
+        data.m_Duration = sw.GetRunningTotal();
+
+        WriteFileResultCallback(uiEntryIdx + 1, uiNumEntries, e.m_sAbsSourcePath, tocEntry.m_uiUncompressedDataSize, tocEntry.m_uiStoredDataSize, data.m_Duration);
+        continue;
+      }
 
-    if (!WriteNextFileCallback(i + 1, uiNumEntries, e.m_sAbsSourcePath))
-      return PL_FAILURE;
+      if (data.m_uiDuplicateOf != plInvalidIndex)
+      {
+        // the TOC entries are written in the same order as m_Entries, so the original is at the same index
+        tocEntry = toc.m_Entries[data.m_uiDuplicateOf];
+        tocEntry.m_uiPathStringOffset = uiPathStringOffset;
 
-    plArchiveEntry& tocEntry = toc.m_Entries.ExpandAndGetRef();
+        ++uiNumDeduplicated;
+        uiDeduplicatedBytes += tocEntry.m_uiStoredDataSize;
 
-    PL_SUCCEED_OR_RETURN(plArchiveUtils::WriteEntryOptimal(inout_stream, e.m_sAbsSourcePath, uiPathStringOffset, e.m_CompressionMode, e.m_iCompressionLevel, tocEntry, uiStreamSize, plMakeDelegate(&plArchiveBuilder::WriteFileProgressCallback, this)));
+        WriteFileResultCallback(uiEntryIdx + 1, uiNumEntries, e.m_sAbsSourcePath, tocEntry.m_uiUncompressedDataSize, 0, data.m_Duration);
+        continue;
+      }
 
-    WriteFileResultCallback(i + 1, uiNumEntries, e.m_sAbsSourcePath, tocEntry.m_uiUncompressedDataSize, tocEntry.m_uiStoredDataSize, sw.Checkpoint());
+      if (data.m_StoredCompression == plArchiveCompressionMode::Uncompressed)
+      {
+        PL_SUCCEED_OR_RETURN(plArchiveUtils::WriteEntryPreprocessed(inout_stream, data.m_Data, uiPathStringOffset, plArchiveCompressionMode::Uncompressed, data.m_Data.GetCount(), tocEntry, uiStreamSize));
+      }
+      else
+      {
+        PL_SUCCEED_OR_RETURN(plArchiveUtils::WriteEntryPreprocessed(inout_stream, data.m_Compressed, uiPathStringOffset, data.m_StoredCompression, data.m_Data.GetCount(), tocEntry, uiStreamSize));
+      }
+
+      if (!WriteFileProgressCallback(tocEntry.m_uiUncompressedDataSize, tocEntry.m_uiUncompressedDataSize))
+        return PL_FAILURE;
+
+      WriteFileResultCallback(uiEntryIdx + 1, uiNumEntries, e.m_sAbsSourcePath, tocEntry.m_uiUncompressedDataSize, tocEntry.m_uiStoredDataSize, data.m_Duration);
+    }
+
+    uiBatchStart = uiBatchEnd;
+  }
+
+  if (uiNumDeduplicated > 0)
+  {
+    plLog::Info("{} files with duplicate content were stored only once, saving {}", uiNumDeduplicated, plArgFileSize(uiDeduplicatedBytes));
   }
 
   PL_SUCCEED_OR_RETURN(plArchiveUtils::AppendTOC(inout_stream, toc));
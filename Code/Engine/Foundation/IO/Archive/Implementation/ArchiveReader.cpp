@@ -4,6 +4,7 @@
 #include <Foundation/IO/Archive/ArchiveUtils.h>
 
 #include <Foundation/IO/Archive/ArchiveUtils.h>
+#include <Foundation/IO/CompressedStreamZstd.h>
 #include <Foundation/IO/FileSystem/FileWriter.h>
 #include <Foundation/IO/MemoryStream.h>
 #include <Foundation/Logging/Log.h>
@@ -11,6 +12,9 @@
 
 #include <Foundation/Logging/Log.h>
 
+plArchiveReader::plArchiveReader() = default;
+plArchiveReader::~plArchiveReader() = default;
+
 plResult plArchiveReader::OpenArchive(plStringView sPath)
 {
 #if PL_ENABLED(PL_SUPPORTS_MEMORY_MAPPED_FILE)
@@ -19,6 +23,9 @@ plResult plArchiveReader::OpenArchive(plStringView sPath)
   PL_SUCCEED_OR_RETURN(m_MemFile.Open(sPath, plMemoryMappedFile::Mode::ReadOnly));
   m_uiMemFileSize = m_MemFile.GetFileSize();
 
+  // entry offsets are relative to the start of the data, which comes after the header and the compression dictionary
+  plUInt64 uiDataStartOffset = 0;
+
   // validate the archive
   {
     plRawMemoryStreamReader reader(m_MemFile.GetReadPointer(), m_MemFile.GetFileSize());
@@ -29,7 +36,41 @@ plResult plArchiveReader::OpenArchive(plStringView sPath)
     {
       PL_SUCCEED_OR_RETURN(plArchiveUtils::ReadHeader(reader, m_uiArchiveVersion));
 
-      m_pDataStart = m_MemFile.GetReadPointer(plArchiveUtils::ArchiveHeaderSize, plMemoryMappedFile::OffsetBase::Start);
+      plUInt32 uiDictionarySize = 0;
+      PL_SUCCEED_OR_RETURN(plArchiveUtils::ReadDictionarySize(reader, m_uiArchiveVersion, uiDictionarySize));
+
+      uiDataStartOffset = plArchiveUtils::ArchiveHeaderSize;
+      m_pDictionary.Clear();
+
+      if (m_uiArchiveVersion >= 5)
+      {
+        uiDataStartOffset += sizeof(plUInt32) + uiDictionarySize;
+
+        if (uiDataStartOffset > m_uiMemFileSize)
+        {
+          plLog::Error("Archive is corrupt. Invalid compression dictionary size.");
+          return PL_FAILURE;
+        }
+
+        if (uiDictionarySize > 0)
+        {
+#  ifdef BUILDSYSTEM_ENABLE_ZSTD_SUPPORT
+          // digest the dictionary once, all entry readers then only reference it
+          const plUInt8* pDictionary = static_cast<const plUInt8*>(m_MemFile.GetReadPointer(plArchiveUtils::ArchiveHeaderSize + sizeof(plUInt32), plMemoryMappedFile::OffsetBase::Start));
+
+          m_pDictionary = PL_DEFAULT_NEW(plZstdDictionary);
+          if (m_pDictionary->CreateForDecompression(plConstByteArrayPtr(pDictionary, uiDictionarySize)).Failed())
+          {
+            plLog::Error("Archive is corrupt. Failed to load the compression dictionary.");
+            return PL_FAILURE;
+          }
+#  else
+          plLog::Warning("Archive uses a zstd compression dictionary, but zstd support is not compiled in.");
+#  endif
+        }
+      }
+
+      m_pDataStart = m_MemFile.GetReadPointer(uiDataStartOffset, plMemoryMappedFile::OffsetBase::Start);
 
       PL_SUCCEED_OR_RETURN(plArchiveUtils::ExtractTOC(m_MemFile, m_ArchiveTOC, m_uiArchiveVersion));
     }
@@ -65,7 +106,7 @@ plResult plArchiveReader::OpenArchive(plStringView sPath)
 
     for (const auto& e : m_ArchiveTOC.m_Entries)
     {
-      if (e.m_uiDataStartOffset + e.m_uiStoredDataSize > uiValidSize)
+      if (e.m_uiDataStartOffset > uiValidSize || e.m_uiStoredDataSize > uiValidSize || uiDataStartOffset + e.m_uiDataStartOffset + e.m_uiStoredDataSize > uiValidSize)
       {
         plLog::Error("Archive is corrupt. Invalid entry data range.");
         return PL_FAILURE;
@@ -122,9 +163,14 @@ void plArchiveReader::ConfigureRawMemoryStreamReader(plUInt32 uiEntryIdx, plRawM
   plArchiveUtils::ConfigureRawMemoryStreamReader(m_ArchiveTOC.m_Entries[uiEntryIdx], m_pDataStart, ref_memReader);
 }
 
+plConstByteArrayPtr plArchiveReader::GetStoredEntryData(plUInt32 uiEntryIdx) const
+{
+  return plArchiveUtils::GetStoredEntryData(m_ArchiveTOC.m_Entries[uiEntryIdx], m_pDataStart);
+}
+
 plUniquePtr<plStreamReader> plArchiveReader::CreateEntryReader(plUInt32 uiEntryIdx) const
 {
-  return plArchiveUtils::CreateEntryReader(m_ArchiveTOC.m_Entries[uiEntryIdx], m_pDataStart);
+  return plArchiveUtils::CreateEntryReader(m_ArchiveTOC.m_Entries[uiEntryIdx], m_pDataStart, m_pDictionary.Borrow());
 }
 
 plResult plArchiveReader::ExtractFile(plUInt32 uiEntryIdx, plStringView sTargetFolder) const
@@ -134,6 +180,9 @@ plResult plArchiveReader::ExtractFile(plUInt32 uiEntryIdx, plStringView sTargetF
 
   plUniquePtr<plStreamReader> pReader = CreateEntryReader(uiEntryIdx);
 
+  if (pReader == nullptr)
+    return PL_FAILURE;
+
   plStringBuilder sOutputFile = sTargetFolder;
   sOutputFile.AppendPath(sFilePath);
 
@@ -33,23 +33,31 @@ bool plArchiveUtils::IsAcceptedArchiveFileExtensions(plStringView sExtension)
   return false;
 }
 
-plResult plArchiveUtils::WriteHeader(plStreamWriter& inout_stream)
+plResult plArchiveUtils::WriteHeader(plStreamWriter& inout_stream, plConstByteArrayPtr compressionDictionary /*= plConstByteArrayPtr()*/)
 {
   static_assert(16 == ArchiveHeaderSize);
 
   const char* szTag = "PLARCHIVE";
   PL_SUCCEED_OR_RETURN(inout_stream.WriteBytes(szTag, 10));
 
-  const plUInt8 uiArchiveVersion = 4;
+  // archives without a dictionary stay at version 4, so that they can still be read by older versions
+  const plUInt8 uiArchiveVersion = compressionDictionary.IsEmpty() ? 4 : 5;
 
   // Version 2: Added end-of-file marker for file corruption (cutoff) detection
   // Version 3: HashedStrings changed from MurmurHash to xxHash
   // Version 4: use 64 Bit string hashes
+  // Version 5: zstd compression dictionary after the header
   inout_stream << uiArchiveVersion;
 
   const plUInt8 uiPadding[5] = {0, 0, 0, 0, 0};
   PL_SUCCEED_OR_RETURN(inout_stream.WriteBytes(uiPadding, 5));
 
+  if (uiArchiveVersion >= 5)
+  {
+    inout_stream << compressionDictionary.GetCount();
+    PL_SUCCEED_OR_RETURN(inout_stream.WriteBytes(compressionDictionary.GetPtr(), compressionDictionary.GetCount()));
+  }
+
   return PL_SUCCESS;
 }
 
@@ -67,7 +75,7 @@ plResult plArchiveUtils::ReadHeader(plStreamReader& inout_stream, plUInt8& out_u
   out_uiVersion = 0;
   inout_stream >> out_uiVersion;
 
-  if (out_uiVersion != 1 && out_uiVersion != 2 && out_uiVersion != 3 && out_uiVersion != 4)
+  if (out_uiVersion != 1 && out_uiVersion != 2 && out_uiVersion != 3 && out_uiVersion != 4 && out_uiVersion != 5)
   {
     plLog::Error("Unsupported archive version '{}'.", out_uiVersion);
     return PL_FAILURE;
@@ -91,6 +99,22 @@ plResult plArchiveUtils::ReadHeader(plStreamReader& inout_stream, plUInt8& out_u
   return PL_SUCCESS;
 }
 
+plResult plArchiveUtils::ReadDictionarySize(plStreamReader& inout_stream, plUInt8 uiArchiveVersion, plUInt32& out_uiDictionarySize)
+{
+  out_uiDictionarySize = 0;
+
+  if (uiArchiveVersion < 5)
+    return PL_SUCCESS;
+
+  if (inout_stream.ReadBytes(&out_uiDictionarySize, sizeof(plUInt32)) != sizeof(plUInt32))
+  {
+    plLog::Error("Invalid or corrupted archive. Missing compression dictionary.");
+    return PL_FAILURE;
+  }
+
+  return PL_SUCCESS;
+}
+
 plResult plArchiveUtils::WriteEntryPreprocessed(plStreamWriter& inout_stream, plConstByteArrayPtr entryData, plUInt32 uiPathStringOffset, plArchiveCompressionMode compression, plUInt32 uiUncompressedEntryDataSize, plArchiveEntry& ref_tocEntry, plUInt64& inout_uiCurrentStreamPosition)
 {
   PL_SUCCEED_OR_RETURN(inout_stream.WriteBytes(entryData.GetPtr(), entryData.GetCount()));
@@ -152,6 +176,12 @@ plResult plArchiveUtils::WriteEntry(
     {
       zstdWriter.SetOutputStream(&inout_stream, uiWorkerThreadCount, (plCompressedStreamWriterZstd::Compression)iCompressionLevel);
       pWriter = &zstdWriter;
+
+      if (uiMaxBytes >= SeekableEntryMinSize)
+      {
+        // large entries are typically streamed, allow readers to skip through them without decompressing everything
+        zstdWriter.EnableSeekableFrames(SeekableFrameSize);
+      }
     }
     break;
 #endif
@@ -254,8 +284,10 @@ public:
 
 #endif
 
-plUniquePtr<plStreamReader> plArchiveUtils::CreateEntryReader(const plArchiveEntry& entry, const void* pStartOfArchiveData)
+plUniquePtr<plStreamReader> plArchiveUtils::CreateEntryReader(const plArchiveEntry& entry, const void* pStartOfArchiveData, const plZstdDictionary* pDictionary /*= nullptr*/)
 {
+  PL_IGNORE_UNUSED(pDictionary);
+
   plUniquePtr<plStreamReader> reader;
 
   switch (entry.m_CompressionMode)
@@ -271,12 +303,40 @@ plUniquePtr<plStreamReader> plArchiveUtils::CreateEntryReader(const plArchiveEnt
 #ifdef BUILDSYSTEM_ENABLE_ZSTD_SUPPORT
     case plArchiveCompressionMode::Compressed_zstd:
     {
+      const plConstByteArrayPtr storedData = GetStoredEntryData(entry, pStartOfArchiveData);
+
+      if (plSeekableCompressedStreamReaderZstd::IsSeekableStream(storedData))
+      {
+        plUniquePtr<plSeekableCompressedStreamReaderZstd> pSeekableReader = PL_DEFAULT_NEW(plSeekableCompressedStreamReaderZstd);
+
+        if (pSeekableReader->SetInputData(storedData).Succeeded())
+        {
+          reader = std::move(pSeekableReader);
+          break;
+        }
+      }
+
       reader = PL_DEFAULT_NEW(plCompressedStreamReaderZstdWithSource);
       plCompressedStreamReaderZstdWithSource* pRawReader = static_cast<plCompressedStreamReaderZstdWithSource*>(reader.Borrow());
       ConfigureRawMemoryStreamReader(entry, pStartOfArchiveData, pRawReader->m_Source);
       pRawReader->SetInputStream(&pRawReader->m_Source);
       break;
     }
+
+    case plArchiveCompressionMode::Compressed_zstd_dict:
+    {
+      if (pDictionary == nullptr)
+      {
+        plLog::Error("Archive entry is compressed with a dictionary, but no dictionary is available.");
+        break;
+      }
+
+      reader = PL_DEFAULT_NEW(plCompressedStreamReaderZstdWithSource);
+      plCompressedStreamReaderZstdWithSource* pRawReader = static_cast<plCompressedStreamReaderZstdWithSource*>(reader.Borrow());
+      ConfigureRawMemoryStreamReader(entry, pStartOfArchiveData, pRawReader->m_Source);
+      pRawReader->SetInputStream(&pRawReader->m_Source, pDictionary);
+      break;
+    }
 #endif
 #ifdef BUILDSYSTEM_ENABLE_ZLIB_SUPPORT
     case plArchiveCompressionMode::Compressed_zip:
@@ -297,6 +357,11 @@ plUniquePtr<plStreamReader> plArchiveUtils::CreateEntryReader(const plArchiveEnt
   return std::move(reader);
 }
 
+plConstByteArrayPtr plArchiveUtils::GetStoredEntryData(const plArchiveEntry& entry, const void* pStartOfArchiveData)
+{
+  return plConstByteArrayPtr(static_cast<const plUInt8*>(plMemoryUtils::AddByteOffset(pStartOfArchiveData, static_cast<std::ptrdiff_t>(entry.m_uiDataStartOffset))), static_cast<plUInt32>(entry.m_uiStoredDataSize));
+}
+
 void plArchiveUtils::ConfigureRawMemoryStreamReader(const plArchiveEntry& entry, const void* pStartOfArchiveData, plRawMemoryStreamReader& ref_memReader)
 {
   ref_memReader.Reset(plMemoryUtils::AddByteOffset(pStartOfArchiveData, static_cast<std::ptrdiff_t>(entry.m_uiDataStartOffset)), entry.m_uiStoredDataSize);
@@ -80,7 +80,21 @@ plDataDirectoryReader* plDataDirectory::ArchiveType::OpenFileToRead(plStringView
 
 #ifdef BUILDSYSTEM_ENABLE_ZSTD_SUPPORT
       case plArchiveCompressionMode::Compressed_zstd:
+      case plArchiveCompressionMode::Compressed_zstd_dict:
       {
+        const plZstdDictionary* pDictionary = nullptr;
+
+        if (pEntry->m_CompressionMode == plArchiveCompressionMode::Compressed_zstd_dict)
+        {
+          pDictionary = m_ArchiveReader.GetCompressionDictionary();
+
+          if (pDictionary == nullptr)
+          {
+            plLog::Error("Archive entry '{}' is compressed with a dictionary, but the archive has none.", sArchivePath);
+            return nullptr;
+          }
+        }
+
         if (!m_FreeReadersZstd.IsEmpty())
         {
           pReader = m_FreeReadersZstd.PeekBack();
@@ -91,6 +105,9 @@ plDataDirectoryReader* plDataDirectory::ArchiveType::OpenFileToRead(plStringView
           m_ReadersZstd.PushBack(PL_DEFAULT_NEW(ArchiveReaderZstd, 1));
           pReader = m_ReadersZstd.PeekBack().Borrow();
         }
+
+        static_cast<ArchiveReaderZstd*>(pReader)->m_pDictionary = pDictionary;
+        static_cast<ArchiveReaderZstd*>(pReader)->m_StoredData = m_ArchiveReader.GetStoredEntryData(uiEntryIndex);
         break;
       }
 #endif
@@ -322,15 +339,33 @@ plDataDirectory::ArchiveReaderZstd::ArchiveReaderZstd(plInt32 iDataDirUserData)
 
 plUInt64 plDataDirectory::ArchiveReaderZstd::Read(void* pBuffer, plUInt64 uiBytes)
 {
+  if (m_bSeekable)
+    return m_SeekableStreamReader.ReadBytes(pBuffer, uiBytes);
+
   return m_CompressedStreamReader.ReadBytes(pBuffer, uiBytes);
 }
 
+plUInt64 plDataDirectory::ArchiveReaderZstd::Skip(plUInt64 uiBytes)
+{
+  // seekable entries only decompress the frame that is read next, everything else has to decompress all skipped data
+  if (m_bSeekable)
+    return m_SeekableStreamReader.SkipBytes(uiBytes);
+
+  return ArchiveReaderCommon::Skip(uiBytes);
+}
+
 plResult plDataDirectory::ArchiveReaderZstd::InternalOpen(plFileShareMode::Enum FileShareMode)
 {
   PL_IGNORE_UNUSED(FileShareMode);
   PL_ASSERT_DEBUG(FileShareMode != plFileShareMode::Exclusive, "Archives only support shared reading of files. Exclusive access cannot be guaranteed.");
 
-  m_CompressedStreamReader.SetInputStream(&m_MemStreamReader);
+  m_bSeekable = plSeekableCompressedStreamReaderZstd::IsSeekableStream(m_StoredData) && m_SeekableStreamReader.SetInputData(m_StoredData, m_pDictionary).Succeeded();
+
+  if (!m_bSeekable)
+  {
+    m_CompressedStreamReader.SetInputStream(&m_MemStreamReader, m_pDictionary);
+  }
+
   return PL_SUCCESS;
 }
 
@@ -7,6 +7,8 @@
 
 #ifdef BUILDSYSTEM_ENABLE_ZSTD_SUPPORT
 
+class plZstdDictionary;
+
 /// \brief A stream reader that will decompress data that was stored using the plCompressedStreamWriterZstd.
 ///
 /// The reader takes another reader as its source for the compressed data (e.g. a file or a memory stream).
@@ -24,7 +26,10 @@ public:
   ///
   /// Calling this a second time on the same instance is valid and allows to reuse the decoder, which is more efficient than creating a new
   /// one.
-  void SetInputStream(plStreamReader* pInputStream); // [tested]
+  ///
+  /// If the data was compressed with a dictionary, the same dictionary has to be passed in here. It must stay alive as long as data is
+  /// read from the stream.
+  void SetInputStream(plStreamReader* pInputStream, const plZstdDictionary* pDictionary = nullptr); // [tested]
 
   /// \brief Reads either uiBytesToRead or the amount of remaining bytes in the stream into pReadBuffer.
   ///
@@ -92,7 +97,19 @@ public:
   /// another stream. This can prevent internal allocations, if one wants to use compression on multiple streams consecutively. It also
   /// allows to create a compressor stream early, but decide at a later pointer whether or with which stream to use it, and it will only
   /// allocate internal structures once that final decision is made.
-  void SetOutputStream(plStreamWriter* pOutputStream, plUInt32 uiMaxNumWorkerThreads, Compression ratio = Compression::Default, plUInt32 uiCompressionCacheSizeKB = 4); // [tested]
+  ///
+  /// If a dictionary is given, it must have been created with plZstdDictionary::CreateForCompression() and must stay alive until
+  /// FinishCompressedStream() has been called. The compression level of the dictionary takes precedence over \a ratio.
+  void SetOutputStream(plStreamWriter* pOutputStream, plUInt32 uiMaxNumWorkerThreads, Compression ratio = Compression::Default, plUInt32 uiCompressionCacheSizeKB = 4, const plZstdDictionary* pDictionary = nullptr); // [tested]
+
+  /// \brief Splits the data into independent zstd frames of \a uiUncompressedFrameSize bytes and appends a seek table at the end.
+  ///
+  /// Such a stream can still be read sequentially with plCompressedStreamReaderZstd, but plSeekableCompressedStreamReaderZstd
+  /// can additionally jump to any position by only decompressing the frame that contains it.
+  /// Smaller frames allow more fine-grained seeking, but reduce the compression ratio.
+  ///
+  /// Has to be called after SetOutputStream() and before writing any data.
+  void EnableSeekableFrames(plUInt32 uiUncompressedFrameSize = 256 * 1024);
 
   /// \brief Compresses \a uiBytesToWrite from \a pWriteBuffer.
   ///
@@ -132,8 +149,20 @@ public:
   /// \note Flushing the stream reduces compression effectiveness. Only in rare circumstances should it be necessary to call this manually.
   virtual plResult Flush() override; // [tested]
 
+  /// \brief Identifies the seek table at the very end of a seekable stream.
+  ///
+  /// Its last two bytes are non-zero, so it can't be confused with the zero-terminator that ends a regular stream.
+  static constexpr plUInt32 SeekTableMagic = 0x4B53504C; // 'LPSK'
+
 private:
   plResult FlushWriteCache();
+  plResult CompressBytes(const void* pWriteBuffer, plUInt64 uiBytesToWrite);
+  plResult EndSeekableFrame();
+
+  plUInt32 m_uiSeekableFrameSize = 0;
+  plUInt32 m_uiCurrentFrameSize = 0;
+  plUInt64 m_uiCurrentFrameStart = 0;
+  plDynamicArray<plUInt32> m_SeekTable; ///< Pairs of stored and uncompressed size per frame
 
   plUInt64 m_uiUncompressedSize = 0;
   plUInt64 m_uiCompressedSize = 0;
@@ -148,10 +177,107 @@ private:
   };
 
   plStreamWriter* m_pOutputStream = nullptr;
+  const plZstdDictionary* m_pDictionary = nullptr;
   /*ZSTD_CStream*/ void* m_pZstdCStream = nullptr;
   /*ZSTD_outBuffer*/ OutBufferImpl m_OutBuffer;
 
   plDynamicArray<plUInt8> m_CompressedCache;
 };
 
+/// \brief Reads a stream that was written by plCompressedStreamWriterZstd with seekable frames, with random access.
+///
+/// Other than plCompressedStreamReaderZstd, this works directly on the whole compressed data in memory (e.g. a memory mapped archive).
+/// Seeking or skipping only decompresses the frame that contains the target position, instead of everything before it.
+class PL_FOUNDATION_DLL plSeekableCompressedStreamReaderZstd : public plStreamReader
+{
+  PL_DISALLOW_COPY_AND_ASSIGN(plSeekableCompressedStreamReaderZstd);
+
+public:
+  plSeekableCompressedStreamReaderZstd();
+  ~plSeekableCompressedStreamReaderZstd();
+
+  /// \brief Checks whether the given data ends with a seek table, as written by plCompressedStreamWriterZstd::EnableSeekableFrames().
+  static bool IsSeekableStream(plConstByteArrayPtr compressedData);
+
+  /// \brief Sets up the reader to read from the given compressed data. The data must stay valid as long as it is read from.
+  ///
+  /// Fails if the data has no valid seek table.
+  plResult SetInputData(plConstByteArrayPtr compressedData, const plZstdDictionary* pDictionary = nullptr);
+
+  virtual plUInt64 ReadBytes(void* pReadBuffer, plUInt64 uiBytesToRead) override;
+
+  /// \brief Skipping is cheap, data is only decompressed once it is actually read.
+  virtual plUInt64 SkipBytes(plUInt64 uiBytesToSkip) override;
+
+  /// \brief Moves the read position to the given offset in the uncompressed data.
+  void SetReadPosition(plUInt64 uiUncompressedOffset);
+
+  plUInt64 GetReadPosition() const { return m_uiReadPosition; }
+
+  plUInt64 GetUncompressedSize() const { return m_uiUncompressedSize; }
+
+private:
+  plResult DecompressFrame(plUInt32 uiFrame);
+
+  struct Frame
+  {
+    plUInt64 m_uiStoredOffset = 0;
+    plUInt64 m_uiUncompressedOffset = 0;
+    plUInt32 m_uiStoredSize = 0;
+    plUInt32 m_uiUncompressedSize = 0;
+  };
+
+  plConstByteArrayPtr m_CompressedData;
+  const plZstdDictionary* m_pDictionary = nullptr;
+  plDynamicArray<Frame> m_Frames;
+  plDynamicArray<plUInt8> m_FrameCache;
+  plUInt32 m_uiCachedFrame = plInvalidIndex;
+  plUInt64 m_uiReadPosition = 0;
+  plUInt64 m_uiUncompressedSize = 0;
+  /*ZSTD_DStream*/ void* m_pZstdDStream = nullptr;
+};
+
+/// \brief A zstd dictionary in its pre-digested form.
+///
+/// Dictionaries drastically improve the compression ratio of small streams with similar content (config files, materials, prefabs, ...)
+/// and also make decompressing them faster. Digesting the raw dictionary data is relatively expensive, so it should be done once and the
+/// plZstdDictionary then be shared by all readers or writers that need it.
+///
+/// The dictionaries created here are 'raw content' dictionaries, so the compressed frames do not reference a dictionary ID.
+/// It is up to the user to pass the same dictionary to the reader that was used by the writer.
+class PL_FOUNDATION_DLL plZstdDictionary
+{
+  PL_DISALLOW_COPY_AND_ASSIGN(plZstdDictionary);
+
+public:
+  plZstdDictionary();
+  ~plZstdDictionary();
+
+  /// \brief Builds raw dictionary content of at most \a uiMaxDictionarySize bytes from the given sample data.
+  ///
+  /// Picks those segments of the samples that share the most content with other samples. Works best with many small samples.
+  /// Fails if there is not enough sample data to build a useful dictionary.
+  static plResult Train(plArrayPtr<const plConstByteArrayPtr> samples, plUInt32 uiMaxDictionarySize, plDynamicArray<plUInt8>& out_dictionary);
+
+  /// \brief Digests the dictionary content for use with plCompressedStreamWriterZstd. The data is copied.
+  plResult CreateForCompression(plConstByteArrayPtr dictionary, plCompressedStreamWriterZstd::Compression ratio);
+
+  /// \brief Digests the dictionary content for use with plCompressedStreamReaderZstd. The data is copied.
+  plResult CreateForDecompression(plConstByteArrayPtr dictionary);
+
+  /// \brief Frees all digested data.
+  void Clear();
+
+  bool IsValidForCompression() const { return m_pCDict != nullptr; }
+  bool IsValidForDecompression() const { return m_pDDict != nullptr; }
+
+private:
+  friend class plCompressedStreamReaderZstd;
+  friend class plCompressedStreamWriterZstd;
+  friend class plSeekableCompressedStreamReaderZstd;
+
+  /*ZSTD_CDict*/ void* m_pCDict = nullptr;
+  /*ZSTD_DDict*/ void* m_pDDict = nullptr;
+};
+
 #endif // BUILDSYSTEM_ENABLE_ZSTD_SUPPORT
@@ -1,10 +1,16 @@
 #pragma once
 
+#include <Foundation/Containers/HashSet.h>
+#include <Foundation/Containers/HashTable.h>
 #include <Foundation/Containers/HybridArray.h>
 #include <Foundation/Containers/Map.h>
 #include <Foundation/IO/FileSystem/FileSystem.h>
 #include <Foundation/IO/FileSystem/Implementation/DataDirType.h>
 #include <Foundation/IO/OSFile.h>
+#include <Foundation/Threading/AtomicInteger.h>
+#include <Foundation/Types/UniquePtr.h>
+
+class plDirectoryWatcher;
 
 namespace plDataDirectory
 {
@@ -34,6 +40,29 @@ namespace plDataDirectory
     /// access.
     static plString s_sRedirectionPrefix;
 
+    /// \brief If enabled, folder data directories that are mounted afterwards build an index of all their files and folders.
+    ///
+    /// ExistsFile() and GetFileStats() are then answered from memory, instead of asking the OS for every single query.
+    /// The index is kept up to date through a plDirectoryWatcher, so it is only available on platforms that support one.
+    /// Changes made by other processes become visible with a delay of up to s_FileIndexUpdateInterval.
+    static bool s_bUseFileIndex;
+
+    /// \brief How often the directory watcher is polled for changes, at most. Polling only happens when the index is queried.
+    static plTime s_FileIndexUpdateInterval;
+
+    struct FileIndexStats
+    {
+      plUInt64 m_uiHits = 0;      ///< Queries that were answered by the index.
+      plUInt64 m_uiMisses = 0;    ///< Queries that had to go to the OS, because the index was unavailable or the file was just written.
+      plUInt32 m_uiNumEntries = 0; ///< Number of files and folders in the index.
+    };
+
+    /// \brief Whether this data directory answers file queries through its file index.
+    bool HasFileIndex() const;
+
+    /// \brief Returns how well the file index of this data directory works.
+    FileIndexStats GetFileIndexStats() const;
+
     /// \brief When s_sRedirectionFile and s_sRedirectionPrefix are used to enable file redirection, this will reload those config files.
     virtual void ReloadExternalConfigs() override;
 
@@ -61,6 +90,25 @@ namespace plDataDirectory
 
     void LoadRedirectionFile();
 
+    struct FileIndexEntry
+    {
+      plTimestamp m_LastModificationTime;
+      plUInt64 m_uiFileSize = 0;
+      bool m_bIsDirectory = false;
+    };
+
+    void BuildFileIndex();
+    void UpdateFileIndex();
+    void UpdateFileIndexEntry(plStringView sAbsolutePath);
+    /// \brief Adds all files and folders inside the given folder to the index, recursively.
+    void AddFolderToFileIndex(plStringView sAbsoluteFolder);
+    void RemoveFileIndexChildren(plStringView sKey);
+    void MakeFileIndexKey(plStringView sRelativePath, plStringBuilder& out_sKey) const;
+    void InvalidateFileIndexEntry(plStringView sFile);
+
+    /// \brief Returns false, if the index can't answer the query. Otherwise \a out_bExists tells whether the file is known and \a out_entry holds its data.
+    bool LookupFileIndex(plStringView sRelativePath, FileIndexEntry& out_entry, bool& out_bExists);
+
     mutable plMutex m_ReaderWriterMutex; ///< Locks m_Readers / m_Writers as well as the m_bIsInUse flag of each reader / writer.
     plHybridArray<plDataDirectory::FolderReader*, 4> m_Readers;
     plHybridArray<plDataDirectory::FolderWriter*, 4> m_Writers;
@@ -68,6 +116,14 @@ namespace plDataDirectory
     mutable plMutex m_RedirectionMutex;
     plMap<plString, plString> m_FileRedirection;
     plString128 m_sRedirectedDataDirPath;
+
+    mutable plMutex m_FileIndexMutex;
+    plMap<plString, FileIndexEntry> m_FileIndex; ///< Sorted, so that everything inside a folder is one range of keys, see RemoveFileIndexChildren().
+    plHashSet<plString> m_UncertainFiles; ///< Files that are currently written through this data directory, the index is outdated for them.
+    plUniquePtr<plDirectoryWatcher> m_pFileIndexWatcher;
+    plTime m_LastFileIndexUpdate;
+    plAtomicInteger64 m_iFileIndexHits;
+    plAtomicInteger64 m_iFileIndexMisses;
   };
 
 
@@ -1,8 +1,10 @@
 #include <Foundation/FoundationPCH.h>
 
 #include <Foundation/Configuration/Startup.h>
+#include <Foundation/IO/DirectoryWatcher.h>
 #include <Foundation/IO/FileSystem/DataDirTypeFolder.h>
 #include <Foundation/Logging/Log.h>
+#include <Foundation/Profiling/Profiling.h>
 
 // clang-format off
 PL_BEGIN_SUBSYSTEM_DECLARATION(Foundation, FolderDataDirectory)
@@ -23,6 +25,8 @@ namespace plDataDirectory
 {
   plString FolderType::s_sRedirectionFile;
   plString FolderType::s_sRedirectionPrefix;
+  bool FolderType::s_bUseFileIndex = false;
+  plTime FolderType::s_FileIndexUpdateInterval = plTime::MakeFromMilliseconds(100);
 
   plResult FolderReader::InternalOpen(plFileShareMode::Enum FileShareMode)
   {
@@ -127,11 +131,15 @@ namespace plDataDirectory
     plStringBuilder sPath = GetRedirectedDataDirectoryPath();
     sPath.AppendPath(sFile);
 
+    InvalidateFileIndexEntry(sFile);
+
     plOSFile::DeleteFile(sPath.GetData()).IgnoreResult();
   }
 
   FolderType::~FolderType()
   {
+    m_pFileIndexWatcher.Clear();
+
     PL_LOCK(m_ReaderWriterMutex);
     for (plUInt32 i = 0; i < m_Readers.GetCount(); ++i)
       PL_DEFAULT_DELETE(m_Readers[i]);
@@ -210,6 +218,14 @@ namespace plDataDirectory
     plStringBuilder sRedirectedAsset;
     ResolveAssetRedirection(sFile, sRedirectedAsset);
 
+    if (!plPathUtils::IsAbsolutePath(sRedirectedAsset))
+    {
+      FileIndexEntry entry;
+      bool bExists = false;
+      if (LookupFileIndex(sRedirectedAsset, entry, bExists))
+        return bExists && !entry.m_bIsDirectory;
+    }
+
     plStringBuilder sPath = GetRedirectedDataDirectoryPath();
     sPath.AppendPath(sRedirectedAsset);
     return plOSFile::ExistsFile(sPath);
@@ -237,6 +253,27 @@ namespace plDataDirectory
     if (!plPathUtils::IsAbsolutePath(sPath))
       return PL_FAILURE;
 
+    if (!plPathUtils::IsAbsolutePath(sRedirectedAsset))
+    {
+      FileIndexEntry entry;
+      bool bExists = false;
+      if (LookupFileIndex(sRedirectedAsset, entry, bExists))
+      {
+        if (!bExists)
+          return PL_FAILURE;
+
+        // same as plOSFile::GetFileStats() would report
+        sPath.MakeCleanPath();
+        out_Stats.m_sParentPath = sPath;
+        out_Stats.m_sParentPath.PathParentDirectory();
+        out_Stats.m_sName = plPathUtils::GetFileNameAndExtension(sPath);
+        out_Stats.m_LastModificationTime = entry.m_LastModificationTime;
+        out_Stats.m_uiFileSize = entry.m_uiFileSize;
+        out_Stats.m_bIsDirectory = entry.m_bIsDirectory;
+        return PL_SUCCESS;
+      }
+    }
+
 #if PL_ENABLED(PL_SUPPORTS_FILE_STATS)
     return plOSFile::GetFileStats(sPath, out_Stats);
 #else
@@ -265,6 +302,11 @@ namespace plDataDirectory
 
     ReloadExternalConfigs();
 
+    if (s_bUseFileIndex)
+    {
+      BuildFileIndex();
+    }
+
     return PL_SUCCESS;
   }
 
@@ -366,6 +408,8 @@ namespace plDataDirectory
   {
     FolderWriter* pWriter = nullptr;
 
+    InvalidateFileIndexEntry(sFile);
+
     {
       PL_LOCK(m_ReaderWriterMutex);
       for (plUInt32 i = 0; i < m_Writers.GetCount(); ++i)
@@ -392,6 +436,231 @@ namespace plDataDirectory
     // if it succeeds, we return the reader
     return pWriter;
   }
+
+  bool FolderType::HasFileIndex() const
+  {
+    PL_LOCK(m_FileIndexMutex);
+    return m_pFileIndexWatcher != nullptr;
+  }
+
+  FolderType::FileIndexStats FolderType::GetFileIndexStats() const
+  {
+    FileIndexStats stats;
+    stats.m_uiHits = static_cast<plUInt64>(m_iFileIndexHits);
+    stats.m_uiMisses = static_cast<plUInt64>(m_iFileIndexMisses);
+
+    PL_LOCK(m_FileIndexMutex);
+    stats.m_uiNumEntries = m_FileIndex.GetCount();
+    return stats;
+  }
+
+  void FolderType::MakeFileIndexKey(plStringView sRelativePath, plStringBuilder& out_sKey) const
+  {
+    out_sKey = sRelativePath;
+    out_sKey.MakeCleanPath();
+    out_sKey.Trim("/", "/");
+
+#if PL_ENABLED(PL_SUPPORTS_CASE_INSENSITIVE_PATHS)
+    out_sKey.ToLower();
+#endif
+  }
+
+  void FolderType::BuildFileIndex()
+  {
+#if PL_ENABLED(PL_SUPPORTS_DIRECTORY_WATCHER) && PL_ENABLED(PL_SUPPORTS_FILE_ITERATORS)
+    PL_PROFILE_SCOPE("BuildFileIndex");
+
+    PL_LOCK(m_FileIndexMutex);
+
+    m_FileIndex.Clear();
+    m_UncertainFiles.Clear();
+
+    // start watching first, so that nothing that changes while the index is built gets lost
+    m_pFileIndexWatcher = PL_DEFAULT_NEW(plDirectoryWatcher);
+    if (m_pFileIndexWatcher->OpenDirectory(m_sRedirectedDataDirPath, plDirectoryWatcher::Watch::Writes | plDirectoryWatcher::Watch::Creates | plDirectoryWatcher::Watch::Deletes | plDirectoryWatcher::Watch::Renames | plDirectoryWatcher::Watch::Subdirectories).Failed())
+    {
+      plLog::Warning("Could not watch data directory '{}', file index is disabled.", m_sRedirectedDataDirPath.GetView());
+      m_pFileIndexWatcher.Clear();
+      return;
+    }
+
+    AddFolderToFileIndex(m_sRedirectedDataDirPath);
+
+    m_LastFileIndexUpdate = plTime::Now();
+
+    plLog::Dev("Indexed {} files and folders in data directory '{}'", m_FileIndex.GetCount(), m_sRedirectedDataDirPath.GetView());
+#endif
+  }
+
+  void FolderType::AddFolderToFileIndex(plStringView sAbsoluteFolder)
+  {
+#if PL_ENABLED(PL_SUPPORTS_FILE_ITERATORS)
+    plStringBuilder sBasePath = m_sRedirectedDataDirPath;
+    sBasePath.MakeCleanPath();
+
+    plStringBuilder sFolder = sAbsoluteFolder;
+    sFolder.MakeCleanPath();
+
+    plStringBuilder sFullPath, sKey;
+
+    plFileSystemIterator it;
+    for (it.StartSearch(sFolder, plFileSystemIteratorFlags::ReportFilesAndFoldersRecursive); it.IsValid(); it.Next())
+    {
+      const plFileStats& stats = it.GetStats();
+      stats.GetFullPath(sFullPath);
+
+      if (sFullPath.MakeRelativeTo(sBasePath).Failed())
+        continue;
+
+      MakeFileIndexKey(sFullPath, sKey);
+
+      FileIndexEntry& entry = m_FileIndex[sKey];
+      entry.m_LastModificationTime = stats.m_LastModificationTime;
+      entry.m_uiFileSize = stats.m_uiFileSize;
+      entry.m_bIsDirectory = stats.m_bIsDirectory;
+    }
+#else
+    PL_IGNORE_UNUSED(sAbsoluteFolder);
+#endif
+  }
+
+  void FolderType::RemoveFileIndexChildren(plStringView sKey)
+  {
+    plStringBuilder sPrefix = sKey;
+    sPrefix.Append("/");
+
+    // all keys that start with the prefix directly follow it in the sorted index
+    for (auto it = m_FileIndex.LowerBound(sPrefix); it.IsValid() && it.Key().StartsWith(sPrefix);)
+    {
+      it = m_FileIndex.Remove(it);
+    }
+  }
+
+  void FolderType::UpdateFileIndexEntry(plStringView sAbsolutePath)
+  {
+    plStringBuilder sRelativePath = sAbsolutePath;
+    sRelativePath.MakeCleanPath();
+
+    if (sRelativePath.MakeRelativeTo(m_sRedirectedDataDirPath).Failed() || sRelativePath.IsEmpty())
+      return;
+
+    plStringBuilder sKey;
+    MakeFileIndexKey(sRelativePath, sKey);
+
+    m_UncertainFiles.Remove(sKey);
+
+#if PL_ENABLED(PL_SUPPORTS_FILE_STATS)
+    plFileStats stats;
+    if (plOSFile::GetFileStats(sAbsolutePath, stats).Succeeded())
+    {
+      FileIndexEntry& entry = m_FileIndex[sKey];
+      const bool bWasDirectory = entry.m_bIsDirectory;
+      entry.m_LastModificationTime = stats.m_LastModificationTime;
+      entry.m_uiFileSize = stats.m_uiFileSize;
+      entry.m_bIsDirectory = stats.m_bIsDirectory;
+
+      if (stats.m_bIsDirectory)
+      {
+        // a folder that was renamed or moved into the data directory only reports itself, not its content
+        RemoveFileIndexChildren(sKey);
+        AddFolderToFileIndex(sAbsolutePath);
+      }
+      else if (bWasDirectory)
+      {
+        RemoveFileIndexChildren(sKey);
+      }
+
+      return;
+    }
+#endif
+
+    auto it = m_FileIndex.Find(sKey);
+    if (!it.IsValid())
+      return;
+
+    const bool bWasDirectory = it.Value().m_bIsDirectory;
+    m_FileIndex.Remove(it);
+
+    if (bWasDirectory)
+    {
+      // everything inside a removed folder is gone as well
+      RemoveFileIndexChildren(sKey);
+    }
+  }
+
+  void FolderType::UpdateFileIndex()
+  {
+#if PL_ENABLED(PL_SUPPORTS_DIRECTORY_WATCHER)
+    const plTime tNow = plTime::Now();
+
+    if (tNow - m_LastFileIndexUpdate < s_FileIndexUpdateInterval)
+      return;
+
+    m_LastFileIndexUpdate = tNow;
+
+    m_pFileIndexWatcher->EnumerateChanges([this](plStringView sFilename, plDirectoryWatcherAction action, plDirectoryWatcherType type)
+      {
+        PL_IGNORE_UNUSED(action);
+        PL_IGNORE_UNUSED(type);
+
+        // whatever happened, the current state on disk is what counts
+        UpdateFileIndexEntry(sFilename);
+      });
+#endif
+  }
+
+  void FolderType::InvalidateFileIndexEntry(plStringView sFile)
+  {
+    PL_LOCK(m_FileIndexMutex);
+
+    if (m_pFileIndexWatcher == nullptr)
+      return;
+
+    plStringBuilder sRedirected, sKey;
+    ResolveAssetRedirection(sFile, sRedirected);
+
+    if (plPathUtils::IsAbsolutePath(sRedirected))
+      return;
+
+    MakeFileIndexKey(sRedirected, sKey);
+
+    // the index is outdated for this file, until the directory watcher reports the change
+    m_FileIndex.Remove(sKey);
+    m_UncertainFiles.Insert(sKey);
+  }
+
+  bool FolderType::LookupFileIndex(plStringView sRelativePath, FileIndexEntry& out_entry, bool& out_bExists)
+  {
+    PL_LOCK(m_FileIndexMutex);
+
+    if (m_pFileIndexWatcher == nullptr)
+      return false;
+
+    UpdateFileIndex();
+
+    plStringBuilder sKey;
+    MakeFileIndexKey(sRelativePath, sKey);
+
+    if (m_UncertainFiles.Contains(sKey))
+    {
+      m_iFileIndexMisses.Increment();
+      return false;
+    }
+
+    m_iFileIndexHits.Increment();
+
+    if (const FileIndexEntry* pEntry = m_FileIndex.GetValue(sKey))
+    {
+      out_entry = *pEntry;
+      out_bExists = true;
+    }
+    else
+    {
+      out_bExists = false;
+    }
+
+    return true;
+  }
 } // namespace plDataDirectory
 
 
@@ -4,6 +4,7 @@
 
 #ifdef BUILDSYSTEM_ENABLE_ZSTD_SUPPORT
 
+#  include <Foundation/Logging/Log.h>
 #  include <Foundation/System/SystemInformation.h>
 #  include <zstd/zstd.h>
 
@@ -23,8 +24,10 @@ plCompressedStreamReaderZstd::~plCompressedStreamReaderZstd()
   }
 }
 
-void plCompressedStreamReaderZstd::SetInputStream(plStreamReader* pInputStream)
+void plCompressedStreamReaderZstd::SetInputStream(plStreamReader* pInputStream, const plZstdDictionary* pDictionary /*= nullptr*/)
 {
+  PL_ASSERT_DEV(pDictionary == nullptr || pDictionary->IsValidForDecompression(), "The dictionary has not been created for decompression.");
+
   m_InBuffer.pos = 0;
   m_InBuffer.size = 0;
   m_bReachedEnd = false;
@@ -36,6 +39,12 @@ void plCompressedStreamReaderZstd::SetInputStream(plStreamReader* pInputStream)
   }
 
   ZSTD_initDStream(reinterpret_cast<ZSTD_DStream*>(m_pZstdDStream));
+
+  if (pDictionary != nullptr)
+  {
+    // only references the digested dictionary, nothing needs to be copied or processed here
+    ZSTD_DCtx_refDDict(reinterpret_cast<ZSTD_DStream*>(m_pZstdDStream), reinterpret_cast<const ZSTD_DDict*>(pDictionary->m_pDDict));
+  }
 }
 
 plUInt64 plCompressedStreamReaderZstd::ReadBytes(void* pReadBuffer, plUInt64 uiBytesToRead)
@@ -160,9 +169,11 @@ plCompressedStreamWriterZstd::~plCompressedStreamWriterZstd()
   }
 }
 
-void plCompressedStreamWriterZstd::SetOutputStream(plStreamWriter* pOutputStream, plUInt32 uiMaxNumWorkerThreads, Compression ratio /*= Compression::Default*/, plUInt32 uiCompressionCacheSizeKB /*= 4*/)
+void plCompressedStreamWriterZstd::SetOutputStream(plStreamWriter* pOutputStream, plUInt32 uiMaxNumWorkerThreads, Compression ratio /*= Compression::Default*/, plUInt32 uiCompressionCacheSizeKB /*= 4*/, const plZstdDictionary* pDictionary /*= nullptr*/)
 {
-  if (m_pOutputStream == pOutputStream)
+  PL_ASSERT_DEV(pDictionary == nullptr || pDictionary->IsValidForCompression(), "The dictionary has not been created for compression.");
+
+  if (m_pOutputStream == pOutputStream && m_pDictionary == pDictionary)
     return;
 
   // limit the cache to 63KB, because at 64KB we run into an endless loop due to a 16 bit overflow
@@ -174,6 +185,11 @@ void plCompressedStreamWriterZstd::SetOutputStream(plStreamWriter* pOutputStream
   m_uiUncompressedSize = 0;
   m_uiCompressedSize = 0;
   m_uiWrittenBytes = 0;
+  m_uiSeekableFrameSize = 0;
+  m_uiCurrentFrameSize = 0;
+  m_uiCurrentFrameStart = 0;
+  m_SeekTable.Clear();
+  m_pDictionary = pDictionary;
 
   if (pOutputStream != nullptr)
   {
@@ -187,7 +203,7 @@ void plCompressedStreamWriterZstd::SetOutputStream(plStreamWriter* pOutputStream
     plUInt32 uiMaxCoreCount = (uiMaxNumWorkerThreads > 0) ? plMath::Clamp(plSystemInformation::Get().GetCPUCoreCount(), 1u, uiMaxNumWorkerThreads) : 0u;
 
     ZSTD_CCtx_reset(reinterpret_cast<ZSTD_CStream*>(m_pZstdCStream), ZSTD_reset_session_only);
-    ZSTD_CCtx_refCDict(reinterpret_cast<ZSTD_CStream*>(m_pZstdCStream), nullptr);
+    ZSTD_CCtx_refCDict(reinterpret_cast<ZSTD_CStream*>(m_pZstdCStream), pDictionary != nullptr ? reinterpret_cast<const ZSTD_CDict*>(pDictionary->m_pCDict) : nullptr);
     ZSTD_CCtx_setParameter(reinterpret_cast<ZSTD_CStream*>(m_pZstdCStream), ZSTD_c_compressionLevel, (int)ratio);
     ZSTD_CCtx_setParameter(reinterpret_cast<ZSTD_CStream*>(m_pZstdCStream), ZSTD_c_nbWorkers, uiMaxCoreCount);
 
@@ -199,11 +215,76 @@ void plCompressedStreamWriterZstd::SetOutputStream(plStreamWriter* pOutputStream
   }
 }
 
+void plCompressedStreamWriterZstd::EnableSeekableFrames(plUInt32 uiUncompressedFrameSize /*= 256 * 1024*/)
+{
+  PL_ASSERT_DEV(m_pOutputStream != nullptr, "SetOutputStream() has to be called first.");
+  PL_ASSERT_DEV(m_uiUncompressedSize == 0, "Seekable frames have to be enabled before writing any data.");
+  PL_ASSERT_DEV(uiUncompressedFrameSize > 0, "Invalid frame size");
+
+  m_uiSeekableFrameSize = uiUncompressedFrameSize;
+  m_uiCurrentFrameSize = 0;
+  m_uiCurrentFrameStart = m_uiWrittenBytes;
+}
+
+plResult plCompressedStreamWriterZstd::EndSeekableFrame()
+{
+  ZSTD_inBuffer emptyBuffer;
+  emptyBuffer.pos = 0;
+  emptyBuffer.size = 0;
+  emptyBuffer.src = nullptr;
+
+  while (true)
+  {
+    const size_t res = ZSTD_compressStream2(reinterpret_cast<ZSTD_CStream*>(m_pZstdCStream), reinterpret_cast<ZSTD_outBuffer*>(&m_OutBuffer), &emptyBuffer, ZSTD_e_end);
+    PL_VERIFY(!ZSTD_isError(res), "Ending the zstd frame failed: '{0}'", ZSTD_getErrorName(res));
+
+    if (FlushWriteCache() == PL_FAILURE)
+      return PL_FAILURE;
+
+    if (res == 0)
+      break;
+  }
+
+  // the next frame starts with a new chunk, so that it can be decompressed on its own
+  m_SeekTable.PushBack(static_cast<plUInt32>(m_uiWrittenBytes - m_uiCurrentFrameStart));
+  m_SeekTable.PushBack(m_uiCurrentFrameSize);
+
+  m_uiCurrentFrameStart = m_uiWrittenBytes;
+  m_uiCurrentFrameSize = 0;
+
+  return PL_SUCCESS;
+}
+
 plResult plCompressedStreamWriterZstd::FinishCompressedStream()
 {
   if (m_pOutputStream == nullptr)
     return PL_SUCCESS;
 
+  if (m_uiSeekableFrameSize > 0)
+  {
+    if (m_uiCurrentFrameSize > 0 && EndSeekableFrame().Failed())
+      return PL_FAILURE;
+
+    // all frames are already complete, only the terminator and the seek table are missing
+    const plUInt16 uiTerminator = 0;
+    if (m_pOutputStream->WriteBytes(&uiTerminator, sizeof(plUInt16)) == PL_FAILURE)
+      return PL_FAILURE;
+
+    if (m_pOutputStream->WriteBytes(m_SeekTable.GetData(), m_SeekTable.GetCount() * sizeof(plUInt32)) == PL_FAILURE)
+      return PL_FAILURE;
+
+    const plUInt32 uiFooter[2] = {m_SeekTable.GetCount() / 2, SeekTableMagic};
+    if (m_pOutputStream->WriteBytes(uiFooter, sizeof(uiFooter)) == PL_FAILURE)
+      return PL_FAILURE;
+
+    m_uiWrittenBytes += sizeof(plUInt16) + m_SeekTable.GetCount() * sizeof(plUInt32) + sizeof(uiFooter);
+    m_uiSeekableFrameSize = 0;
+    m_SeekTable.Clear();
+    m_pOutputStream = nullptr;
+
+    return PL_SUCCESS;
+  }
+
   if (Flush().Failed())
     return PL_FAILURE;
 
@@ -281,6 +362,33 @@ plResult plCompressedStreamWriterZstd::WriteBytes(const void* pWriteBuffer, plUI
 {
   PL_ASSERT_DEV(m_pZstdCStream != nullptr, "The stream is already closed, you cannot write more data to it.");
 
+  if (m_uiSeekableFrameSize == 0)
+    return CompressBytes(pWriteBuffer, uiBytesToWrite);
+
+  const plUInt8* pBytes = static_cast<const plUInt8*>(pWriteBuffer);
+
+  // split the data at the frame boundaries
+  while (uiBytesToWrite > 0)
+  {
+    const plUInt32 uiToWrite = static_cast<plUInt32>(plMath::Min<plUInt64>(uiBytesToWrite, m_uiSeekableFrameSize - m_uiCurrentFrameSize));
+
+    PL_SUCCEED_OR_RETURN(CompressBytes(pBytes, uiToWrite));
+    m_uiCurrentFrameSize += uiToWrite;
+
+    if (m_uiCurrentFrameSize == m_uiSeekableFrameSize)
+    {
+      PL_SUCCEED_OR_RETURN(EndSeekableFrame());
+    }
+
+    pBytes += uiToWrite;
+    uiBytesToWrite -= uiToWrite;
+  }
+
+  return PL_SUCCESS;
+}
+
+plResult plCompressedStreamWriterZstd::CompressBytes(const void* pWriteBuffer, plUInt64 uiBytesToWrite)
+{
   m_uiUncompressedSize += static_cast<plUInt32>(uiBytesToWrite);
 
   ZSTD_inBuffer inBuffer;
@@ -304,4 +412,422 @@ plResult plCompressedStreamWriterZstd::WriteBytes(const void* pWriteBuffer, plUI
   return PL_SUCCESS;
 }
 
+//////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////
+
+plSeekableCompressedStreamReaderZstd::plSeekableCompressedStreamReaderZstd() = default;
+
+plSeekableCompressedStreamReaderZstd::~plSeekableCompressedStreamReaderZstd()
+{
+  if (m_pZstdDStream != nullptr)
+  {
+    ZSTD_freeDStream(reinterpret_cast<ZSTD_DStream*>(m_pZstdDStream));
+    m_pZstdDStream = nullptr;
+  }
+}
+
+bool plSeekableCompressedStreamReaderZstd::IsSeekableStream(plConstByteArrayPtr compressedData)
+{
+  if (compressedData.GetCount() < sizeof(plUInt16) + 2 * sizeof(plUInt32))
+    return false;
+
+  plUInt32 uiMagic = 0;
+  plMemoryUtils::RawByteCopy(&uiMagic, compressedData.GetEndPtr() - sizeof(plUInt32), sizeof(plUInt32));
+
+  return uiMagic == plCompressedStreamWriterZstd::SeekTableMagic;
+}
+
+plResult plSeekableCompressedStreamReaderZstd::SetInputData(plConstByteArrayPtr compressedData, const plZstdDictionary* pDictionary /*= nullptr*/)
+{
+  PL_ASSERT_DEV(pDictionary == nullptr || pDictionary->IsValidForDecompression(), "The dictionary has not been created for decompression.");
+
+  m_CompressedData = {};
+  m_pDictionary = pDictionary;
+  m_Frames.Clear();
+  m_uiCachedFrame = plInvalidIndex;
+  m_uiReadPosition = 0;
+  m_uiUncompressedSize = 0;
+
+  if (!IsSeekableStream(compressedData))
+    return PL_FAILURE;
+
+  plUInt32 uiNumFrames = 0;
+  plMemoryUtils::RawByteCopy(&uiNumFrames, compressedData.GetEndPtr() - 2 * sizeof(plUInt32), sizeof(plUInt32));
+
+  const plUInt64 uiTableSize = static_cast<plUInt64>(uiNumFrames) * 2 * sizeof(plUInt32);
+  const plUInt64 uiTrailerSize = sizeof(plUInt16) + uiTableSize + 2 * sizeof(plUInt32);
+
+  if (uiTrailerSize > compressedData.GetCount())
+    return PL_FAILURE;
+
+  const plUInt8* pTable = compressedData.GetEndPtr() - 2 * sizeof(plUInt32) - uiTableSize;
+
+  m_Frames.SetCount(uiNumFrames);
+
+  plUInt64 uiStoredOffset = 0;
+  for (plUInt32 i = 0; i < uiNumFrames; ++i)
+  {
+    Frame& frame = m_Frames[i];
+    plMemoryUtils::RawByteCopy(&frame.m_uiStoredSize, pTable + i * 2 * sizeof(plUInt32), sizeof(plUInt32));
+    plMemoryUtils::RawByteCopy(&frame.m_uiUncompressedSize, pTable + i * 2 * sizeof(plUInt32) + sizeof(plUInt32), sizeof(plUInt32));
+
+    frame.m_uiStoredOffset = uiStoredOffset;
+    frame.m_uiUncompressedOffset = m_uiUncompressedSize;
+
+    uiStoredOffset += frame.m_uiStoredSize;
+    m_uiUncompressedSize += frame.m_uiUncompressedSize;
+  }
+
+  if (uiStoredOffset + uiTrailerSize != compressedData.GetCount())
+  {
+    m_Frames.Clear();
+    m_uiUncompressedSize = 0;
+    return PL_FAILURE;
+  }
+
+  m_CompressedData = compressedData;
+
+  if (m_pZstdDStream == nullptr)
+  {
+    m_pZstdDStream = ZSTD_createDStream();
+  }
+
+  return PL_SUCCESS;
+}
+
+plResult plSeekableCompressedStreamReaderZstd::DecompressFrame(plUInt32 uiFrame)
+{
+  if (m_uiCachedFrame == uiFrame)
+    return PL_SUCCESS;
+
+  m_uiCachedFrame = plInvalidIndex;
+
+  const Frame& frame = m_Frames[uiFrame];
+  m_FrameCache.SetCountUninitialized(frame.m_uiUncompressedSize);
+
+  ZSTD_DStream* pStream = reinterpret_cast<ZSTD_DStream*>(m_pZstdDStream);
+  ZSTD_initDStream(pStream);
+
+  if (m_pDictionary != nullptr)
+  {
+    ZSTD_DCtx_refDDict(pStream, reinterpret_cast<const ZSTD_DDict*>(m_pDictionary->m_pDDict));
+  }
+
+  ZSTD_outBuffer outBuffer;
+  outBuffer.dst = m_FrameCache.GetData();
+  outBuffer.pos = 0;
+  outBuffer.size = m_FrameCache.GetCount();
+
+  // the frame is stored in the same chunks as a regular stream (16 bit size + data)
+  const plUInt8* pChunk = m_CompressedData.GetPtr() + frame.m_uiStoredOffset;
+  const plUInt8* pFrameEnd = pChunk + frame.m_uiStoredSize;
+
+  while (pChunk + sizeof(plUInt16) <= pFrameEnd)
+  {
+    plUInt16 uiChunkSize = 0;
+    plMemoryUtils::RawByteCopy(&uiChunkSize, pChunk, sizeof(plUInt16));
+    pChunk += sizeof(plUInt16);
+
+    if (pChunk + uiChunkSize > pFrameEnd)
+      return PL_FAILURE;
+
+    ZSTD_inBuffer inBuffer;
+    inBuffer.src = pChunk;
+    inBuffer.pos = 0;
+    inBuffer.size = uiChunkSize;
+
+    while (inBuffer.pos < inBuffer.size)
+    {
+      const size_t res = ZSTD_decompressStream(pStream, &outBuffer, &inBuffer);
+
+      if (ZSTD_isError(res))
+      {
+        plLog::Error("Decompressing the zstd frame failed: '{0}'", ZSTD_getErrorName(res));
+        return PL_FAILURE;
+      }
+
+      if (res == 0 && inBuffer.pos < inBuffer.size)
+        return PL_FAILURE; // more data than the frame should contain
+    }
+
+    pChunk += uiChunkSize;
+  }
+
+  if (outBuffer.pos != outBuffer.size)
+    return PL_FAILURE;
+
+  m_uiCachedFrame = uiFrame;
+  return PL_SUCCESS;
+}
+
+plUInt64 plSeekableCompressedStreamReaderZstd::ReadBytes(void* pReadBuffer, plUInt64 uiBytesToRead)
+{
+  if (pReadBuffer == nullptr)
+    return SkipBytes(uiBytesToRead);
+
+  plUInt8* pTarget = static_cast<plUInt8*>(pReadBuffer);
+  plUInt64 uiBytesRead = 0;
+
+  while (uiBytesRead < uiBytesToRead && m_uiReadPosition < m_uiUncompressedSize)
+  {
+    // mostly the data is read sequentially, so check the cached frame first
+    plUInt32 uiFrame = m_uiCachedFrame;
+
+    if (uiFrame == plInvalidIndex || m_uiReadPosition < m_Frames[uiFrame].m_uiUncompressedOffset || m_uiReadPosition >= m_Frames[uiFrame].m_uiUncompressedOffset + m_Frames[uiFrame].m_uiUncompressedSize)
+    {
+      // binary search for the last frame that starts at or before the read position
+      plUInt32 uiFirst = 0;
+      plUInt32 uiLast = m_Frames.GetCount();
+
+      while (uiLast - uiFirst > 1)
+      {
+        const plUInt32 uiMiddle = uiFirst + (uiLast - uiFirst) / 2;
+
+        if (m_Frames[uiMiddle].m_uiUncompressedOffset <= m_uiReadPosition)
+          uiFirst = uiMiddle;
+        else
+          uiLast = uiMiddle;
+      }
+
+      uiFrame = uiFirst;
+
+      if (DecompressFrame(uiFrame).Failed())
+      {
+        plLog::Error("Seekable zstd stream is corrupted.");
+        break;
+      }
+    }
+
+    const Frame& frame = m_Frames[uiFrame];
+    const plUInt64 uiOffsetInFrame = m_uiReadPosition - frame.m_uiUncompressedOffset;
+    const plUInt64 uiToCopy = plMath::Min(uiBytesToRead - uiBytesRead, frame.m_uiUncompressedSize - uiOffsetInFrame);
+
+    plMemoryUtils::RawByteCopy(pTarget + uiBytesRead, m_FrameCache.GetData() + uiOffsetInFrame, static_cast<size_t>(uiToCopy));
+
+    uiBytesRead += uiToCopy;
+    m_uiReadPosition += uiToCopy;
+  }
+
+  return uiBytesRead;
+}
+
+plUInt64 plSeekableCompressedStreamReaderZstd::SkipBytes(plUInt64 uiBytesToSkip)
+{
+  const plUInt64 uiSkipped = plMath::Min(uiBytesToSkip, m_uiUncompressedSize - m_uiReadPosition);
+  m_uiReadPosition += uiSkipped;
+  return uiSkipped;
+}
+
+void plSeekableCompressedStreamReaderZstd::SetReadPosition(plUInt64 uiUncompressedOffset)
+{
+  m_uiReadPosition = plMath::Min(uiUncompressedOffset, m_uiUncompressedSize);
+}
+
+//////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////
+
+plZstdDictionary::plZstdDictionary() = default;
+
+plZstdDictionary::~plZstdDictionary()
+{
+  Clear();
+}
+
+void plZstdDictionary::Clear()
+{
+  if (m_pCDict != nullptr)
+  {
+    ZSTD_freeCDict(reinterpret_cast<ZSTD_CDict*>(m_pCDict));
+    m_pCDict = nullptr;
+  }
+
+  if (m_pDDict != nullptr)
+  {
+    ZSTD_freeDDict(reinterpret_cast<ZSTD_DDict*>(m_pDDict));
+    m_pDDict = nullptr;
+  }
+}
+
+plResult plZstdDictionary::CreateForCompression(plConstByteArrayPtr dictionary, plCompressedStreamWriterZstd::Compression ratio)
+{
+  if (m_pCDict != nullptr)
+  {
+    ZSTD_freeCDict(reinterpret_cast<ZSTD_CDict*>(m_pCDict));
+  }
+
+  m_pCDict = ZSTD_createCDict(dictionary.GetPtr(), dictionary.GetCount(), (int)ratio);
+  return m_pCDict != nullptr ? PL_SUCCESS : PL_FAILURE;
+}
+
+plResult plZstdDictionary::CreateForDecompression(plConstByteArrayPtr dictionary)
+{
+  if (m_pDDict != nullptr)
+  {
+    ZSTD_freeDDict(reinterpret_cast<ZSTD_DDict*>(m_pDDict));
+  }
+
+  m_pDDict = ZSTD_createDDict(dictionary.GetPtr(), dictionary.GetCount());
+  return m_pDDict != nullptr ? PL_SUCCESS : PL_FAILURE;
+}
+
+namespace
+{
+  // The vendored zstd does not include the dictionary builder (zdict), so this is a simplified version of its 'fast cover' algorithm:
+  // Byte sequences that appear in many different samples are counted (in a fixed size table, collisions are accepted),
+  // and then those segments of the samples are selected, that cover the most frequent and not yet covered sequences.
+
+  constexpr plUInt32 DictKmerSize = 8;
+  constexpr plUInt32 DictSegmentSize = 128;
+  constexpr plUInt32 DictTableBits = 20;
+
+  struct KmerFrequency
+  {
+    plUInt32 m_uiNumSamples = 0;
+    plUInt32 m_uiLastSample = plInvalidIndex;
+  };
+
+  struct DictSegment
+  {
+    plUInt32 m_uiSample = 0;
+    plUInt32 m_uiStart = 0;
+    plUInt32 m_uiSize = 0;
+    plUInt64 m_uiScore = 0;
+  };
+
+  PL_ALWAYS_INLINE plUInt32 HashKmer(const plUInt8* pData)
+  {
+    plUInt64 uiKmer;
+    plMemoryUtils::RawByteCopy(&uiKmer, pData, sizeof(plUInt64));
+    return static_cast<plUInt32>((uiKmer * 0x9E3779B97F4A7C15ull) >> (64 - DictTableBits));
+  }
+
+  plUInt64 ScoreSegment(const plConstByteArrayPtr& sample, const DictSegment& segment, const plDynamicArray<KmerFrequency>& frequencies)
+  {
+    plUInt64 uiScore = 0;
+
+    const plUInt32 uiEnd = plMath::Min(segment.m_uiStart + segment.m_uiSize, sample.GetCount() - DictKmerSize + 1);
+    for (plUInt32 i = segment.m_uiStart; i < uiEnd; ++i)
+    {
+      const plUInt32 uiNumSamples = frequencies[HashKmer(sample.GetPtr() + i)].m_uiNumSamples;
+
+      // sequences that only appear in a single sample are not worth putting into the dictionary
+      if (uiNumSamples > 1)
+      {
+        uiScore += uiNumSamples;
+      }
+    }
+
+    return uiScore;
+  }
+} // namespace
+
+plResult plZstdDictionary::Train(plArrayPtr<const plConstByteArrayPtr> samples, plUInt32 uiMaxDictionarySize, plDynamicArray<plUInt8>& out_dictionary)
+{
+  out_dictionary.Clear();
+
+  if (samples.GetCount() < 8 || uiMaxDictionarySize < DictSegmentSize)
+    return PL_FAILURE;
+
+  plDynamicArray<KmerFrequency> frequencies;
+  frequencies.SetCount(1u << DictTableBits);
+
+  plDynamicArray<DictSegment> segments;
+
+  for (plUInt32 uiSample = 0; uiSample < samples.GetCount(); ++uiSample)
+  {
+    const plConstByteArrayPtr& sample = samples[uiSample];
+
+    if (sample.GetCount() < DictKmerSize)
+      continue;
+
+    for (plUInt32 i = 0; i + DictKmerSize <= sample.GetCount(); ++i)
+    {
+      KmerFrequency& freq = frequencies[HashKmer(sample.GetPtr() + i)];
+
+      // count every sequence only once per sample
+      if (freq.m_uiLastSample != uiSample)
+      {
+        freq.m_uiLastSample = uiSample;
+        ++freq.m_uiNumSamples;
+      }
+    }
+
+    for (plUInt32 uiStart = 0; uiStart < sample.GetCount(); uiStart += DictSegmentSize)
+    {
+      DictSegment& segment = segments.ExpandAndGetRef();
+      segment.m_uiSample = uiSample;
+      segment.m_uiStart = uiStart;
+      segment.m_uiSize = plMath::Min(DictSegmentSize, sample.GetCount() - uiStart);
+    }
+  }
+
+  for (DictSegment& segment : segments)
+  {
+    segment.m_uiScore = ScoreSegment(samples[segment.m_uiSample], segment, frequencies);
+  }
+
+  segments.Sort([](const DictSegment& a, const DictSegment& b)
+    {
+      if (a.m_uiScore != b.m_uiScore)
+        return a.m_uiScore > b.m_uiScore;
+
+      // keep the result deterministic
+      if (a.m_uiSample != b.m_uiSample)
+        return a.m_uiSample < b.m_uiSample;
+
+      return a.m_uiStart < b.m_uiStart; });
+
+  plHybridArray<const DictSegment*, 256> selected;
+  plUInt32 uiDictionarySize = 0;
+
+  for (const DictSegment& segment : segments)
+  {
+    if (segment.m_uiScore == 0)
+      break;
+
+    if (uiDictionarySize + segment.m_uiSize > uiMaxDictionarySize)
+      continue;
+
+    // segments are only scored once up front, previously selected segments may already cover most of this one
+    const plUInt64 uiCurrentScore = ScoreSegment(samples[segment.m_uiSample], segment, frequencies);
+    if (uiCurrentScore * 2 < segment.m_uiScore)
+      continue;
+
+    selected.PushBack(&segment);
+    uiDictionarySize += segment.m_uiSize;
+
+    // everything in this segment is now covered by the dictionary
+    const plConstByteArrayPtr& sample = samples[segment.m_uiSample];
+    const plUInt32 uiEnd = plMath::Min(segment.m_uiStart + segment.m_uiSize, sample.GetCount() - DictKmerSize + 1);
+    for (plUInt32 i = segment.m_uiStart; i < uiEnd; ++i)
+    {
+      frequencies[HashKmer(sample.GetPtr() + i)].m_uiNumSamples = 0;
+    }
+
+    if (uiDictionarySize + DictKmerSize > uiMaxDictionarySize)
+      break;
+  }
+
+  // none of the samples have anything in common
+  if (selected.IsEmpty())
+    return PL_FAILURE;
+
+  // zstd can reference content at the end of the dictionary with smaller offsets, so the best segments go last
+  out_dictionary.Reserve(uiDictionarySize);
+
+  for (plUInt32 i = selected.GetCount(); i > 0; --i)
+  {
+    const DictSegment& segment = *selected[i - 1];
+    out_dictionary.PushBackRange(samples[segment.m_uiSample].GetSubArray(segment.m_uiStart, segment.m_uiSize));
+  }
+
+  return PL_SUCCESS;
+}
+
 #endif
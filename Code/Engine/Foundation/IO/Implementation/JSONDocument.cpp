@@ -0,0 +1,695 @@
+#include <Foundation/FoundationPCH.h>
+
+#include <Foundation/IO/JSONDocument.h>
+#include <Foundation/Logging/Log.h>
+#include <Foundation/Strings/Implementation/StringUtilsSimd.h>
+#include <Foundation/Utilities/ConversionUtils.h>
+
+namespace
+{
+  /// \brief Bit masks for a block of 64 bytes, one bit per byte.
+  struct JSONBlockMasks
+  {
+    plUInt64 m_uiQuotes = 0;
+    plUInt64 m_uiBackslashes = 0;
+    plUInt64 m_uiOperators = 0; ///< { } [ ] : ,
+    plUInt64 m_uiWhitespace = 0;
+    plUInt64 m_uiSlashes = 0;
+    plUInt64 m_uiZeros = 0;
+  };
+} // namespace
+
+#if PL_ENABLED(PL_STRING_SIMD)
+
+static void JSONClassifyBlock(const char* pBlock, JSONBlockMasks& out_masks)
+{
+  out_masks = {};
+
+  for (plUInt32 i = 0; i < 4; ++i)
+  {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pBlock + i * 16));
+    const plUInt32 uiShift = i * 16;
+
+    auto Match = [v](char c)
+    { return _mm_cmpeq_epi8(v, _mm_set1_epi8(c)); };
+
+    const __m128i operators = _mm_or_si128(_mm_or_si128(_mm_or_si128(Match('{'), Match('}')), _mm_or_si128(Match('['), Match(']'))), _mm_or_si128(Match(':'), Match(',')));
+    const __m128i whitespace = _mm_or_si128(_mm_or_si128(Match(' '), Match('\t')), _mm_or_si128(Match('\n'), Match('\r')));
+
+    out_masks.m_uiQuotes |= static_cast<plUInt64>(_mm_movemask_epi8(Match('"'))) << uiShift;
+    out_masks.m_uiBackslashes |= static_cast<plUInt64>(_mm_movemask_epi8(Match('\\'))) << uiShift;
+    out_masks.m_uiOperators |= static_cast<plUInt64>(_mm_movemask_epi8(operators)) << uiShift;
+    out_masks.m_uiWhitespace |= static_cast<plUInt64>(_mm_movemask_epi8(whitespace)) << uiShift;
+    out_masks.m_uiSlashes |= static_cast<plUInt64>(_mm_movemask_epi8(Match('/'))) << uiShift;
+    out_masks.m_uiZeros |= static_cast<plUInt64>(_mm_movemask_epi8(Match('\0'))) << uiShift;
+  }
+}
+
+#else
+
+static void JSONClassifyBlock(const char* pBlock, JSONBlockMasks& out_masks)
+{
+  out_masks = {};
+
+  for (plUInt32 i = 0; i < 64; ++i)
+  {
+    const plUInt64 uiBit = plUInt64(1) << i;
+
+    switch (pBlock[i])
+    {
+      case '"':
+        out_masks.m_uiQuotes |= uiBit;
+        break;
+      case '\\':
+        out_masks.m_uiBackslashes |= uiBit;
+        break;
+      case '{':
+      case '}':
+      case '[':
+      case ']':
+      case ':':
+      case ',':
+        out_masks.m_uiOperators |= uiBit;
+        break;
+      case ' ':
+      case '\t':
+      case '\n':
+      case '\r':
+        out_masks.m_uiWhitespace |= uiBit;
+        break;
+      case '/':
+        out_masks.m_uiSlashes |= uiBit;
+        break;
+      case '\0':
+        out_masks.m_uiZeros |= uiBit;
+        break;
+    }
+  }
+}
+
+#endif
+
+/// \brief Sets bit i if bit i or an odd number of bits below i are set.
+static plUInt64 JSONPrefixXor(plUInt64 uiBits)
+{
+  uiBits ^= uiBits << 1;
+  uiBits ^= uiBits << 2;
+  uiBits ^= uiBits << 4;
+  uiBits ^= uiBits << 8;
+  uiBits ^= uiBits << 16;
+  uiBits ^= uiBits << 32;
+  return uiBits;
+}
+
+/// \brief Returns the bits of all characters that are preceded by an unescaped backslash.
+static plUInt64 JSONFindEscapedCharacters(plUInt64 uiBackslashes, bool& inout_bFirstIsEscaped)
+{
+  plUInt64 uiEscaped = inout_bFirstIsEscaped ? 1 : 0;
+  inout_bFirstIsEscaped = false;
+
+  // backslashes are rare, so simply go through them one by one
+  while (uiBackslashes != 0)
+  {
+    const plUInt32 uiBit = plMath::FirstBitLow(uiBackslashes);
+    uiBackslashes &= uiBackslashes - 1;
+
+    if ((uiEscaped & (plUInt64(1) << uiBit)) != 0)
+      continue;
+
+    if (uiBit == 63)
+      inout_bFirstIsEscaped = true;
+    else
+      uiEscaped |= plUInt64(1) << (uiBit + 1);
+  }
+
+  return uiEscaped;
+}
+
+static bool JSONIsDelimiter(char c)
+{
+  switch (c)
+  {
+    case '{':
+    case '}':
+    case '[':
+    case ']':
+    case ':':
+    case ',':
+    case '"':
+    case ' ':
+    case '\t':
+    case '\n':
+    case '\r':
+      return true;
+  }
+
+  return false;
+}
+
+plJSONDocument::Value plJSONDocument::Value::FindMember(plStringView sName) const
+{
+  if (!IsObject())
+    return Value();
+
+  for (Value child = GetFirstChild(); child.IsValid(); child = child.GetNextSibling())
+  {
+    if (child.GetName() == sName)
+      return child;
+  }
+
+  return Value();
+}
+
+plResult plJSONDocument::Parse(plArrayPtr<const char> input, plLogInterface* pLog)
+{
+  Clear();
+
+  m_Input = input;
+  return ParseBuffer(pLog, true);
+}
+
+plResult plJSONDocument::Parse(plStreamReader& ref_input, plLogInterface* pLog)
+{
+  Clear();
+
+  ReadAll(ref_input, m_OwnedInput);
+
+  m_Input = m_OwnedInput;
+  return ParseBuffer(pLog, true);
+}
+
+void plJSONDocument::ReadAll(plStreamReader& ref_input, plDynamicArray<char>& out_buffer)
+{
+  out_buffer.Clear();
+
+  plUInt8 temp[4096];
+  while (true)
+  {
+    const plUInt64 uiRead = ref_input.ReadBytes(temp, PL_ARRAY_SIZE(temp));
+
+    if (uiRead == 0)
+      break;
+
+    out_buffer.PushBackRange(plArrayPtr<const char>(reinterpret_cast<const char*>(temp), static_cast<plUInt32>(uiRead)));
+  }
+}
+
+void plJSONDocument::Clear()
+{
+  m_Input.Clear();
+  m_OwnedInput.Clear();
+  m_WithoutComments.Clear();
+  m_Unescaped.Clear();
+  m_Structurals.Clear();
+  m_Nodes.Clear();
+}
+
+plResult plJSONDocument::ParseBuffer(plLogInterface* pLog, bool bLogErrors)
+{
+  const char* szError = nullptr;
+  plUInt32 uiErrorOffset = 0;
+
+  bool bFoundComment = false;
+  plResult res = BuildIndex(bFoundComment, szError, uiErrorOffset);
+
+  if (res.Succeeded() && bFoundComment)
+  {
+    // comments are rare, so instead of handling them in the indexing, they are replaced by whitespace in a copy of the input
+    RemoveComments();
+    res = BuildIndex(bFoundComment, szError, uiErrorOffset);
+  }
+
+  if (res.Succeeded())
+  {
+    res = BuildNodes(szError, uiErrorOffset);
+  }
+
+  m_Structurals.Clear();
+
+  if (res.Failed())
+  {
+    if (bLogErrors)
+    {
+      plUInt32 uiLine = 1;
+      plUInt32 uiColumn = 1;
+      for (plUInt32 i = 0; i < uiErrorOffset && i < m_Input.GetCount(); ++i)
+      {
+        if (m_Input[i] == '\n')
+        {
+          ++uiLine;
+          uiColumn = 1;
+        }
+        else
+          ++uiColumn;
+      }
+
+      plLog::Error(pLog, "Line {0} ({1}): {2}", uiLine, uiColumn, szError);
+    }
+
+    m_Nodes.Clear();
+    return PL_FAILURE;
+  }
+
+  return PL_SUCCESS;
+}
+
+plResult plJSONDocument::BuildIndex(bool& inout_bFoundComment, const char*& out_szError, plUInt32& out_uiErrorOffset)
+{
+  // after RemoveComments() all remaining slashes are treated like any other character
+  const bool bCheckForComments = !inout_bFoundComment;
+  inout_bFoundComment = false;
+  m_Structurals.Clear();
+  m_Structurals.Reserve(m_Input.GetCount() / 8);
+
+  const char* pInput = m_Input.GetPtr();
+  const plUInt32 uiSize = m_Input.GetCount();
+
+  bool bFirstIsEscaped = false;
+  plUInt64 uiInStringCarry = 0;
+  plUInt64 uiValueCarry = 0;
+
+  for (plUInt32 uiBlockStart = 0; uiBlockStart < uiSize; uiBlockStart += 64)
+  {
+    JSONBlockMasks masks;
+
+    if (uiSize - uiBlockStart >= 64)
+    {
+      JSONClassifyBlock(pInput + uiBlockStart, masks);
+    }
+    else
+    {
+      // pad the last block with whitespace
+      char lastBlock[64];
+      plMemoryUtils::Copy(&lastBlock[0], pInput + uiBlockStart, uiSize - uiBlockStart);
+      plMemoryUtils::PatternFill(lastBlock + (uiSize - uiBlockStart), ' ', 64 - (uiSize - uiBlockStart));
+      JSONClassifyBlock(lastBlock, masks);
+    }
+
+    if (masks.m_uiZeros != 0)
+    {
+      out_szError = "The document contains a zero byte.";
+      out_uiErrorOffset = uiBlockStart + plMath::FirstBitLow(masks.m_uiZeros);
+      return PL_FAILURE;
+    }
+
+    const plUInt64 uiEscaped = JSONFindEscapedCharacters(masks.m_uiBackslashes, bFirstIsEscaped);
+    const plUInt64 uiQuotes = masks.m_uiQuotes & ~uiEscaped;
+
+    // the bits of opening quotes and the string content are set, the closing quote is not
+    const plUInt64 uiInString = JSONPrefixXor(uiQuotes) ^ uiInStringCarry;
+    uiInStringCarry = static_cast<plUInt64>(static_cast<plInt64>(uiInString) >> 63);
+
+    if (bCheckForComments && (masks.m_uiSlashes & ~uiInString) != 0)
+    {
+      inout_bFoundComment = true;
+      return PL_SUCCESS;
+    }
+
+    const plUInt64 uiOperators = masks.m_uiOperators & ~uiInString;
+
+    // numbers, true, false and null only need their first character in the index
+    const plUInt64 uiValues = ~(masks.m_uiOperators | masks.m_uiWhitespace | uiQuotes | uiInString);
+    const plUInt64 uiValueStarts = uiValues & ~((uiValues << 1) | uiValueCarry);
+    uiValueCarry = uiValues >> 63;
+
+    plUInt64 uiStructurals = uiOperators | uiQuotes | uiValueStarts;
+
+    while (uiStructurals != 0)
+    {
+      m_Structurals.PushBack(uiBlockStart + plMath::FirstBitLow(uiStructurals));
+      uiStructurals &= uiStructurals - 1;
+    }
+  }
+
+  if (uiInStringCarry != 0)
+  {
+    out_szError = "Reached end of document before end of string was found.";
+    out_uiErrorOffset = uiSize;
+    return PL_FAILURE;
+  }
+
+  return PL_SUCCESS;
+}
+
+void plJSONDocument::RemoveComments()
+{
+  // the original input is kept intact, so that plJSONParser can still parse it if this fails
+  m_WithoutComments = m_Input;
+  m_Input = m_WithoutComments;
+
+  char* pCur = m_WithoutComments.GetData();
+  char* pEnd = pCur + m_WithoutComments.GetCount();
+
+  while (pCur < pEnd)
+  {
+    if (*pCur == '"')
+    {
+      // skip the string
+      for (++pCur; pCur < pEnd && *pCur != '"'; ++pCur)
+      {
+        if (*pCur == '\\')
+          ++pCur;
+      }
+
+      ++pCur;
+    }
+    else if (*pCur == '/' && pCur + 1 < pEnd && pCur[1] == '/')
+    {
+      for (; pCur < pEnd && *pCur != '\n'; ++pCur)
+        *pCur = ' ';
+    }
+    else if (*pCur == '/' && pCur + 1 < pEnd && pCur[1] == '*')
+    {
+      pCur[0] = ' ';
+      pCur[1] = ' ';
+      pCur += 2;
+
+      // an unterminated comment reaches until the end of the document
+      for (; pCur < pEnd && (pCur[0] != '*' || pCur + 1 >= pEnd || pCur[1] != '/'); ++pCur)
+        *pCur = ' ';
+
+      if (pCur < pEnd)
+      {
+        pCur[0] = ' ';
+        pCur[1] = ' ';
+        pCur += 2;
+      }
+    }
+    else
+    {
+      ++pCur;
+    }
+  }
+}
+
+plResult plJSONDocument::BuildNodes(const char*& out_szError, plUInt32& out_uiErrorOffset)
+{
+  m_Nodes.Clear();
+
+  const char* pInput = m_Input.GetPtr();
+  const plUInt32 uiNumStructurals = m_Structurals.GetCount();
+
+  if (uiNumStructurals == 0)
+    return PL_SUCCESS; // the document is empty
+
+  // every value needs at least one structural and all but the first value in a container need a comma, so this never has to grow
+  m_Nodes.Reserve((uiNumStructurals + 1) / 2);
+
+  struct Container
+  {
+    plUInt32 m_uiNode;
+    plUInt32 m_uiLastChild;
+    bool m_bAfterValue;
+
+    PL_DECLARE_POD_TYPE();
+  };
+
+  plHybridArray<Container, 32> stack;
+
+  plUInt32 uiCur = 0;
+  plStringView sName;
+
+  auto Fail = [&](const char* szError)
+  {
+    out_szError = szError;
+    out_uiErrorOffset = uiCur < uiNumStructurals ? m_Structurals[uiCur] : m_Input.GetCount();
+    return PL_FAILURE;
+  };
+
+  // adds a node as the next child of the innermost container
+  auto AddNode = [&](ValueType type) -> Node&
+  {
+    const plUInt32 uiNode = m_Nodes.GetCount();
+    Node& node = m_Nodes.ExpandAndGetRef();
+    node.m_Type = type;
+    node.m_sName = sName;
+    node.m_uiEnd = uiNode + 1;
+    sName = {};
+
+    if (!stack.IsEmpty())
+    {
+      Container& parent = stack.PeekBack();
+
+      if (m_Nodes[parent.m_uiNode].m_uiChildCount > 0)
+        m_Nodes[parent.m_uiLastChild].m_uiNextSibling = uiNode;
+
+      m_Nodes[parent.m_uiNode].m_uiChildCount++;
+      parent.m_uiLastChild = uiNode;
+      parent.m_bAfterValue = true;
+    }
+
+    return node;
+  };
+
+  auto OpenContainer = [&](ValueType type)
+  {
+    AddNode(type);
+    stack.PushBack({m_Nodes.GetCount() - 1, 0, false});
+    ++uiCur;
+  };
+
+  if (pInput[m_Structurals[0]] == '{')
+    OpenContainer(ValueType::Object);
+  else if (pInput[m_Structurals[0]] == '[')
+    OpenContainer(ValueType::Array);
+  else
+    return Fail("Start of document: Expected a { or [ or an empty document.");
+
+  while (!stack.IsEmpty())
+  {
+    if (uiCur >= uiNumStructurals)
+      return Fail("End of the document reached without closing all objects.");
+
+    Container& container = stack.PeekBack();
+    const bool bIsObject = m_Nodes[container.m_uiNode].m_Type == ValueType::Object;
+    const char c = pInput[m_Structurals[uiCur]];
+
+    if (c == (bIsObject ? '}' : ']'))
+    {
+      m_Nodes[container.m_uiNode].m_uiEnd = m_Nodes.GetCount();
+      stack.PopBack();
+      ++uiCur;
+      continue;
+    }
+
+    if (container.m_bAfterValue)
+    {
+      if (c != ',')
+        return Fail("After parsing value: Expected a comma or closing brackets/braces (], }).");
+
+      container.m_bAfterValue = false;
+      ++uiCur;
+      continue;
+    }
+
+    if (bIsObject)
+    {
+      // superfluous commas are allowed in objects
+      if (c == ',')
+      {
+        ++uiCur;
+        continue;
+      }
+
+      if (c != '"')
+        return Fail("While parsing object: Expected \" to begin a new variable, or } to close the object.");
+
+      if (ReadString(uiCur, sName).Failed())
+        return Fail("Invalid string.");
+
+      uiCur += 2;
+
+      if (uiCur >= uiNumStructurals || pInput[m_Structurals[uiCur]] != ':')
+        return Fail("After parsing variable name: Expected : to separate variable and value.");
+
+      ++uiCur;
+
+      if (uiCur >= uiNumStructurals)
+        return Fail("End of the document reached without closing all objects.");
+    }
+
+    const plUInt32 uiValueStart = m_Structurals[uiCur];
+
+    switch (pInput[uiValueStart])
+    {
+      case '{':
+        OpenContainer(ValueType::Object);
+        break;
+
+      case '[':
+        OpenContainer(ValueType::Array);
+        break;
+
+      case '"':
+      {
+        plStringView sValue;
+        if (ReadString(uiCur, sValue).Failed())
+          return Fail("Invalid string.");
+
+        AddNode(ValueType::String).m_sString = sValue;
+        uiCur += 2;
+        break;
+      }
+
+      case ']':
+      case '}':
+      case ':':
+      case ',':
+        return Fail("Parsing value: Expected [, {, f, t, \", 0-1, ., +, -, or even 'e'.");
+
+      default:
+      {
+        plUInt32 uiValueEnd = uiValueStart + 1;
+        while (uiValueEnd < m_Input.GetCount() && !JSONIsDelimiter(pInput[uiValueEnd]))
+          ++uiValueEnd;
+
+        const plStringView sValue(pInput + uiValueStart, pInput + uiValueEnd);
+
+        if (sValue == "true" || sValue == "false")
+        {
+          AddNode(ValueType::Bool).m_bBool = sValue == "true";
+        }
+        else if (sValue == "null")
+        {
+          AddNode(ValueType::Null);
+        }
+        else
+        {
+          for (char n : sValue)
+          {
+            if ((n < '0' || n > '9') && n != '.' && n != 'e' && n != 'E' && n != '-' && n != '+')
+              return Fail("Parsing value: Expected a number, true, false or null.");
+          }
+
+          double fValue = 0;
+          if (plConversionUtils::StringToFloat(sValue, fValue).Failed())
+            return Fail("Reading number failed.");
+
+          AddNode(ValueType::Number).m_fNumber = fValue;
+        }
+
+        ++uiCur;
+        break;
+      }
+    }
+  }
+
+  // like plJSONParser, ignore everything after the top level element
+  return PL_SUCCESS;
+}
+
+plResult plJSONDocument::ReadString(plUInt32 uiStructural, plStringView& out_sString)
+{
+  // the indexing guarantees that the next structural is the closing quote
+  if (uiStructural + 1 >= m_Structurals.GetCount())
+    return PL_FAILURE;
+
+  const char* pStart = m_Input.GetPtr() + m_Structurals[uiStructural] + 1;
+  const char* pEnd = m_Input.GetPtr() + m_Structurals[uiStructural + 1];
+
+  const char* pBackslash = static_cast<const char*>(memchr(pStart, '\\', pEnd - pStart));
+
+  if (pBackslash == nullptr)
+  {
+    out_sString = plStringView(pStart, pEnd);
+    return PL_SUCCESS;
+  }
+
+  // unescaped strings are never longer than the escaped ones, so this buffer never needs to grow, which would invalidate previous strings
+  if (m_Unescaped.GetCapacity() == 0)
+    m_Unescaped.Reserve(m_Input.GetCount());
+
+  PL_ASSERT_DEV(m_Unescaped.GetCount() + (pEnd - pStart) <= m_Unescaped.GetCapacity(), "Unescaped string buffer is too small.");
+
+  const plUInt32 uiFirst = m_Unescaped.GetCount();
+  m_Unescaped.PushBackRange(plArrayPtr<const char>(pStart, static_cast<plUInt32>(pBackslash - pStart)));
+
+  auto ReadUtf16CodePoint = [&](const char*& ref_pCur, plUInt16& out_uiCodePoint) -> plResult
+  {
+    if (pEnd - ref_pCur < 4)
+      return PL_FAILURE;
+
+    plUInt32 uiValue = 0;
+    for (plUInt32 i = 0; i < 4; ++i)
+    {
+      const char c = ref_pCur[i];
+      if (!plStringUtils::IsHexDigit(c))
+        return PL_FAILURE;
+
+      uiValue = uiValue * 16 + plConversionUtils::HexCharacterToIntValue(c);
+    }
+
+    ref_pCur += 4;
+    out_uiCodePoint = static_cast<plUInt16>(uiValue);
+    return PL_SUCCESS;
+  };
+
+  for (const char* pCur = pBackslash; pCur < pEnd;)
+  {
+    if (*pCur != '\\')
+    {
+      m_Unescaped.PushBack(*pCur);
+      ++pCur;
+      continue;
+    }
+
+    ++pCur;
+
+    switch (*pCur++)
+    {
+      case '"':
+        m_Unescaped.PushBack('"');
+        break;
+      case '\\':
+        m_Unescaped.PushBack('\\');
+        break;
+      case '/':
+        m_Unescaped.PushBack('/');
+        break;
+      case 'b':
+        m_Unescaped.PushBack('\b');
+        break;
+      case 'f':
+        m_Unescaped.PushBack('\f');
+        break;
+      case 'n':
+        m_Unescaped.PushBack('\n');
+        break;
+      case 'r':
+        m_Unescaped.PushBack('\r');
+        break;
+      case 't':
+        m_Unescaped.PushBack('\t');
+        break;
+      case 'u':
+      {
+        plUInt16 cpt[2];
+        PL_SUCCEED_OR_RETURN(ReadUtf16CodePoint(pCur, cpt[0]));
+
+        const plUInt16* pCodePoint = &cpt[0];
+        if (plUnicodeUtils::IsUtf16Surrogate(pCodePoint))
+        {
+          if (pEnd - pCur < 2 || pCur[0] != '\\' || pCur[1] != 'u')
+            return PL_FAILURE;
+
+          pCur += 2;
+          PL_SUCCEED_OR_RETURN(ReadUtf16CodePoint(pCur, cpt[1]));
+        }
+
+        const plUInt32 uiCodePoint = plUnicodeUtils::DecodeUtf16ToUtf32(pCodePoint);
+
+        // plJSONParser passes zero terminated strings to its callbacks, which would be cut off here
+        if (uiCodePoint == 0)
+          return PL_FAILURE;
+        plUnicodeUtils::UtfInserter<char, plDynamicArray<char>> inserter(&m_Unescaped);
+        plUnicodeUtils::EncodeUtf32ToUtf8(uiCodePoint, inserter);
+        break;
+      }
+      default:
+        return PL_FAILURE;
+    }
+  }
+
+  out_sString = plStringView(m_Unescaped.GetData() + uiFirst, m_Unescaped.GetData() + m_Unescaped.GetCount());
+  return PL_SUCCESS;
+}
@@ -1,5 +1,6 @@
 #include <Foundation/FoundationPCH.h>
 
+#include <Foundation/IO/JSONDocument.h>
 #include <Foundation/IO/JSONParser.h>
 #include <Foundation/Logging/Log.h>
 #include <Foundation/Utilities/ConversionUtils.h>
@@ -106,6 +107,92 @@ void plJSONParser::ParseAll()
   }
 }
 
+bool plJSONParser::ParseBuffered(plStreamReader& stream, plUInt32 uiFirstLineOffset)
+{
+  plJSONDocument::ReadAll(stream, m_BufferedInput);
+
+  plJSONDocument doc;
+  doc.m_Input = m_BufferedInput;
+
+  if (doc.ParseBuffer(m_pLogInterface, false).Failed())
+  {
+    m_BufferedInputReader.Reset(m_BufferedInput.GetData(), m_BufferedInput.GetCount());
+    SetInputStream(m_BufferedInputReader, uiFirstLineOffset);
+    return false;
+  }
+
+  // leave the parser in the finished state
+  m_StateStack.Clear();
+  m_uiCurByte = '\0';
+  m_pInput = nullptr;
+
+  struct OpenContainer
+  {
+    plUInt32 m_uiEnd;
+    bool m_bObject;
+
+    PL_DECLARE_POD_TYPE();
+  };
+
+  plHybridArray<OpenContainer, 32> openContainers;
+
+  const plUInt32 uiNumNodes = doc.m_Nodes.GetCount();
+  for (plUInt32 i = 0; i <= uiNumNodes;)
+  {
+    while (!openContainers.IsEmpty() && openContainers.PeekBack().m_uiEnd == i)
+    {
+      if (openContainers.PeekBack().m_bObject)
+        OnEndObject();
+      else
+        OnEndArray();
+
+      openContainers.PopBack();
+    }
+
+    if (i == uiNumNodes)
+      break;
+
+    const plJSONDocument::Node& node = doc.m_Nodes[i];
+
+    if (!openContainers.IsEmpty() && openContainers.PeekBack().m_bObject && !OnVariable(node.m_sName))
+    {
+      i = node.m_uiEnd;
+      continue;
+    }
+
+    switch (node.m_Type)
+    {
+      case plJSONDocument::ValueType::Null:
+        OnReadValueNULL();
+        break;
+      case plJSONDocument::ValueType::Bool:
+        OnReadValue(node.m_bBool);
+        break;
+      case plJSONDocument::ValueType::Number:
+        OnReadValue(node.m_fNumber);
+        break;
+      case plJSONDocument::ValueType::String:
+        OnReadValue(node.m_sString);
+        break;
+      case plJSONDocument::ValueType::Object:
+        OnBeginObject();
+        openContainers.PushBack({node.m_uiEnd, true});
+        break;
+      case plJSONDocument::ValueType::Array:
+        OnBeginArray();
+        openContainers.PushBack({node.m_uiEnd, false});
+        break;
+
+        PL_DEFAULT_CASE_NOT_IMPLEMENTED;
+    }
+
+    ++i;
+  }
+
+  m_BufferedInput.Clear();
+  return true;
+}
+
 void plJSONParser::ParsingError(plStringView sMessage, bool bFatal)
 {
   if (bFatal)
@@ -555,7 +642,8 @@ void plJSONParser::SkipString()
 
   do
   {
-    bEscapeSequence = (m_uiCurByte == '\\');
+    // a backslash that is itself escaped does not start an escape sequence
+    bEscapeSequence = !bEscapeSequence && (m_uiCurByte == '\\');
 
     m_uiCurByte = '\0';
 
@@ -14,10 +14,11 @@ plResult plJSONReader::Parse(plStreamReader& ref_inputStream, plUInt32 uiFirstLi
   m_Stack.Clear();
   m_sLastName.Clear();
 
-  SetInputStream(ref_inputStream, uiFirstLineOffset);
-
-  while (!m_bParsingError && ContinueParsing())
+  if (!ParseBuffered(ref_inputStream, uiFirstLineOffset))
   {
+    while (!m_bParsingError && ContinueParsing())
+    {
+    }
   }
 
   if (m_bParsingError)
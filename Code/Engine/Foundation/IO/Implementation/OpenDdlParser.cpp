@@ -805,6 +805,10 @@ void plOpenDdlParser::ContinueString()
         SkipString();
       }
 
+      // an unterminated string stops parsing, neither the partial string nor anything after it must be processed
+      if (m_bHadFatalParsingError)
+        return;
+
       SkipWhitespace();
 
       if (!m_bSkippingMode)
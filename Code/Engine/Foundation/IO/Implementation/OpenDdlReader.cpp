@@ -1,6 +1,296 @@
 #include <Foundation/FoundationPCH.h>
 
+#include <Foundation/IO/MemoryMappedFile.h>
+#include <Foundation/IO/MemoryStream.h>
+#include <Foundation/IO/OSFile.h>
 #include <Foundation/IO/OpenDdlReader.h>
+#include <Foundation/Utilities/ConversionUtils.h>
+
+namespace
+{
+  enum OpenDdlCharClass : plUInt8
+  {
+    Identifier = PL_BIT(0), ///< a-z A-Z 0-9 _ : .
+    Whitespace = PL_BIT(1), ///< 1 to 32, like plStringUtils::IsWhiteSpace()
+    Digit = PL_BIT(2),      ///< 0-9
+    HexDigit = PL_BIT(3),   ///< 0-9 a-f A-F
+    FloatChar = PL_BIT(4),  ///< everything the parser reads as part of a decimal float: 0-9 . e E + - _
+    WordChar = PL_BIT(5),   ///< everything that is not an identifier delimiter in C code: a-z A-Z 0-9 _
+  };
+
+  struct OpenDdlCharTable
+  {
+    constexpr OpenDdlCharTable()
+    {
+      for (plUInt32 c = 1; c <= 32; ++c)
+        m_Classes[c] |= Whitespace;
+
+      for (plUInt32 c = '0'; c <= '9'; ++c)
+        m_Classes[c] |= Identifier | Digit | HexDigit | FloatChar | WordChar;
+
+      for (plUInt32 c = 'a'; c <= 'z'; ++c)
+        m_Classes[c] |= Identifier | WordChar;
+
+      for (plUInt32 c = 'A'; c <= 'Z'; ++c)
+        m_Classes[c] |= Identifier | WordChar;
+
+      for (plUInt32 c = 'a'; c <= 'f'; ++c)
+        m_Classes[c] |= HexDigit;
+
+      for (plUInt32 c = 'A'; c <= 'F'; ++c)
+        m_Classes[c] |= HexDigit;
+
+      m_Classes['_'] |= Identifier | FloatChar | WordChar;
+      m_Classes[':'] |= Identifier;
+      m_Classes['.'] |= Identifier | FloatChar;
+      m_Classes['e'] |= FloatChar;
+      m_Classes['E'] |= FloatChar;
+      m_Classes['+'] |= FloatChar;
+      m_Classes['-'] |= FloatChar;
+    }
+
+    plUInt8 m_Classes[256] = {};
+  };
+
+  static constexpr OpenDdlCharTable s_OpenDdlChars;
+} // namespace
+
+static PL_ALWAYS_INLINE bool OpenDdlIs(char c, plUInt8 uiClass)
+{
+  return (s_OpenDdlChars.m_Classes[static_cast<plUInt8>(c)] & uiClass) != 0;
+}
+
+static PL_ALWAYS_INLINE const char* OpenDdlSkipClass(const char* pCur, const char* pEnd, plUInt8 uiClass)
+{
+  while (pCur < pEnd && OpenDdlIs(*pCur, uiClass))
+    ++pCur;
+
+  return pCur;
+}
+
+/// \brief Skips whitespace and comments. Fails for things that the stream parser handles differently, e.g. a single '/' or an unterminated comment.
+static plResult OpenDdlSkipWhitespace(const char*& ref_pCur, const char* pEnd)
+{
+  while (true)
+  {
+    ref_pCur = OpenDdlSkipClass(ref_pCur, pEnd, Whitespace);
+
+    if (ref_pCur == pEnd || *ref_pCur != '/')
+      return PL_SUCCESS;
+
+    if (ref_pCur + 1 == pEnd)
+      return PL_FAILURE;
+
+    if (ref_pCur[1] == '/')
+    {
+      const void* pLineEnd = memchr(ref_pCur, '\n', pEnd - ref_pCur);
+      ref_pCur = pLineEnd ? static_cast<const char*>(pLineEnd) : pEnd;
+    }
+    else if (ref_pCur[1] == '*')
+    {
+      ref_pCur += 2;
+
+      while (true)
+      {
+        const char* pStar = static_cast<const char*>(memchr(ref_pCur, '*', pEnd - ref_pCur));
+        if (pStar == nullptr || pStar + 1 == pEnd)
+          return PL_FAILURE;
+
+        ref_pCur = pStar + 1;
+
+        if (*ref_pCur == '/')
+        {
+          ++ref_pCur;
+          break;
+        }
+      }
+    }
+    else
+    {
+      return PL_FAILURE;
+    }
+  }
+}
+
+/// \brief Skips the whitespace after a value. Values directly followed by a comment are left to the stream parser, which would append what comes after the comment.
+static PL_ALWAYS_INLINE plResult OpenDdlSkipWhitespaceAfterValue(const char*& ref_pCur, const char* pEnd)
+{
+  if (ref_pCur < pEnd && *ref_pCur == '/')
+    return PL_FAILURE;
+
+  return OpenDdlSkipWhitespace(ref_pCur, pEnd);
+}
+
+static plResult OpenDdlReadIdentifier(const char*& ref_pCur, const char* pEnd, plStringView& out_sIdentifier)
+{
+  const char* pStart = ref_pCur;
+  ref_pCur = OpenDdlSkipClass(ref_pCur, pEnd, Identifier);
+
+  // empty and overlong identifiers are errors or warnings
+  if (ref_pCur == pStart || ref_pCur - pStart >= 64)
+    return PL_FAILURE;
+
+  out_sIdentifier = plStringView(pStart, ref_pCur);
+  return OpenDdlSkipWhitespace(ref_pCur, pEnd);
+}
+
+static plOpenDdlPrimitiveType OpenDdlGetPrimitiveType(plStringView sType)
+{
+  // the same names that plOpenDdlParser accepts
+  struct TypeName
+  {
+    const char* m_szName;
+    plOpenDdlPrimitiveType m_Type;
+  };
+
+  static constexpr TypeName s_TypeNames[] = {
+    {"u1", plOpenDdlPrimitiveType::UInt8},
+    {"unsigned_int8", plOpenDdlPrimitiveType::UInt8},
+    {"uint8", plOpenDdlPrimitiveType::UInt8},
+    {"u2", plOpenDdlPrimitiveType::UInt16},
+    {"unsigned_int16", plOpenDdlPrimitiveType::UInt16},
+    {"uint16", plOpenDdlPrimitiveType::UInt16},
+    {"u3", plOpenDdlPrimitiveType::UInt32},
+    {"unsigned_int32", plOpenDdlPrimitiveType::UInt32},
+    {"uint32", plOpenDdlPrimitiveType::UInt32},
+    {"u4", plOpenDdlPrimitiveType::UInt64},
+    {"unsigned_int64", plOpenDdlPrimitiveType::UInt64},
+    {"uint64", plOpenDdlPrimitiveType::UInt64},
+    {"i1", plOpenDdlPrimitiveType::Int8},
+    {"int8", plOpenDdlPrimitiveType::Int8},
+    {"i2", plOpenDdlPrimitiveType::Int16},
+    {"int16", plOpenDdlPrimitiveType::Int16},
+    {"i3", plOpenDdlPrimitiveType::Int32},
+    {"int32", plOpenDdlPrimitiveType::Int32},
+    {"i4", plOpenDdlPrimitiveType::Int64},
+    {"int64", plOpenDdlPrimitiveType::Int64},
+    {"f", plOpenDdlPrimitiveType::Float},
+    {"float", plOpenDdlPrimitiveType::Float},
+    {"d", plOpenDdlPrimitiveType::Double},
+    {"double", plOpenDdlPrimitiveType::Double},
+    {"s", plOpenDdlPrimitiveType::String},
+    {"string", plOpenDdlPrimitiveType::String},
+    {"b", plOpenDdlPrimitiveType::Bool},
+    {"bool", plOpenDdlPrimitiveType::Bool},
+  };
+
+  // all primitive type names are short, custom types usually aren't
+  if (sType.GetElementCount() <= 14)
+  {
+    for (const TypeName& typeName : s_TypeNames)
+    {
+      if (sType == typeName.m_szName)
+        return typeName.m_Type;
+    }
+  }
+
+  return plOpenDdlPrimitiveType::Custom;
+}
+
+/// \brief Converts 8 ASCII digits at once. All 8 bytes must be digits.
+static PL_ALWAYS_INLINE plUInt32 OpenDdlParseEightDigits(const char* p)
+{
+  plUInt64 v;
+  memcpy(&v, p, 8);
+
+  v -= 0x3030303030303030ull;
+  v = (v * 10) + (v >> 8);
+  v = (((v & 0x000000FF000000FFull) * (100 + (1000000ull << 32))) + (((v >> 16) & 0x000000FF000000FFull) * (1 + (10000ull << 32)))) >> 32;
+
+  return static_cast<plUInt32>(v);
+}
+
+static PL_ALWAYS_INLINE bool OpenDdlAreEightDigits(const char* p)
+{
+  plUInt64 v;
+  memcpy(&v, p, 8);
+
+  return ((v & 0xF0F0F0F0F0F0F0F0ull) | (((v + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4)) == 0x3333333333333333ull;
+}
+
+/// \brief Reads digits into a 64 bit value, 8 digits at a time where possible. Overflows wrap around, just like in the stream parser.
+///
+/// Underscores are skipped if bAllowUnderscores is set. Returns the number of digits that were read.
+static plUInt32 OpenDdlReadDigits(const char*& ref_pCur, const char* pEnd, plUInt64& inout_uiValue, bool bAllowUnderscores)
+{
+  plUInt32 uiNumDigits = 0;
+
+  while (true)
+  {
+    while (pEnd - ref_pCur >= 8 && OpenDdlAreEightDigits(ref_pCur))
+    {
+      inout_uiValue = inout_uiValue * 100000000ull + OpenDdlParseEightDigits(ref_pCur);
+      ref_pCur += 8;
+      uiNumDigits += 8;
+    }
+
+    if (ref_pCur == pEnd)
+      return uiNumDigits;
+
+    const char c = *ref_pCur;
+
+    if (c >= '0' && c <= '9')
+    {
+      inout_uiValue = inout_uiValue * 10 + (c - '0');
+      ++uiNumDigits;
+    }
+    else if (c != '_' || !bAllowUnderscores)
+    {
+      return uiNumDigits;
+    }
+
+    ++ref_pCur;
+  }
+}
+
+/// \brief Same result as plConversionUtils::StringToFloat(), but only supports digits with an optional '.' and is much faster.
+static plResult OpenDdlParseSimpleFloat(plStringView sText, double& out_fValue)
+{
+  const char* pCur = sText.GetStartPointer();
+  const char* pEnd = sText.GetEndPointer();
+
+  plUInt64 uiIntegerPart = 0;
+  OpenDdlReadDigits(pCur, pEnd, uiIntegerPart, false);
+
+  plUInt64 uiFractionalPart = 0;
+  plUInt64 uiFractionDivisor = 1;
+
+  if (pCur < pEnd && *pCur == '.')
+  {
+    ++pCur;
+    const plUInt32 uiNumDigits = OpenDdlReadDigits(pCur, pEnd, uiFractionalPart, false);
+
+    for (plUInt32 i = 0; i < uiNumDigits; ++i)
+      uiFractionDivisor *= 10;
+  }
+
+  if (pCur != pEnd)
+    return PL_FAILURE;
+
+  out_fValue = (double)uiIntegerPart + (double)uiFractionalPart / (double)uiFractionDivisor;
+  return PL_SUCCESS;
+}
+
+/// \brief Converts pairs of hex digits into bytes, 8 digits at a time. Only valid for exactly 2 * uiNumBytes hex digits.
+static void OpenDdlParseHexBytes(const char* pHex, plUInt8* pBinary, plUInt32 uiNumBytes)
+{
+  for (plUInt32 i = 0; i < uiNumBytes; i += 4)
+  {
+    plUInt64 v;
+    memcpy(&v, pHex + i * 2, 8);
+
+    // '0'-'9' are 0x30-0x39, 'a'-'f' and 'A'-'F' have bit 6 set and need an extra 9 on top of their low nibble
+    v = (v & 0x0F0F0F0F0F0F0F0Full) + ((v >> 6) & 0x0101010101010101ull) * 9;
+
+    // combine the nibble pairs to bytes and move them together
+    v = ((v & 0x000F000F000F000Full) << 4) | ((v >> 8) & 0x000F000F000F000Full);
+    v = (v | (v >> 8)) & 0x0000FFFF0000FFFFull;
+    v = (v | (v >> 16)) & 0x00000000FFFFFFFFull;
+
+    const plUInt32 uiBytes = static_cast<plUInt32>(v);
+    memcpy(pBinary + i, &uiBytes, 4);
+  }
+}
 
 plOpenDdlReader::plOpenDdlReader()
 {
@@ -37,6 +327,63 @@ plResult plOpenDdlReader::ParseDocument(plStreamReader& inout_stream, plUInt32 u
   return ParseAll();
 }
 
+plResult plOpenDdlReader::ParseDocument(plArrayPtr<const char> input, plUInt32 uiFirstLineOffset, plLogInterface* pLog)
+{
+  PL_ASSERT_DEBUG(m_ObjectStack.IsEmpty(), "A reader can only be used once.");
+
+  const char* pStart = input.GetPtr();
+  const char* pEnd = pStart + input.GetCount();
+
+  // like the stream parser, stop at the first zero byte
+  if (const void* pZero = input.IsEmpty() ? nullptr : memchr(pStart, '\0', input.GetCount()))
+  {
+    pEnd = static_cast<const char*>(pZero);
+  }
+
+  // large documents need lots of elements, so use larger chunks
+  m_uiChunkSize = plMath::Clamp<plUInt32>(input.GetCount() / 4, s_uiChunkSize, 1024 * 1024);
+
+  if (ParseInPlace(pStart, pEnd).Succeeded())
+    return PL_SUCCESS;
+
+  // the document contains something that only the stream parser handles, start over with that
+  m_ObjectStack.Clear();
+  m_GlobalNames.Clear();
+  ClearDataChunks();
+  m_uiChunkSize = s_uiChunkSize;
+
+  plRawMemoryStreamReader stream(input.GetPtr(), input.GetCount());
+  return ParseDocument(stream, uiFirstLineOffset, pLog);
+}
+
+plResult plOpenDdlReader::ParseFile(plStringView sAbsolutePath, plLogInterface* pLog)
+{
+  plOSFile file;
+  if (file.Open(sAbsolutePath, plFileOpenMode::Read).Failed())
+  {
+    plLog::Error(pLog, "Could not open '{}' for reading.", sAbsolutePath);
+    return PL_FAILURE;
+  }
+
+#if PL_ENABLED(PL_SUPPORTS_MEMORY_MAPPED_FILE)
+  // empty files can't be mapped
+  if (file.GetFileSize() > 0)
+  {
+    file.Close();
+
+    m_pMappedFile = PL_DEFAULT_NEW(plMemoryMappedFile);
+    if (m_pMappedFile->Open(sAbsolutePath, plMemoryMappedFile::Mode::ReadOnly).Failed())
+      return PL_FAILURE;
+
+    const char* pData = static_cast<const char*>(m_pMappedFile->GetReadPointer());
+    return ParseDocument(plArrayPtr<const char>(pData, static_cast<plUInt32>(m_pMappedFile->GetFileSize())), 0, pLog);
+  }
+#endif
+
+  file.ReadAll(m_FileContent);
+  return ParseDocument(plArrayPtr<const char>(reinterpret_cast<const char*>(m_FileContent.GetData()), m_FileContent.GetCount()), 0, pLog);
+}
+
 const plOpenDdlReaderElement* plOpenDdlReader::GetRootElement() const
 {
   PL_ASSERT_DEBUG(!m_ObjectStack.IsEmpty(), "The reader has not parsed any document yet or an error occurred during parsing.");
@@ -71,6 +418,15 @@ plOpenDdlReaderElement* plOpenDdlReader::CreateElement(plOpenDdlPrimitiveType ty
   pElement->m_sName = CopyString(sName);
   pElement->m_uiNumChildElements = 0;
 
+  AddChildElement(pElement, sName, bGlobalName);
+
+  m_ObjectStack.PushBack(pElement);
+
+  return pElement;
+}
+
+void plOpenDdlReader::AddChildElement(plOpenDdlReaderElement* pElement, plStringView sName, bool bGlobalName)
+{
   if (bGlobalName)
   {
     pElement->m_uiNumChildElements = PL_BIT(31);
@@ -94,10 +450,6 @@ plOpenDdlReaderElement* plOpenDdlReader::CreateElement(plOpenDdlPrimitiveType ty
     ((plOpenDdlReaderElement*)pParent->m_pLastChild)->m_pSiblingElement = pElement;
     pParent->m_pLastChild = pElement;
   }
-
-  m_ObjectStack.PushBack(pElement);
-
-  return pElement;
 }
 
 
@@ -257,6 +609,355 @@ void plOpenDdlReader::OnParsingError(plStringView sMessage, bool bFatal, plUInt3
 
 //////////////////////////////////////////////////////////////////////////
 
+plResult plOpenDdlReader::ParseInPlace(const char* pCur, const char* pEnd)
+{
+  plOpenDdlReaderElement* pRoot = new (AllocateBytes(sizeof(plOpenDdlReaderElement))) plOpenDdlReaderElement();
+  pRoot->m_sCustomType = "root";
+
+  m_ObjectStack.PushBack(pRoot);
+
+  PL_SUCCEED_OR_RETURN(OpenDdlSkipWhitespace(pCur, pEnd));
+
+  while (pCur < pEnd)
+  {
+    if (*pCur == '}')
+    {
+      // more objects closed than opened
+      if (m_ObjectStack.GetCount() == 1)
+        return PL_FAILURE;
+
+      m_ObjectStack.PopBack();
+
+      ++pCur;
+      PL_SUCCEED_OR_RETURN(OpenDdlSkipWhitespace(pCur, pEnd));
+      continue;
+    }
+
+    plStringView sType;
+    plStringView sName;
+    bool bGlobalName = false;
+
+    PL_SUCCEED_OR_RETURN(OpenDdlReadIdentifier(pCur, pEnd, sType));
+
+    if (pCur < pEnd && (*pCur == '%' || *pCur == '$'))
+    {
+      bGlobalName = *pCur == '$';
+
+      ++pCur;
+      PL_SUCCEED_OR_RETURN(OpenDdlReadIdentifier(pCur, pEnd, sName));
+    }
+
+    if (pCur == pEnd || *pCur != '{')
+      return PL_FAILURE;
+
+    ++pCur;
+    PL_SUCCEED_OR_RETURN(OpenDdlSkipWhitespace(pCur, pEnd));
+
+    const plOpenDdlPrimitiveType type = OpenDdlGetPrimitiveType(sType);
+
+    plOpenDdlReaderElement* pElement = new (AllocateBytes(sizeof(plOpenDdlReaderElement))) plOpenDdlReaderElement();
+    pElement->m_PrimitiveType = type;
+    pElement->m_sName = sName;
+
+    if (type == plOpenDdlPrimitiveType::Custom)
+    {
+      pElement->m_sCustomType = sType;
+    }
+
+    AddChildElement(pElement, sName, bGlobalName);
+
+    if (type == plOpenDdlPrimitiveType::Custom)
+    {
+      m_ObjectStack.PushBack(pElement);
+    }
+    else
+    {
+      PL_SUCCEED_OR_RETURN(ReadPrimitivesInPlace(pCur, pEnd, pElement));
+    }
+  }
+
+  // all objects must be closed at the end of the document
+  return m_ObjectStack.GetCount() == 1 ? PL_SUCCESS : PL_FAILURE;
+}
+
+plResult plOpenDdlReader::ReadPrimitivesInPlace(const char*& ref_pCur, const char* pEnd, plOpenDdlReaderElement* pElement)
+{
+  const plOpenDdlPrimitiveType type = pElement->m_PrimitiveType;
+  const char*& pCur = ref_pCur;
+
+  m_TempCache.Clear();
+  plUInt32 uiCount = 0;
+
+  auto Append = [&](const auto& value)
+  {
+    const plUInt32 uiOffset = m_TempCache.GetCount();
+    m_TempCache.SetCountUninitialized(uiOffset + sizeof(value));
+    memcpy(&m_TempCache[uiOffset], &value, sizeof(value));
+    ++uiCount;
+  };
+
+  while (true)
+  {
+    if (pCur == pEnd)
+      return PL_FAILURE;
+
+    if (*pCur == '}')
+    {
+      ++pCur;
+      PL_SUCCEED_OR_RETURN(OpenDdlSkipWhitespace(pCur, pEnd));
+      break;
+    }
+
+    if (*pCur == ',')
+    {
+      ++pCur;
+      PL_SUCCEED_OR_RETURN(OpenDdlSkipWhitespace(pCur, pEnd));
+      continue;
+    }
+
+    switch (type)
+    {
+      case plOpenDdlPrimitiveType::Bool:
+      {
+        const char c = *pCur;
+        if (c != '1' && c != '0' && c != 'f' && c != 't')
+          return PL_FAILURE;
+
+        const char* pStart = pCur;
+        pCur = OpenDdlSkipClass(pCur + 1, pEnd, WordChar);
+
+        bool bValue = false;
+        if (plConversionUtils::StringToBool(plStringView(pStart, pCur), bValue).Failed())
+          return PL_FAILURE;
+
+        PL_SUCCEED_OR_RETURN(OpenDdlSkipWhitespaceAfterValue(pCur, pEnd));
+        Append(bValue);
+        break;
+      }
+
+      case plOpenDdlPrimitiveType::Int8:
+      case plOpenDdlPrimitiveType::Int16:
+      case plOpenDdlPrimitiveType::Int32:
+      case plOpenDdlPrimitiveType::Int64:
+      case plOpenDdlPrimitiveType::UInt8:
+      case plOpenDdlPrimitiveType::UInt16:
+      case plOpenDdlPrimitiveType::UInt32:
+      case plOpenDdlPrimitiveType::UInt64:
+      {
+        plInt8 sign = 1;
+
+        if (*pCur == '-' || *pCur == '+')
+        {
+          sign = (*pCur == '-') ? -1 : 1;
+          ++pCur;
+        }
+
+        // HEX, octal, binary and character literals are not supported, whitespace after the sign is a warning
+        if (pCur == pEnd || *pCur < '0' || *pCur > '9')
+          return PL_FAILURE;
+        if (*pCur == '0' && pCur + 1 < pEnd && (pCur[1] == 'x' || pCur[1] == 'X' || pCur[1] == 'o' || pCur[1] == 'O' || pCur[1] == 'b' || pCur[1] == 'B'))
+          return PL_FAILURE;
+
+        plUInt64 value = 0;
+        OpenDdlReadDigits(pCur, pEnd, value, true);
+        PL_SUCCEED_OR_RETURN(OpenDdlSkipWhitespaceAfterValue(pCur, pEnd));
+
+        // same conversions as in plOpenDdlParser::ContinueInt()
+        switch (type)
+        {
+          case plOpenDdlPrimitiveType::Int8:
+            Append(static_cast<plInt8>(sign * (plInt8)value));
+            break;
+          case plOpenDdlPrimitiveType::Int16:
+            Append(static_cast<plInt16>(sign * (plInt16)value));
+            break;
+          case plOpenDdlPrimitiveType::Int32:
+            Append(static_cast<plInt32>(sign * (plInt32)value));
+            break;
+          case plOpenDdlPrimitiveType::Int64:
+            Append(static_cast<plInt64>(sign * (plInt64)value));
+            break;
+          default:
+            // a negative sign on an unsigned type is a warning
+            if (sign < 0)
+              return PL_FAILURE;
+
+            if (type == plOpenDdlPrimitiveType::UInt8)
+              Append(static_cast<plUInt8>(value));
+            else if (type == plOpenDdlPrimitiveType::UInt16)
+              Append(static_cast<plUInt16>(value));
+            else if (type == plOpenDdlPrimitiveType::UInt32)
+              Append(static_cast<plUInt32>(value));
+            else
+              Append(static_cast<plUInt64>(value));
+            break;
+        }
+        break;
+      }
+
+      case plOpenDdlPrimitiveType::Float:
+      case plOpenDdlPrimitiveType::Double:
+      {
+        float sign = 1;
+
+        if (*pCur == '-' || *pCur == '+')
+        {
+          sign = (*pCur == '-') ? -1.0f : 1.0f;
+          ++pCur;
+        }
+
+        if (pCur == pEnd)
+          return PL_FAILURE;
+
+        double dValue = 0;
+        float fValue = 0;
+
+        if (*pCur == '0' && pCur + 1 < pEnd && (pCur[1] == 'x' || pCur[1] == 'X'))
+        {
+          // the exact binary representation, that's what plOpenDdlWriter writes by default
+          pCur += 2;
+
+          const char* pStart = pCur;
+          pCur = OpenDdlSkipClass(pCur, pEnd, HexDigit);
+
+          if (pCur == pStart)
+            return PL_FAILURE;
+
+          const plUInt32 uiNumBytes = (type == plOpenDdlPrimitiveType::Float) ? 4 : 8;
+          plUInt8* pTarget = (type == plOpenDdlPrimitiveType::Float) ? reinterpret_cast<plUInt8*>(&fValue) : reinterpret_cast<plUInt8*>(&dValue);
+
+          if (pCur - pStart == uiNumBytes * 2)
+            OpenDdlParseHexBytes(pStart, pTarget, uiNumBytes);
+          else
+            plConversionUtils::ConvertHexToBinary(plStringView(pStart, pCur), pTarget, uiNumBytes);
+        }
+        else if ((*pCur >= '0' && *pCur <= '9') || *pCur == '.')
+        {
+          if (*pCur == '0' && pCur + 1 < pEnd && (pCur[1] == 'o' || pCur[1] == 'O' || pCur[1] == 'b' || pCur[1] == 'B'))
+            return PL_FAILURE;
+
+          const char* pStart = pCur;
+          pCur = OpenDdlSkipClass(pCur + 1, pEnd, FloatChar);
+
+          const plStringView sValue(pStart, pCur);
+
+          if (OpenDdlParseSimpleFloat(sValue, dValue).Failed() && plConversionUtils::StringToFloat(sValue, dValue).Failed())
+            return PL_FAILURE;
+
+          fValue = (float)dValue;
+        }
+        else
+        {
+          return PL_FAILURE;
+        }
+
+        PL_SUCCEED_OR_RETURN(OpenDdlSkipWhitespaceAfterValue(pCur, pEnd));
+
+        if (type == plOpenDdlPrimitiveType::Float)
+          Append(sign * fValue);
+        else
+          Append(sign * dValue);
+        break;
+      }
+
+      case plOpenDdlPrimitiveType::String:
+      {
+        if (*pCur != '\"')
+          return PL_FAILURE;
+
+        const char* pStart = ++pCur;
+        bool bHasEscapes = false;
+
+        while (pCur < pEnd && *pCur != '\"')
+        {
+          if (*pCur == '\\')
+          {
+            bHasEscapes = true;
+            ++pCur;
+          }
+
+          ++pCur;
+        }
+
+        if (pCur >= pEnd)
+          return PL_FAILURE;
+
+        plStringView sValue(pStart, pCur);
+
+        if (bHasEscapes)
+        {
+          // only strings with escape sequences need to be copied
+          char* pTarget = reinterpret_cast<char*>(AllocateBytes(static_cast<plUInt32>(pCur - pStart)));
+          char* pWrite = pTarget;
+
+          for (const char* pRead = pStart; pRead < pCur; ++pRead)
+          {
+            if (*pRead != '\\')
+            {
+              *pWrite++ = *pRead;
+              continue;
+            }
+
+            switch (*++pRead)
+            {
+              case '\"':
+              case '\\':
+              case '/':
+                *pWrite++ = *pRead;
+                break;
+              case 'b':
+                *pWrite++ = '\b';
+                break;
+              case 'f':
+                *pWrite++ = '\f';
+                break;
+              case 'n':
+                *pWrite++ = '\n';
+                break;
+              case 'r':
+                *pWrite++ = '\r';
+                break;
+              case 't':
+                *pWrite++ = '\t';
+                break;
+              default:
+                // unicode literals and unknown escape sequences are warnings
+                return PL_FAILURE;
+            }
+          }
+
+          sValue = plStringView(pTarget, pWrite);
+        }
+
+        ++pCur;
+        PL_SUCCEED_OR_RETURN(OpenDdlSkipWhitespace(pCur, pEnd));
+        Append(sValue);
+        break;
+      }
+
+        PL_DEFAULT_CASE_NOT_IMPLEMENTED;
+    }
+  }
+
+  StorePrimitivesInPlace(pElement, uiCount);
+  return PL_SUCCESS;
+}
+
+void plOpenDdlReader::StorePrimitivesInPlace(plOpenDdlReaderElement* pElement, plUInt32 uiCount)
+{
+  if (uiCount > 0)
+  {
+    plUInt8* pTarget = AllocateBytes(m_TempCache.GetCount());
+    plMemoryUtils::Copy(pTarget, m_TempCache.GetData(), m_TempCache.GetCount());
+
+    pElement->m_pFirstChild = pTarget;
+  }
+
+  pElement->m_uiNumChildElements += uiCount;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
 void plOpenDdlReader::ClearDataChunks()
 {
   for (plUInt32 i = 0; i < m_DataChunks.GetCount(); ++i)
@@ -265,6 +966,9 @@ void plOpenDdlReader::ClearDataChunks()
   }
 
   m_DataChunks.Clear();
+
+  m_pCurrentChunk = nullptr;
+  m_uiBytesInChunkLeft = 0;
 }
 
 plUInt8* plOpenDdlReader::AllocateBytes(plUInt32 uiNumBytes)
@@ -272,7 +976,7 @@ plUInt8* plOpenDdlReader::AllocateBytes(plUInt32 uiNumBytes)
   uiNumBytes = plMemoryUtils::AlignSize(uiNumBytes, static_cast<plUInt32>(PL_ALIGNMENT_MINIMUM));
 
   // if the requested data is very large, just allocate it as an individual chunk
-  if (uiNumBytes > s_uiChunkSize / 2)
+  if (uiNumBytes > m_uiChunkSize / 2)
   {
     plUInt8* pResult = PL_DEFAULT_NEW_ARRAY(plUInt8, uiNumBytes).GetPtr();
     m_DataChunks.PushBack(pResult);
@@ -282,8 +986,8 @@ plUInt8* plOpenDdlReader::AllocateBytes(plUInt32 uiNumBytes)
   // if our current chunk is too small, discard the remaining free bytes and just allocate a new chunk
   if (m_uiBytesInChunkLeft < uiNumBytes)
   {
-    m_pCurrentChunk = PL_DEFAULT_NEW_ARRAY(plUInt8, s_uiChunkSize).GetPtr();
-    m_uiBytesInChunkLeft = s_uiChunkSize;
+    m_pCurrentChunk = PL_DEFAULT_NEW_ARRAY(plUInt8, m_uiChunkSize).GetPtr();
+    m_uiBytesInChunkLeft = m_uiChunkSize;
     m_DataChunks.PushBack(m_pCurrentChunk);
   }
 
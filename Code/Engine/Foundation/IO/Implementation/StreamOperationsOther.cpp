@@ -5,6 +5,7 @@
 #include <Foundation/Strings/HashedString.h>
 #include <Foundation/Time/Timestamp.h>
 #include <Foundation/Types/VarianceTypes.h>
+#include <Foundation/Types/VariantTypedArray.h>
 #include <Foundation/Types/VariantTypeRegistry.h>
 
 // plAllocator::Stats
@@ -338,3 +339,41 @@ void operator>>(plStreamReader& inout_stream, plVarianceTypeAngle& ref_value)
   inout_stream >> ref_value.m_fVariance;
   inout_stream >> ref_value.m_Value;
 }
+
+// plVariantTypedArray
+
+void operator<<(plStreamWriter& inout_stream, const plVariantTypedArray& value)
+{
+  inout_stream << (plUInt8)value.GetElementType();
+  inout_stream << value.m_Data.GetCount();
+  inout_stream.WriteBytes(value.m_Data.GetData(), value.m_Data.GetCount()).AssertSuccess();
+}
+void operator>>(plStreamReader& inout_stream, plVariantTypedArray& ref_value)
+{
+  plUInt8 uiElementType = 0;
+  plUInt32 uiNumBytes = 0;
+  inout_stream >> uiElementType;
+  inout_stream >> uiNumBytes;
+
+  const plVariantType::Enum elementType = static_cast<plVariantType::Enum>(uiElementType);
+  if (!plVariantTypedArray::IsElementTypeSupported(elementType) || uiNumBytes % plVariantTypedArray::GetElementSize(elementType) != 0)
+  {
+    plLog::Error("Invalid plVariantTypedArray data: element type {} with {} bytes", uiElementType, uiNumBytes);
+
+    // skip the data to keep the stream in sync
+    ref_value.Clear();
+    inout_stream.SkipBytes(uiNumBytes);
+    return;
+  }
+
+  ref_value.m_ElementType = elementType;
+  ref_value.m_Data.SetCountUninitialized(uiNumBytes);
+
+  const plUInt64 uiBytesRead = inout_stream.ReadBytes(ref_value.m_Data.GetData(), uiNumBytes);
+  if (uiBytesRead != uiNumBytes)
+  {
+    plLog::Error("Invalid plVariantTypedArray data: expected {} bytes, but the stream only contained {}", uiNumBytes, uiBytesRead);
+
+    ref_value.Clear();
+  }
+}
@@ -78,3 +78,11 @@ PL_FOUNDATION_DLL void operator<<(plStreamWriter& inout_stream, const plVariance
 
 /// \brief Operator to serialize plTimestamp objects.
 PL_FOUNDATION_DLL void operator>>(plStreamReader& inout_stream, plVarianceTypeAngle& ref_value);
+
+struct plVariantTypedArray;
+
+/// \brief Operator to serialize plVariantTypedArray objects.
+PL_FOUNDATION_DLL void operator<<(plStreamWriter& inout_stream, const plVariantTypedArray& value);
+
+/// \brief Operator to serialize plVariantTypedArray objects.
+PL_FOUNDATION_DLL void operator>>(plStreamReader& inout_stream, plVariantTypedArray& ref_value);
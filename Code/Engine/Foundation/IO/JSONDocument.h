@@ -0,0 +1,137 @@
+#pragma once
+
+#include <Foundation/Containers/DynamicArray.h>
+#include <Foundation/IO/Stream.h>
+
+class plLogInterface;
+
+/// \brief A read-only JSON document that is parsed in one go from a fully buffered input.
+///
+/// Parsing happens in two stages. The first stage finds the positions of all structural characters, strings and other values,
+/// 64 bytes at a time (with SSE2, if available). The second stage walks these positions and stores all values in a flat array,
+/// in document order. All strings are plStringViews into the input buffer, only strings that contain escape sequences are
+/// unescaped into a separate buffer. This makes it much faster than plJSONReader, which allocates a plVariant for every value.
+///
+/// Like plJSONParser, the document may contain // and /* */ comments and superfluous commas. Otherwise it has to be valid JSON,
+/// the top level element must be an object or an array.
+class PL_FOUNDATION_DLL plJSONDocument
+{
+  struct Node;
+
+public:
+  enum class ValueType : plUInt8
+  {
+    Invalid, ///< Returned for values that don't exist, e.g. the root of an empty document or a member that wasn't found.
+    Null,
+    Bool,
+    Number,
+    String,
+    Object,
+    Array,
+  };
+
+  /// \brief A lightweight handle to a value in a plJSONDocument. Only valid as long as the document isn't modified or destroyed.
+  class Value
+  {
+  public:
+    Value() = default;
+
+    ValueType GetType() const { return IsValid() ? GetNode().m_Type : ValueType::Invalid; }
+    bool IsValid() const { return m_pDocument != nullptr; }
+    bool IsNull() const { return GetType() == ValueType::Null; }
+    bool IsBool() const { return GetType() == ValueType::Bool; }
+    bool IsNumber() const { return GetType() == ValueType::Number; }
+    bool IsString() const { return GetType() == ValueType::String; }
+    bool IsObject() const { return GetType() == ValueType::Object; }
+    bool IsArray() const { return GetType() == ValueType::Array; }
+
+    /// \brief Returns the value of a boolean, or false for all other types.
+    bool GetBool() const { return IsBool() && GetNode().m_bBool; }
+
+    /// \brief Returns the value of a number, or 0 for all other types.
+    double GetNumber() const { return IsNumber() ? GetNode().m_fNumber : 0.0; }
+
+    /// \brief Returns the (unescaped) text of a string, or an empty string for all other types.
+    plStringView GetString() const { return IsString() ? GetNode().m_sString : plStringView(); }
+
+    /// \brief Returns the name of this value, if it is a member of an object.
+    plStringView GetName() const { return IsValid() ? GetNode().m_sName : plStringView(); }
+
+    /// \brief Returns the number of members of an object or elements of an array.
+    plUInt32 GetChildCount() const { return IsValid() ? GetNode().m_uiChildCount : 0; }
+
+    /// \brief Returns the first member of an object or the first element of an array.
+    Value GetFirstChild() const { return GetChildCount() > 0 ? Value(m_pDocument, m_uiIndex + 1) : Value(); }
+
+    /// \brief Returns the next member or element of the parent object or array.
+    Value GetNextSibling() const { return IsValid() && GetNode().m_uiNextSibling != 0 ? Value(m_pDocument, GetNode().m_uiNextSibling) : Value(); }
+
+    /// \brief Returns the member of an object with the given name. This is a linear search.
+    Value FindMember(plStringView sName) const;
+
+  private:
+    friend class plJSONDocument;
+
+    Value(const plJSONDocument* pDocument, plUInt32 uiIndex)
+      : m_pDocument(pDocument)
+      , m_uiIndex(uiIndex)
+    {
+    }
+
+    const Node& GetNode() const { return m_pDocument->m_Nodes[m_uiIndex]; }
+
+    const plJSONDocument* m_pDocument = nullptr;
+    plUInt32 m_uiIndex = 0;
+  };
+
+  /// \brief Parses the given buffer. The buffer is not copied, so it must stay alive and unchanged as long as the document is used.
+  ///
+  /// Errors are logged through pLog.
+  plResult Parse(plArrayPtr<const char> input, plLogInterface* pLog = nullptr);
+
+  /// \brief Reads the entire stream into an internal buffer and parses it.
+  plResult Parse(plStreamReader& ref_input, plLogInterface* pLog = nullptr);
+
+  /// \brief Removes all values.
+  void Clear();
+
+  /// \brief Returns the top level object or array. Invalid if the document is empty.
+  Value GetRoot() const { return m_Nodes.IsEmpty() ? Value() : Value(this, 0); }
+
+  /// \brief Returns the number of values in the document, including all objects and arrays.
+  plUInt32 GetValueCount() const { return m_Nodes.GetCount(); }
+
+private:
+  friend class plJSONParser;
+
+  struct Node
+  {
+    plStringView m_sName;
+    plStringView m_sString;
+    double m_fNumber = 0.0;
+    plUInt32 m_uiChildCount = 0;
+    plUInt32 m_uiNextSibling = 0; ///< 0 if this is the last child.
+    plUInt32 m_uiEnd = 0;         ///< Index of the first node after all children of this node.
+    ValueType m_Type = ValueType::Invalid;
+    bool m_bBool = false;
+  };
+
+  static void ReadAll(plStreamReader& ref_input, plDynamicArray<char>& out_buffer);
+
+  /// \brief Parses m_Input. Errors are only logged if bLogErrors is set.
+  plResult ParseBuffer(plLogInterface* pLog, bool bLogErrors);
+  /// \brief Finds the positions of all structural characters. Stops early and sets inout_bFoundComment, if a comment may start outside a string.
+  ///
+  /// Pass true for inout_bFoundComment after the comments were removed.
+  plResult BuildIndex(bool& inout_bFoundComment, const char*& out_szError, plUInt32& out_uiErrorOffset);
+  void RemoveComments();
+  plResult BuildNodes(const char*& out_szError, plUInt32& out_uiErrorOffset);
+  plResult ReadString(plUInt32 uiStructural, plStringView& out_sString);
+
+  plArrayPtr<const char> m_Input;
+  plDynamicArray<char> m_OwnedInput;
+  plDynamicArray<char> m_WithoutComments;
+  plDynamicArray<char> m_Unescaped;
+  plDynamicArray<plUInt32> m_Structurals;
+  plDynamicArray<Node> m_Nodes;
+};
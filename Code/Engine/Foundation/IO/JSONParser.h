@@ -2,6 +2,7 @@
 
 #include <Foundation/Basics.h>
 #include <Foundation/Containers/HybridArray.h>
+#include <Foundation/IO/MemoryStream.h>
 #include <Foundation/IO/Stream.h>
 
 class plLogInterface;
@@ -35,6 +36,17 @@ protected:
   /// \brief Calls ContinueParsing() in a loop until that returns false.
   void ParseAll();
 
+  /// \brief Reads the entire stream into memory and parses it with plJSONDocument, which is much faster for large documents.
+  ///
+  /// If that succeeds, the entire document has already been reported through the callbacks and true is returned.
+  /// Documents that plJSONDocument rejects (including all documents with errors) are not reported at all. Instead false is returned
+  /// and the parser is set up to parse the buffered stream incrementally, as if SetInputStream() had been called. The caller then
+  /// continues with ContinueParsing() or ParseAll(), so the callbacks and error messages are exactly the same as without buffering.
+  ///
+  /// SkipObject() and SkipArray() must not be called from the callbacks while the buffered document is reported,
+  /// return false from OnVariable() to skip a value instead.
+  bool ParseBuffered(plStreamReader& stream, plUInt32 uiFirstLineOffset = 0);
+
   /// \brief Skips the rest of the currently open object. No OnEndArray() and OnEndObject() calls will be done for this object,
   /// cleanup must be done manually.
   void SkipObject();
@@ -147,6 +159,8 @@ private:
 
   plStreamReader* m_pInput;
   plHybridArray<JSONState, 32> m_StateStack;
+  plDynamicArray<char> m_BufferedInput;
+  plRawMemoryStreamReader m_BufferedInputReader;
   plHybridArray<plUInt8, 4096> m_TempString;
 
   bool m_bSkippingMode;
@@ -5,6 +5,9 @@
 #include <Foundation/Containers/Map.h>
 #include <Foundation/IO/OpenDdlParser.h>
 #include <Foundation/Logging/Log.h>
+#include <Foundation/Types/UniquePtr.h>
+
+class plMemoryMappedFile;
 
 /// \brief Represents a single 'object' in a DDL document, e.g. either a custom type or a primitives list.
 class PL_FOUNDATION_DLL plOpenDdlReaderElement
@@ -130,6 +133,22 @@ public:
   plResult ParseDocument(plStreamReader& inout_stream, plUInt32 uiFirstLineOffset = 0, plLogInterface* pLog = plLog::GetThreadLocalLogSystem(),
     plUInt32 uiCacheSizeInKB = 4); // [tested]
 
+  /// \brief Parses the document directly from the given memory, without copying it.
+  ///
+  /// Names, custom type names and strings without escape sequences point into \a input, so the memory must stay valid and unchanged
+  /// as long as the reader is used. All elements and primitives are allocated from one arena, which is freed when the reader is destroyed.
+  /// This is much faster than parsing from a stream, especially for large documents with many primitives.
+  ///
+  /// The elements are created directly, the On... callbacks are not called. Documents that the fast path doesn't handle identically
+  /// (anything that produces a warning or an error, quoted identifiers, comments within values, ...) are parsed with the regular
+  /// stream parser instead, so the result and all reported errors are the same.
+  plResult ParseDocument(plArrayPtr<const char> input, plUInt32 uiFirstLineOffset = 0, plLogInterface* pLog = plLog::GetThreadLocalLogSystem());
+
+  /// \brief Memory maps the given file and parses it in place, see ParseDocument(plArrayPtr<const char>, ...).
+  ///
+  /// The file stays mapped as long as the reader exists. On platforms that don't support memory mapped files, the file is read into memory instead.
+  plResult ParseFile(plStringView sAbsolutePath, plLogInterface* pLog = plLog::GetThreadLocalLogSystem());
+
   /// \brief Every document has exactly one root element.
   const plOpenDdlReaderElement* GetRootElement() const; // [tested]
 
@@ -167,6 +186,12 @@ protected:
   plStringView CopyString(const plStringView& string);
   void StorePrimitiveData(bool bThisIsAll, plUInt32 bytecount, const plUInt8* pData);
 
+  void AddChildElement(plOpenDdlReaderElement* pElement, plStringView sName, bool bGlobalName);
+
+  plResult ParseInPlace(const char* pCur, const char* pEnd);
+  plResult ReadPrimitivesInPlace(const char*& ref_pCur, const char* pEnd, plOpenDdlReaderElement* pElement);
+  void StorePrimitivesInPlace(plOpenDdlReaderElement* pElement, plUInt32 uiCount);
+
   void ClearDataChunks();
   plUInt8* AllocateBytes(plUInt32 uiNumBytes);
 
@@ -175,6 +200,7 @@ protected:
   plHybridArray<plUInt8*, 16> m_DataChunks;
   plUInt8* m_pCurrentChunk;
   plUInt32 m_uiBytesInChunkLeft;
+  plUInt32 m_uiChunkSize = s_uiChunkSize;
 
   plDynamicArray<plUInt8> m_TempCache;
 
@@ -184,4 +210,7 @@ protected:
   plDeque<plString> m_Strings;
 
   plMap<plString, plOpenDdlReaderElement*> m_GlobalNames;
+
+  plUniquePtr<plMemoryMappedFile> m_pMappedFile;
+  plDynamicArray<plUInt8> m_FileContent;
 };
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <Foundation/Logging/Log.h>
+
+/// \brief Describes what plAsyncLog does when the log queue of a thread is full.
+struct PL_FOUNDATION_DLL plAsyncLogOverflow
+{
+  using StorageType = plUInt8;
+
+  enum Enum : plUInt8
+  {
+    Block,           ///< The logging thread waits until the background thread has made room. No message is ever lost.
+    DropNonCritical, ///< Warnings and less severe messages are dropped. Errors, serious warnings, groups and flushes wait.
+
+    Default = DropNonCritical
+  };
+};
+
+/// \brief Configuration for plAsyncLog::Startup().
+struct PL_FOUNDATION_DLL plAsyncLogConfig
+{
+  /// \brief The size of the queue of every thread that logs, in bytes. Rounded up to the next power of two.
+  plUInt32 m_uiQueueSize = 64 * 1024;
+
+  /// \brief What to do when a queue is full.
+  plAsyncLogOverflow::Enum m_Overflow = plAsyncLogOverflow::Default;
+};
+
+/// \brief Moves the work of the log writers off the threads that log.
+///
+/// Without it, plGlobalLog calls every registered log writer synchronously, so writing to the console or into a file happens on the
+/// logging thread and all threads that log serialize on the log writer mutex.
+/// While plAsyncLog is active, plGlobalLog instead copies each message into a lock-free queue that belongs to the logging thread.
+/// Every message gets a sequence number from a global atomic counter when it is published.
+/// A background thread takes the messages from all queues in the order in which they were logged and passes them to the log writers.
+/// Message counting and the global log override are still handled synchronously.
+///
+/// Messages that are logged on the background thread itself (e.g. by a log writer) are passed to the log writers directly.
+/// The platform crash handlers call FlushOnCrash(), so that messages that are still queued are written before the process goes down.
+class PL_FOUNDATION_DLL plAsyncLog
+{
+public:
+  /// \brief Starts the background thread. From now on all messages sent through plGlobalLog are passed on asynchronously.
+  static void Startup(const plAsyncLogConfig& config = {});
+
+  /// \brief Passes all queued messages to the log writers and stops the background thread.
+  static void Shutdown();
+
+  /// \brief Returns whether messages are currently passed on asynchronously.
+  static bool IsActive();
+
+  /// \brief Blocks until all messages that were logged before the call have been passed to the log writers.
+  static void Flush();
+
+  /// \brief Passes all queued messages to the log writers on the calling thread and switches to synchronous logging.
+  ///
+  /// Only meant to be called when the process crashed. Does nothing if plAsyncLog is not active.
+  static void FlushOnCrash();
+
+  /// \brief Returns how many messages were dropped because a queue was full, since the last Startup().
+  static plUInt32 GetDroppedMessageCount();
+
+private:
+  friend class plGlobalLog;
+  friend class plAsyncLogThread;
+
+  /// \brief Queues the message on the current thread. Returns false if the message must be passed to the log writers directly.
+  static bool Enqueue(const plLoggingEventData& le);
+
+  /// \brief Passes all queued messages to the log writers. The caller must hold the queue mutex, unless bAfterCrash is set.
+  ///
+  /// Never waits for threads that publish messages. After a crash, all messages that are visible are passed on, even if a thread never
+  /// finishes publishing an older one.
+  static void DrainQueues(bool bAfterCrash = false);
+};
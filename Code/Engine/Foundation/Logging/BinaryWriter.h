@@ -0,0 +1,133 @@
+#pragma once
+
+#include <Foundation/Containers/DynamicArray.h>
+#include <Foundation/Containers/HashTable.h>
+#include <Foundation/IO/MemoryMappedFile.h>
+#include <Foundation/Logging/Log.h>
+#include <Foundation/Time/Timestamp.h>
+#include <Foundation/Types/Delegate.h>
+
+namespace plLogWriter
+{
+  /// \brief A log writer that writes log messages into a compact binary file, which can be converted to text with plBinaryLogReader.
+  ///
+  /// Messages are collected in blocks. Within a block every distinct string (text, tag or group name) is stored only once and all numbers
+  /// are stored as variable length integers. Full blocks are compressed with zstd (if available) and appended to the file through a memory
+  /// mapping, so everything that was written out survives a crash of the process. Every block header stores the time range, the message
+  /// types and the threads of its messages, which allows readers to skip blocks without decompressing them.
+  ///
+  /// A block is written out when it is full, when a flush is requested (see plLog::Flush()), when its first message is older than a second,
+  /// and in EndLog().
+  ///
+  /// Create an instance of this class, register the LogMessageHandler at plLog and pass the pointer
+  /// to the instance as the pPassThrough argument to it.
+  class PL_FOUNDATION_DLL Binary
+  {
+  public:
+    ~Binary();
+
+    /// \brief Register this at plLog to write all log messages to the binary file.
+    void LogMessageHandler(const plLoggingEventData& eventData);
+
+    /// \brief Creates the given file (an absolute path) and from now on writes all incoming log messages into it.
+    ///
+    /// If the file can't be created, e.g. because another process writes to it, a number is appended to the file name.
+    void BeginLog(plStringView sFile);
+
+    /// \brief Writes out the last block and closes the file.
+    void EndLog();
+
+    /// \brief Returns the path of the file that was really opened. See BeginLog().
+    const plString& GetOpenedLogFile() const { return m_sFile; }
+
+    /// \brief Sets how many bytes of uncompressed data are collected before a block is compressed and written out.
+    void SetBlockSize(plUInt32 uiBlockSize) { m_uiBlockSize = uiBlockSize; }
+
+  private:
+    void FlushBlock();
+    plResult AppendToFile(plArrayPtr<const plUInt8> data0, plArrayPtr<const plUInt8> data1);
+    plUInt32 InternString(plStringView sText);
+
+    plString m_sFile;
+    plMemoryMappedFile m_File;
+    plUInt64 m_uiFileEnd = 0;
+    bool m_bWriting = false;
+
+    plTime m_StartTime;
+    plTime m_BlockStartTime;
+    plUInt32 m_uiBlockSize = 64 * 1024;
+
+    plDynamicArray<plUInt8> m_Block;
+    plDynamicArray<plUInt8> m_Compressed;
+    plHashTable<plString, plUInt32> m_Strings;
+    plUInt32 m_uiNumRecords = 0;
+    plInt64 m_iFirstTime = 0;
+    plInt64 m_iLastTime = 0;
+    plUInt64 m_uiThreadMask = 0;
+    plUInt16 m_uiTypeMask = 0;
+  };
+} // namespace plLogWriter
+
+/// \brief A single log message that was read by plBinaryLogReader. The strings point into memory of the reader.
+struct PL_FOUNDATION_DLL plBinaryLogEntry
+{
+  plLogMsgType::Enum m_EventType = plLogMsgType::None;
+  plUInt8 m_uiIndentation = 0;
+  plUInt32 m_uiThreadIndex = 0;
+  plTime m_Time; ///< Relative to plBinaryLogReader::GetStartTimestamp().
+  plStringView m_sText;
+  plStringView m_sTag;
+  double m_fSeconds = 0; ///< The duration of a log block, only set for plLogMsgType::EndGroup.
+};
+
+/// \brief Selects which entries plBinaryLogReader::ReadEntries() returns.
+struct PL_FOUNDATION_DLL plBinaryLogFilter
+{
+  /// \brief Messages that are less severe than this are skipped.
+  plLogMsgType::Enum m_LogLevel = plLogMsgType::All;
+
+  /// \brief If not zero, only entries of this thread are returned. See plLoggingEventData::m_uiThreadIndex.
+  plUInt32 m_uiThreadIndex = 0;
+
+  /// \brief Only entries in this time range are returned. The times are relative to plBinaryLogReader::GetStartTimestamp().
+  plTime m_StartTime = plTime::MakeZero();
+  plTime m_EndTime = plTime::MakeFromHours(1000000);
+
+  /// \brief Whether BeginGroup and EndGroup entries are returned.
+  bool m_bIncludeGroups = true;
+};
+
+/// \brief Reads log files that were written with plLogWriter::Binary.
+///
+/// The file is memory-mapped and only the blocks that may contain entries that pass the filter are decompressed.
+class PL_FOUNDATION_DLL plBinaryLogReader
+{
+public:
+  /// \brief Opens the given file (an absolute path) and checks its header.
+  plResult Open(plStringView sFile);
+
+  void Close();
+
+  /// \brief The time at which the log was started.
+  plTimestamp GetStartTimestamp() const { return m_StartTimestamp; }
+
+  using EntryCallback = plDelegate<void(const plBinaryLogEntry&)>;
+
+  /// \brief Calls the callback for every entry that passes the filter, in the order in which they were written.
+  ///
+  /// Fails if the file is corrupt. A log that wasn't closed properly is read up to the last block that was written completely.
+  plResult ReadEntries(const plBinaryLogFilter& filter, EntryCallback callback);
+
+  /// \brief Returns how many blocks ReadEntries() decompressed and how many it skipped, in the last call.
+  void GetBlockStats(plUInt32& out_uiReadBlocks, plUInt32& out_uiSkippedBlocks) const;
+
+private:
+  plResult ReadBlock(plArrayPtr<const plUInt8> data, plUInt32 uiNumRecords, plInt64 iFirstTime, const plBinaryLogFilter& filter, EntryCallback callback);
+
+  plMemoryMappedFile m_File;
+  plTimestamp m_StartTimestamp;
+  plDynamicArray<plUInt8> m_Decompressed;
+  plDynamicArray<plStringView> m_Strings;
+  plUInt32 m_uiReadBlocks = 0;
+  plUInt32 m_uiSkippedBlocks = 0;
+};
@@ -0,0 +1,490 @@
+#include <Foundation/FoundationPCH.h>
+
+#include <Foundation/Logging/AsyncLog.h>
+#include <Foundation/Memory/MemoryUtils.h>
+#include <Foundation/Threading/Thread.h>
+#include <Foundation/Threading/ThreadSignal.h>
+#include <Foundation/Threading/ThreadUtils.h>
+
+#include <atomic>
+
+namespace
+{
+  /// \brief The header of every message in a queue. It is followed by the tag and the text, both null-terminated.
+  struct plAsyncLogRecord
+  {
+    plUInt32 m_uiSize; ///< The size of the header, tag and text, rounded up to a multiple of 8. See plAsyncLogPaddingFlag.
+    plUInt32 m_uiSequence;
+    plUInt32 m_uiTextLength;
+    plUInt32 m_uiThreadIndex;
+    plInt8 m_EventType;
+    plUInt8 m_uiIndentation;
+    plUInt8 m_uiTagLength;
+    plUInt8 m_uiReserved;
+    double m_fSeconds;
+  };
+
+  /// \brief Set in m_uiSize when the rest of the queue up to its end is unused, because the next record didn't fit in there.
+  constexpr plUInt32 plAsyncLogPaddingFlag = 0x80000000u;
+
+  /// \brief Stored in plAsyncLogQueue::m_uiReservedSequence while the owning thread isn't publishing a message.
+  constexpr plUInt64 plAsyncLogNoReservation = 0xFFFFFFFFFFFFFFFFull;
+
+  /// \brief A single-producer single-consumer ring buffer. The producer is the thread that owns it, the consumer holds s_AsyncLogQueuesMutex.
+  ///
+  /// The read and write positions only ever grow (and wrap around at 2^32), the position in the buffer is masked with the capacity.
+  /// Both sides store their position with release semantics after they are done with the data, and load the other one with acquire semantics.
+  struct plAsyncLogQueue
+  {
+    plUInt8* m_pData = nullptr;
+    plUInt32 m_uiCapacity = 0;
+    std::atomic<plUInt32> m_uiWritePos = 0;
+    std::atomic<plUInt32> m_uiReadPos = 0;
+    std::atomic<plUInt64> m_uiReservedSequence = plAsyncLogNoReservation; ///< A lower bound for the sequence number of the message that is being published.
+    plUInt32 m_uiDrainEnd = 0;                                             ///< The write position when the current drain pass started. Only used by the consumer.
+    bool m_bOrphaned = false;                                              ///< The owning thread has exited, the queue is deleted once it is empty.
+    plAsyncLogQueue* m_pNext = nullptr;
+
+    plUInt32 GetWritePos() const { return m_uiWritePos.load(std::memory_order_acquire); }
+    plUInt32 GetReadPos() const { return m_uiReadPos.load(std::memory_order_acquire); }
+    bool IsEmpty() const { return GetReadPos() == GetWritePos(); }
+  };
+
+  /// \brief Releases the queue of a thread when the thread exits.
+  struct plAsyncLogThreadQueue
+  {
+    ~plAsyncLogThreadQueue();
+
+    plAsyncLogQueue* m_pQueue = nullptr;
+  };
+} // namespace
+
+static plMutex s_AsyncLogQueuesMutex;
+static plAsyncLogQueue* s_pAsyncLogQueues = nullptr;
+static plAsyncLogConfig s_AsyncLogConfig;
+static plAtomicBool s_bAsyncLogActive;
+static plAtomicBool s_bAsyncLogStopRequested;
+static plAtomicBool s_bAsyncLogThreadSleeping;
+static std::atomic<plUInt32> s_uiAsyncLogSequence = 0;
+static std::atomic<plUInt32> s_uiAsyncLogDrainedSequence = 0; ///< All messages with smaller sequence numbers have been passed on.
+static plAtomicInteger32 s_iAsyncLogDroppedMessages;
+static plInt32 s_iAsyncLogReportedDroppedMessages = 0;
+static plThreadSignal s_AsyncLogWakeUpSignal;
+static thread_local bool s_bIsAsyncLogThread = false;
+static thread_local plAsyncLogThreadQueue s_AsyncLogThreadQueue;
+
+static void DeleteLogQueue(plAsyncLogQueue* pQueue)
+{
+  delete[] pQueue->m_pData;
+  delete pQueue;
+}
+
+plAsyncLogThreadQueue::~plAsyncLogThreadQueue()
+{
+  if (m_pQueue == nullptr)
+    return;
+
+  PL_LOCK(s_AsyncLogQueuesMutex);
+
+  if (!m_pQueue->IsEmpty())
+  {
+    // the background thread (or the next Startup) will deliver the remaining messages and then delete the queue
+    m_pQueue->m_bOrphaned = true;
+    return;
+  }
+
+  for (plAsyncLogQueue** ppQueue = &s_pAsyncLogQueues; *ppQueue != nullptr; ppQueue = &(*ppQueue)->m_pNext)
+  {
+    if (*ppQueue == m_pQueue)
+    {
+      *ppQueue = m_pQueue->m_pNext;
+      break;
+    }
+  }
+
+  DeleteLogQueue(m_pQueue);
+}
+
+static plAsyncLogQueue* CreateLogQueue()
+{
+  // use new, not PL_DEFAULT_NEW, the queues live as long as their threads, which may be longer than the allocators
+  plAsyncLogQueue* pQueue = new plAsyncLogQueue;
+  pQueue->m_uiCapacity = plMath::PowerOfTwo_Ceil(plMath::Max(s_AsyncLogConfig.m_uiQueueSize, 4096u));
+  pQueue->m_pData = new plUInt8[pQueue->m_uiCapacity];
+
+  PL_LOCK(s_AsyncLogQueuesMutex);
+  pQueue->m_pNext = s_pAsyncLogQueues;
+  s_pAsyncLogQueues = pQueue;
+
+  return pQueue;
+}
+
+/// \brief Returns the oldest record in the queue that was published before the current drain pass started, skipping padding at the end
+/// of the buffer. Must only be called by the consumer.
+static const plAsyncLogRecord* PeekLogRecord(plAsyncLogQueue* pQueue)
+{
+  while (pQueue->GetReadPos() != pQueue->m_uiDrainEnd)
+  {
+    const plUInt32 uiReadPos = pQueue->GetReadPos();
+    const plAsyncLogRecord* pRecord = reinterpret_cast<const plAsyncLogRecord*>(pQueue->m_pData + (uiReadPos & (pQueue->m_uiCapacity - 1)));
+
+    if ((pRecord->m_uiSize & plAsyncLogPaddingFlag) == 0)
+      return pRecord;
+
+    pQueue->m_uiReadPos.store(uiReadPos + (pRecord->m_uiSize & ~plAsyncLogPaddingFlag), std::memory_order_release);
+  }
+
+  return nullptr;
+}
+
+static bool HasQueuedLogMessages()
+{
+  PL_LOCK(s_AsyncLogQueuesMutex);
+
+  for (plAsyncLogQueue* pQueue = s_pAsyncLogQueues; pQueue != nullptr; pQueue = pQueue->m_pNext)
+  {
+    if (!pQueue->IsEmpty())
+      return true;
+  }
+
+  return false;
+}
+
+static bool IsPublishingLogMessage()
+{
+  PL_LOCK(s_AsyncLogQueuesMutex);
+
+  for (plAsyncLogQueue* pQueue = s_pAsyncLogQueues; pQueue != nullptr; pQueue = pQueue->m_pNext)
+  {
+    if (pQueue->m_uiReservedSequence.load(std::memory_order_seq_cst) != plAsyncLogNoReservation)
+      return true;
+  }
+
+  return false;
+}
+
+class plAsyncLogThread : public plThread
+{
+public:
+  plAsyncLogThread()
+    : plThread("plAsyncLog")
+  {
+  }
+
+private:
+  virtual plUInt32 Run() override
+  {
+    s_bIsAsyncLogThread = true;
+
+    while (!s_bAsyncLogStopRequested)
+    {
+      {
+        PL_LOCK(s_AsyncLogQueuesMutex);
+        plAsyncLog::DrainQueues();
+      }
+
+      // producers only raise the signal while this flag is set, so it has to be set before checking for new messages
+      s_bAsyncLogThreadSleeping = true;
+
+      if (!HasQueuedLogMessages() && !s_bAsyncLogStopRequested)
+      {
+        s_AsyncLogWakeUpSignal.WaitForSignal(plTime::MakeFromMilliseconds(100));
+      }
+
+      s_bAsyncLogThreadSleeping = false;
+    }
+
+    {
+      PL_LOCK(s_AsyncLogQueuesMutex);
+      plAsyncLog::DrainQueues();
+    }
+
+    s_bIsAsyncLogThread = false;
+    return 0;
+  }
+};
+
+static plAsyncLogThread* s_pAsyncLogThread = nullptr;
+
+void plAsyncLog::Startup(const plAsyncLogConfig& config)
+{
+  PL_ASSERT_DEV(s_pAsyncLogThread == nullptr, "plAsyncLog is already running.");
+
+  s_AsyncLogConfig = config;
+  s_iAsyncLogDroppedMessages = 0;
+  s_iAsyncLogReportedDroppedMessages = 0;
+  s_bAsyncLogStopRequested = false;
+
+  s_pAsyncLogThread = PL_DEFAULT_NEW(plAsyncLogThread);
+  s_pAsyncLogThread->Start();
+
+  s_bAsyncLogActive = true;
+}
+
+void plAsyncLog::Shutdown()
+{
+  if (s_pAsyncLogThread == nullptr)
+    return;
+
+  // from now on messages are passed to the log writers directly, see Enqueue()
+  s_bAsyncLogActive = false;
+
+  // threads that are publishing a message right now may not have seen that yet, the background thread still has to deliver their message
+  while (IsPublishingLogMessage())
+  {
+    plThreadUtils::YieldTimeSlice();
+  }
+
+  s_bAsyncLogStopRequested = true;
+  s_AsyncLogWakeUpSignal.RaiseSignal();
+  s_pAsyncLogThread->Join();
+  PL_DEFAULT_DELETE(s_pAsyncLogThread);
+
+  // the background thread has drained the queues after the last message was published, another pass is cheap and leaves nothing behind
+  PL_LOCK(s_AsyncLogQueuesMutex);
+  DrainQueues();
+}
+
+bool plAsyncLog::IsActive()
+{
+  return s_bAsyncLogActive;
+}
+
+void plAsyncLog::Flush()
+{
+  if (!s_bAsyncLogActive || s_bIsAsyncLogThread)
+    return;
+
+  // all messages that were queued before this point have a smaller sequence number
+  const plUInt32 uiTargetSequence = s_uiAsyncLogSequence.load(std::memory_order_acquire);
+
+  while (s_bAsyncLogActive && static_cast<plInt32>(s_uiAsyncLogDrainedSequence.load(std::memory_order_acquire) - uiTargetSequence) < 0)
+  {
+    s_AsyncLogWakeUpSignal.RaiseSignal();
+    plThreadUtils::Sleep(plTime::MakeFromMilliseconds(1));
+  }
+}
+
+void plAsyncLog::FlushOnCrash()
+{
+  if (!s_bAsyncLogActive.Set(false))
+    return;
+
+  // The background thread may be stuck in a log writer or may even be the thread that crashed.
+  // Give it a moment to finish its current pass, but deliver the queued messages in any case.
+  bool bLocked = false;
+  for (plUInt32 i = 0; i < 100 && !bLocked; ++i)
+  {
+    bLocked = s_AsyncLogQueuesMutex.TryLock().Succeeded();
+
+    if (!bLocked)
+      plThreadUtils::Sleep(plTime::MakeFromMilliseconds(1));
+  }
+
+  DrainQueues(true);
+
+  if (bLocked)
+    s_AsyncLogQueuesMutex.Unlock();
+}
+
+plUInt32 plAsyncLog::GetDroppedMessageCount()
+{
+  return static_cast<plUInt32>(static_cast<plInt32>(s_iAsyncLogDroppedMessages));
+}
+
+bool plAsyncLog::Enqueue(const plLoggingEventData& le)
+{
+  if (!s_bAsyncLogActive || s_bIsAsyncLogThread)
+    return false;
+
+  if (s_AsyncLogThreadQueue.m_pQueue == nullptr)
+  {
+    s_AsyncLogThreadQueue.m_pQueue = CreateLogQueue();
+  }
+
+  plAsyncLogQueue* pQueue = s_AsyncLogThreadQueue.m_pQueue;
+  const plUInt32 uiCapacity = pQueue->m_uiCapacity;
+
+  const plUInt32 uiTagLength = plMath::Min(le.m_sTag.GetElementCount(), 255u);
+  plUInt32 uiTextLength = le.m_sText.GetElementCount();
+
+  // a single message may take up at most half the queue, longer texts are cut off at a character boundary
+  const plUInt32 uiMaxTextLength = uiCapacity / 2 - sizeof(plAsyncLogRecord) - uiTagLength - 2 - 7;
+  if (uiTextLength > uiMaxTextLength)
+  {
+    uiTextLength = uiMaxTextLength;
+
+    while (uiTextLength > 0 && plUnicodeUtils::IsUtf8ContinuationByte(le.m_sText.GetStartPointer()[uiTextLength]))
+      --uiTextLength;
+  }
+
+  const plUInt32 uiSize = plMemoryUtils::AlignSize<plUInt32>(sizeof(plAsyncLogRecord) + uiTagLength + uiTextLength + 2, 8);
+
+  const plUInt32 uiWritePos = pQueue->GetWritePos();
+  const plUInt32 uiOffset = uiWritePos & (uiCapacity - 1);
+  const plUInt32 uiSpaceToEnd = uiCapacity - uiOffset;
+  const plUInt32 uiRequired = uiSpaceToEnd < uiSize ? uiSpaceToEnd + uiSize : uiSize;
+
+  while (uiCapacity - (uiWritePos - pQueue->GetReadPos()) < uiRequired)
+  {
+    if (s_AsyncLogConfig.m_Overflow == plAsyncLogOverflow::DropNonCritical && le.m_EventType >= plLogMsgType::WarningMsg)
+    {
+      s_iAsyncLogDroppedMessages.Increment();
+      return true;
+    }
+
+    // plAsyncLog is shutting down or the process crashed, nobody may empty the queue anymore
+    if (!s_bAsyncLogActive)
+      return false;
+
+    s_AsyncLogWakeUpSignal.RaiseSignal();
+    plThreadUtils::YieldTimeSlice();
+  }
+
+  plUInt32 uiPos = uiWritePos;
+
+  if (uiSpaceToEnd < uiSize)
+  {
+    *reinterpret_cast<plUInt32*>(pQueue->m_pData + uiOffset) = uiSpaceToEnd | plAsyncLogPaddingFlag;
+    uiPos += uiSpaceToEnd;
+  }
+
+  plUInt8* pTarget = pQueue->m_pData + (uiPos & (uiCapacity - 1));
+
+  plAsyncLogRecord* pRecord = reinterpret_cast<plAsyncLogRecord*>(pTarget);
+  pRecord->m_uiSize = uiSize;
+  pRecord->m_uiTextLength = uiTextLength;
+  pRecord->m_uiThreadIndex = le.m_uiThreadIndex;
+  pRecord->m_EventType = le.m_EventType;
+  pRecord->m_uiIndentation = le.m_uiIndentation;
+  pRecord->m_uiTagLength = static_cast<plUInt8>(uiTagLength);
+  pRecord->m_uiReserved = 0;
+#if PL_ENABLED(PL_COMPILE_FOR_DEVELOPMENT)
+  pRecord->m_fSeconds = le.m_fSeconds;
+#else
+  pRecord->m_fSeconds = 0;
+#endif
+
+  char* szTag = reinterpret_cast<char*>(pRecord + 1);
+  plMemoryUtils::RawByteCopy(szTag, le.m_sTag.GetStartPointer(), uiTagLength);
+  szTag[uiTagLength] = '\0';
+
+  char* szText = szTag + uiTagLength + 1;
+  plMemoryUtils::RawByteCopy(szText, le.m_sText.GetStartPointer(), uiTextLength);
+  szText[uiTextLength] = '\0';
+
+  // Reserve a lower bound of the sequence number before taking it. DrainQueues() only passes on messages with smaller sequence numbers
+  // than every reservation, so it never passes on a message before all messages with smaller sequence numbers are visible, too.
+  pQueue->m_uiReservedSequence.store(s_uiAsyncLogSequence.load(std::memory_order_relaxed), std::memory_order_seq_cst);
+
+  // Shutdown() switched to synchronous logging while the record was written, nobody would deliver it anymore
+  if (!s_bAsyncLogActive)
+  {
+    pQueue->m_uiReservedSequence.store(plAsyncLogNoReservation, std::memory_order_release);
+    return false;
+  }
+
+  pRecord->m_uiSequence = s_uiAsyncLogSequence.fetch_add(1, std::memory_order_seq_cst);
+  pQueue->m_uiWritePos.store(uiPos + uiSize, std::memory_order_release);
+  pQueue->m_uiReservedSequence.store(plAsyncLogNoReservation, std::memory_order_release);
+
+  if (s_bAsyncLogThreadSleeping)
+  {
+    s_AsyncLogWakeUpSignal.RaiseSignal();
+  }
+
+  return true;
+}
+
+void plAsyncLog::DrainQueues(bool bAfterCrash)
+{
+  // A thread that took a sequence number before the counter is read here has reserved it before, so its reservation is visible.
+  // Every message with a smaller sequence number than the counter and all reservations has been published before the reservations were
+  // read, so it is included in the write positions that are read afterwards.
+  // After a crash a thread may never finish publishing its message, so everything that is visible is passed on, as well as possible.
+  plUInt32 uiSequenceEnd = s_uiAsyncLogSequence.load(std::memory_order_seq_cst);
+
+  for (plAsyncLogQueue* pQueue = bAfterCrash ? nullptr : s_pAsyncLogQueues; pQueue != nullptr; pQueue = pQueue->m_pNext)
+  {
+    const plUInt64 uiReservedSequence = pQueue->m_uiReservedSequence.load(std::memory_order_seq_cst);
+
+    if (uiReservedSequence != plAsyncLogNoReservation && static_cast<plInt32>(static_cast<plUInt32>(uiReservedSequence) - uiSequenceEnd) < 0)
+    {
+      uiSequenceEnd = static_cast<plUInt32>(uiReservedSequence);
+    }
+  }
+
+  for (plAsyncLogQueue* pQueue = s_pAsyncLogQueues; pQueue != nullptr; pQueue = pQueue->m_pNext)
+  {
+    pQueue->m_uiDrainEnd = pQueue->GetWritePos();
+  }
+
+  // merge the queues of all threads, always taking the oldest message
+  while (true)
+  {
+    plAsyncLogQueue* pOldestQueue = nullptr;
+    const plAsyncLogRecord* pOldest = nullptr;
+
+    for (plAsyncLogQueue* pQueue = s_pAsyncLogQueues; pQueue != nullptr; pQueue = pQueue->m_pNext)
+    {
+      const plAsyncLogRecord* pRecord = PeekLogRecord(pQueue);
+
+      if (pRecord != nullptr && (pOldest == nullptr || static_cast<plInt32>(pRecord->m_uiSequence - pOldest->m_uiSequence) < 0))
+      {
+        pOldest = pRecord;
+        pOldestQueue = pQueue;
+      }
+    }
+
+    // the remaining messages wait for the next pass, a message with a smaller sequence number may still be published
+    if (pOldest == nullptr || (!bAfterCrash && static_cast<plInt32>(pOldest->m_uiSequence - uiSequenceEnd) >= 0))
+      break;
+
+    const char* szTag = reinterpret_cast<const char*>(pOldest + 1);
+    const char* szText = szTag + pOldest->m_uiTagLength + 1;
+
+    plLoggingEventData le;
+    le.m_EventType = static_cast<plLogMsgType::Enum>(pOldest->m_EventType);
+    le.m_uiIndentation = pOldest->m_uiIndentation;
+    le.m_uiThreadIndex = pOldest->m_uiThreadIndex;
+    le.m_sTag = plStringView(szTag, pOldest->m_uiTagLength);
+    le.m_sText = plStringView(szText, pOldest->m_uiTextLength);
+#if PL_ENABLED(PL_COMPILE_FOR_DEVELOPMENT)
+    le.m_fSeconds = pOldest->m_fSeconds;
+#endif
+
+    plGlobalLog::s_LoggingEvent.Broadcast(le);
+
+    pOldestQueue->m_uiReadPos.store(pOldestQueue->GetReadPos() + pOldest->m_uiSize, std::memory_order_release);
+  }
+
+  const plInt32 iDroppedMessages = s_iAsyncLogDroppedMessages;
+  if (iDroppedMessages != s_iAsyncLogReportedDroppedMessages)
+  {
+    plStringBuilder sText;
+    sText.SetFormat("{} log messages were dropped, because the log queue was full.", iDroppedMessages - s_iAsyncLogReportedDroppedMessages);
+    s_iAsyncLogReportedDroppedMessages = iDroppedMessages;
+
+    plLoggingEventData le;
+    le.m_EventType = plLogMsgType::WarningMsg;
+    le.m_sText = sText;
+    plGlobalLog::s_LoggingEvent.Broadcast(le);
+  }
+
+  for (plAsyncLogQueue** ppQueue = &s_pAsyncLogQueues; *ppQueue != nullptr;)
+  {
+    plAsyncLogQueue* pQueue = *ppQueue;
+
+    if (pQueue->m_bOrphaned && pQueue->IsEmpty())
+    {
+      *ppQueue = pQueue->m_pNext;
+      DeleteLogQueue(pQueue);
+    }
+    else
+    {
+      ppQueue = &pQueue->m_pNext;
+    }
+  }
+
+  s_uiAsyncLogDrainedSequence.store(uiSequenceEnd, std::memory_order_release);
+}
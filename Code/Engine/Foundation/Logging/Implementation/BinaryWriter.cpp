@@ -0,0 +1,525 @@
+#include <Foundation/FoundationPCH.h>
+
+#include <Foundation/IO/OSFile.h>
+#include <Foundation/Logging/BinaryWriter.h>
+#include <Foundation/Types/ScopeExit.h>
+#include <Foundation/Utilities/Compression.h>
+
+// File layout:
+//   plBinaryLogFileHeader
+//   any number of blocks: plBinaryLogBlockHeader, followed by m_uiStoredSize bytes of (possibly compressed) records
+//   zero bytes up to the end of the file, since the file is grown in steps
+//
+// Record layout (all integers are variable length encoded, 7 bits per byte, least significant first):
+//   plInt8 event type, plUInt8 indentation, thread index, microseconds since the first record of the block, text, tag,
+//   [for EndGroup only] duration of the group in microseconds
+//
+// Strings are stored as an index into the strings of the block. Index zero means that the string follows (length, then bytes)
+// and gets the next index.
+
+namespace
+{
+  struct plBinaryLogFileHeader
+  {
+    char m_Magic[8];
+    plUInt32 m_uiVersion;
+    plUInt32 m_uiReserved;
+    plInt64 m_iStartTimestamp; ///< Microseconds since the Unix epoch.
+  };
+
+  struct plBinaryLogBlockHeader
+  {
+    plUInt32 m_uiMagic;
+    plUInt32 m_uiStoredSize;
+    plUInt32 m_uiUncompressedSize;
+    plUInt32 m_uiNumRecords;
+    plInt64 m_iFirstTime; ///< Microseconds since the start of the log.
+    plInt64 m_iLastTime;
+    plUInt64 m_uiThreadMask; ///< Bit (thread index % 64) is set for every thread that has a record in this block.
+    plUInt16 m_uiTypeMask;   ///< Bit (event type - plLogMsgType::GlobalDefault) is set for every event type in this block.
+    plUInt8 m_uiCompression;
+    plUInt8 m_uiReserved[5];
+  };
+
+  static_assert(sizeof(plBinaryLogFileHeader) == 24);
+  static_assert(sizeof(plBinaryLogBlockHeader) == 48);
+
+  constexpr char plBinaryLogMagic[8] = {'P', 'L', 'B', 'I', 'N', 'L', 'O', 'G'};
+  constexpr plUInt32 plBinaryLogVersion = 1;
+  constexpr plUInt32 plBinaryLogBlockMagic = 0x4B4C4250; // "PBLK"
+
+  constexpr plUInt8 plBinaryLogCompressionNone = 0;
+  constexpr plUInt8 plBinaryLogCompressionZstd = 1;
+
+  constexpr plUInt64 plBinaryLogMinGrowth = 1024 * 1024;
+  constexpr plUInt64 plBinaryLogMaxGrowth = 64 * 1024 * 1024;
+} // namespace
+
+static plUInt16 GetBinaryLogTypeBit(plLogMsgType::Enum type)
+{
+  return static_cast<plUInt16>(1u << (type - plLogMsgType::GlobalDefault));
+}
+
+static void WriteBinaryLogVarInt(plDynamicArray<plUInt8>& inout_data, plUInt64 uiValue)
+{
+  while (uiValue >= 0x80)
+  {
+    inout_data.PushBack(static_cast<plUInt8>(uiValue) | 0x80);
+    uiValue >>= 7;
+  }
+
+  inout_data.PushBack(static_cast<plUInt8>(uiValue));
+}
+
+static bool ReadBinaryLogVarInt(const plUInt8*& inout_pData, const plUInt8* pEnd, plUInt64& out_uiValue)
+{
+  out_uiValue = 0;
+
+  for (plUInt32 uiShift = 0; uiShift < 64 && inout_pData < pEnd; uiShift += 7)
+  {
+    const plUInt8 uiByte = *inout_pData++;
+    out_uiValue |= static_cast<plUInt64>(uiByte & 0x7F) << uiShift;
+
+    if ((uiByte & 0x80) == 0)
+      return true;
+  }
+
+  return false;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+plLogWriter::Binary::~Binary()
+{
+  EndLog();
+}
+
+void plLogWriter::Binary::BeginLog(plStringView sFile)
+{
+  EndLog();
+
+#if PL_ENABLED(PL_SUPPORTS_MEMORY_MAPPED_FILE)
+  PL_ASSERT_DEV(plPathUtils::IsAbsolutePath(sFile), "plLogWriter::Binary::BeginLog() requires an absolute path");
+
+  plStringBuilder sPath = sFile;
+
+  plOSFile file;
+  for (plUInt32 i = 1; file.Open(sPath, plFileOpenMode::Write, plFileShareMode::SharedReads).Failed(); ++i)
+  {
+    if (i == 32)
+    {
+      plLog::Error("Could not open Log-File \"{0}\".", sFile);
+      return;
+    }
+
+    plStringBuilder sNewName;
+    sNewName.SetFormat("{0}_{1}", plPathUtils::GetFileName(sFile), i);
+
+    sPath = sFile;
+    sPath.ChangeFileName(sNewName);
+  }
+
+  m_StartTime = plTime::Now();
+
+  plBinaryLogFileHeader header = {};
+  plMemoryUtils::Copy(header.m_Magic, plBinaryLogMagic, 8);
+  header.m_uiVersion = plBinaryLogVersion;
+  header.m_iStartTimestamp = plTimestamp::CurrentTimestamp().GetInt64(plSIUnitOfTime::Microsecond);
+
+  // the file must not be empty for the memory mapping, it is grown as blocks are appended
+  plResult res = file.Write(&header, sizeof(header));
+  file.Close();
+
+  if (res.Succeeded())
+  {
+    m_sFile = sPath;
+    res = m_File.Open(m_sFile, plMemoryMappedFile::Mode::ReadWrite);
+  }
+
+  if (res.Failed())
+  {
+    plLog::Error("Could not open Log-File \"{0}\".", sPath);
+    m_File.Close();
+    return;
+  }
+
+  m_uiFileEnd = sizeof(plBinaryLogFileHeader);
+#else
+  plLog::Error("plLogWriter::Binary requires memory mapped files, which are not supported on this platform.");
+#endif
+}
+
+void plLogWriter::Binary::EndLog()
+{
+  if (m_File.GetMode() == plMemoryMappedFile::Mode::None)
+    return;
+
+  FlushBlock();
+
+  m_File.Close();
+}
+
+void plLogWriter::Binary::LogMessageHandler(const plLoggingEventData& eventData)
+{
+  // messages that are logged while writing to the file (e.g. errors of the memory mapping) are ignored
+  if (m_File.GetMode() == plMemoryMappedFile::Mode::None || m_bWriting)
+    return;
+
+  m_bWriting = true;
+  PL_SCOPE_EXIT(m_bWriting = false);
+
+  if (eventData.m_EventType == plLogMsgType::Flush)
+  {
+    FlushBlock();
+    return;
+  }
+
+  const plTime now = plTime::Now();
+
+  if (m_uiNumRecords > 0 && now - m_BlockStartTime > plTime::MakeFromSeconds(1))
+  {
+    FlushBlock();
+  }
+
+  const plInt64 iTime = static_cast<plInt64>((now - m_StartTime).GetMicroseconds());
+
+  if (m_uiNumRecords == 0)
+  {
+    m_BlockStartTime = now;
+    m_iFirstTime = iTime;
+  }
+
+  m_iLastTime = plMath::Max(m_iLastTime, iTime);
+  m_uiThreadMask |= plUInt64(1) << (eventData.m_uiThreadIndex % 64);
+  m_uiTypeMask |= GetBinaryLogTypeBit(eventData.m_EventType);
+  ++m_uiNumRecords;
+
+  m_Block.PushBack(static_cast<plUInt8>(eventData.m_EventType));
+  m_Block.PushBack(eventData.m_uiIndentation);
+  WriteBinaryLogVarInt(m_Block, eventData.m_uiThreadIndex);
+  WriteBinaryLogVarInt(m_Block, static_cast<plUInt64>(plMath::Max<plInt64>(iTime - m_iFirstTime, 0)));
+
+  for (plStringView sText : {eventData.m_sText, eventData.m_sTag})
+  {
+    const plUInt32 uiIndex = InternString(sText);
+    WriteBinaryLogVarInt(m_Block, uiIndex);
+
+    if (uiIndex == 0)
+    {
+      WriteBinaryLogVarInt(m_Block, sText.GetElementCount());
+      m_Block.PushBackRange(plArrayPtr<const plUInt8>(reinterpret_cast<const plUInt8*>(sText.GetStartPointer()), sText.GetElementCount()));
+    }
+  }
+
+  if (eventData.m_EventType == plLogMsgType::EndGroup)
+  {
+#if PL_ENABLED(PL_COMPILE_FOR_DEVELOPMENT)
+    WriteBinaryLogVarInt(m_Block, static_cast<plUInt64>(plMath::Max(eventData.m_fSeconds, 0.0) * 1000000.0));
+#else
+    WriteBinaryLogVarInt(m_Block, 0);
+#endif
+  }
+
+  if (m_Block.GetCount() >= m_uiBlockSize)
+  {
+    FlushBlock();
+  }
+}
+
+plUInt32 plLogWriter::Binary::InternString(plStringView sText)
+{
+  plUInt32 uiIndex = 0;
+  if (m_Strings.TryGetValue(sText, uiIndex))
+    return uiIndex;
+
+  m_Strings.Insert(sText, m_Strings.GetCount() + 1);
+  return 0;
+}
+
+void plLogWriter::Binary::FlushBlock()
+{
+  if (m_uiNumRecords == 0)
+    return;
+
+  plBinaryLogBlockHeader header = {};
+  header.m_uiMagic = plBinaryLogBlockMagic;
+  header.m_uiUncompressedSize = m_Block.GetCount();
+  header.m_uiNumRecords = m_uiNumRecords;
+  header.m_iFirstTime = m_iFirstTime;
+  header.m_iLastTime = m_iLastTime;
+  header.m_uiThreadMask = m_uiThreadMask;
+  header.m_uiTypeMask = m_uiTypeMask;
+  header.m_uiCompression = plBinaryLogCompressionNone;
+
+  plArrayPtr<const plUInt8> payload = m_Block;
+
+#ifdef BUILDSYSTEM_ENABLE_ZSTD_SUPPORT
+  if (plCompressionUtils::Compress(m_Block, plCompressionMethod::ZStd, m_Compressed).Succeeded() && m_Compressed.GetCount() < m_Block.GetCount())
+  {
+    payload = m_Compressed;
+    header.m_uiCompression = plBinaryLogCompressionZstd;
+  }
+#endif
+
+  header.m_uiStoredSize = payload.GetCount();
+
+  if (AppendToFile(plArrayPtr<const plUInt8>(reinterpret_cast<const plUInt8*>(&header), sizeof(header)), payload).Failed())
+  {
+    // stop logging, the file is in an unknown state
+    m_File.Close();
+  }
+
+  m_Block.Clear();
+  m_Strings.Clear();
+  m_uiNumRecords = 0;
+  m_iFirstTime = 0;
+  m_iLastTime = 0;
+  m_uiThreadMask = 0;
+  m_uiTypeMask = 0;
+}
+
+plResult plLogWriter::Binary::AppendToFile(plArrayPtr<const plUInt8> header, plArrayPtr<const plUInt8> payload)
+{
+#if PL_ENABLED(PL_SUPPORTS_MEMORY_MAPPED_FILE)
+  const plUInt64 uiRequiredSize = m_uiFileEnd + header.GetCount() + payload.GetCount();
+  const plUInt64 uiFileSize = m_File.GetFileSize();
+
+  if (uiRequiredSize > uiFileSize)
+  {
+    // grow in large steps, since every step has to re-map the whole file
+    const plUInt64 uiGrowth = plMath::Clamp(uiFileSize / 8, plBinaryLogMinGrowth, plBinaryLogMaxGrowth);
+    const plUInt64 uiNewSize = plMath::Max(uiRequiredSize, uiFileSize + uiGrowth);
+
+    m_File.Close();
+
+    {
+      plOSFile file;
+      PL_SUCCEED_OR_RETURN(file.Open(m_sFile, plFileOpenMode::Append, plFileShareMode::SharedReads));
+
+      static const plUInt8 s_Zeros[64 * 1024] = {};
+      for (plUInt64 uiSize = uiFileSize; uiSize < uiNewSize;)
+      {
+        const plUInt64 uiBytes = plMath::Min<plUInt64>(sizeof(s_Zeros), uiNewSize - uiSize);
+        PL_SUCCEED_OR_RETURN(file.Write(s_Zeros, uiBytes));
+        uiSize += uiBytes;
+      }
+    }
+
+    PL_SUCCEED_OR_RETURN(m_File.Open(m_sFile, plMemoryMappedFile::Mode::ReadWrite));
+  }
+
+  // write the header last, so that readers never see a block header before its data
+  plUInt8* pTarget = static_cast<plUInt8*>(m_File.GetWritePointer(m_uiFileEnd));
+  plMemoryUtils::Copy(pTarget + header.GetCount(), payload.GetPtr(), payload.GetCount());
+  plMemoryUtils::Copy(pTarget, header.GetPtr(), header.GetCount());
+
+  m_uiFileEnd = uiRequiredSize;
+  return PL_SUCCESS;
+#else
+  return PL_FAILURE;
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+plResult plBinaryLogReader::Open(plStringView sFile)
+{
+  Close();
+
+#if PL_ENABLED(PL_SUPPORTS_MEMORY_MAPPED_FILE)
+  PL_SUCCEED_OR_RETURN(m_File.Open(sFile, plMemoryMappedFile::Mode::ReadOnly));
+
+  plBinaryLogFileHeader header;
+  if (m_File.GetFileSize() < sizeof(header))
+  {
+    plLog::Error("'{}' is not a binary log file.", sFile);
+    Close();
+    return PL_FAILURE;
+  }
+
+  plMemoryUtils::Copy(reinterpret_cast<plUInt8*>(&header), static_cast<const plUInt8*>(m_File.GetReadPointer()), sizeof(header));
+
+  if (!plMemoryUtils::IsEqual(header.m_Magic, plBinaryLogMagic, 8))
+  {
+    plLog::Error("'{}' is not a binary log file.", sFile);
+    Close();
+    return PL_FAILURE;
+  }
+
+  if (header.m_uiVersion != plBinaryLogVersion)
+  {
+    plLog::Error("Binary log file '{}' has unsupported version {}.", sFile, header.m_uiVersion);
+    Close();
+    return PL_FAILURE;
+  }
+
+  m_StartTimestamp = plTimestamp::MakeFromInt(header.m_iStartTimestamp, plSIUnitOfTime::Microsecond);
+  return PL_SUCCESS;
+#else
+  plLog::Error("plBinaryLogReader requires memory mapped files, which are not supported on this platform.");
+  return PL_FAILURE;
+#endif
+}
+
+void plBinaryLogReader::Close()
+{
+  m_File.Close();
+  m_StartTimestamp = plTimestamp::MakeInvalid();
+}
+
+void plBinaryLogReader::GetBlockStats(plUInt32& out_uiReadBlocks, plUInt32& out_uiSkippedBlocks) const
+{
+  out_uiReadBlocks = m_uiReadBlocks;
+  out_uiSkippedBlocks = m_uiSkippedBlocks;
+}
+
+plResult plBinaryLogReader::ReadEntries(const plBinaryLogFilter& filter, EntryCallback callback)
+{
+  m_uiReadBlocks = 0;
+  m_uiSkippedBlocks = 0;
+
+  if (m_File.GetMode() == plMemoryMappedFile::Mode::None)
+    return PL_FAILURE;
+
+  plUInt16 uiRelevantTypes = 0;
+  for (plInt32 type = plLogMsgType::ErrorMsg; type <= plMath::Min<plInt32>(filter.m_LogLevel, plLogMsgType::DebugMsg); ++type)
+  {
+    uiRelevantTypes |= GetBinaryLogTypeBit(static_cast<plLogMsgType::Enum>(type));
+  }
+
+  if (filter.m_bIncludeGroups)
+  {
+    uiRelevantTypes |= GetBinaryLogTypeBit(plLogMsgType::BeginGroup) | GetBinaryLogTypeBit(plLogMsgType::EndGroup);
+  }
+
+  const plInt64 iStartTime = static_cast<plInt64>(filter.m_StartTime.GetMicroseconds());
+  const plInt64 iEndTime = static_cast<plInt64>(filter.m_EndTime.GetMicroseconds());
+  const plUInt64 uiThreadBit = plUInt64(1) << (filter.m_uiThreadIndex % 64);
+
+  const plUInt8* pFile = static_cast<const plUInt8*>(m_File.GetReadPointer());
+  const plUInt64 uiFileSize = m_File.GetFileSize();
+
+  for (plUInt64 uiPos = sizeof(plBinaryLogFileHeader); uiPos + sizeof(plBinaryLogBlockHeader) <= uiFileSize;)
+  {
+    plBinaryLogBlockHeader header;
+    plMemoryUtils::Copy(reinterpret_cast<plUInt8*>(&header), pFile + uiPos, sizeof(header));
+
+    // the rest of the file hasn't been written (yet)
+    if (header.m_uiMagic != plBinaryLogBlockMagic || uiPos + sizeof(header) + header.m_uiStoredSize > uiFileSize)
+      break;
+
+    plArrayPtr<const plUInt8> data(pFile + uiPos + sizeof(header), header.m_uiStoredSize);
+    uiPos += sizeof(header) + header.m_uiStoredSize;
+
+    if (header.m_iLastTime < iStartTime || header.m_iFirstTime > iEndTime || (header.m_uiTypeMask & uiRelevantTypes) == 0 ||
+        (filter.m_uiThreadIndex != 0 && (header.m_uiThreadMask & uiThreadBit) == 0))
+    {
+      ++m_uiSkippedBlocks;
+      continue;
+    }
+
+    ++m_uiReadBlocks;
+
+    if (header.m_uiCompression == plBinaryLogCompressionZstd)
+    {
+#ifdef BUILDSYSTEM_ENABLE_ZSTD_SUPPORT
+      PL_SUCCEED_OR_RETURN(plCompressionUtils::Decompress(data, plCompressionMethod::ZStd, m_Decompressed));
+      data = m_Decompressed;
+#else
+      plLog::Error("The binary log file is compressed with zstd, which is not available in this build.");
+      return PL_FAILURE;
+#endif
+    }
+    else if (header.m_uiCompression != plBinaryLogCompressionNone)
+    {
+      plLog::Error("Unknown compression {} in binary log file.", header.m_uiCompression);
+      return PL_FAILURE;
+    }
+
+    PL_SUCCEED_OR_RETURN(ReadBlock(data, header.m_uiNumRecords, header.m_iFirstTime, filter, callback));
+  }
+
+  return PL_SUCCESS;
+}
+
+plResult plBinaryLogReader::ReadBlock(plArrayPtr<const plUInt8> data, plUInt32 uiNumRecords, plInt64 iFirstTime, const plBinaryLogFilter& filter, EntryCallback callback)
+{
+  m_Strings.Clear();
+
+  const plUInt8* pData = data.GetPtr();
+  const plUInt8* pEnd = data.GetEndPtr();
+
+  auto ReadString = [&](plStringView& out_sText) -> bool
+  {
+    plUInt64 uiIndex = 0;
+    if (!ReadBinaryLogVarInt(pData, pEnd, uiIndex))
+      return false;
+
+    if (uiIndex > 0)
+    {
+      if (uiIndex > m_Strings.GetCount())
+        return false;
+
+      out_sText = m_Strings[static_cast<plUInt32>(uiIndex - 1)];
+      return true;
+    }
+
+    plUInt64 uiLength = 0;
+    if (!ReadBinaryLogVarInt(pData, pEnd, uiLength) || uiLength > static_cast<plUInt64>(pEnd - pData))
+      return false;
+
+    out_sText = plStringView(reinterpret_cast<const char*>(pData), static_cast<plUInt32>(uiLength));
+    m_Strings.PushBack(out_sText);
+    pData += uiLength;
+    return true;
+  };
+
+  for (plUInt32 i = 0; i < uiNumRecords; ++i)
+  {
+    plBinaryLogEntry entry;
+    plUInt64 uiThreadIndex = 0;
+    plUInt64 uiTime = 0;
+
+    if (pEnd - pData < 2)
+      break;
+
+    entry.m_EventType = static_cast<plLogMsgType::Enum>(static_cast<plInt8>(pData[0]));
+    entry.m_uiIndentation = pData[1];
+    pData += 2;
+
+    if (!ReadBinaryLogVarInt(pData, pEnd, uiThreadIndex) || !ReadBinaryLogVarInt(pData, pEnd, uiTime) || !ReadString(entry.m_sText) || !ReadString(entry.m_sTag))
+      break;
+
+    if (entry.m_EventType == plLogMsgType::EndGroup)
+    {
+      plUInt64 uiDuration = 0;
+      if (!ReadBinaryLogVarInt(pData, pEnd, uiDuration))
+        break;
+
+      entry.m_fSeconds = static_cast<double>(uiDuration) / 1000000.0;
+    }
+
+    entry.m_uiThreadIndex = static_cast<plUInt32>(uiThreadIndex);
+    entry.m_Time = plTime::MakeFromMicroseconds(static_cast<double>(iFirstTime + static_cast<plInt64>(uiTime)));
+
+    bool bPass = false;
+    if (entry.m_EventType > plLogMsgType::None && entry.m_EventType < plLogMsgType::All)
+      bPass = entry.m_EventType <= filter.m_LogLevel;
+    else if (entry.m_EventType == plLogMsgType::BeginGroup || entry.m_EventType == plLogMsgType::EndGroup)
+      bPass = filter.m_bIncludeGroups;
+
+    bPass = bPass && (filter.m_uiThreadIndex == 0 || entry.m_uiThreadIndex == filter.m_uiThreadIndex);
+    bPass = bPass && entry.m_Time >= filter.m_StartTime && entry.m_Time <= filter.m_EndTime;
+
+    if (bPass)
+    {
+      callback(entry);
+    }
+
+    if (i + 1 == uiNumRecords)
+      return PL_SUCCESS;
+  }
+
+  plLog::Error("Corrupt block in binary log file.");
+  return PL_FAILURE;
+}
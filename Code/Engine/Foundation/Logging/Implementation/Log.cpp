@@ -1,6 +1,7 @@
 #include <Foundation/FoundationPCH.h>
 
 #include <Foundation/Application/Application.h>
+#include <Foundation/Logging/AsyncLog.h>
 #include <Foundation/Logging/Log.h>
 #include <Foundation/Strings/StringBuilder.h>
 #include <Foundation/Strings/StringConversion.h>
@@ -30,6 +31,19 @@ static plMutex s_OverrideLogMutex;
 /// \brief The log system that messages are sent to when the user specifies no system himself.
 static thread_local plLogInterface* s_DefaultLogSystem = nullptr;
 
+static plAtomicInteger32 s_iNextLogThreadIndex;
+static thread_local plUInt32 s_uiLogThreadIndex = 0;
+
+static plUInt32 GetLogThreadIndex()
+{
+  if (s_uiLogThreadIndex == 0)
+  {
+    s_uiLogThreadIndex = static_cast<plUInt32>(s_iNextLogThreadIndex.Increment());
+  }
+
+  return s_uiLogThreadIndex;
+}
+
 
 plEventSubscriptionID plGlobalLog::AddLogWriter(plLoggingEvent::Handler handler)
 {
@@ -97,6 +111,10 @@ void plGlobalLog::HandleLogMessage(const plLoggingEventData& le)
       plLog::Print(stmp);
     }
 #endif
+
+    if (plAsyncLog::Enqueue(le))
+      return;
+
     s_LoggingEvent.Broadcast(le);
   }
 }
@@ -167,6 +185,7 @@ void plLog::EndLogBlock(plLogInterface* pInterface, plLogBlock* pBlock)
     le.m_EventType = plLogMsgType::EndGroup;
     le.m_sText = pBlock->m_sName;
     le.m_uiIndentation = pBlock->m_uiBlockDepth;
+    le.m_uiThreadIndex = GetLogThreadIndex();
     le.m_sTag = pBlock->m_sContextInfo;
 #if PL_ENABLED(PL_COMPILE_FOR_DEVELOPMENT)
     le.m_fSeconds = pBlock->m_fSeconds;
@@ -189,6 +208,7 @@ void plLog::WriteBlockHeader(plLogInterface* pInterface, plLogBlock* pBlock)
   le.m_EventType = plLogMsgType::BeginGroup;
   le.m_sText = pBlock->m_sName;
   le.m_uiIndentation = pBlock->m_uiBlockDepth;
+  le.m_uiThreadIndex = GetLogThreadIndex();
   le.m_sTag = pBlock->m_sContextInfo;
 
   pInterface->HandleLogMessage(le);
@@ -239,6 +259,7 @@ void plLog::BroadcastLoggingEvent(plLogInterface* pInterface, plLogMsgType::Enum
   le.m_EventType = type;
   le.m_sText = sString;
   le.m_uiIndentation = uiIndentation;
+  le.m_uiThreadIndex = GetLogThreadIndex();
   le.m_sTag = szTag;
 
   pInterface->HandleLogMessage(le);
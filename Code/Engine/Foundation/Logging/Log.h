@@ -54,6 +54,10 @@ struct PL_FOUNDATION_DLL plLoggingEventData
   /// \brief How many "levels" to indent.
   plUInt8 m_uiIndentation = 0;
 
+  /// \brief Identifies the thread that logged the message. Threads are numbered in the order in which they log for the first time, starting
+  /// at one. Zero if the message didn't come from plLog.
+  plUInt32 m_uiThreadIndex = 0;
+
   /// \brief The information text.
   plStringView m_sText;
 
@@ -152,6 +156,7 @@ private:
   PL_DISALLOW_COPY_AND_ASSIGN(plGlobalLog);
 
   friend class plLog; // only plLog may create instances of this class
+  friend class plAsyncLog;
   plGlobalLog() = default;
 };
 
@@ -1,6 +1,7 @@
 #include <Foundation/FoundationInternal.h>
 PL_FOUNDATION_INTERNAL_HEADER
 
+#include <Foundation/Logging/AsyncLog.h>
 #include <Foundation/Logging/Log.h>
 #include <Foundation/System/CrashHandler.h>
 #include <Foundation/System/MiniDumpUtils.h>
@@ -17,6 +18,8 @@ static void PrintHelper(const char* szString)
 
 static void plCrashHandlerFunc() noexcept
 {
+  plAsyncLog::FlushOnCrash();
+
   if (plCrashHandler::GetCrashHandler() != nullptr)
   {
     plCrashHandler::GetCrashHandler()->HandleCrash(nullptr);
@@ -29,6 +32,8 @@ static void plCrashHandlerFunc() noexcept
 
 static void plSignalHandler(int signum)
 {
+  plAsyncLog::FlushOnCrash();
+
   plLog::Printf("***Unhandled Signal:***\n");
   switch (signum)
   {
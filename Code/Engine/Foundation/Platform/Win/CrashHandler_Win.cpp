@@ -2,6 +2,7 @@
 
 #if PL_ENABLED(PL_PLATFORM_WINDOWS)
 
+#  include <Foundation/Logging/AsyncLog.h>
 #  include <Foundation/Logging/Log.h>
 #  include <Foundation/System/CrashHandler.h>
 #  include <Foundation/System/MiniDumpUtils.h>
@@ -21,6 +22,8 @@ static LONG WINAPI plCrashHandlerFunc(struct _EXCEPTION_POINTERS* pExceptionInfo
 
   if (s_bAlreadyHandled == false)
   {
+    plAsyncLog::FlushOnCrash();
+
     if (plCrashHandler::GetCrashHandler() != nullptr)
     {
       s_bAlreadyHandled = true;
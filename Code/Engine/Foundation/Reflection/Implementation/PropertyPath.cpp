@@ -1,7 +1,10 @@
 #include <Foundation/FoundationPCH.h>
 
+#include <Foundation/Configuration/Startup.h>
 #include <Foundation/Reflection/PropertyPath.h>
 #include <Foundation/Reflection/ReflectionUtils.h>
+#include <Foundation/Threading/Lock.h>
+#include <Foundation/Threading/Mutex.h>
 #include <Foundation/Types/UniquePtr.h>
 
 // clang-format off
@@ -17,6 +20,58 @@ PL_BEGIN_STATIC_REFLECTED_TYPE(plPropertyPathStep, plNoBase, 1, plRTTIDefaultAll
 PL_END_STATIC_REFLECTED_TYPE;
 // clang-format on
 
+struct plPropertyPath::PathCache
+{
+  /// The cache is simply cleared when it gets too large, paths with changing indices would otherwise let it grow forever.
+  static constexpr plUInt32 MaxEntries = 4096;
+
+  struct Key
+  {
+    const plRTTI* m_pRootType = nullptr;
+    plUInt64 m_uiPathHash = 0;
+
+    bool operator==(const Key& rhs) const { return m_pRootType == rhs.m_pRootType && m_uiPathHash == rhs.m_uiPathHash; }
+  };
+
+  struct KeyHash
+  {
+    static plUInt32 Hash(const Key& key) { return plHashingUtils::CombineHashValues32(plHashHelper<const plRTTI*>::Hash(key.m_pRootType), plHashingUtils::StringHashTo32(key.m_uiPathHash)); }
+    static bool Equal(const Key& a, const Key& b) { return a == b; }
+  };
+
+  struct Entry
+  {
+    plString m_sPath;
+    plHybridArray<ResolvedStep, 2> m_Steps;
+  };
+
+  plMutex m_Mutex;
+  plUInt32 m_uiTypeChangeCounter = 0;
+  plHashTable<Key, Entry, KeyHash> m_Paths;
+};
+
+plPropertyPath::PathCache* plPropertyPath::s_pPathCache = nullptr;
+
+// clang-format off
+PL_BEGIN_SUBSYSTEM_DECLARATION(Foundation, PropertyPath)
+
+  BEGIN_SUBSYSTEM_DEPENDENCIES
+  "Reflection"
+  END_SUBSYSTEM_DEPENDENCIES
+
+  ON_CORESYSTEMS_STARTUP
+  {
+    plPropertyPath::s_pPathCache = PL_DEFAULT_NEW(plPropertyPath::PathCache);
+  }
+
+  ON_CORESYSTEMS_SHUTDOWN
+  {
+    PL_DEFAULT_DELETE(plPropertyPath::s_pPathCache);
+  }
+
+PL_END_SUBSYSTEM_DECLARATION;
+// clang-format on
+
 plPropertyPath::plPropertyPath() = default;
 plPropertyPath::~plPropertyPath() = default;
 
@@ -29,6 +84,13 @@ plResult plPropertyPath::InitializeFromPath(const plRTTI& rootObjectRtti, const
 {
   m_bIsValid = false;
 
+  const plUInt64 uiPathHash = plHashingUtils::StringHash(szPath);
+  if (FindCachedPath(rootObjectRtti, szPath, uiPathHash))
+  {
+    m_bIsValid = true;
+    return PL_SUCCESS;
+  }
+
   const plStringBuilder sPathParts = szPath;
   plStringBuilder sIndex;
   plStringBuilder sFieldName;
@@ -99,10 +161,55 @@ plResult plPropertyPath::InitializeFromPath(const plRTTI& rootObjectRtti, const
     pCurRtti = pAbsProp->GetSpecificType();
   }
 
+  AddCachedPath(rootObjectRtti, szPath, uiPathHash);
+
   m_bIsValid = true;
   return PL_SUCCESS;
 }
 
+bool plPropertyPath::FindCachedPath(const plRTTI& rootObjectRtti, plStringView sPath, plUInt64 uiPathHash)
+{
+  if (s_pPathCache == nullptr)
+    return false;
+
+  PL_LOCK(s_pPathCache->m_Mutex);
+
+  // the cached steps point to properties, which may be gone once types were changed or unloaded
+  const plUInt32 uiTypeChangeCounter = plRTTI::GetTypeChangeCounter();
+  if (s_pPathCache->m_uiTypeChangeCounter != uiTypeChangeCounter)
+  {
+    s_pPathCache->m_Paths.Clear();
+    s_pPathCache->m_uiTypeChangeCounter = uiTypeChangeCounter;
+    return false;
+  }
+
+  const PathCache::Entry* pEntry = s_pPathCache->m_Paths.GetValue(PathCache::Key{&rootObjectRtti, uiPathHash});
+  if (pEntry == nullptr || pEntry->m_sPath != sPath)
+    return false;
+
+  m_PathSteps = pEntry->m_Steps;
+  return true;
+}
+
+void plPropertyPath::AddCachedPath(const plRTTI& rootObjectRtti, plStringView sPath, plUInt64 uiPathHash) const
+{
+  if (s_pPathCache == nullptr)
+    return;
+
+  PL_LOCK(s_pPathCache->m_Mutex);
+
+  const plUInt32 uiTypeChangeCounter = plRTTI::GetTypeChangeCounter();
+  if (s_pPathCache->m_uiTypeChangeCounter != uiTypeChangeCounter || s_pPathCache->m_Paths.GetCount() >= PathCache::MaxEntries)
+  {
+    s_pPathCache->m_Paths.Clear();
+    s_pPathCache->m_uiTypeChangeCounter = uiTypeChangeCounter;
+  }
+
+  PathCache::Entry& entry = s_pPathCache->m_Paths[PathCache::Key{&rootObjectRtti, uiPathHash}];
+  entry.m_sPath = sPath;
+  entry.m_Steps = m_PathSteps;
+}
+
 plResult plPropertyPath::InitializeFromPath(const plRTTI* pRootObjectRtti, const plArrayPtr<const plPropertyPathStep> path)
 {
   m_bIsValid = false;
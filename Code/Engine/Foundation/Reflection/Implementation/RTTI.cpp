@@ -12,10 +12,36 @@ struct plTypeData
   plMutex m_Mutex;
   plHashTable<plUInt64, plRTTI*, plHashHelper<plUInt64>, plStaticsAllocatorWrapper> m_TypeNameHashToType;
   plDynamicArray<plRTTI*> m_AllTypes;
+  plDynamicArray<plRTTIPropertyTable*, plStaticsAllocatorWrapper> m_RetiredPropertyTables;
 
   bool m_bIterating = false;
 };
 
+/// Incremented whenever a type is updated or unregistered, see plRTTI::GetTypeChangeCounter().
+/// Zero-initialized before any type is constructed, so it is safe to use during static initialization.
+static plInt32 s_iTypeChangeCounter = 0;
+
+/// Incremented before a property table is built, so that plRTTI::InvalidatePropertyTables() can skip searching for derived types
+/// during static initialization, when no tables exist yet.
+static plInt32 s_iNumBuiltPropertyTables = 0;
+
+/// \brief All properties of a type including those of its base types, with an open addressing hash table for lookups by name.
+struct plRTTIPropertyTable
+{
+  struct Slot
+  {
+    PL_DECLARE_POD_TYPE();
+
+    plUInt64 m_uiNameHash;
+    plUInt32 m_uiProperty; ///< Index + 1 into m_AllProperties, 0 for empty slots.
+    bool m_bInherited;     ///< Whether the property is declared in a base type.
+  };
+
+  plUInt32 m_uiSlotMask = 0;
+  plDynamicArray<const plAbstractProperty*, plStaticsAllocatorWrapper> m_AllProperties; ///< In the same order as plRTTI::GetAllProperties().
+  plDynamicArray<Slot, plStaticsAllocatorWrapper> m_Slots;
+};
+
 plTypeData* GetTypeData()
 {
   // Prevent static initialization hazard between first plRTTI instance
@@ -47,6 +73,7 @@ PL_BEGIN_SUBSYSTEM_DECLARATION(Foundation, Reflection)
   ON_CORESYSTEMS_SHUTDOWN
   {
     plPlugin::Events().RemoveEventHandler(plRTTI::PluginEventHandler);
+    plRTTI::ReclaimPropertyTables();
   }
 
 PL_END_SUBSYSTEM_DECLARATION;
@@ -91,6 +118,9 @@ plRTTI::~plRTTI()
   {
     UnregisterType();
   }
+
+  plRTTIPropertyTable* pTable = m_pPropertyTable.load(std::memory_order_acquire);
+  PL_DELETE(plFoundation::GetStaticsAllocator(), pTable);
 }
 
 void plRTTI::GatherDynamicMessageHandlers()
@@ -209,6 +239,9 @@ void plRTTI::UpdateType(const plRTTI* pParentType, plUInt32 uiTypeSize, plUInt32
   m_uiTypeVersion = uiTypeVersion;
   m_TypeFlags = flags;
   m_ParentHierarchy.Clear();
+
+  InvalidatePropertyTables();
+  plAtomicUtils::Increment(s_iTypeChangeCounter);
 }
 
 void plRTTI::RegisterType()
@@ -225,6 +258,8 @@ void plRTTI::RegisterType()
 
 void plRTTI::UnregisterType()
 {
+  plAtomicUtils::Increment(s_iTypeChangeCounter);
+
   auto pData = GetTypeData();
   PL_LOCK(pData->m_Mutex);
   pData->m_TypeNameHashToType.Remove(m_uiTypeNameHash);
@@ -240,11 +275,7 @@ void plRTTI::UnregisterType()
 void plRTTI::GetAllProperties(plDynamicArray<const plAbstractProperty*>& out_properties) const
 {
   out_properties.Clear();
-
-  if (m_pParentType)
-    m_pParentType->GetAllProperties(out_properties);
-
-  out_properties.PushBackRange(GetProperties());
+  out_properties.PushBackRange(GetPropertyTable()->m_AllProperties.GetArrayPtr());
 }
 
 const plRTTI* plRTTI::FindTypeByName(plStringView sName)
@@ -293,25 +324,150 @@ const plRTTI* plRTTI::FindTypeIf(PredicateFunc func)
 
 const plAbstractProperty* plRTTI::FindPropertyByName(plStringView sName, bool bSearchBaseTypes /* = true */) const
 {
-  const plRTTI* pInstance = this;
+  return FindPropertyByNameHash(plHashingUtils::StringHash(sName), sName, bSearchBaseTypes);
+}
+
+const plAbstractProperty* plRTTI::FindPropertyByNameHash(plUInt64 uiNameHash, plStringView sName, bool bSearchBaseTypes /* = true */) const
+{
+  const plRTTIPropertyTable* pTable = GetPropertyTable();
+
+  for (plUInt32 uiSlot = static_cast<plUInt32>(uiNameHash) & pTable->m_uiSlotMask;; uiSlot = (uiSlot + 1) & pTable->m_uiSlotMask)
+  {
+    const plRTTIPropertyTable::Slot& slot = pTable->m_Slots[uiSlot];
+
+    if (slot.m_uiProperty == 0)
+      return nullptr;
+
+    if (slot.m_uiNameHash != uiNameHash)
+      continue;
+
+    const plAbstractProperty* pProp = pTable->m_AllProperties[slot.m_uiProperty - 1];
+
+    // only compare the name to be safe against hash collisions
+    if (pProp->GetPropertyName() != sName)
+      continue;
+
+    return (!bSearchBaseTypes && slot.m_bInherited) ? nullptr : pProp;
+  }
+}
+
+plUInt32 plRTTI::GetTypeChangeCounter()
+{
+  return static_cast<plUInt32>(plAtomicUtils::Read(s_iTypeChangeCounter));
+}
+
+const plRTTIPropertyTable* plRTTI::GetPropertyTable() const
+{
+  plRTTIPropertyTable* pCurrent = m_pPropertyTable.load(std::memory_order_acquire);
+  if (pCurrent != nullptr)
+    return pCurrent;
+
+  plAtomicUtils::Increment(s_iNumBuiltPropertyTables);
+
+  plRTTIPropertyTable* pTable = PL_NEW(plFoundation::GetStaticsAllocator(), plRTTIPropertyTable);
+
+  plHybridArray<const plRTTI*, 8> hierarchy;
+  for (const plRTTI* pInstance = this; pInstance != nullptr; pInstance = pInstance->m_pParentType)
+  {
+    hierarchy.PushBack(pInstance);
+  }
+
+  // base type properties first, like GetAllProperties() always did
+  for (plUInt32 i = hierarchy.GetCount(); i > 0; --i)
+  {
+    pTable->m_AllProperties.PushBackRange(hierarchy[i - 1]->m_Properties);
+  }
+
+  const plUInt32 uiNumSlots = plMath::PowerOfTwo_Ceil(plMath::Max(8u, pTable->m_AllProperties.GetCount() * 2));
+  pTable->m_uiSlotMask = uiNumSlots - 1;
+  pTable->m_Slots.SetCount(uiNumSlots, {0, 0, false});
+
+  // insert the properties of derived types first, so that they hide properties with the same name in base types
+  plUInt32 uiFirstProperty = pTable->m_AllProperties.GetCount();
+  for (plUInt32 i = 0; i < hierarchy.GetCount(); ++i)
+  {
+    const plArrayPtr<const plAbstractProperty* const> properties = hierarchy[i]->m_Properties;
+    uiFirstProperty -= properties.GetCount();
+
+    for (plUInt32 p = 0; p < properties.GetCount(); ++p)
+    {
+      const plStringView sName = properties[p]->GetPropertyName();
+      const plUInt64 uiNameHash = plHashingUtils::StringHash(sName);
+
+      plUInt32 uiSlot = static_cast<plUInt32>(uiNameHash) & pTable->m_uiSlotMask;
+      bool bHidden = false;
+      for (; pTable->m_Slots[uiSlot].m_uiProperty != 0; uiSlot = (uiSlot + 1) & pTable->m_uiSlotMask)
+      {
+        const plRTTIPropertyTable::Slot& slot = pTable->m_Slots[uiSlot];
+        if (slot.m_uiNameHash == uiNameHash && pTable->m_AllProperties[slot.m_uiProperty - 1]->GetPropertyName() == sName)
+        {
+          bHidden = true;
+          break;
+        }
+      }
 
-  do
+      if (!bHidden)
+      {
+        pTable->m_Slots[uiSlot] = {uiNameHash, uiFirstProperty + p + 1, i > 0};
+      }
+    }
+  }
+
+  if (!m_pPropertyTable.compare_exchange_strong(pCurrent, pTable, std::memory_order_acq_rel, std::memory_order_acquire))
   {
-    for (plUInt32 p = 0; p < pInstance->m_Properties.GetCount(); ++p)
+    // another thread built the table at the same time
+    PL_DELETE(plFoundation::GetStaticsAllocator(), pTable);
+    return pCurrent;
+  }
+
+  return pTable;
+}
+
+void plRTTI::InvalidatePropertyTables()
+{
+  if (plAtomicUtils::Read(s_iNumBuiltPropertyTables) == 0)
+    return;
+
+  auto pData = GetTypeData();
+  PL_LOCK(pData->m_Mutex);
+
+  // other threads may still be reading the old tables, so they are only deleted in ReclaimPropertyTables()
+  auto RetireTable = [&](const plRTTI* pType)
+  {
+    if (plRTTIPropertyTable* pTable = pType->m_pPropertyTable.exchange(nullptr, std::memory_order_acq_rel))
     {
-      if (pInstance->m_Properties[p]->GetPropertyName() == sName)
+      pData->m_RetiredPropertyTables.PushBack(pTable);
+    }
+  };
+
+  RetireTable(this);
+
+  // the tables of derived types contain the properties of this type as well
+  for (const plRTTI* pType : pData->m_AllTypes)
+  {
+    for (const plRTTI* pBase = pType->m_pParentType; pBase != nullptr; pBase = pBase->m_pParentType)
+    {
+      if (pBase == this)
       {
-        return pInstance->m_Properties[p];
+        RetireTable(pType);
+        break;
       }
     }
+  }
+}
 
-    if (!bSearchBaseTypes)
-      return nullptr;
+void plRTTI::ReclaimPropertyTables()
+{
+  auto pData = GetTypeData();
+  PL_LOCK(pData->m_Mutex);
 
-    pInstance = pInstance->m_pParentType;
-  } while (pInstance != nullptr);
+  for (plRTTIPropertyTable* pTable : pData->m_RetiredPropertyTables)
+  {
+    PL_DELETE(plFoundation::GetStaticsAllocator(), pTable);
+  }
 
-  return nullptr;
+  pData->m_RetiredPropertyTables.Clear();
+  pData->m_RetiredPropertyTables.Compact();
 }
 
 bool plRTTI::DispatchMessage(void* pInstance, plMessage& ref_msg) const
@@ -544,6 +700,13 @@ void plRTTI::PluginEventHandler(const plPluginEvent& EventData)
     }
     break;
 
+    case plPluginEvent::AfterPluginChanges:
+    {
+      // plugin changes are not done while other threads use reflection, so no one can still hold on to a retired property table
+      ReclaimPropertyTables();
+    }
+    break;
+
     default:
       break;
   }
@@ -7,10 +7,13 @@
 #include <Foundation/Memory/Allocator.h>
 #include <Foundation/Reflection/Implementation/StaticRTTI.h>
 
+#include <atomic>
+
 // *****************************************
 // ***** Runtime Type Information Data *****
 
 struct plRTTIAllocator;
+struct plRTTIPropertyTable;
 class plAbstractProperty;
 class plAbstractFunctionProperty;
 class plAbstractMessageHandler;
@@ -109,9 +112,21 @@ public:
   /// \brief Searches all plRTTI instances for one where the given predicate function returns true
   static const plRTTI* FindTypeIf(PredicateFunc func);
 
-  /// \brief Will iterate over all properties of this type and (optionally) the base types to search for a property with the given name.
+  /// \brief Searches the properties of this type and (optionally) the base types for a property with the given name.
+  ///
+  /// The first call builds a hash table of all properties of the type, including those of the base types, afterwards every lookup is O(1).
   const plAbstractProperty* FindPropertyByName(plStringView sName, bool bSearchBaseTypes = true) const; // [tested]
 
+  /// \brief Same as FindPropertyByName(), but takes the already computed hash of the name, e.g. from plHashedString::GetHash().
+  ///
+  /// The name is still compared when the hash matches, so that hash collisions can't return the wrong property.
+  const plAbstractProperty* FindPropertyByNameHash(plUInt64 uiNameHash, plStringView sName, bool bSearchBaseTypes = true) const;
+
+  /// \brief Returns a counter that changes whenever a type is updated or unregistered.
+  ///
+  /// Caches that store plRTTI or property pointers can compare it against a stored value to detect when they have to be cleared.
+  static plUInt32 GetTypeChangeCounter();
+
   /// \brief Returns the name of the plugin which this type is declared in.
   PL_ALWAYS_INLINE plStringView GetPluginName() const { return m_sPluginName; } // [tested]
 
@@ -191,6 +206,8 @@ protected:
   void GatherDynamicMessageHandlers();
   void SetupParentHierarchy();
 
+  const plRTTIPropertyTable* GetPropertyTable() const;
+
   const plRTTI* m_pParentType = nullptr;
   plRTTIAllocator* m_pAllocator = nullptr;
 
@@ -210,12 +227,22 @@ protected:
   plArrayPtr<plMessageSenderInfo> m_MessageSenders;
   plSmallArray<const plRTTI*, 7, plStaticsAllocatorWrapper> m_ParentHierarchy;
 
+  /// Built on first use and rebuilt after this type or one of its base types was updated. Outdated tables may still be in use by
+  /// other threads, so they are only deleted after all plugin changes are finished and at shutdown, see ReclaimPropertyTables().
+  mutable std::atomic<plRTTIPropertyTable*> m_pPropertyTable = nullptr;
+
 private:
   PL_MAKE_SUBSYSTEM_STARTUP_FRIEND(Foundation, Reflection);
 
   /// \brief Assigns the given plugin name to every plRTTI instance that has no plugin assigned yet.
   static void AssignPlugin(plStringView sPluginName);
 
+  /// \brief Deletes all property tables that were replaced by UpdateType().
+  static void ReclaimPropertyTables();
+
+  /// \brief Replaces the property tables of this type and all derived types, so that they get rebuilt on next use.
+  void InvalidatePropertyTables();
+
   static void SanityCheckType(plRTTI* pType);
 
   /// \brief Handles events by plPlugin, to figure out which types were provided by which plugin
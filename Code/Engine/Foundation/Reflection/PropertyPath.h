@@ -76,6 +76,15 @@ private:
   static plResult ResolvePath(void* pCurrentObject, const plRTTI* pType, const plArrayPtr<const ResolvedStep> path, bool bWriteToObject,
     const plDelegate<void(void* pLeaf, const plRTTI& pType)>& func);
 
+  PL_MAKE_SUBSYSTEM_STARTUP_FRIEND(Foundation, PropertyPath);
+
+  /// \brief Paths that were resolved by InitializeFromPath(const plRTTI&, const char*), shared by all instances.
+  struct PathCache;
+  static PathCache* s_pPathCache;
+
+  bool FindCachedPath(const plRTTI& rootObjectRtti, plStringView sPath, plUInt64 uiPathHash);
+  void AddCachedPath(const plRTTI& rootObjectRtti, plStringView sPath, plUInt64 uiPathHash) const;
+
   bool m_bIsValid = false;
   plHybridArray<ResolvedStep, 2> m_PathSteps;
 };
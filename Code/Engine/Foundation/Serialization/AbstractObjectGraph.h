@@ -3,12 +3,15 @@
 /// \file
 
 #include <Foundation/Basics.h>
+#include <Foundation/Containers/HashSet.h>
 #include <Foundation/Containers/HybridArray.h>
 #include <Foundation/Containers/Set.h>
 #include <Foundation/Reflection/Reflection.h>
 #include <Foundation/Strings/HashedString.h>
 #include <Foundation/Types/Enum.h>
 #include <Foundation/Types/Uuid.h>
+
+#include <atomic>
 #include <Foundation/Types/Variant.h>
 
 class plAbstractObjectGraph;
@@ -48,13 +51,27 @@ public:
   void SetType(plStringView sType);
 
   const Property* FindProperty(plStringView sName) const;
+
+  /// \brief Returns a property for modification. Any change through the returned pointer has to be done before GetContentHash() is called again.
   Property* FindProperty(plStringView sName);
 
   plStringView GetNodeName() const { return m_sNodeName; }
 
+  /// \brief Returns a hash over the names and values of all properties, independent of their order.
+  ///
+  /// The hash is computed on first use and cached until the properties are modified. Nodes with the same hash have the same properties,
+  /// which allows plAbstractObjectGraph::CreateDiffWithBaseGraph to skip unchanged nodes without comparing every value.
+  /// Returns 0 if a property holds a value that can't be hashed (typed objects and pointers), such nodes are always compared property by property.
+  /// May be called from multiple threads at the same time, as long as the node isn't modified.
+  plUInt64 GetContentHash() const;
+
 private:
   friend class plAbstractObjectGraph;
 
+  static constexpr plUInt64 ContentHashNotComputed = 0xFFFFFFFFFFFFFFFFull;
+
+  void InvalidateContentHash() { m_uiContentHash.store(ContentHashNotComputed, std::memory_order_relaxed); }
+
   plAbstractObjectGraph* m_pOwner = nullptr;
 
   plUuid m_Guid;
@@ -62,6 +79,9 @@ private:
   plStringView m_sType;
   plStringView m_sNodeName;
 
+  /// Threads that compute the hash at the same time all store the same value, so it is enough to make the accesses atomic.
+  mutable std::atomic<plUInt64> m_uiContentHash = ContentHashNotComputed;
+
   plHybridArray<Property, 16> m_Properties;
 };
 PL_DECLARE_REFLECTABLE_TYPE(PL_FOUNDATION_DLL, plAbstractObjectNode);
@@ -122,6 +142,9 @@ public:
   using FilterFunction = plDelegate<bool(const plAbstractObjectNode*, const plAbstractObjectNode::Property*)>;
   plAbstractObjectNode* Clone(plAbstractObjectGraph& ref_cloneTarget, const plAbstractObjectNode* pRootNode = nullptr, FilterFunction filter = FilterFunction()) const;
 
+  /// \brief Stores the string for the lifetime of the graph and returns a view to it.
+  ///
+  /// Strings are interned globally (through plHashedString), so equal strings registered in different graphs share the same memory.
   plStringView RegisterString(plStringView sString);
 
   const plAbstractObjectNode* GetNode(const plUuid& guid) const;
@@ -163,6 +186,10 @@ public:
 
   plAbstractObjectNode* CopyNodeIntoGraph(const plAbstractObjectNode* pNode, FilterFunction& ref_filter);
 
+  /// \brief Computes the operations that turn the base graph into this graph.
+  ///
+  /// Nodes that exist in both graphs are only compared property by property if their content hashes differ.
+  /// For large graphs the nodes are compared in parallel, the order of the operations is always the same.
   void CreateDiffWithBaseGraph(const plAbstractObjectGraph& base, plDeque<plAbstractGraphDiffOperation>& out_diffResult) const;
 
   void ApplyDiff(plDeque<plAbstractGraphDiffOperation>& ref_diff);
@@ -176,7 +203,7 @@ private:
   void MergeArrays(const plVariantArray& baseArray, const plVariantArray& leftArray, const plVariantArray& rightArray, plVariantArray& out) const;
   void ReMapNodeGuidsToMatchGraphRecursive(plHashTable<plUuid, plUuid>& guidMap, plAbstractObjectNode* lhs, const plAbstractObjectGraph& rhsGraph, const plAbstractObjectNode* rhs);
 
-  plSet<plString> m_Strings;
+  plHashSet<plHashedString> m_Strings;
   plMap<plUuid, plAbstractObjectNode*> m_Nodes;
   plMap<plStringView, plAbstractObjectNode*> m_NodesByName;
 };
@@ -4,6 +4,7 @@
 #include <Foundation/Serialization/AbstractObjectGraph.h>
 #include <Foundation/Serialization/ApplyNativePropertyChangesContext.h>
 #include <Foundation/Serialization/RttiConverter.h>
+#include <Foundation/Threading/TaskSystem.h>
 
 // clang-format off
 PL_BEGIN_STATIC_REFLECTED_ENUM(plObjectChangeType, 1)
@@ -29,6 +30,90 @@ PL_BEGIN_STATIC_REFLECTED_TYPE(plDiffOperation, plNoBase, 1, plRTTIDefaultAlloca
 PL_END_STATIC_REFLECTED_TYPE;
 // clang-format on
 
+namespace
+{
+  /// Typed pointers can't be hashed at all. Typed objects are not hashed either, custom variant types only provide a 32 bit hash,
+  /// which isn't reliable enough to skip comparing the values.
+  bool plAbstractObjectGraphIsHashable(const plVariant& value)
+  {
+    switch (value.GetType())
+    {
+      case plVariantType::TypedPointer:
+      case plVariantType::TypedObject:
+        return false;
+
+      case plVariantType::VariantArray:
+        for (const plVariant& element : value.Get<plVariantArray>())
+        {
+          if (!plAbstractObjectGraphIsHashable(element))
+            return false;
+        }
+        return true;
+
+      case plVariantType::VariantDictionary:
+        for (auto it = value.Get<plVariantDictionary>().GetIterator(); it.IsValid(); ++it)
+        {
+          if (!plAbstractObjectGraphIsHashable(it.Value()))
+            return false;
+        }
+        return true;
+
+      default:
+        return true;
+    }
+  }
+
+  PL_ALWAYS_INLINE bool plAbstractObjectGraphIsSameName(plStringView sName1, plStringView sName2)
+  {
+    // names are registered as hashed strings, so within a graph and across graphs equal names usually point to the same memory
+    if (sName1.GetStartPointer() == sName2.GetStartPointer() && sName1.GetElementCount() == sName2.GetElementCount())
+      return true;
+
+    return sName1 == sName2;
+  }
+
+  /// Nodes of the same type are usually written by the same code, so the property is typically found at the same index.
+  const plAbstractObjectNode::Property* plAbstractObjectGraphFindProperty(const plAbstractObjectNode& node, plUInt32 uiIndexHint, plStringView sName)
+  {
+    const auto& properties = node.GetProperties();
+
+    if (uiIndexHint < properties.GetCount() && plAbstractObjectGraphIsSameName(properties[uiIndexHint].m_sPropertyName, sName))
+      return &properties[uiIndexHint];
+
+    for (const plAbstractObjectNode::Property& prop : properties)
+    {
+      if (plAbstractObjectGraphIsSameName(prop.m_sPropertyName, sName))
+        return &prop;
+    }
+
+    return nullptr;
+  }
+
+  /// Returns true if the property at uiIndex doesn't exist in the base node or has a different value there.
+  bool plAbstractObjectGraphIsPropertyChanged(const plAbstractObjectNode& node, const plAbstractObjectNode& baseNode, plUInt32 uiIndex)
+  {
+    const plAbstractObjectNode::Property& prop = node.GetProperties()[uiIndex];
+    const plAbstractObjectNode::Property* pBaseProp = plAbstractObjectGraphFindProperty(baseNode, uiIndex, prop.m_sPropertyName);
+
+    return pBaseProp == nullptr || pBaseProp->m_Value != prop.m_Value;
+  }
+
+  bool plAbstractObjectGraphHasChangedProperties(const plAbstractObjectNode& node, const plAbstractObjectNode& baseNode)
+  {
+    const plUInt64 uiHash = node.GetContentHash();
+    if (uiHash != 0 && uiHash == baseNode.GetContentHash())
+      return false;
+
+    for (plUInt32 i = 0; i < node.GetProperties().GetCount(); ++i)
+    {
+      if (plAbstractObjectGraphIsPropertyChanged(node, baseNode, i))
+        return true;
+    }
+
+    return false;
+  }
+} // namespace
+
 plAbstractObjectGraph::~plAbstractObjectGraph()
 {
   Clear();
@@ -92,9 +177,12 @@ plAbstractObjectNode* plAbstractObjectGraph::Clone(plAbstractObjectGraph& ref_cl
 
 plStringView plAbstractObjectGraph::RegisterString(plStringView sString)
 {
-  auto it = m_Strings.Insert(sString);
-  PL_ASSERT_DEV(it.IsValid(), "");
-  return it.Key();
+  plHashedString sHashed;
+  sHashed.Assign(sString);
+
+  // the set keeps the string alive, the view points into the global string storage
+  m_Strings.Insert(sHashed);
+  return sHashed.GetView();
 }
 
 plAbstractObjectNode* plAbstractObjectGraph::GetNode(const plUuid& guid)
@@ -166,6 +254,7 @@ void plAbstractObjectNode::AddProperty(plStringView sName, const plVariant& valu
   auto& prop = m_Properties.ExpandAndGetRef();
   prop.m_sPropertyName = m_pOwner->RegisterString(sName);
   prop.m_Value = value;
+  InvalidateContentHash();
 }
 
 void plAbstractObjectNode::ChangeProperty(plStringView sName, const plVariant& value)
@@ -175,6 +264,7 @@ void plAbstractObjectNode::ChangeProperty(plStringView sName, const plVariant& v
     if (m_Properties[i].m_sPropertyName == sName)
     {
       m_Properties[i].m_Value = value;
+      InvalidateContentHash();
       return;
     }
   }
@@ -189,6 +279,7 @@ void plAbstractObjectNode::RenameProperty(plStringView sOldName, plStringView sN
     if (m_Properties[i].m_sPropertyName == sOldName)
     {
       m_Properties[i].m_sPropertyName = m_pOwner->RegisterString(sNewName);
+      InvalidateContentHash();
       return;
     }
   }
@@ -197,6 +288,7 @@ void plAbstractObjectNode::RenameProperty(plStringView sOldName, plStringView sN
 void plAbstractObjectNode::ClearProperties()
 {
   m_Properties.Clear();
+  InvalidateContentHash();
 }
 
 plResult plAbstractObjectNode::InlineProperty(plStringView sName)
@@ -233,6 +325,7 @@ plResult plAbstractObjectNode::InlineProperty(plStringView sName)
         return PL_FAILURE;
 
       prop.m_Value.MoveTypedObject(pObject, plRTTI::FindTypeByName(pNode->GetType()));
+      InvalidateContentHash();
 
       // Delete old objects.
       for (plUuid& uuid : context.m_SubTree)
@@ -252,6 +345,7 @@ void plAbstractObjectNode::RemoveProperty(plStringView sName)
     if (m_Properties[i].m_sPropertyName == sName)
     {
       m_Properties.RemoveAtAndSwap(i);
+      InvalidateContentHash();
       return;
     }
   }
@@ -281,6 +375,8 @@ plAbstractObjectNode::Property* plAbstractObjectNode::FindProperty(plStringView
   {
     if (m_Properties[i].m_sPropertyName == sName)
     {
+      // the caller may modify the property
+      InvalidateContentHash();
       return &m_Properties[i];
     }
   }
@@ -288,6 +384,36 @@ plAbstractObjectNode::Property* plAbstractObjectNode::FindProperty(plStringView
   return nullptr;
 }
 
+plUInt64 plAbstractObjectNode::GetContentHash() const
+{
+  const plUInt64 uiCachedHash = m_uiContentHash.load(std::memory_order_relaxed);
+  if (uiCachedHash != ContentHashNotComputed)
+    return uiCachedHash;
+
+  // sum up the hashes of all properties, so that the order of the properties doesn't matter
+  plUInt64 uiSum = 0;
+  bool bHashable = true;
+
+  for (const Property& prop : m_Properties)
+  {
+    if (!plAbstractObjectGraphIsHashable(prop.m_Value))
+    {
+      bHashable = false;
+      break;
+    }
+
+    uiSum += prop.m_Value.ComputeHash(plHashingUtils::xxHash64String(prop.m_sPropertyName));
+  }
+
+  plUInt64 uiHash = bHashable ? plHashingUtils::xxHash64(&uiSum, sizeof(uiSum), m_Properties.GetCount()) : 0;
+
+  if (uiHash == ContentHashNotComputed)
+    uiHash = ContentHashNotComputed - 1;
+
+  m_uiContentHash.store(uiHash, std::memory_order_relaxed);
+  return uiHash;
+}
+
 void plAbstractObjectGraph::ReMapNodeGuids(const plUuid& seedGuid, bool bRemapInverse /*= false*/)
 {
   plHybridArray<plAbstractObjectNode*, 16> nodes;
@@ -321,6 +447,7 @@ void plAbstractObjectGraph::ReMapNodeGuids(const plUuid& seedGuid, bool bRemapIn
     {
       RemapVariant(prop.m_Value, guidMap);
     }
+    pNode->InvalidateContentHash();
     m_Nodes[pNode->m_Guid] = pNode;
   }
 }
@@ -333,6 +460,9 @@ void plAbstractObjectGraph::ReMapNodeGuidsToMatchGraph(plAbstractObjectNode* pRo
 
   ReMapNodeGuidsToMatchGraphRecursive(guidMap, pRoot, rhsGraph, pRhsRoot);
 
+  if (guidMap.IsEmpty())
+    return;
+
   // go through all nodes to remap remaining occurrences of remapped guids
   for (auto it : m_Nodes)
   {
@@ -341,7 +471,7 @@ void plAbstractObjectGraph::ReMapNodeGuidsToMatchGraph(plAbstractObjectNode* pRo
     {
       RemapVariant(prop.m_Value, guidMap);
     }
-    m_Nodes[it.Value()->m_Guid] = it.Value();
+    it.Value()->InvalidateContentHash();
   }
 }
 
@@ -361,15 +491,17 @@ void plAbstractObjectGraph::ReMapNodeGuidsToMatchGraphRecursive(plHashTable<plUu
     m_Nodes.Insert(rhs->GetGuid(), lhs);
   }
 
-  for (plAbstractObjectNode::Property& prop : lhs->m_Properties)
+  for (plUInt32 uiProp = 0; uiProp < lhs->m_Properties.GetCount(); ++uiProp)
   {
+    const plAbstractObjectNode::Property& prop = lhs->m_Properties[uiProp];
+
     if (prop.m_Value.IsA<plUuid>() && prop.m_Value.Get<plUuid>().IsValid())
     {
       // if the guid is an owned object in the graph, remap to rhs.
       auto it = m_Nodes.Find(prop.m_Value.Get<plUuid>());
       if (it.IsValid())
       {
-        if (const plAbstractObjectNode::Property* rhsProp = rhs->FindProperty(prop.m_sPropertyName))
+        if (const plAbstractObjectNode::Property* rhsProp = plAbstractObjectGraphFindProperty(*rhs, uiProp, prop.m_sPropertyName))
         {
           if (rhsProp->m_Value.IsA<plUuid>() && rhsProp->m_Value.Get<plUuid>().IsValid())
           {
@@ -384,8 +516,15 @@ void plAbstractObjectGraph::ReMapNodeGuidsToMatchGraphRecursive(plHashTable<plUu
     // Arrays may be of owner guids and could be remapped.
     else if (prop.m_Value.IsA<plVariantArray>())
     {
+      const plAbstractObjectNode::Property* rhsProp = plAbstractObjectGraphFindProperty(*rhs, uiProp, prop.m_sPropertyName);
+      if (rhsProp == nullptr || !rhsProp->m_Value.IsA<plVariantArray>())
+        continue;
+
       const plVariantArray& values = prop.m_Value.Get<plVariantArray>();
-      for (plUInt32 i = 0; i < values.GetCount(); i++)
+      const plVariantArray& rhsValues = rhsProp->m_Value.Get<plVariantArray>();
+      const plUInt32 uiCount = plMath::Min(values.GetCount(), rhsValues.GetCount());
+
+      for (plUInt32 i = 0; i < uiCount; i++)
       {
         auto& subValue = values[i];
         if (subValue.IsA<plUuid>() && subValue.Get<plUuid>().IsValid())
@@ -394,22 +533,12 @@ void plAbstractObjectGraph::ReMapNodeGuidsToMatchGraphRecursive(plHashTable<plUu
           auto it = m_Nodes.Find(subValue.Get<plUuid>());
           if (it.IsValid())
           {
-            if (const plAbstractObjectNode::Property* rhsProp = rhs->FindProperty(prop.m_sPropertyName))
+            const auto& rhsElemValue = rhsValues[i];
+            if (rhsElemValue.IsA<plUuid>() && rhsElemValue.Get<plUuid>().IsValid())
             {
-              if (rhsProp->m_Value.IsA<plVariantArray>())
+              if (const plAbstractObjectNode* rhsPropNode = rhsGraph.GetNode(rhsElemValue.Get<plUuid>()))
               {
-                const plVariantArray& rhsValues = rhsProp->m_Value.Get<plVariantArray>();
-                if (i < rhsValues.GetCount())
-                {
-                  const auto& rhsElemValue = rhsValues[i];
-                  if (rhsElemValue.IsA<plUuid>() && rhsElemValue.Get<plUuid>().IsValid())
-                  {
-                    if (const plAbstractObjectNode* rhsPropNode = rhsGraph.GetNode(rhsElemValue.Get<plUuid>()))
-                    {
-                      ReMapNodeGuidsToMatchGraphRecursive(guidMap, it.Value(), rhsGraph, rhsPropNode);
-                    }
-                  }
-                }
+                ReMapNodeGuidsToMatchGraphRecursive(guidMap, it.Value(), rhsGraph, rhsPropNode);
               }
             }
           }
@@ -419,7 +548,13 @@ void plAbstractObjectGraph::ReMapNodeGuidsToMatchGraphRecursive(plHashTable<plUu
     // Maps may be of owner guids and could be remapped.
     else if (prop.m_Value.IsA<plVariantDictionary>())
     {
+      const plAbstractObjectNode::Property* rhsProp = plAbstractObjectGraphFindProperty(*rhs, uiProp, prop.m_sPropertyName);
+      if (rhsProp == nullptr || !rhsProp->m_Value.IsA<plVariantDictionary>())
+        continue;
+
       const plVariantDictionary& values = prop.m_Value.Get<plVariantDictionary>();
+      const plVariantDictionary& rhsValues = rhsProp->m_Value.Get<plVariantDictionary>();
+
       for (auto lhsIt = values.GetIterator(); lhsIt.IsValid(); ++lhsIt)
       {
         auto& subValue = lhsIt.Value();
@@ -429,21 +564,13 @@ void plAbstractObjectGraph::ReMapNodeGuidsToMatchGraphRecursive(plHashTable<plUu
           auto it = m_Nodes.Find(subValue.Get<plUuid>());
           if (it.IsValid())
           {
-            if (const plAbstractObjectNode::Property* rhsProp = rhs->FindProperty(prop.m_sPropertyName))
+            if (const plVariant* pRhsElemValue = rhsValues.GetValue(lhsIt.Key()))
             {
-              if (rhsProp->m_Value.IsA<plVariantDictionary>())
+              if (pRhsElemValue->IsA<plUuid>() && pRhsElemValue->Get<plUuid>().IsValid())
               {
-                const plVariantDictionary& rhsValues = rhsProp->m_Value.Get<plVariantDictionary>();
-                if (rhsValues.Contains(lhsIt.Key()))
+                if (const plAbstractObjectNode* rhsPropNode = rhsGraph.GetNode(pRhsElemValue->Get<plUuid>()))
                 {
-                  const auto& rhsElemValue = *rhsValues.GetValue(lhsIt.Key());
-                  if (rhsElemValue.IsA<plUuid>() && rhsElemValue.Get<plUuid>().IsValid())
-                  {
-                    if (const plAbstractObjectNode* rhsPropNode = rhsGraph.GetNode(rhsElemValue.Get<plUuid>()))
-                    {
-                      ReMapNodeGuidsToMatchGraphRecursive(guidMap, it.Value(), rhsGraph, rhsPropNode);
-                    }
-                  }
+                  ReMapNodeGuidsToMatchGraphRecursive(guidMap, it.Value(), rhsGraph, rhsPropNode);
                 }
               }
             }
@@ -618,90 +745,115 @@ void plAbstractObjectGraph::CreateDiffWithBaseGraph(const plAbstractObjectGraph&
 {
   out_diffResult.Clear();
 
-  // check whether any nodes have been deleted
+  struct NodePair
+  {
+    PL_DECLARE_POD_TYPE();
+
+    const plAbstractObjectNode* m_pNode;
+    const plAbstractObjectNode* m_pBaseNode;
+    bool m_bChanged;
+  };
+
+  plDynamicArray<const plAbstractObjectNode*> removedNodes;
+  plDynamicArray<const plAbstractObjectNode*> addedNodes;
+  plDynamicArray<NodePair> commonNodes;
+  commonNodes.Reserve(plMath::Min(m_Nodes.GetCount(), base.m_Nodes.GetCount()));
+
+  // both maps are sorted by guid, so walking them side by side finds all removed, added and common nodes in one go
   {
-    for (auto itNodeBase = base.GetAllNodes().GetIterator(); itNodeBase.IsValid(); ++itNodeBase)
+    auto itNodeThis = m_Nodes.GetIterator();
+    auto itNodeBase = base.m_Nodes.GetIterator();
+
+    while (itNodeThis.IsValid() || itNodeBase.IsValid())
     {
-      if (GetNode(itNodeBase.Key()) == nullptr)
+      if (!itNodeThis.IsValid() || (itNodeBase.IsValid() && itNodeBase.Key() < itNodeThis.Key()))
       {
         // does not exist in this graph -> has been deleted from base
-        plAbstractGraphDiffOperation op;
-        op.m_Node = itNodeBase.Key();
-        op.m_Operation = plAbstractGraphDiffOperation::Op::NodeRemoved;
-        op.m_sProperty = itNodeBase.Value()->m_sType;
-        op.m_Value = itNodeBase.Value()->m_sNodeName;
-
-        out_diffResult.PushBack(op);
+        removedNodes.PushBack(itNodeBase.Value());
+        ++itNodeBase;
+      }
+      else if (!itNodeBase.IsValid() || itNodeThis.Key() < itNodeBase.Key())
+      {
+        // does not exist in base graph -> has been added
+        addedNodes.PushBack(itNodeThis.Value());
+        ++itNodeThis;
+      }
+      else
+      {
+        commonNodes.PushBack({itNodeThis.Value(), itNodeBase.Value(), false});
+        ++itNodeThis;
+        ++itNodeBase;
       }
     }
   }
 
-  // check whether any nodes have been added
+  // find the nodes that have any changed properties, every node is only accessed by one task
   {
-    for (auto itNodeThis = GetAllNodes().GetIterator(); itNodeThis.IsValid(); ++itNodeThis)
-    {
-      if (base.GetNode(itNodeThis.Key()) == nullptr)
-      {
-        // does not exist in base graph -> has been added
-        plAbstractGraphDiffOperation op;
-        op.m_Node = itNodeThis.Key();
-        op.m_Operation = plAbstractGraphDiffOperation::Op::NodeAdded;
-        op.m_sProperty = itNodeThis.Value()->m_sType;
-        op.m_Value = itNodeThis.Value()->m_sNodeName;
+    plParallelForParams params;
+    params.m_uiBinSize = 256;
 
-        out_diffResult.PushBack(op);
-
-        // set all properties
-        for (const auto& prop : itNodeThis.Value()->GetProperties())
+    plTaskSystem::ParallelForIndexed(
+      0, commonNodes.GetCount(), [&](plUInt32 uiStart, plUInt32 uiEnd)
+      {
+        for (plUInt32 i = uiStart; i < uiEnd; ++i)
         {
-          op.m_Operation = plAbstractGraphDiffOperation::Op::PropertyChanged;
-          op.m_sProperty = prop.m_sPropertyName;
-          op.m_Value = prop.m_Value;
-
-          out_diffResult.PushBack(op);
+          commonNodes[i].m_bChanged = plAbstractObjectGraphHasChangedProperties(*commonNodes[i].m_pNode, *commonNodes[i].m_pBaseNode);
         }
-      }
-    }
+      },
+      "plAbstractObjectGraph::CreateDiffWithBaseGraph", plTaskNesting::Never, params);
   }
 
-  // check whether any properties have been modified
+  for (const plAbstractObjectNode* pBaseNode : removedNodes)
   {
-    for (auto itNodeThis = GetAllNodes().GetIterator(); itNodeThis.IsValid(); ++itNodeThis)
-    {
-      const auto pBaseNode = base.GetNode(itNodeThis.Key());
+    plAbstractGraphDiffOperation op;
+    op.m_Node = pBaseNode->m_Guid;
+    op.m_Operation = plAbstractGraphDiffOperation::Op::NodeRemoved;
+    op.m_sProperty = pBaseNode->m_sType;
+    op.m_Value = pBaseNode->m_sNodeName;
 
-      if (pBaseNode == nullptr)
-        continue;
+    out_diffResult.PushBack(op);
+  }
 
-      for (const plAbstractObjectNode::Property& prop : itNodeThis.Value()->GetProperties())
-      {
-        bool bDifferent = true;
+  for (const plAbstractObjectNode* pNode : addedNodes)
+  {
+    plAbstractGraphDiffOperation op;
+    op.m_Node = pNode->m_Guid;
+    op.m_Operation = plAbstractGraphDiffOperation::Op::NodeAdded;
+    op.m_sProperty = pNode->m_sType;
+    op.m_Value = pNode->m_sNodeName;
 
-        for (const plAbstractObjectNode::Property& baseProp : pBaseNode->GetProperties())
-        {
-          if (baseProp.m_sPropertyName == prop.m_sPropertyName)
-          {
-            if (baseProp.m_Value == prop.m_Value)
-            {
-              bDifferent = false;
-              break;
-            }
+    out_diffResult.PushBack(op);
 
-            bDifferent = true;
-            break;
-          }
-        }
+    // set all properties
+    for (const auto& prop : pNode->GetProperties())
+    {
+      op.m_Operation = plAbstractGraphDiffOperation::Op::PropertyChanged;
+      op.m_sProperty = prop.m_sPropertyName;
+      op.m_Value = prop.m_Value;
 
-        if (bDifferent)
-        {
-          plAbstractGraphDiffOperation op;
-          op.m_Node = itNodeThis.Key();
-          op.m_Operation = plAbstractGraphDiffOperation::Op::PropertyChanged;
-          op.m_sProperty = prop.m_sPropertyName;
-          op.m_Value = prop.m_Value;
+      out_diffResult.PushBack(op);
+    }
+  }
 
-          out_diffResult.PushBack(op);
-        }
+  // check which properties have been modified
+  for (const NodePair& pair : commonNodes)
+  {
+    if (!pair.m_bChanged)
+      continue;
+
+    const auto& properties = pair.m_pNode->GetProperties();
+
+    for (plUInt32 i = 0; i < properties.GetCount(); ++i)
+    {
+      if (plAbstractObjectGraphIsPropertyChanged(*pair.m_pNode, *pair.m_pBaseNode, i))
+      {
+        plAbstractGraphDiffOperation op;
+        op.m_Node = pair.m_pNode->m_Guid;
+        op.m_Operation = plAbstractGraphDiffOperation::Op::PropertyChanged;
+        op.m_sProperty = properties[i].m_sPropertyName;
+        op.m_Value = properties[i].m_Value;
+
+        out_diffResult.PushBack(op);
       }
     }
   }
@@ -710,27 +862,32 @@ void plAbstractObjectGraph::CreateDiffWithBaseGraph(const plAbstractObjectGraph&
 
 void plAbstractObjectGraph::ApplyDiff(plDeque<plAbstractGraphDiffOperation>& ref_diff)
 {
+  // consecutive property changes usually affect the same node
+  plAbstractObjectNode* pLastNode = nullptr;
+
   for (const auto& op : ref_diff)
   {
     switch (op.m_Operation)
     {
       case plAbstractGraphDiffOperation::Op::NodeAdded:
       {
-        AddNode(op.m_Node, op.m_sProperty, op.m_uiTypeVersion, op.m_Value.Get<plString>());
+        pLastNode = AddNode(op.m_Node, op.m_sProperty, op.m_uiTypeVersion, op.m_Value.Get<plString>());
       }
       break;
 
       case plAbstractGraphDiffOperation::Op::NodeRemoved:
       {
         RemoveNode(op.m_Node);
+        pLastNode = nullptr;
       }
       break;
 
       case plAbstractGraphDiffOperation::Op::PropertyChanged:
       {
-        auto* pNode = GetNode(op.m_Node);
+        auto* pNode = (pLastNode != nullptr && pLastNode->m_Guid == op.m_Node) ? pLastNode : GetNode(op.m_Node);
         if (pNode)
         {
+          pLastNode = pNode;
           auto* pProp = pNode->FindProperty(op.m_sProperty);
 
           if (!pProp)
@@ -769,9 +926,46 @@ void plAbstractObjectGraph::MergeDiffs(const plDeque<plAbstractGraphDiffOperatio
     bool operator==(const Prop& rhs) const { return m_Node == rhs.m_Node && m_sProperty == rhs.m_sProperty; }
   };
 
-  plMap<Prop, plHybridArray<const plAbstractGraphDiffOperation*, 2>> propChanges;
-  plSet<plUuid> removed;
-  plMap<plUuid, plUInt32> added;
+  struct PropHash
+  {
+    static plUInt32 Hash(const Prop& key) { return plHashingUtils::CombineHashValues32(plHashHelper<plUuid>::Hash(key.m_Node), plHashHelper<plStringView>::Hash(key.m_sProperty)); }
+    static bool Equal(const Prop& a, const Prop& b) { return a == b; }
+  };
+
+  struct PropChange
+  {
+    PL_DECLARE_POD_TYPE();
+
+    Prop m_Key;
+    const plAbstractGraphDiffOperation* m_pLeft;
+    const plAbstractGraphDiffOperation* m_pRight;
+
+    bool operator<(const PropChange& rhs) const { return m_Key < rhs.m_Key; }
+  };
+
+  // changes are collected through a hash table and sorted once at the end, the result is the same as with an ordered map
+  plDynamicArray<PropChange> propChanges;
+  plHashTable<Prop, plUInt32, PropHash> propChangeIndices;
+  propChangeIndices.Reserve(lhs.GetCount() + rhs.GetCount());
+
+  auto AddPropChange = [&](const plAbstractGraphDiffOperation& op)
+  {
+    const Prop key(op.m_Node, op.m_sProperty);
+    plUInt32 uiIndex = 0;
+    if (propChangeIndices.TryGetValue(key, uiIndex))
+    {
+      if (propChanges[uiIndex].m_pRight == nullptr)
+        propChanges[uiIndex].m_pRight = &op;
+    }
+    else
+    {
+      propChangeIndices.Insert(key, propChanges.GetCount());
+      propChanges.PushBack({key, &op, nullptr});
+    }
+  };
+
+  plHashSet<plUuid> removed;
+  plHashTable<plUuid, plUInt32> added;
   for (const plAbstractGraphDiffOperation& op : lhs)
   {
     if (op.m_Operation == plAbstractGraphDiffOperation::Op::NodeRemoved)
@@ -786,8 +980,7 @@ void plAbstractObjectGraph::MergeDiffs(const plDeque<plAbstractGraphDiffOperatio
     }
     else if (op.m_Operation == plAbstractGraphDiffOperation::Op::PropertyChanged)
     {
-      auto it = propChanges.FindOrAdd(Prop(op.m_Node, op.m_sProperty));
-      it.Value().PushBack(&op);
+      AddPropChange(op);
     }
   }
   for (const plAbstractGraphDiffOperation& op : rhs)
@@ -799,9 +992,9 @@ void plAbstractObjectGraph::MergeDiffs(const plDeque<plAbstractGraphDiffOperatio
     }
     else if (op.m_Operation == plAbstractGraphDiffOperation::Op::NodeAdded)
     {
-      if (added.Contains(op.m_Node))
+      if (const plUInt32* pIndex = added.GetValue(op.m_Node))
       {
-        plAbstractGraphDiffOperation& leftOp = ref_out[added[op.m_Node]];
+        plAbstractGraphDiffOperation& leftOp = ref_out[*pIndex];
         leftOp.m_sProperty = op.m_sProperty; // Take type from rhs.
       }
       else
@@ -811,24 +1004,24 @@ void plAbstractObjectGraph::MergeDiffs(const plDeque<plAbstractGraphDiffOperatio
     }
     else if (op.m_Operation == plAbstractGraphDiffOperation::Op::PropertyChanged)
     {
-      auto it = propChanges.FindOrAdd(Prop(op.m_Node, op.m_sProperty));
-      it.Value().PushBack(&op);
+      AddPropChange(op);
     }
   }
 
-  for (auto it = propChanges.GetIterator(); it.IsValid(); ++it)
+  propChanges.Sort();
+
+  for (const PropChange& change : propChanges)
   {
-    const Prop& key = it.Key();
-    const plHybridArray<const plAbstractGraphDiffOperation*, 2>& value = it.Value();
+    const Prop& key = change.m_Key;
 
-    if (value.GetCount() == 1)
+    if (change.m_pRight == nullptr)
     {
-      ref_out.PushBack(*value[0]);
+      ref_out.PushBack(*change.m_pLeft);
     }
     else
     {
-      const plAbstractGraphDiffOperation& leftProp = *value[0];
-      const plAbstractGraphDiffOperation& rightProp = *value[1];
+      const plAbstractGraphDiffOperation& leftProp = *change.m_pLeft;
+      const plAbstractGraphDiffOperation& rightProp = *change.m_pRight;
 
       if (leftProp.m_Value.GetType() == plVariantType::VariantArray && rightProp.m_Value.GetType() == plVariantType::VariantArray)
       {
@@ -838,8 +1031,7 @@ void plAbstractObjectGraph::MergeDiffs(const plDeque<plAbstractGraphDiffOperatio
         const plAbstractObjectNode* pNode = GetNode(key.m_Node);
         if (pNode)
         {
-          plStringBuilder sTemp(key.m_sProperty);
-          const plAbstractObjectNode::Property* pProperty = pNode->FindProperty(sTemp);
+          const plAbstractObjectNode::Property* pProperty = pNode->FindProperty(key.m_sProperty);
           if (pProperty && pProperty->m_Value.GetType() == plVariantType::VariantArray)
           {
             // Do 3-way array merge
@@ -3,6 +3,7 @@
 #include <Foundation/IO/OpenDdlReader.h>
 #include <Foundation/IO/OpenDdlUtils.h>
 #include <Foundation/IO/OpenDdlWriter.h>
+#include <Foundation/IO/StreamUtils.h>
 #include <Foundation/Logging/Log.h>
 #include <Foundation/Serialization/DdlSerializer.h>
 #include <Foundation/Serialization/GraphVersioning.h>
@@ -181,8 +182,12 @@ static void ReadGraph(plAbstractObjectGraph* pGraph, const plOpenDdlReaderElemen
 plResult plAbstractGraphDdlSerializer::Read(
   plStreamReader& inout_stream, plAbstractObjectGraph* pGraph, plAbstractObjectGraph* pTypesGraph, bool bApplyPatches)
 {
+  // the whole document is needed anyway, parsing it in place is much faster than parsing the stream
+  plDynamicArray<plUInt8> content;
+  plStreamUtils::ReadAllAndAppend(inout_stream, content);
+
   plOpenDdlReader reader;
-  if (reader.ParseDocument(inout_stream, 0, plLog::GetThreadLocalLogSystem()).Failed())
+  if (reader.ParseDocument(plArrayPtr<const char>(reinterpret_cast<const char*>(content.GetData()), content.GetCount()), 0, plLog::GetThreadLocalLogSystem()).Failed())
   {
     plLog::Error("Failed to parse DDL graph");
     return PL_FAILURE;
@@ -232,8 +237,11 @@ plResult plAbstractGraphDdlSerializer::Read(const plOpenDdlReaderElement* pRootE
 
 plResult plAbstractGraphDdlSerializer::ReadBlocks(plStreamReader& stream, plHybridArray<plSerializedBlock, 3>& blocks)
 {
+  plDynamicArray<plUInt8> content;
+  plStreamUtils::ReadAllAndAppend(stream, content);
+
   plOpenDdlReader reader;
-  if (reader.ParseDocument(stream, 0, plLog::GetThreadLocalLogSystem()).Failed())
+  if (reader.ParseDocument(plArrayPtr<const char>(reinterpret_cast<const char*>(content.GetData()), content.GetCount()), 0, plLog::GetThreadLocalLogSystem()).Failed())
   {
     plLog::Error("Failed to parse DDL graph");
     return PL_FAILURE;
@@ -7,9 +7,43 @@
 #include <Foundation/Serialization/DdlSerializer.h>
 #include <Foundation/Serialization/ReflectionSerializer.h>
 #include <Foundation/Serialization/RttiConverter.h>
+#include <Foundation/Serialization/SerializationPlan.h>
 #include <Foundation/Types/ScopeExit.h>
 #include <Foundation/Types/VariantTypeRegistry.h>
 
+namespace
+{
+  /// \brief Returns the already consumed stream tag first and then continues with the actual stream.
+  class plReflectionSerializerPrefixReader : public plStreamReader
+  {
+  public:
+    plReflectionSerializerPrefixReader(plStreamReader& inout_stream, plUInt32 uiPrefix)
+      : m_Stream(inout_stream)
+      , m_uiPrefix(uiPrefix)
+    {
+    }
+
+    virtual plUInt64 ReadBytes(void* pReadBuffer, plUInt64 uiBytesToRead) override
+    {
+      plUInt64 uiBytesRead = 0;
+
+      if (m_uiPrefixBytesRead < sizeof(m_uiPrefix) && uiBytesToRead > 0)
+      {
+        uiBytesRead = plMath::Min<plUInt64>(uiBytesToRead, sizeof(m_uiPrefix) - m_uiPrefixBytesRead);
+        plMemoryUtils::Copy(static_cast<plUInt8*>(pReadBuffer), reinterpret_cast<const plUInt8*>(&m_uiPrefix) + m_uiPrefixBytesRead, static_cast<size_t>(uiBytesRead));
+        m_uiPrefixBytesRead += static_cast<plUInt32>(uiBytesRead);
+      }
+
+      return uiBytesRead + m_Stream.ReadBytes(static_cast<plUInt8*>(pReadBuffer) + uiBytesRead, uiBytesToRead - uiBytesRead);
+    }
+
+  private:
+    plStreamReader& m_Stream;
+    plUInt32 m_uiPrefix = 0;
+    plUInt32 m_uiPrefixBytesRead = 0;
+  };
+} // namespace
+
 ////////////////////////////////////////////////////////////////////////
 // plReflectionSerializer public static functions
 ////////////////////////////////////////////////////////////////////////
@@ -45,14 +79,8 @@ void plReflectionSerializer::WriteObjectToDDL(plOpenDdlWriter& ref_ddl, const pl
 
 void plReflectionSerializer::WriteObjectToBinary(plStreamWriter& inout_stream, const plRTTI* pRtti, const void* pObject)
 {
-  plAbstractObjectGraph graph;
-  plRttiConverterContext context;
-  plRttiConverterWriter conv(&graph, &context, false, true);
-
-  context.RegisterObject(plUuid::MakeUuid(), pRtti, const_cast<void*>(pObject));
-  conv.AddObjectToGraph(pRtti, const_cast<void*>(pObject), "root");
-
-  plAbstractGraphBinarySerializer::Write(inout_stream, &graph);
+  plReflectionBinaryWriter writer(inout_stream);
+  writer.WriteObject(pRtti, pObject);
 }
 
 void* plReflectionSerializer::ReadObjectFromDDL(plStreamReader& inout_stream, const plRTTI*& ref_pRtti)
@@ -90,10 +118,23 @@ void* plReflectionSerializer::ReadObjectFromDDL(const plOpenDdlReaderElement* pR
 
 void* plReflectionSerializer::ReadObjectFromBinary(plStreamReader& inout_stream, const plRTTI*& ref_pRtti)
 {
+  plUInt32 uiTag = 0;
+  inout_stream >> uiTag;
+
+  if (uiTag == plReflectionBinaryReader::GetStreamTag())
+  {
+    plReflectionBinaryReader reader(inout_stream);
+    reader.SkipStreamTag();
+    return reader.ReadObject(ref_pRtti);
+  }
+
+  // data that was written before plReflectionBinaryWriter existed
+  plReflectionSerializerPrefixReader prefixedStream(inout_stream, uiTag);
+
   plAbstractObjectGraph graph;
   plRttiConverterContext context;
 
-  plAbstractGraphBinarySerializer::Read(inout_stream, &graph);
+  plAbstractGraphBinarySerializer::Read(prefixedStream, &graph);
 
   plRttiConverterReader convRead(&graph, &context);
   auto* pRootNode = graph.GetNodeByName("root");
@@ -129,10 +170,23 @@ void plReflectionSerializer::ReadObjectPropertiesFromDDL(plStreamReader& inout_s
 
 void plReflectionSerializer::ReadObjectPropertiesFromBinary(plStreamReader& inout_stream, const plRTTI& rtti, void* pObject)
 {
+  plUInt32 uiTag = 0;
+  inout_stream >> uiTag;
+
+  if (uiTag == plReflectionBinaryReader::GetStreamTag())
+  {
+    plReflectionBinaryReader reader(inout_stream);
+    reader.SkipStreamTag();
+    reader.ReadObjectProperties(rtti, pObject).IgnoreResult();
+    return;
+  }
+
+  plReflectionSerializerPrefixReader prefixedStream(inout_stream, uiTag);
+
   plAbstractObjectGraph graph;
   plRttiConverterContext context;
 
-  plAbstractGraphBinarySerializer::Read(inout_stream, &graph);
+  plAbstractGraphBinarySerializer::Read(prefixedStream, &graph);
 
   plRttiConverterReader convRead(&graph, &context);
   auto* pRootNode = graph.GetNodeByName("root");
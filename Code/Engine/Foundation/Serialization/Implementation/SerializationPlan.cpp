@@ -0,0 +1,804 @@
+#include <Foundation/FoundationPCH.h>
+
+#include <Foundation/Configuration/Startup.h>
+#include <Foundation/IO/MemoryStream.h>
+#include <Foundation/IO/TypeVersionContext.h>
+#include <Foundation/Reflection/ReflectionUtils.h>
+#include <Foundation/Serialization/AbstractObjectGraph.h>
+#include <Foundation/Serialization/BinarySerializer.h>
+#include <Foundation/Serialization/GraphVersioning.h>
+#include <Foundation/Serialization/RttiConverter.h>
+#include <Foundation/Serialization/SerializationPlan.h>
+#include <Foundation/Threading/Lock.h>
+#include <Foundation/Threading/Mutex.h>
+
+// 'PLRB'
+static constexpr plUInt32 s_uiReflectionBinaryTag = 0x42524C50;
+static constexpr plUInt8 s_uiReflectionBinaryVersion = 1;
+
+enum plReflectionBinaryRecord : plUInt8
+{
+  PlannedObject,
+  GraphObject,
+};
+
+struct plSerializationPlanCache
+{
+  plMutex m_Mutex;
+  plHashTable<const plRTTI*, plSharedPtr<const plSerializationPlan>> m_Plans; // nullptr for types that have no plan
+};
+
+static plSerializationPlanCache* s_pSerializationPlanCache = nullptr;
+
+// clang-format off
+PL_BEGIN_SUBSYSTEM_DECLARATION(Foundation, SerializationPlan)
+
+  BEGIN_SUBSYSTEM_DEPENDENCIES
+  "Reflection"
+  END_SUBSYSTEM_DEPENDENCIES
+
+  ON_CORESYSTEMS_STARTUP
+  {
+    s_pSerializationPlanCache = PL_DEFAULT_NEW(plSerializationPlanCache);
+    plPlugin::Events().AddEventHandler(plSerializationPlan::PluginEventHandler);
+  }
+
+  ON_CORESYSTEMS_SHUTDOWN
+  {
+    plPlugin::Events().RemoveEventHandler(plSerializationPlan::PluginEventHandler);
+    plSerializationPlan::ClearCache();
+    PL_DEFAULT_DELETE(s_pSerializationPlanCache);
+  }
+
+PL_END_SUBSYSTEM_DECLARATION;
+// clang-format on
+
+namespace
+{
+  /// \brief Returns the size of a variant type that can be copied with memcpy, or 0.
+  struct plSerializationPlanPodSize
+  {
+    template <typename T>
+    PL_ALWAYS_INLINE plUInt32 operator()()
+    {
+      return plIsPodType<T>::value ? sizeof(T) : 0;
+    }
+  };
+
+  /// \brief Reads a Raw field into a variant.
+  struct plSerializationPlanReadRaw
+  {
+    template <typename T>
+    PL_ALWAYS_INLINE void operator()(plStreamReader& inout_stream, plVariant& out_value)
+    {
+      if constexpr (plIsPodType<T>::value && std::is_default_constructible<T>::value)
+      {
+        T value;
+        inout_stream.ReadBytes(&value, sizeof(T));
+        out_value = value;
+      }
+    }
+  };
+} // namespace
+
+static plUInt32 GetRawFieldSize(plVariantType::Enum type)
+{
+  // plStringView and plTempHashedString are POD, but only valid in the process that wrote them
+  if (type <= plVariantType::FirstStandardType || type >= plVariantType::LastStandardType || type == plVariantType::StringView ||
+      type == plVariantType::TempHashedString)
+    return 0;
+
+  plSerializationPlanPodSize func;
+  return plVariant::DispatchTo(func, type);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// plSerializationPlan
+//////////////////////////////////////////////////////////////////////////
+
+plSharedPtr<const plSerializationPlan> plSerializationPlan::GetPlan(const plRTTI* pRtti)
+{
+  if (s_pSerializationPlanCache == nullptr)
+    return nullptr;
+
+  PL_LOCK(s_pSerializationPlanCache->m_Mutex);
+
+  plSharedPtr<const plSerializationPlan> pCachedPlan;
+  if (s_pSerializationPlanCache->m_Plans.TryGetValue(pRtti, pCachedPlan))
+    return pCachedPlan;
+
+  plSharedPtr<plSerializationPlan> pPlan = PL_DEFAULT_NEW(plSerializationPlan);
+  if (pPlan->Build(pRtti).Failed())
+  {
+    pPlan.Clear();
+  }
+
+  s_pSerializationPlanCache->m_Plans.Insert(pRtti, pPlan);
+  return pPlan;
+}
+
+void plSerializationPlan::ClearCache()
+{
+  PL_LOCK(s_pSerializationPlanCache->m_Mutex);
+
+  // plReflectionBinaryWriter and plReflectionBinaryReader keep their own references to the plans that they use
+  s_pSerializationPlanCache->m_Plans.Clear();
+}
+
+void plSerializationPlan::PluginEventHandler(const plPluginEvent& eventData)
+{
+  // plans reference the properties of types that may have been unloaded
+  if (eventData.m_EventType == plPluginEvent::AfterUnloading)
+  {
+    ClearCache();
+  }
+}
+
+plResult plSerializationPlan::Build(const plRTTI* pRtti)
+{
+  // phantom types have no memory layout that could be accessed directly
+  if (pRtti->GetTypeFlags().IsAnySet(plTypeFlags::Phantom | plTypeFlags::Minimal))
+    return PL_FAILURE;
+
+  m_pType = pRtti;
+
+  // the property pointer functions only do address arithmetic, so they can be called on an uninitialized block of memory
+  plDynamicArray<plUInt8> scratchObject;
+  scratchObject.SetCount(plMath::Max(pRtti->GetTypeSize(), 1u));
+
+  PL_SUCCEED_OR_RETURN(AddNode(pRtti, plInvalidIndex, 0, nullptr, scratchObject.GetData()));
+
+  for (const Field& field : m_Fields)
+  {
+    if (field.m_Kind != FieldKind::Value && field.m_uiOffset + field.m_uiSize > pRtti->GetTypeSize())
+      return PL_FAILURE;
+  }
+
+  BuildSteps();
+  BuildSchema();
+  return PL_SUCCESS;
+}
+
+plResult plSerializationPlan::AddNode(const plRTTI* pType, plUInt32 uiParent, plUInt32 uiOffset, const char* szPropertyName, const plUInt8* pScratchObject)
+{
+  const plUInt32 uiNode = m_Nodes.GetCount();
+
+  Node& node = m_Nodes.ExpandAndGetRef();
+  node.m_pType = pType;
+  node.m_uiParent = uiParent;
+  node.m_uiOffset = uiOffset;
+  node.m_szPropertyName = szPropertyName;
+
+  plHybridArray<const plAbstractProperty*, 32> properties;
+  pType->GetAllProperties(properties);
+
+  for (const plAbstractProperty* pProp : properties)
+  {
+    switch (pProp->GetCategory())
+    {
+      case plPropertyCategory::Constant:
+      case plPropertyCategory::Function:
+        continue;
+
+      case plPropertyCategory::Member:
+        break;
+
+      default:
+        // containers are not supported
+        return PL_FAILURE;
+    }
+
+    if (pProp->GetFlags().IsSet(plPropertyFlags::ReadOnly))
+      continue;
+
+    if (pProp->GetFlags().IsSet(plPropertyFlags::Pointer))
+      return PL_FAILURE;
+
+    const plAbstractMemberProperty* pMember = static_cast<const plAbstractMemberProperty*>(pProp);
+    const plRTTI* pPropType = pProp->GetSpecificType();
+    const plUInt8* pMemberPtr = static_cast<const plUInt8*>(pMember->GetPropertyPointer(pScratchObject + uiOffset));
+
+    if (pProp->GetFlags().IsSet(plPropertyFlags::Class) && !plReflectionUtils::IsValueType(pProp))
+    {
+      // same as plRttiConverterWriter, structs without properties are ignored
+      if (pPropType->GetProperties().IsEmpty())
+        continue;
+
+      if (pMemberPtr == nullptr)
+        return PL_FAILURE;
+
+      PL_SUCCEED_OR_RETURN(AddNode(pPropType, uiNode, static_cast<plUInt32>(pMemberPtr - pScratchObject), pProp->GetPropertyName(), pScratchObject));
+      continue;
+    }
+
+    Field& field = m_Fields.ExpandAndGetRef();
+    field.m_pProperty = pMember;
+    field.m_uiNode = uiNode;
+    field.m_uiOffset = uiOffset;
+    field.m_VariantType = pPropType->GetVariantType();
+
+    if (pProp->GetFlags().IsAnySet(plPropertyFlags::IsEnum | plPropertyFlags::Bitflags))
+    {
+      field.m_Kind = FieldKind::Enum;
+      continue;
+    }
+
+    if (pMemberPtr == nullptr)
+      continue;
+
+    const plUInt32 uiRawSize = GetRawFieldSize(field.m_VariantType);
+
+    if (uiRawSize != 0 && uiRawSize == pPropType->GetTypeSize())
+    {
+      field.m_Kind = FieldKind::Raw;
+      field.m_uiOffset = static_cast<plUInt32>(pMemberPtr - pScratchObject);
+      field.m_uiSize = uiRawSize;
+    }
+    else if (pPropType == plGetStaticRTTI<plString>())
+    {
+      field.m_Kind = FieldKind::String;
+      field.m_uiOffset = static_cast<plUInt32>(pMemberPtr - pScratchObject);
+      field.m_uiSize = sizeof(plString);
+    }
+  }
+
+  return PL_SUCCESS;
+}
+
+void plSerializationPlan::BuildSteps()
+{
+  for (plUInt32 i = 0; i < m_Fields.GetCount(); ++i)
+  {
+    const Field& field = m_Fields[i];
+
+    if (field.m_Kind == FieldKind::Raw && !m_Steps.IsEmpty())
+    {
+      Step& prev = m_Steps.PeekBack();
+
+      if (prev.m_Kind == FieldKind::Raw && prev.m_uiOffset + prev.m_uiSize == field.m_uiOffset)
+      {
+        prev.m_uiSize += field.m_uiSize;
+        continue;
+      }
+    }
+
+    Step& step = m_Steps.ExpandAndGetRef();
+    step.m_Kind = field.m_Kind;
+    step.m_uiOffset = field.m_uiOffset;
+    step.m_uiSize = field.m_uiSize;
+    step.m_uiField = i;
+  }
+}
+
+void plSerializationPlan::BuildSchema()
+{
+  plMemoryStreamContainerWrapperStorage<plDynamicArray<plUInt8>> storage(&m_Schema);
+  plMemoryStreamWriter writer(&storage);
+
+  writer << m_Nodes.GetCount();
+  for (const Node& node : m_Nodes)
+  {
+    writer << node.m_pType->GetTypeName();
+    writer << node.m_pType->GetTypeVersion();
+    writer << node.m_uiParent;
+    writer << plStringView(node.m_szPropertyName);
+  }
+
+  writer << m_Fields.GetCount();
+  for (const Field& field : m_Fields)
+  {
+    writer << field.m_uiNode;
+    writer << plStringView(field.m_pProperty->GetPropertyName());
+    writer << static_cast<plUInt8>(field.m_Kind);
+    writer << static_cast<plUInt8>(field.m_VariantType);
+  }
+
+  m_uiSchemaHash = plHashingUtils::xxHash64(m_Schema.GetData(), m_Schema.GetCount());
+}
+
+void plSerializationPlan::WriteObject(plStreamWriter& inout_stream, const void* pObject) const
+{
+  const plUInt8* pBytes = static_cast<const plUInt8*>(pObject);
+  plStringBuilder sValue;
+
+  for (const Step& step : m_Steps)
+  {
+    switch (step.m_Kind)
+    {
+      case FieldKind::Raw:
+        inout_stream.WriteBytes(pBytes + step.m_uiOffset, step.m_uiSize).AssertSuccess();
+        break;
+
+      case FieldKind::String:
+        inout_stream << *reinterpret_cast<const plString*>(pBytes + step.m_uiOffset);
+        break;
+
+      case FieldKind::Value:
+        inout_stream << plReflectionUtils::GetMemberPropertyValue(m_Fields[step.m_uiField].m_pProperty, pBytes + step.m_uiOffset);
+        break;
+
+      case FieldKind::Enum:
+      {
+        const plAbstractEnumerationProperty* pProp = static_cast<const plAbstractEnumerationProperty*>(m_Fields[step.m_uiField].m_pProperty);
+        plReflectionUtils::EnumerationToString(pProp->GetSpecificType(), pProp->GetValue(pBytes + step.m_uiOffset), sValue);
+        inout_stream << sValue;
+        break;
+      }
+    }
+  }
+}
+
+void plSerializationPlan::ReadObject(plStreamReader& inout_stream, void* pObject) const
+{
+  plUInt8* pBytes = static_cast<plUInt8*>(pObject);
+  plVariant value;
+  plStringBuilder sValue;
+
+  for (const Step& step : m_Steps)
+  {
+    switch (step.m_Kind)
+    {
+      case FieldKind::Raw:
+        inout_stream.ReadBytes(pBytes + step.m_uiOffset, step.m_uiSize);
+        break;
+
+      case FieldKind::String:
+        inout_stream >> *reinterpret_cast<plString*>(pBytes + step.m_uiOffset);
+        break;
+
+      case FieldKind::Value:
+        inout_stream >> value;
+        plReflectionUtils::SetMemberPropertyValue(m_Fields[step.m_uiField].m_pProperty, pBytes + step.m_uiOffset, value);
+        break;
+
+      case FieldKind::Enum:
+      {
+        const plAbstractEnumerationProperty* pProp = static_cast<const plAbstractEnumerationProperty*>(m_Fields[step.m_uiField].m_pProperty);
+        plInt64 iValue = 0;
+        inout_stream >> sValue;
+        plReflectionUtils::StringToEnumeration(pProp->GetSpecificType(), sValue, iValue);
+        pProp->SetValue(pBytes + step.m_uiOffset, iValue);
+        break;
+      }
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// plReflectionBinaryWriter
+//////////////////////////////////////////////////////////////////////////
+
+plReflectionBinaryWriter::plReflectionBinaryWriter(plStreamWriter& inout_stream)
+  : m_Stream(inout_stream)
+{
+}
+
+void plReflectionBinaryWriter::WriteObject(const plRTTI* pRtti, const void* pObject)
+{
+  if (!m_bHeaderWritten)
+  {
+    m_bHeaderWritten = true;
+    m_Stream << s_uiReflectionBinaryTag;
+    m_Stream << s_uiReflectionBinaryVersion;
+  }
+
+  WrittenType* pWrittenType = nullptr;
+  if (!m_WrittenTypes.TryGetValue(pRtti, pWrittenType))
+  {
+    pWrittenType = &m_WrittenTypes[pRtti];
+    pWrittenType->m_pPlan = plSerializationPlan::GetPlan(pRtti);
+    pWrittenType->m_uiIndex = plInvalidIndex;
+  }
+
+  const plSerializationPlan* pPlan = pWrittenType->m_pPlan;
+
+  if (pPlan == nullptr)
+  {
+    m_Stream << static_cast<plUInt8>(plReflectionBinaryRecord::GraphObject);
+
+    plAbstractObjectGraph graph;
+    plRttiConverterContext context;
+    plRttiConverterWriter conv(&graph, &context, false, true);
+
+    context.RegisterObject(plUuid::MakeUuid(), pRtti, const_cast<void*>(pObject));
+    conv.AddObjectToGraph(pRtti, const_cast<void*>(pObject), "root");
+
+    plAbstractGraphBinarySerializer::Write(m_Stream, &graph);
+    return;
+  }
+
+  m_Stream << static_cast<plUInt8>(plReflectionBinaryRecord::PlannedObject);
+
+  if (pWrittenType->m_uiIndex != plInvalidIndex)
+  {
+    m_Stream << pWrittenType->m_uiIndex;
+  }
+  else
+  {
+    // the first object of each type is preceded by the description of the type
+    pWrittenType->m_uiIndex = m_uiNumWrittenPlans++;
+
+    m_Stream << pWrittenType->m_uiIndex;
+    m_Stream << pPlan->GetSchemaHash();
+    m_Stream << pPlan->GetSchema().GetCount();
+    m_Stream.WriteBytes(pPlan->GetSchema().GetPtr(), pPlan->GetSchema().GetCount()).AssertSuccess();
+
+    // the schema only contains the versions of the node types themselves, the context also stores those of their base classes
+    if (plTypeVersionWriteContext* pVersionContext = plTypeVersionWriteContext::GetContext())
+    {
+      for (const plSerializationPlan::Node& node : pPlan->m_Nodes)
+      {
+        pVersionContext->AddType(node.m_pType);
+      }
+    }
+  }
+
+  pPlan->WriteObject(m_Stream, pObject);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// plReflectionBinaryReader
+//////////////////////////////////////////////////////////////////////////
+
+plReflectionBinaryReader::plReflectionBinaryReader(plStreamReader& inout_stream)
+  : m_Stream(inout_stream)
+{
+}
+
+plUInt32 plReflectionBinaryReader::GetStreamTag()
+{
+  return s_uiReflectionBinaryTag;
+}
+
+plResult plReflectionBinaryReader::ReadHeader()
+{
+  if (!m_bTagRead)
+  {
+    plUInt32 uiTag = 0;
+    m_Stream >> uiTag;
+
+    if (uiTag != s_uiReflectionBinaryTag)
+    {
+      plLog::Error("The stream was not written with plReflectionBinaryWriter.");
+      return PL_FAILURE;
+    }
+
+    m_bTagRead = true;
+  }
+
+  plUInt8 uiVersion = 0;
+  if (m_Stream.ReadBytes(&uiVersion, 1) != 1 || uiVersion != s_uiReflectionBinaryVersion)
+  {
+    plLog::Error("Unsupported reflection binary version {}.", uiVersion);
+    return PL_FAILURE;
+  }
+
+  return PL_SUCCESS;
+}
+
+plResult plReflectionBinaryReader::ReadRecord(plUInt8& out_uiRecord, StoredType*& out_pType)
+{
+  // the tag and the version are only written once per stream
+  if (!m_bHeaderRead)
+  {
+    PL_SUCCEED_OR_RETURN(ReadHeader());
+    m_bHeaderRead = true;
+  }
+
+  out_pType = nullptr;
+  if (m_Stream.ReadBytes(&out_uiRecord, 1) != 1)
+    return PL_FAILURE;
+
+  if (out_uiRecord == plReflectionBinaryRecord::GraphObject)
+    return PL_SUCCESS;
+
+  if (out_uiRecord != plReflectionBinaryRecord::PlannedObject)
+  {
+    plLog::Error("Invalid reflection binary record {}.", out_uiRecord);
+    return PL_FAILURE;
+  }
+
+  plUInt32 uiTypeIndex = 0;
+  m_Stream >> uiTypeIndex;
+
+  if (uiTypeIndex < m_StoredTypes.GetCount())
+  {
+    out_pType = &m_StoredTypes[uiTypeIndex];
+    return PL_SUCCESS;
+  }
+
+  if (uiTypeIndex != m_StoredTypes.GetCount())
+  {
+    plLog::Error("Invalid type index {} in reflection binary stream.", uiTypeIndex);
+    return PL_FAILURE;
+  }
+
+  out_pType = &m_StoredTypes.ExpandAndGetRef();
+  return ReadStoredType(*out_pType);
+}
+
+plResult plReflectionBinaryReader::ReadStoredType(StoredType& out_type)
+{
+  plUInt64 uiSchemaHash = 0;
+  plUInt32 uiSchemaSize = 0;
+  m_Stream >> uiSchemaHash;
+  m_Stream >> uiSchemaSize;
+
+  plDynamicArray<plUInt8> schema;
+  schema.SetCountUninitialized(uiSchemaSize);
+  if (m_Stream.ReadBytes(schema.GetData(), uiSchemaSize) != uiSchemaSize)
+    return PL_FAILURE;
+
+  plRawMemoryStreamReader reader(schema);
+
+  plUInt32 uiNumNodes = 0;
+  reader >> uiNumNodes;
+  if (uiNumNodes == 0 || uiNumNodes > uiSchemaSize)
+    return PL_FAILURE;
+
+  out_type.m_Nodes.SetCount(uiNumNodes);
+  for (SchemaNode& node : out_type.m_Nodes)
+  {
+    reader >> node.m_sType;
+    reader >> node.m_uiVersion;
+    reader >> node.m_uiParent;
+    reader >> node.m_sPropertyName;
+  }
+
+  plUInt32 uiNumFields = 0;
+  reader >> uiNumFields;
+  if (uiNumFields > uiSchemaSize)
+    return PL_FAILURE;
+
+  out_type.m_Fields.SetCount(uiNumFields);
+  for (SchemaField& field : out_type.m_Fields)
+  {
+    plUInt8 uiVariantType = 0;
+    reader >> field.m_uiNode;
+    reader >> field.m_sName;
+    reader >> field.m_uiKind;
+    reader >> uiVariantType;
+    field.m_VariantType = static_cast<plVariantType::Enum>(uiVariantType);
+
+    if (field.m_uiNode >= uiNumNodes || field.m_uiKind > static_cast<plUInt8>(plSerializationPlan::FieldKind::Enum))
+      return PL_FAILURE;
+  }
+
+  for (plUInt32 i = 1; i < uiNumNodes; ++i)
+  {
+    if (out_type.m_Nodes[i].m_uiParent >= i)
+      return PL_FAILURE;
+  }
+
+  out_type.m_pType = plRTTI::FindTypeByName(out_type.m_Nodes[0].m_sType);
+
+  if (out_type.m_pType != nullptr)
+  {
+    plSharedPtr<const plSerializationPlan> pPlan = plSerializationPlan::GetPlan(out_type.m_pType);
+    if (pPlan != nullptr && pPlan->GetSchemaHash() == uiSchemaHash)
+    {
+      out_type.m_pPlan = pPlan;
+    }
+  }
+
+  const plTypeVersionReadContext* pVersionContext = plTypeVersionReadContext::GetContext();
+
+  for (const SchemaNode& node : out_type.m_Nodes)
+  {
+    const plRTTI* pNodeType = plRTTI::FindTypeByName(node.m_sType);
+    if (pNodeType == nullptr || pNodeType->GetTypeVersion() != node.m_uiVersion)
+    {
+      out_type.m_bNeedsPatching = true;
+    }
+
+    // without an entry in the types graph, plGraphVersioning would assume that the node type is at its current version
+    StoredTypeVersion& nodeVersion = out_type.m_TypeVersions.ExpandAndGetRef();
+    nodeVersion.m_sType = node.m_sType;
+    nodeVersion.m_uiVersion = node.m_uiVersion;
+
+    if (pNodeType == nullptr)
+      continue;
+
+    if (pNodeType->GetParentType() != nullptr)
+    {
+      nodeVersion.m_sParentType = pNodeType->GetParentType()->GetTypeName();
+    }
+
+    if (pVersionContext == nullptr)
+      continue;
+
+    for (const plRTTI* pType = pNodeType->GetParentType(); pType != nullptr; pType = pType->GetParentType())
+    {
+      const plUInt32 uiStoredVersion = pVersionContext->GetTypeVersion(pType);
+      if (uiStoredVersion == plInvalidIndex)
+        continue;
+
+      if (uiStoredVersion != pType->GetTypeVersion())
+      {
+        out_type.m_bNeedsPatching = true;
+      }
+
+      StoredTypeVersion& typeVersion = out_type.m_TypeVersions.ExpandAndGetRef();
+      typeVersion.m_sType = pType->GetTypeName();
+      typeVersion.m_sParentType = pType->GetParentType() != nullptr ? pType->GetParentType()->GetTypeName() : plStringView();
+      typeVersion.m_uiVersion = uiStoredVersion;
+    }
+  }
+
+  // the versions of base classes are not part of the schema hash
+  if (out_type.m_bNeedsPatching)
+  {
+    out_type.m_pPlan = nullptr;
+  }
+
+  return PL_SUCCESS;
+}
+
+void plReflectionBinaryReader::ReadGraph(const StoredType& type, plAbstractObjectGraph& ref_graph)
+{
+  plHybridArray<plAbstractObjectNode*, 8> nodes;
+  nodes.SetCount(type.m_Nodes.GetCount());
+
+  for (plUInt32 i = 0; i < type.m_Nodes.GetCount(); ++i)
+  {
+    const SchemaNode& node = type.m_Nodes[i];
+
+    if (i == 0)
+    {
+      nodes[i] = ref_graph.AddNode(plUuid::MakeUuid(), node.m_sType, node.m_uiVersion, "root");
+    }
+    else
+    {
+      // embedded structs are separate nodes, referenced by the parent, just like plRttiConverterWriter stores them
+      plUuid guid = nodes[node.m_uiParent]->GetGuid();
+      guid.HashCombine(plUuid::MakeStableUuidFromString(node.m_sPropertyName));
+
+      nodes[i] = ref_graph.AddNode(guid, node.m_sType, node.m_uiVersion);
+      nodes[node.m_uiParent]->AddProperty(node.m_sPropertyName, guid);
+    }
+  }
+
+  plVariant value;
+  plStringBuilder sValue;
+
+  for (const SchemaField& field : type.m_Fields)
+  {
+    switch (static_cast<plSerializationPlan::FieldKind>(field.m_uiKind))
+    {
+      case plSerializationPlan::FieldKind::Raw:
+      {
+        plSerializationPlanReadRaw func;
+        if (GetRawFieldSize(field.m_VariantType) != 0)
+          plVariant::DispatchTo(func, field.m_VariantType, m_Stream, value);
+        break;
+      }
+
+      case plSerializationPlan::FieldKind::String:
+      case plSerializationPlan::FieldKind::Enum:
+        m_Stream >> sValue;
+        value = plString(sValue);
+        break;
+
+      case plSerializationPlan::FieldKind::Value:
+        m_Stream >> value;
+        break;
+    }
+
+    nodes[field.m_uiNode]->AddProperty(field.m_sName, value);
+  }
+}
+
+void plReflectionBinaryReader::PatchGraph(const StoredType& type, plAbstractObjectGraph& ref_graph)
+{
+  if (!type.m_bNeedsPatching)
+    return;
+
+  // plGraphPatchContext only reads the name, parent and version from the type descriptors
+  plAbstractObjectGraph typesGraph;
+
+  for (const StoredTypeVersion& typeVersion : type.m_TypeVersions)
+  {
+    const plUuid guid = plUuid::MakeStableUuidFromString(typeVersion.m_sType);
+    if (typesGraph.GetNode(guid) != nullptr)
+      continue;
+
+    plAbstractObjectNode* pNode = typesGraph.AddNode(guid, "plReflectedTypeDescriptor", 1);
+    pNode->AddProperty("TypeName", typeVersion.m_sType);
+    pNode->AddProperty("ParentTypeName", typeVersion.m_sParentType);
+    pNode->AddProperty("TypeVersion", typeVersion.m_uiVersion);
+  }
+
+  plGraphVersioning::GetSingleton()->PatchGraph(&ref_graph, &typesGraph);
+}
+
+void* plReflectionBinaryReader::ReadObject(const plRTTI*& out_pRtti)
+{
+  out_pRtti = nullptr;
+
+  plUInt8 uiRecord = 0;
+  StoredType* pType = nullptr;
+  if (ReadRecord(uiRecord, pType).Failed())
+    return nullptr;
+
+  plAbstractObjectGraph graph;
+  plRttiConverterContext context;
+
+  if (uiRecord == plReflectionBinaryRecord::GraphObject)
+  {
+    plAbstractGraphBinarySerializer::Read(m_Stream, &graph, nullptr, true);
+  }
+  else if (pType->m_pPlan != nullptr)
+  {
+    out_pRtti = pType->m_pType;
+
+    void* pObject = context.CreateObject(plUuid::MakeUuid(), out_pRtti);
+    if (pObject != nullptr)
+    {
+      pType->m_pPlan->ReadObject(m_Stream, pObject);
+    }
+
+    return pObject;
+  }
+  else
+  {
+    ReadGraph(*pType, graph);
+    PatchGraph(*pType, graph);
+  }
+
+  plRttiConverterReader convRead(&graph, &context);
+  auto* pRootNode = graph.GetNodeByName("root");
+
+  if (pRootNode == nullptr)
+    return nullptr;
+
+  out_pRtti = plRTTI::FindTypeByName(pRootNode->GetType());
+  if (out_pRtti == nullptr)
+  {
+    plLog::Error("Unknown type '{}' in reflection binary stream.", pRootNode->GetType());
+    return nullptr;
+  }
+
+  void* pTarget = context.CreateObject(pRootNode->GetGuid(), out_pRtti);
+  if (pTarget != nullptr)
+  {
+    convRead.ApplyPropertiesToObject(pRootNode, out_pRtti, pTarget);
+  }
+
+  return pTarget;
+}
+
+plResult plReflectionBinaryReader::ReadObjectProperties(const plRTTI& rtti, void* pObject)
+{
+  plUInt8 uiRecord = 0;
+  StoredType* pType = nullptr;
+  PL_SUCCEED_OR_RETURN(ReadRecord(uiRecord, pType));
+
+  plAbstractObjectGraph graph;
+  plRttiConverterContext context;
+
+  if (uiRecord == plReflectionBinaryRecord::GraphObject)
+  {
+    plAbstractGraphBinarySerializer::Read(m_Stream, &graph, nullptr, true);
+  }
+  else if (pType->m_pPlan != nullptr && pType->m_pType == &rtti)
+  {
+    pType->m_pPlan->ReadObject(m_Stream, pObject);
+    return PL_SUCCESS;
+  }
+  else
+  {
+    ReadGraph(*pType, graph);
+    PatchGraph(*pType, graph);
+  }
+
+  plRttiConverterReader convRead(&graph, &context);
+  auto* pRootNode = graph.GetNodeByName("root");
+
+  if (pRootNode == nullptr)
+    return PL_FAILURE;
+
+  convRead.ApplyPropertiesToObject(pRootNode, &rtti, pObject);
+  return PL_SUCCESS;
+}
+
+PL_STATICLINK_FILE(Foundation, Foundation_Serialization_Implementation_SerializationPlan);
@@ -25,6 +25,9 @@ public:
   static void WriteObjectToDDL(plOpenDdlWriter& ref_ddl, const plRTTI* pRtti, const void* pObject, plUuid guid = plUuid()); // [tested]
 
   /// \brief Same as WriteObjectToDDL but binary.
+  ///
+  /// Uses plReflectionBinaryWriter, so types that have a plSerializationPlan are written directly, without building an
+  /// plAbstractObjectGraph first.
   static void WriteObjectToBinary(plStreamWriter& inout_stream, const plRTTI* pRtti, const void* pObject); // [tested]
 
   /// \brief Reads the entire DDL data in the stream and restores a reflected object.
@@ -38,6 +41,8 @@ public:
   static void* ReadObjectFromDDL(const plOpenDdlReaderElement* pRootElement, const plRTTI*& ref_pRtti); // [tested]
 
   /// \brief Same as ReadObjectFromDDL but binary.
+  ///
+  /// Also reads data that was written before WriteObjectToBinary used plReflectionBinaryWriter.
   static void* ReadObjectFromBinary(plStreamReader& inout_stream, const plRTTI*& ref_pRtti); // [tested]
 
   /// \brief Reads the entire DDL data in the stream and sets all properties of the given object.
@@ -0,0 +1,217 @@
+#pragma once
+
+/// \file
+
+#include <Foundation/Containers/Deque.h>
+#include <Foundation/Containers/DynamicArray.h>
+#include <Foundation/Containers/HashTable.h>
+#include <Foundation/IO/Stream.h>
+#include <Foundation/Reflection/Reflection.h>
+#include <Foundation/Types/SharedPtr.h>
+
+class plAbstractObjectGraph;
+struct plPluginEvent;
+
+/// \brief A flattened description of how the properties of a reflected type are written to and read from a binary stream.
+///
+/// The plan is built once per plRTTI and cached. All member properties, including those of embedded structs, are collected into one
+/// list of fields in property order. Members that are POD standard types (numbers, vectors, matrices, colors, ...) are copied directly
+/// from and to the object memory, and neighboring POD members are merged into a single copy. Strings are written directly as well.
+/// Enums and bitflags are written as strings, just like plRttiConverterWriter stores them, so that graphs rebuilt from the data look
+/// exactly like the ones that graph patches expect. Accessor properties and all other standard types go through plVariant.
+///
+/// Types that contain pointers, containers (arrays, sets and maps) or embedded structs behind accessors have no plan.
+/// Read-only properties are skipped, just like plReflectionSerializer does.
+///
+/// Use plReflectionBinaryWriter and plReflectionBinaryReader instead of using plans directly.
+class PL_FOUNDATION_DLL plSerializationPlan : public plRefCounted
+{
+  PL_DISALLOW_COPY_AND_ASSIGN(plSerializationPlan);
+
+public:
+  /// \brief Returns the plan for the given type or nullptr, if the type can't be handled by a plan. Thread-safe.
+  ///
+  /// The cache of plans is cleared whenever a plugin is unloaded, the returned plan stays valid until the last reference to it is released.
+  static plSharedPtr<const plSerializationPlan> GetPlan(const plRTTI* pRtti);
+
+  /// \brief Returns the type that this plan was built for.
+  const plRTTI* GetType() const { return m_pType; }
+
+  /// \brief Returns a hash over all type names, type versions and fields of this plan.
+  ///
+  /// Data that was written with a plan with the same hash can be read back directly.
+  plUInt64 GetSchemaHash() const { return m_uiSchemaHash; }
+
+  /// \brief Returns the serialized description of all nodes and fields, which allows to read the data without the plan.
+  plArrayPtr<const plUInt8> GetSchema() const { return m_Schema; }
+
+  /// \brief Writes all fields of pObject.
+  void WriteObject(plStreamWriter& inout_stream, const void* pObject) const;
+
+  /// \brief Reads all fields into pObject. The data must have been written with a plan with the same schema hash.
+  void ReadObject(plStreamReader& inout_stream, void* pObject) const;
+
+private:
+  friend class plReflectionBinaryWriter;
+  friend class plReflectionBinaryReader;
+  PL_MAKE_SUBSYSTEM_STARTUP_FRIEND(Foundation, SerializationPlan);
+
+  enum class FieldKind : plUInt8
+  {
+    Raw,    ///< A POD standard type that is copied directly.
+    String, ///< A plString member.
+    Value,  ///< Anything else, read and written through plVariant.
+    Enum,   ///< An enum or bitflags property, written as the string that plReflectionUtils::EnumerationToString() returns.
+  };
+
+  /// \brief The root type or an embedded struct.
+  struct Node
+  {
+    const plRTTI* m_pType = nullptr;
+    plUInt32 m_uiParent = plInvalidIndex;
+    plUInt32 m_uiOffset = 0;
+    const char* m_szPropertyName = nullptr; ///< The name of the member in the parent node.
+  };
+
+  struct Field
+  {
+    const plAbstractMemberProperty* m_pProperty = nullptr;
+    plUInt32 m_uiNode = 0;
+    plUInt32 m_uiOffset = 0; ///< Offset of the member for Raw and String fields, offset of the node for Value fields.
+    plUInt32 m_uiSize = 0;
+    FieldKind m_Kind = FieldKind::Value;
+    plVariantType::Enum m_VariantType = plVariantType::Invalid;
+  };
+
+  /// \brief Fields in the order in which they are processed, with neighboring Raw fields merged.
+  struct Step
+  {
+    FieldKind m_Kind = FieldKind::Value;
+    plUInt32 m_uiOffset = 0;
+    plUInt32 m_uiSize = 0;
+    plUInt32 m_uiField = 0;
+  };
+
+  plSerializationPlan() = default;
+
+  plResult Build(const plRTTI* pRtti);
+  plResult AddNode(const plRTTI* pType, plUInt32 uiParent, plUInt32 uiOffset, const char* szPropertyName, const plUInt8* pScratchObject);
+  void BuildSteps();
+  void BuildSchema();
+
+  static void ClearCache();
+  static void PluginEventHandler(const plPluginEvent& eventData);
+
+  const plRTTI* m_pType = nullptr;
+  plUInt64 m_uiSchemaHash = 0;
+  plDynamicArray<Node> m_Nodes;
+  plDynamicArray<Field> m_Fields;
+  plDynamicArray<Step> m_Steps;
+  plDynamicArray<plUInt8> m_Schema;
+};
+
+/// \brief Writes reflected objects to a binary stream, without building an plAbstractObjectGraph first.
+///
+/// Objects of types that have a plSerializationPlan are written directly. The description of each type (names, versions and fields) is
+/// only written once per writer, so writing many objects of the same type through one writer is very compact.
+/// All other objects are converted to a graph and written with plAbstractGraphBinarySerializer.
+///
+/// If a plTypeVersionWriteContext is active, the types of all planned objects and their embedded structs are added to it, so that
+/// the versions of their base classes are stored as well.
+///
+/// The data can only be read with plReflectionBinaryReader.
+class PL_FOUNDATION_DLL plReflectionBinaryWriter
+{
+public:
+  plReflectionBinaryWriter(plStreamWriter& inout_stream);
+
+  /// \brief Writes all properties of pObject.
+  void WriteObject(const plRTTI* pRtti, const void* pObject);
+
+private:
+  struct WrittenType
+  {
+    plSharedPtr<const plSerializationPlan> m_pPlan;
+    plUInt32 m_uiIndex = 0;
+  };
+
+  plStreamWriter& m_Stream;
+  bool m_bHeaderWritten = false;
+  plUInt32 m_uiNumWrittenPlans = 0;
+  plHashTable<const plRTTI*, WrittenType> m_WrittenTypes;
+};
+
+/// \brief Reads objects that were written with plReflectionBinaryWriter.
+///
+/// If the type of an object still has the same plan as when it was written, the data is copied directly into the object.
+/// Otherwise, e.g. when the type version has changed or properties were added or removed, the data is converted into an
+/// plAbstractObjectGraph, patched with plGraphVersioning if necessary, and applied to the object with plRttiConverterReader,
+/// so all properties that still exist are restored.
+///
+/// If a plTypeVersionReadContext is active, the base class versions stored in it are used for patching as well. Otherwise base classes
+/// are assumed to be at their current version, just like plGraphVersioning does without a types graph.
+class PL_FOUNDATION_DLL plReflectionBinaryReader
+{
+public:
+  plReflectionBinaryReader(plStreamReader& inout_stream);
+
+  /// \brief Allocates an object of the stored type and reads its properties. Returns nullptr, if the type is unknown.
+  void* ReadObject(const plRTTI*& out_pRtti);
+
+  /// \brief Reads the properties of the next object into the existing pObject.
+  ///
+  /// The type of pObject should be the stored type, otherwise all matching properties are restored as good as possible.
+  plResult ReadObjectProperties(const plRTTI& rtti, void* pObject);
+
+  /// \brief Returns the value that every stream written by plReflectionBinaryWriter starts with.
+  static plUInt32 GetStreamTag();
+
+  /// \brief Call this if the stream tag was already read and checked by the caller.
+  void SkipStreamTag() { m_bTagRead = true; }
+
+private:
+  struct SchemaNode
+  {
+    plString m_sType;
+    plUInt32 m_uiVersion = 0;
+    plUInt32 m_uiParent = plInvalidIndex;
+    plString m_sPropertyName;
+  };
+
+  struct SchemaField
+  {
+    plUInt32 m_uiNode = 0;
+    plString m_sName;
+    plUInt8 m_uiKind = 0;
+    plVariantType::Enum m_VariantType = plVariantType::Invalid;
+  };
+
+  /// \brief The stored version of a node type, or of one of its base classes if a plTypeVersionReadContext was active.
+  struct StoredTypeVersion
+  {
+    plString m_sType;
+    plString m_sParentType;
+    plUInt32 m_uiVersion = 0;
+  };
+
+  struct StoredType
+  {
+    const plRTTI* m_pType = nullptr;             ///< nullptr, if the type doesn't exist anymore.
+    plSharedPtr<const plSerializationPlan> m_pPlan; ///< Only set if the stored schema matches the current plan of the type.
+    bool m_bNeedsPatching = false;
+    plDynamicArray<SchemaNode> m_Nodes;
+    plDynamicArray<SchemaField> m_Fields;
+    plDynamicArray<StoredTypeVersion> m_TypeVersions;
+  };
+
+  plResult ReadHeader();
+  plResult ReadRecord(plUInt8& out_uiRecord, StoredType*& out_pType);
+  plResult ReadStoredType(StoredType& out_type);
+  void ReadGraph(const StoredType& type, plAbstractObjectGraph& ref_graph);
+  void PatchGraph(const StoredType& type, plAbstractObjectGraph& ref_graph);
+
+  plStreamReader& m_Stream;
+  bool m_bTagRead = false;
+  bool m_bHeaderRead = false;
+  plDeque<StoredType> m_StoredTypes;
+};
@@ -49,6 +49,24 @@ public:
   static plUInt32 ClearUnusedStrings();
 #endif
 
+  /// \brief Information about the central string storage, see GetStats().
+  struct Stats
+  {
+    plUInt32 m_uiNumStrings = 0;     ///< How many strings are stored.
+    plUInt64 m_uiStringBytes = 0;    ///< The size of all stored strings in bytes, without the overhead of the storage.
+    plUInt32 m_uiNumShards = 0;      ///< Into how many independently locked parts the storage is split.
+    plUInt32 m_uiLargestShard = 0;   ///< The number of strings in the fullest shard.
+    plUInt32 m_uiIndexSlots = 0;     ///< The number of slots in the lock-free lookup tables of all shards.
+    plUInt32 m_uiLockedLookups = 0;  ///< How often a string could not be found without locking a shard.
+    plUInt32 m_uiContendedLocks = 0; ///< How often a thread had to wait for a shard that was locked by another thread.
+  };
+
+  /// \brief Returns statistics about the central string storage.
+  ///
+  /// The storage is split into shards by hash value. Strings that were already stored are found without taking a lock,
+  /// so m_uiLockedLookups should roughly match the number of distinct strings, and m_uiContendedLocks should stay low.
+  static void GetStats(Stats& out_stats);
+
   PL_DECLARE_MEM_RELOCATABLE_TYPE();
 
   /// \brief Initializes this string to the empty string.
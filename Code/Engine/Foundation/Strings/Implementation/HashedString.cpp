@@ -4,16 +4,107 @@
 #include <Foundation/Strings/HashedString.h>
 #include <Foundation/Threading/Lock.h>
 #include <Foundation/Threading/Mutex.h>
+#include <Foundation/Types/ScopeExit.h>
 
-struct HashedStringData
+#include <atomic>
+
+static_assert(std::is_trivially_copyable_v<plHashedString::HashedType>);
+
+constexpr plUInt32 HashedStringShardCount = 16;
+
+/// \brief Open addressing table of the strings in a shard, which can be searched without holding the shard's mutex.
+///
+/// Slots are only ever filled, never cleared. When the table gets too full, it is replaced by a larger one and the old one is kept
+/// alive, because other threads may still search it.
+struct HashedStringIndex
+{
+  plUInt32 m_uiMask = 0;
+  plArrayPtr<std::atomic<plHashedString::HashedType>> m_Slots;
+};
+
+struct alignas(64) HashedStringShard
 {
   plMutex m_Mutex;
   plHashedString::StringStorage m_Storage;
+  std::atomic<HashedStringIndex*> m_pIndex = nullptr;
+  plDynamicArray<HashedStringIndex*, plStaticsAllocatorWrapper> m_RetiredIndices;
+
+  plUInt32 m_uiLockedLookups = 0;
+  plUInt32 m_uiContendedLocks = 0;
+};
+
+struct HashedStringData
+{
+  HashedStringShard m_Shards[HashedStringShardCount];
   plHashedString::HashedType m_Empty;
 };
 
 static HashedStringData* s_pHSData;
 
+static HashedStringShard& GetHashedStringShard(plUInt64 uiHash)
+{
+  // the index uses the low bits of the hash
+  return s_pHSData->m_Shards[(uiHash >> 32) % HashedStringShardCount];
+}
+
+static bool FindInHashedStringIndex(const HashedStringShard& shard, plUInt64 uiHash, plHashedString::HashedType& out_it)
+{
+  const HashedStringIndex* pIndex = shard.m_pIndex.load(std::memory_order_acquire);
+
+  if (pIndex == nullptr)
+    return false;
+
+  // the index is at most half full, so there is always an empty slot that ends the search
+  for (plUInt32 uiSlot = static_cast<plUInt32>(uiHash) & pIndex->m_uiMask;; uiSlot = (uiSlot + 1) & pIndex->m_uiMask)
+  {
+    const plHashedString::HashedType it = pIndex->m_Slots[uiSlot].load(std::memory_order_acquire);
+
+    if (!it.IsValid())
+      return false;
+
+    if (it.Key() == uiHash)
+    {
+      out_it = it;
+      return true;
+    }
+  }
+}
+
+static void InsertIntoHashedStringIndex(HashedStringIndex& ref_index, plHashedString::HashedType it)
+{
+  plUInt32 uiSlot = static_cast<plUInt32>(it.Key()) & ref_index.m_uiMask;
+
+  while (ref_index.m_Slots[uiSlot].load(std::memory_order_relaxed).IsValid())
+  {
+    uiSlot = (uiSlot + 1) & ref_index.m_uiMask;
+  }
+
+  ref_index.m_Slots[uiSlot].store(it, std::memory_order_release);
+}
+
+/// \brief Replaces the index of the shard by one that contains all strings in the shard. Must be called with the shard's mutex held.
+static void RebuildHashedStringIndex(HashedStringShard& ref_shard)
+{
+  plAllocator* pAllocator = plFoundation::GetStaticsAllocator();
+
+  HashedStringIndex* pIndex = PL_NEW(pAllocator, HashedStringIndex);
+  const plUInt32 uiCapacity = plMath::PowerOfTwo_Ceil(plMath::Max(ref_shard.m_Storage.GetCount() * 4, 64u));
+  pIndex->m_uiMask = uiCapacity - 1;
+  pIndex->m_Slots = PL_NEW_ARRAY(pAllocator, std::atomic<plHashedString::HashedType>, uiCapacity);
+
+  for (auto it = ref_shard.m_Storage.GetIterator(); it.IsValid(); ++it)
+  {
+    InsertIntoHashedStringIndex(*pIndex, it);
+  }
+
+  HashedStringIndex* pOldIndex = ref_shard.m_pIndex.exchange(pIndex, std::memory_order_acq_rel);
+
+  if (pOldIndex != nullptr)
+  {
+    ref_shard.m_RetiredIndices.PushBack(pOldIndex);
+  }
+}
+
 PL_MSVC_ANALYSIS_WARNING_PUSH
 PL_MSVC_ANALYSIS_WARNING_DISABLE(6011) // Disable warning for null pointer dereference as InitHashedString() will ensure that s_pHSData is set
 
@@ -23,11 +114,37 @@ plHashedString::HashedType plHashedString::AddHashedString(plStringView sString,
   if (s_pHSData == nullptr)
     InitHashedString();
 
-  PL_LOCK(s_pHSData->m_Mutex);
+  HashedStringShard& shard = GetHashedStringShard(uiHash);
+
+#if PL_DISABLED(PL_HASHED_STRING_REF_COUNTING)
+  // strings are never removed, so once a string is in the index, it can be used without any synchronization
+  HashedType existing;
+  if (FindInHashedStringIndex(shard, uiHash, existing))
+  {
+#  if PL_ENABLED(PL_COMPILE_FOR_DEVELOPMENT)
+    if (existing.Value().m_sString != sString)
+    {
+      plLog::Error("Hash collision encountered: Strings \"{}\" and \"{}\" both hash to {}.", plArgSensitive(existing.Value().m_sString), plArgSensitive(sString), uiHash);
+    }
+#  endif
+
+    return existing;
+  }
+#endif
+
+  if (shard.m_Mutex.TryLock().Failed())
+  {
+    shard.m_Mutex.Lock();
+    ++shard.m_uiContendedLocks;
+  }
+
+  PL_SCOPE_EXIT(shard.m_Mutex.Unlock());
+
+  ++shard.m_uiLockedLookups;
 
   // try to find the existing string
   bool bExisted = false;
-  auto ret = s_pHSData->m_Storage.FindOrAdd(uiHash, &bExisted);
+  auto ret = shard.m_Storage.FindOrAdd(uiHash, &bExisted);
 
   // if it already exists, just increase the refcount
   if (bExisted)
@@ -51,6 +168,17 @@ plHashedString::HashedType plHashedString::AddHashedString(plStringView sString,
     d.m_iRefCount = 1;
 #endif
     d.m_sString = sString;
+
+    // publish the string only after it is fully initialized
+    HashedStringIndex* pIndex = shard.m_pIndex.load(std::memory_order_relaxed);
+    if (pIndex == nullptr || shard.m_Storage.GetCount() * 2 > pIndex->m_uiMask)
+    {
+      RebuildHashedStringIndex(shard);
+    }
+    else
+    {
+      InsertIntoHashedStringIndex(*pIndex, ret);
+    }
   }
 
   return ret;
@@ -79,19 +207,29 @@ void plHashedString::InitHashedString()
 #if PL_ENABLED(PL_HASHED_STRING_REF_COUNTING)
 plUInt32 plHashedString::ClearUnusedStrings()
 {
-  PL_LOCK(s_pHSData->m_Mutex);
-
   plUInt32 uiDeleted = 0;
 
-  for (auto it = s_pHSData->m_Storage.GetIterator(); it.IsValid();)
+  for (HashedStringShard& shard : s_pHSData->m_Shards)
   {
-    if (it.Value().m_iRefCount == 0)
+    PL_LOCK(shard.m_Mutex);
+
+    const plUInt32 uiPrevCount = shard.m_Storage.GetCount();
+
+    for (auto it = shard.m_Storage.GetIterator(); it.IsValid();)
     {
-      it = s_pHSData->m_Storage.Remove(it);
-      ++uiDeleted;
+      if (it.Value().m_iRefCount == 0)
+      {
+        it = shard.m_Storage.Remove(it);
+        ++uiDeleted;
+      }
+      else
+        ++it;
+    }
+
+    if (shard.m_Storage.GetCount() != uiPrevCount)
+    {
+      RebuildHashedStringIndex(shard);
     }
-    else
-      ++it;
   }
 
   return uiDeleted;
@@ -142,8 +280,10 @@ void plHashedString::Clear()
 
 plResult plHashedString::LookupStringHash(plUInt64 uiHash, plStringView& out_sResult)
 {
-  PL_LOCK(s_pHSData->m_Mutex);
-  auto it = s_pHSData->m_Storage.Find(uiHash);
+  HashedStringShard& shard = GetHashedStringShard(uiHash);
+
+  PL_LOCK(shard.m_Mutex);
+  auto it = shard.m_Storage.Find(uiHash);
 
   if (!it.IsValid())
     return PL_FAILURE;
@@ -151,3 +291,31 @@ plResult plHashedString::LookupStringHash(plUInt64 uiHash, plStringView& out_sRe
   out_sResult = it.Value().m_sString;
   return PL_SUCCESS;
 }
+
+void plHashedString::GetStats(Stats& out_stats)
+{
+  out_stats = {};
+
+  if (s_pHSData == nullptr)
+    return;
+
+  out_stats.m_uiNumShards = HashedStringShardCount;
+
+  for (HashedStringShard& shard : s_pHSData->m_Shards)
+  {
+    PL_LOCK(shard.m_Mutex);
+
+    const HashedStringIndex* pIndex = shard.m_pIndex.load(std::memory_order_relaxed);
+
+    out_stats.m_uiNumStrings += shard.m_Storage.GetCount();
+    out_stats.m_uiLargestShard = plMath::Max(out_stats.m_uiLargestShard, shard.m_Storage.GetCount());
+    out_stats.m_uiIndexSlots += pIndex != nullptr ? pIndex->m_uiMask + 1 : 0;
+    out_stats.m_uiLockedLookups += shard.m_uiLockedLookups;
+    out_stats.m_uiContendedLocks += shard.m_uiContendedLocks;
+
+    for (auto it = shard.m_Storage.GetIterator(); it.IsValid(); ++it)
+    {
+      out_stats.m_uiStringBytes += it.Value().m_sString.GetElementCount();
+    }
+  }
+}
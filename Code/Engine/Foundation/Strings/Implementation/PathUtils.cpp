@@ -1,6 +1,7 @@
 #include <Foundation/FoundationPCH.h>
 
 #include <Foundation/Strings/Implementation/StringIterator.h>
+#include <Foundation/Strings/Implementation/StringUtilsSimd.h>
 #include <Foundation/Strings/StringBuilder.h>
 
 const char* plPathUtils::FindPreviousSeparator(const char* szPathStart, const char* szStartSearchAt)
@@ -8,15 +9,8 @@ const char* plPathUtils::FindPreviousSeparator(const char* szPathStart, const ch
   if (plStringUtils::IsNullOrEmpty(szPathStart))
     return nullptr;
 
-  while (szStartSearchAt > szPathStart)
-  {
-    plUnicodeUtils::MoveToPriorUtf8(szStartSearchAt, szPathStart).AssertSuccess();
-
-    if (IsPathSeparator(*szStartSearchAt))
-      return szStartSearchAt;
-  }
-
-  return nullptr;
+  // both separators are ASCII, so they can't be part of a multi-byte character
+  return plInternal::StringSimdFindLastChar(szPathStart, szStartSearchAt, '/', '\\');
 }
 
 bool plPathUtils::HasAnyExtension(plStringView sPath)
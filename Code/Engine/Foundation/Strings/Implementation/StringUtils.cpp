@@ -1,5 +1,6 @@
 #include <Foundation/FoundationPCH.h>
 
+#include <Foundation/Strings/Implementation/StringUtilsSimd.h>
 #include <Foundation/Strings/StringView.h>
 #include <Foundation/Utilities/ConversionUtils.h>
 
@@ -191,6 +192,67 @@ plUInt32 plStringUtils::ToLowerString(char* pString, const char* pStringEnd)
   return uiNewStringLength;
 }
 
+plUInt32 plStringUtils::GetCharacterCount(const char* szUtf8, const char* pStringEnd)
+{
+  if (IsNullOrEmpty(szUtf8))
+    return 0;
+
+  if (pStringEnd == plUnicodeUtils::GetMaxStringEnd<char>())
+    pStringEnd = szUtf8 + strlen(szUtf8);
+
+  plUInt32 uiCharacters = 0;
+
+  if (pStringEnd > szUtf8)
+  {
+    szUtf8 += plInternal::StringSimdCountCharacters(szUtf8, static_cast<plUInt32>(pStringEnd - szUtf8), uiCharacters);
+  }
+
+  while ((szUtf8 < pStringEnd) && (*szUtf8 != '\0'))
+  {
+    // skip all the Utf8 continuation bytes
+    if (!plUnicodeUtils::IsUtf8ContinuationByte(*szUtf8))
+      ++uiCharacters;
+
+    ++szUtf8;
+  }
+
+  return uiCharacters;
+}
+
+void plStringUtils::GetCharacterAndElementCount(const char* szUtf8, plUInt32& ref_uiCharacterCount, plUInt32& ref_uiElementCount, const char* pStringEnd)
+{
+  ref_uiCharacterCount = 0;
+  ref_uiElementCount = 0;
+
+  if (IsNullOrEmpty(szUtf8))
+    return;
+
+  if (pStringEnd == plUnicodeUtils::GetMaxStringEnd<char>())
+    pStringEnd = szUtf8 + strlen(szUtf8);
+
+  if (pStringEnd > szUtf8)
+  {
+    ref_uiElementCount = plInternal::StringSimdCountCharacters(szUtf8, static_cast<plUInt32>(pStringEnd - szUtf8), ref_uiCharacterCount);
+    szUtf8 += ref_uiElementCount;
+  }
+
+  while (szUtf8 < pStringEnd)
+  {
+    char uiByte = *szUtf8;
+    if (uiByte == '\0')
+    {
+      break;
+    }
+
+    // skip all the Utf8 continuation bytes
+    if (!plUnicodeUtils::IsUtf8ContinuationByte(uiByte))
+      ++ref_uiCharacterCount;
+
+    ++szUtf8;
+    ++ref_uiElementCount;
+  }
+}
+
 // Macro to Handle nullptr-pointer strings
 #define PL_STRINGCOMPARE_HANDLE_NULL_PTRS(szString1, szString2, ret_equal, ret_str2_larger, ret_str1_larger, szString1End, szString2End)                  \
   if (szString1 == szString2)                                     /* Handles the case that both are nullptr and that both are actually the same string */ \
@@ -216,10 +278,26 @@ plUInt32 plStringUtils::ToLowerString(char* pString, const char* pStringEnd)
 
 #define ToSignedInt(c) ((plInt32)((unsigned char)c))
 
+/// \brief Returns how many bytes can be read from both strings, or 0 if the length of either string is only determined by its terminator.
+static plUInt32 StringUtilsGetKnownCommonLength(const char* pString1, const char* pString2, const char* pString1End, const char* pString2End)
+{
+  if (pString1End == plUnicodeUtils::GetMaxStringEnd<char>() || pString2End == plUnicodeUtils::GetMaxStringEnd<char>())
+    return 0;
+
+  if (pString1End <= pString1 || pString2End <= pString2)
+    return 0;
+
+  return static_cast<plUInt32>(plMath::Min(pString1End - pString1, pString2End - pString2));
+}
+
 plInt32 plStringUtils::Compare(const char* pString1, const char* pString2, const char* pString1End, const char* pString2End)
 {
   PL_STRINGCOMPARE_HANDLE_NULL_PTRS(pString1, pString2, 0, -1, 1, pString1End, pString2End);
 
+  const plUInt32 uiEqualBytes = plInternal::StringSimdSkipEqual(pString1, pString2, StringUtilsGetKnownCommonLength(pString1, pString2, pString1End, pString2End));
+  pString1 += uiEqualBytes;
+  pString2 += uiEqualBytes;
+
   while ((pString1 < pString1End) && (pString2 < pString2End) && (*pString1 != '\0') && (*pString2 != '\0'))
   {
     if (*pString1 != *pString2)
@@ -288,6 +366,11 @@ plInt32 plStringUtils::Compare_NoCase(const char* pString1, const char* pString2
 {
   PL_STRINGCOMPARE_HANDLE_NULL_PTRS(pString1, pString2, 0, -1, 1, pString1End, pString2End);
 
+  // skip the ASCII prefix that is equal, the rest needs to be decoded
+  const plUInt32 uiEqualBytes = plInternal::StringSimdSkipEqualAscii_NoCase(pString1, pString2, StringUtilsGetKnownCommonLength(pString1, pString2, pString1End, pString2End));
+  pString1 += uiEqualBytes;
+  pString2 += uiEqualBytes;
+
   while ((pString1 < pString1End) && (pString2 < pString2End) && (*pString1 != '\0') && (*pString2 != '\0'))
   {
     // utf8::next will already advance the iterators
@@ -556,6 +639,23 @@ const char* plStringUtils::FindSubString(const char* szSource, const char* szStr
 
   const char* pCurPos = &szSource[0];
 
+  // a match can only start where the first byte matches, and since that byte starts a character, so does the match
+  if (pSourceEnd != plUnicodeUtils::GetMaxStringEnd<char>() && szStringToFind < szStringToFindEnd && !plUnicodeUtils::IsUtf8ContinuationByte(*szStringToFind))
+  {
+    while (true)
+    {
+      pCurPos = plInternal::StringSimdFindCharOrZero(pCurPos, pSourceEnd, *szStringToFind);
+
+      if (pCurPos == pSourceEnd || *pCurPos == '\0')
+        return nullptr;
+
+      if (plStringUtils::StartsWith(pCurPos, szStringToFind, pSourceEnd, szStringToFindEnd))
+        return pCurPos;
+
+      ++pCurPos;
+    }
+  }
+
   while ((pCurPos < pSourceEnd) && (*pCurPos != '\0'))
   {
     if (plStringUtils::StartsWith(pCurPos, szStringToFind, pSourceEnd, szStringToFindEnd))
@@ -597,6 +697,21 @@ const char* plStringUtils::FindLastSubString(const char* szSource, const char* s
   if (szStartSearchAt == nullptr)
     szStartSearchAt = szSource + plStringUtils::GetStringElementCount(szSource, pSourceEnd);
 
+  // same as in FindSubString(), only positions where the first byte matches need to be checked
+  if (szStringToFind < szStringToFindEnd && !plUnicodeUtils::IsUtf8ContinuationByte(*szStringToFind))
+  {
+    while (true)
+    {
+      szStartSearchAt = plInternal::StringSimdFindLastChar(szSource, szStartSearchAt, *szStringToFind, *szStringToFind);
+
+      if (szStartSearchAt == nullptr)
+        return nullptr;
+
+      if (plStringUtils::StartsWith(szStartSearchAt, szStringToFind, pSourceEnd, szStringToFindEnd))
+        return szStartSearchAt;
+    }
+  }
+
   // while we haven't reached the stars .. erm, start
   while (szStartSearchAt > szSource)
   {
@@ -898,3 +1013,26 @@ bool plStringUtils::IsValidIdentifierName(const char* pString, const char* pStri
 
   return true;
 }
+
+bool plUnicodeUtils::IsValidUtf8(const char* szString, const char* szStringEnd)
+{
+#if PL_ENABLED(PL_USE_STRING_VALIDATION)
+  if (szStringEnd == GetMaxStringEnd<char>())
+    szStringEnd = szString + strlen(szString);
+
+  while (szString < szStringEnd)
+  {
+    // ASCII is always valid, only the other characters need to be decoded
+    szString += plInternal::StringSimdSkipAscii(szString, static_cast<plUInt32>(szStringEnd - szString));
+
+    if (szString < szStringEnd && utf8::internal::validate_next(szString, szStringEnd) != utf8::internal::UTF8_OK)
+      return false;
+  }
+
+  return true;
+#else
+  PL_IGNORE_UNUSED(szString);
+  PL_IGNORE_UNUSED(szStringEnd);
+  return true;
+#endif
+}
@@ -0,0 +1,205 @@
+#pragma once
+
+#include <Foundation/Math/Math.h>
+
+// only SSE2 is needed, which every x64 CPU supports, so this doesn't depend on PL_SIMD_IMPLEMENTATION
+#if PL_ENABLED(PL_PLATFORM_ARCH_X86) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#  define PL_STRING_SIMD PL_ON
+#  include <emmintrin.h>
+#else
+#  define PL_STRING_SIMD PL_OFF
+#endif
+
+/// \file
+/// Helpers that let the string functions process 16 bytes per iteration, as long as the data is ASCII.
+///
+/// All functions work on a range of known length and never read outside of it. The "Skip" functions only look at full blocks of 16 bytes
+/// and return how many bytes the caller can skip, the caller then continues with its scalar code. Without SIMD support they return 0.
+
+namespace plInternal
+{
+#if PL_ENABLED(PL_STRING_SIMD)
+  PL_ALWAYS_INLINE __m128i StringSimdLoad(const char* p)
+  {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+  }
+
+  /// \brief Converts 'a' to 'z' to upper case, leaves all other bytes alone. Only valid if all bytes are ASCII.
+  PL_ALWAYS_INLINE __m128i StringSimdToUpperAscii(__m128i v)
+  {
+    const __m128i isLower = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(v, _mm_set1_epi8('z' + 1)));
+    return _mm_sub_epi8(v, _mm_and_si128(isLower, _mm_set1_epi8('a' - 'A')));
+  }
+
+  /// \brief Returns uiBlockStart + the index of the first zero bit in the 16 bit mask. At least one of the 16 bits must be zero.
+  PL_ALWAYS_INLINE plUInt32 StringSimdFirstMismatch(plUInt32 uiBlockStart, plUInt32 uiMask)
+  {
+    return uiBlockStart + plMath::FirstBitLow(~uiMask);
+  }
+#endif
+
+  /// \brief Returns the number of leading bytes that are equal in both strings and not zero.
+  inline plUInt32 StringSimdSkipEqual(const char* pString1, const char* pString2, plUInt32 uiLength)
+  {
+    plUInt32 i = 0;
+
+#if PL_ENABLED(PL_STRING_SIMD)
+    const __m128i zero = _mm_setzero_si128();
+
+    for (; i + 16 <= uiLength; i += 16)
+    {
+      const __m128i a = StringSimdLoad(pString1 + i);
+      const __m128i b = StringSimdLoad(pString2 + i);
+
+      const plUInt32 uiMask = _mm_movemask_epi8(_mm_andnot_si128(_mm_cmpeq_epi8(a, zero), _mm_cmpeq_epi8(a, b)));
+
+      if (uiMask != 0xFFFF)
+        return StringSimdFirstMismatch(i, uiMask);
+    }
+#else
+    PL_IGNORE_UNUSED(pString1);
+    PL_IGNORE_UNUSED(pString2);
+    PL_IGNORE_UNUSED(uiLength);
+#endif
+
+    return i;
+  }
+
+  /// \brief Returns the number of leading bytes that are ASCII, not zero and equal in both strings when ignoring case.
+  ///
+  /// Since all skipped bytes are ASCII, the result is always at a character boundary.
+  inline plUInt32 StringSimdSkipEqualAscii_NoCase(const char* pString1, const char* pString2, plUInt32 uiLength)
+  {
+    plUInt32 i = 0;
+
+#if PL_ENABLED(PL_STRING_SIMD)
+    const __m128i zero = _mm_setzero_si128();
+
+    for (; i + 16 <= uiLength; i += 16)
+    {
+      const __m128i a = StringSimdLoad(pString1 + i);
+      const __m128i b = StringSimdLoad(pString2 + i);
+
+      // non-ASCII bytes are negative, so they fail the 'greater than zero' test, just like the terminator
+      const __m128i valid = _mm_and_si128(_mm_cmpgt_epi8(a, zero), _mm_cmpgt_epi8(b, zero));
+      const __m128i equal = _mm_cmpeq_epi8(StringSimdToUpperAscii(a), StringSimdToUpperAscii(b));
+      const plUInt32 uiMask = _mm_movemask_epi8(_mm_and_si128(valid, equal));
+
+      if (uiMask != 0xFFFF)
+        return StringSimdFirstMismatch(i, uiMask);
+    }
+#else
+    PL_IGNORE_UNUSED(pString1);
+    PL_IGNORE_UNUSED(pString2);
+    PL_IGNORE_UNUSED(uiLength);
+#endif
+
+    return i;
+  }
+
+  /// \brief Returns the number of leading bytes that are ASCII (a zero byte counts as ASCII).
+  inline plUInt32 StringSimdSkipAscii(const char* pString, plUInt32 uiLength)
+  {
+    plUInt32 i = 0;
+
+#if PL_ENABLED(PL_STRING_SIMD)
+    for (; i + 16 <= uiLength; i += 16)
+    {
+      const plUInt32 uiNonAscii = _mm_movemask_epi8(StringSimdLoad(pString + i));
+
+      if (uiNonAscii != 0)
+        return i + plMath::FirstBitLow(uiNonAscii);
+    }
+#else
+    PL_IGNORE_UNUSED(pString);
+    PL_IGNORE_UNUSED(uiLength);
+#endif
+
+    return i;
+  }
+
+  /// \brief Counts the characters in full blocks of 16 bytes until a block contains a zero byte.
+  ///
+  /// Returns the number of bytes that were looked at, which always ends at a block boundary.
+  inline plUInt32 StringSimdCountCharacters(const char* pString, plUInt32 uiLength, plUInt32& out_uiCharacters)
+  {
+    plUInt32 i = 0;
+    out_uiCharacters = 0;
+
+#if PL_ENABLED(PL_STRING_SIMD)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i continuationLimit = _mm_set1_epi8(static_cast<char>(0xC0));
+
+    for (; i + 16 <= uiLength; i += 16)
+    {
+      const __m128i v = StringSimdLoad(pString + i);
+
+      if (_mm_movemask_epi8(_mm_cmpeq_epi8(v, zero)) != 0)
+        break;
+
+      // continuation bytes are 0x80 to 0xBF, which are the only bytes that are smaller than (signed) 0xC0
+      const plUInt32 uiContinuation = _mm_movemask_epi8(_mm_cmplt_epi8(v, continuationLimit));
+      out_uiCharacters += 16 - plMath::CountBits(uiContinuation);
+    }
+#else
+    PL_IGNORE_UNUSED(pString);
+    PL_IGNORE_UNUSED(uiLength);
+#endif
+
+    return i;
+  }
+
+  /// \brief Returns a pointer to the first byte in [pString; pStringEnd) that is either uiChar or zero, or pStringEnd.
+  inline const char* StringSimdFindCharOrZero(const char* pString, const char* pStringEnd, char uiChar)
+  {
+#if PL_ENABLED(PL_STRING_SIMD)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i search = _mm_set1_epi8(uiChar);
+
+    for (; pStringEnd - pString >= 16; pString += 16)
+    {
+      const __m128i v = StringSimdLoad(pString);
+      const plUInt32 uiMask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, search), _mm_cmpeq_epi8(v, zero)));
+
+      if (uiMask != 0)
+        return pString + plMath::FirstBitLow(uiMask);
+    }
+#endif
+
+    for (; pString < pStringEnd; ++pString)
+    {
+      if (*pString == uiChar || *pString == '\0')
+        return pString;
+    }
+
+    return pStringEnd;
+  }
+
+  /// \brief Returns a pointer to the last byte in [pString; pStringEnd) that is either uiChar1 or uiChar2, or nullptr.
+  inline const char* StringSimdFindLastChar(const char* pString, const char* pStringEnd, char uiChar1, char uiChar2)
+  {
+#if PL_ENABLED(PL_STRING_SIMD)
+    const __m128i search1 = _mm_set1_epi8(uiChar1);
+    const __m128i search2 = _mm_set1_epi8(uiChar2);
+
+    for (; pStringEnd - pString >= 16; pStringEnd -= 16)
+    {
+      const __m128i v = StringSimdLoad(pStringEnd - 16);
+      const plUInt32 uiMask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, search1), _mm_cmpeq_epi8(v, search2)));
+
+      if (uiMask != 0)
+        return pStringEnd - 16 + plMath::FirstBitHigh(uiMask);
+    }
+#endif
+
+    while (pStringEnd > pString)
+    {
+      --pStringEnd;
+
+      if (*pStringEnd == uiChar1 || *pStringEnd == uiChar2)
+        return pStringEnd;
+    }
+
+    return nullptr;
+  }
+} // namespace plInternal
@@ -68,57 +68,21 @@ plUInt32 plStringUtils::GetStringElementCount(const T* pString, const T* pString
   if (pStringEnd != plUnicodeUtils::GetMaxStringEnd<T>())
     return (plUInt32)(pStringEnd - pString);
 
-  plUInt32 uiCount = 0;
-  while ((*pString != '\0') && (pString < pStringEnd))
-  {
-    ++pString;
-    ++uiCount;
-  }
-
-  return uiCount;
-}
-
-inline plUInt32 plStringUtils::GetCharacterCount(const char* szUtf8, const char* pStringEnd)
-{
-  if (IsNullOrEmpty(szUtf8))
-    return 0;
-
-  plUInt32 uiCharacters = 0;
-
-  while ((*szUtf8 != '\0') && (szUtf8 < pStringEnd))
+  if constexpr (std::is_same_v<T, char>)
   {
-    // skip all the Utf8 continuation bytes
-    if (!plUnicodeUtils::IsUtf8ContinuationByte(*szUtf8))
-      ++uiCharacters;
-
-    ++szUtf8;
+    // the C library has vectorized implementations of this
+    return (plUInt32)strlen(pString);
   }
-
-  return uiCharacters;
-}
-
-inline void plStringUtils::GetCharacterAndElementCount(const char* szUtf8, plUInt32& ref_uiCharacterCount, plUInt32& ref_uiElementCount, const char* pStringEnd)
-{
-  ref_uiCharacterCount = 0;
-  ref_uiElementCount = 0;
-
-  if (IsNullOrEmpty(szUtf8))
-    return;
-
-  while (szUtf8 < pStringEnd)
+  else
   {
-    char uiByte = *szUtf8;
-    if (uiByte == '\0')
+    plUInt32 uiCount = 0;
+    while ((*pString != '\0') && (pString < pStringEnd))
     {
-      break;
+      ++pString;
+      ++uiCount;
     }
 
-    // skip all the Utf8 continuation bytes
-    if (!plUnicodeUtils::IsUtf8ContinuationByte(uiByte))
-      ++ref_uiCharacterCount;
-
-    ++szUtf8;
-    ++ref_uiElementCount;
+    return uiCount;
   }
 }
 
@@ -147,20 +147,6 @@ inline plUInt32 plUnicodeUtils::GetSizeForCharacterInUtf8(plUInt32 uiCharacter)
   return 4;
 }
 
-PL_ALWAYS_INLINE bool plUnicodeUtils::IsValidUtf8(const char* szString, const char* szStringEnd)
-{
-#if PL_ENABLED(PL_USE_STRING_VALIDATION)
-  if (szStringEnd == GetMaxStringEnd<char>())
-    szStringEnd = szString + strlen(szString);
-
-  return utf8::is_valid(szString, szStringEnd);
-#else
-  PL_IGNORE_UNUSED(szString);
-  PL_IGNORE_UNUSED(szStringEnd);
-  return true;
-#endif
-}
-
 inline bool plUnicodeUtils::SkipUtf8Bom(const char*& ref_szUtf8)
 {
   PL_ASSERT_DEBUG(ref_szUtf8 != nullptr, "This function expects non nullptr pointers");
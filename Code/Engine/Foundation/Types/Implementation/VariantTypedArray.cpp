@@ -0,0 +1,516 @@
+#include <Foundation/FoundationPCH.h>
+
+#include <Foundation/Reflection/Reflection.h>
+#include <Foundation/Types/VariantTypedArray.h>
+#include <Foundation/Types/VariantTypeRegistry.h>
+
+// only SSE2 is needed, which every x64 CPU supports, so this doesn't depend on PL_SIMD_IMPLEMENTATION
+#if PL_ENABLED(PL_PLATFORM_ARCH_X86) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#  define PL_VARIANT_TYPED_ARRAY_SIMD PL_ON
+#  include <emmintrin.h>
+#else
+#  define PL_VARIANT_TYPED_ARRAY_SIMD PL_OFF
+#endif
+
+// clang-format off
+PL_BEGIN_STATIC_REFLECTED_TYPE(plVariantTypedArray, plNoBase, 1, plRTTIDefaultAllocator<plVariantTypedArray>)
+{
+  PL_BEGIN_PROPERTIES
+  {
+    PL_ENUM_MEMBER_PROPERTY("ElementType", plVariantType, m_ElementType),
+    PL_MEMBER_PROPERTY("Data", m_Data),
+  }
+  PL_END_PROPERTIES;
+}
+PL_END_STATIC_REFLECTED_TYPE;
+// clang-format on
+
+PL_DEFINE_CUSTOM_VARIANT_TYPE(plVariantTypedArray);
+
+namespace
+{
+  /// \brief Calls func with a null pointer of the C++ type of the given scalar type. Returns false for all other types.
+  template <typename Functor>
+  PL_FORCE_INLINE bool plVariantTypedArrayDispatchScalar(plVariantType::Enum type, Functor&& func)
+  {
+    switch (type)
+    {
+      case plVariantType::Bool:
+        func(static_cast<bool*>(nullptr));
+        return true;
+      case plVariantType::Int8:
+        func(static_cast<plInt8*>(nullptr));
+        return true;
+      case plVariantType::UInt8:
+        func(static_cast<plUInt8*>(nullptr));
+        return true;
+      case plVariantType::Int16:
+        func(static_cast<plInt16*>(nullptr));
+        return true;
+      case plVariantType::UInt16:
+        func(static_cast<plUInt16*>(nullptr));
+        return true;
+      case plVariantType::Int32:
+        func(static_cast<plInt32*>(nullptr));
+        return true;
+      case plVariantType::UInt32:
+        func(static_cast<plUInt32*>(nullptr));
+        return true;
+      case plVariantType::Int64:
+        func(static_cast<plInt64*>(nullptr));
+        return true;
+      case plVariantType::UInt64:
+        func(static_cast<plUInt64*>(nullptr));
+        return true;
+      case plVariantType::Float:
+        func(static_cast<float*>(nullptr));
+        return true;
+      case plVariantType::Double:
+        func(static_cast<double*>(nullptr));
+        return true;
+      default:
+        return false;
+    }
+  }
+
+  /// \brief Same as plVariantTypedArrayDispatchScalar, but also handles all vector types.
+  template <typename Functor>
+  PL_FORCE_INLINE bool plVariantTypedArrayDispatchElement(plVariantType::Enum type, Functor&& func)
+  {
+    switch (type)
+    {
+      case plVariantType::Vector2:
+        func(static_cast<plVec2*>(nullptr));
+        return true;
+      case plVariantType::Vector3:
+        func(static_cast<plVec3*>(nullptr));
+        return true;
+      case plVariantType::Vector4:
+        func(static_cast<plVec4*>(nullptr));
+        return true;
+      case plVariantType::Vector2I:
+        func(static_cast<plVec2I32*>(nullptr));
+        return true;
+      case plVariantType::Vector3I:
+        func(static_cast<plVec3I32*>(nullptr));
+        return true;
+      case plVariantType::Vector4I:
+        func(static_cast<plVec4I32*>(nullptr));
+        return true;
+      case plVariantType::Vector2U:
+        func(static_cast<plVec2U32*>(nullptr));
+        return true;
+      case plVariantType::Vector3U:
+        func(static_cast<plVec3U32*>(nullptr));
+        return true;
+      case plVariantType::Vector4U:
+        func(static_cast<plVec4U32*>(nullptr));
+        return true;
+      default:
+        return plVariantTypedArrayDispatchScalar(type, std::forward<Functor>(func));
+    }
+  }
+
+  /// \brief Returns the type of the components of a vector, or the type itself for numbers.
+  plVariantType::Enum plVariantTypedArrayGetComponentType(plVariantType::Enum type)
+  {
+    switch (type)
+    {
+      case plVariantType::Vector2:
+      case plVariantType::Vector3:
+      case plVariantType::Vector4:
+        return plVariantType::Float;
+      case plVariantType::Vector2I:
+      case plVariantType::Vector3I:
+      case plVariantType::Vector4I:
+        return plVariantType::Int32;
+      case plVariantType::Vector2U:
+      case plVariantType::Vector3U:
+      case plVariantType::Vector4U:
+        return plVariantType::UInt32;
+      default:
+        return type;
+    }
+  }
+
+  /// \brief Converts a single number the same way plVariant::ConvertTo does.
+  template <typename T>
+  struct plVariantTypedArrayCast
+  {
+    template <typename S>
+    PL_ALWAYS_INLINE static T Cast(S value)
+    {
+      return static_cast<T>(value);
+    }
+  };
+
+  template <>
+  struct plVariantTypedArrayCast<bool>
+  {
+    template <typename S>
+    PL_ALWAYS_INLINE static bool Cast(S value)
+    {
+      return static_cast<plInt32>(value) != 0;
+    }
+  };
+
+#define PL_VARIANT_TYPED_ARRAY_CAST_VIA(TYPE, INTERMEDIATE)       \
+  template <>                                                     \
+  struct plVariantTypedArrayCast<TYPE>                            \
+  {                                                               \
+    template <typename S>                                         \
+    PL_ALWAYS_INLINE static TYPE Cast(S value)                    \
+    {                                                             \
+      return static_cast<TYPE>(static_cast<INTERMEDIATE>(value)); \
+    }                                                             \
+  };
+
+  PL_VARIANT_TYPED_ARRAY_CAST_VIA(plInt8, plInt32)
+  PL_VARIANT_TYPED_ARRAY_CAST_VIA(plInt16, plInt32)
+  PL_VARIANT_TYPED_ARRAY_CAST_VIA(plUInt8, plUInt32)
+  PL_VARIANT_TYPED_ARRAY_CAST_VIA(plUInt16, plUInt32)
+
+#undef PL_VARIANT_TYPED_ARRAY_CAST_VIA
+
+  /// \brief Converts as many values as possible with SSE2 and returns how many were converted.
+  template <typename S, typename T>
+  PL_ALWAYS_INLINE plUInt32 plVariantTypedArrayConvertSimd(const S* pSource, T* pTarget, plUInt32 uiCount)
+  {
+    plUInt32 i = 0;
+
+#if PL_ENABLED(PL_VARIANT_TYPED_ARRAY_SIMD)
+    if constexpr (std::is_same_v<S, float> && std::is_same_v<T, plInt32>)
+    {
+      for (; i + 4 <= uiCount; i += 4)
+      {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pTarget + i), _mm_cvttps_epi32(_mm_loadu_ps(pSource + i)));
+      }
+    }
+    else if constexpr (std::is_same_v<S, plInt32> && std::is_same_v<T, float>)
+    {
+      for (; i + 4 <= uiCount; i += 4)
+      {
+        _mm_storeu_ps(pTarget + i, _mm_cvtepi32_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pSource + i))));
+      }
+    }
+    else if constexpr (std::is_same_v<S, float> && std::is_same_v<T, double>)
+    {
+      for (; i + 4 <= uiCount; i += 4)
+      {
+        const __m128 v = _mm_loadu_ps(pSource + i);
+        _mm_storeu_pd(pTarget + i, _mm_cvtps_pd(v));
+        _mm_storeu_pd(pTarget + i + 2, _mm_cvtps_pd(_mm_movehl_ps(v, v)));
+      }
+    }
+    else if constexpr (std::is_same_v<S, double> && std::is_same_v<T, float>)
+    {
+      for (; i + 4 <= uiCount; i += 4)
+      {
+        const __m128 lo = _mm_cvtpd_ps(_mm_loadu_pd(pSource + i));
+        const __m128 hi = _mm_cvtpd_ps(_mm_loadu_pd(pSource + i + 2));
+        _mm_storeu_ps(pTarget + i, _mm_movelh_ps(lo, hi));
+      }
+    }
+    else if constexpr (std::is_same_v<S, plInt32> && std::is_same_v<T, double>)
+    {
+      for (; i + 4 <= uiCount; i += 4)
+      {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSource + i));
+        _mm_storeu_pd(pTarget + i, _mm_cvtepi32_pd(v));
+        _mm_storeu_pd(pTarget + i + 2, _mm_cvtepi32_pd(_mm_unpackhi_epi64(v, v)));
+      }
+    }
+    else if constexpr (std::is_same_v<S, double> && std::is_same_v<T, plInt32>)
+    {
+      for (; i + 4 <= uiCount; i += 4)
+      {
+        const __m128i lo = _mm_cvttpd_epi32(_mm_loadu_pd(pSource + i));
+        const __m128i hi = _mm_cvttpd_epi32(_mm_loadu_pd(pSource + i + 2));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pTarget + i), _mm_unpacklo_epi64(lo, hi));
+      }
+    }
+#else
+    PL_IGNORE_UNUSED(pSource);
+    PL_IGNORE_UNUSED(pTarget);
+    PL_IGNORE_UNUSED(uiCount);
+#endif
+
+    return i;
+  }
+
+  template <typename S, typename T>
+  void plVariantTypedArrayConvertScalars(const void* pSource, void* pTarget, plUInt32 uiCount)
+  {
+    const S* pS = static_cast<const S*>(pSource);
+    T* pT = static_cast<T*>(pTarget);
+
+    for (plUInt32 i = plVariantTypedArrayConvertSimd(pS, pT, uiCount); i < uiCount; ++i)
+    {
+      pT[i] = plVariantTypedArrayCast<T>::Cast(pS[i]);
+    }
+  }
+
+  using plVariantTypedArrayConvertFunc = void (*)(const void* pSource, void* pTarget, plUInt32 uiCount);
+
+  /// \brief Returns the function that converts scalars of sourceType to targetType, or nullptr if either type isn't a number.
+  plVariantTypedArrayConvertFunc plVariantTypedArrayGetConvertFunc(plVariantType::Enum sourceType, plVariantType::Enum targetType)
+  {
+    plVariantTypedArrayConvertFunc func = nullptr;
+
+    plVariantTypedArrayDispatchScalar(sourceType, [&](auto pS)
+      {
+        using S = std::remove_pointer_t<decltype(pS)>;
+
+        plVariantTypedArrayDispatchScalar(targetType, [&](auto pT)
+          {
+            using T = std::remove_pointer_t<decltype(pT)>;
+            func = &plVariantTypedArrayConvertScalars<S, T>;
+          });
+      });
+
+    return func;
+  }
+} // namespace
+
+plVariantTypedArray::plVariantTypedArray(plVariantType::Enum elementType, plUInt32 uiCount)
+{
+  PL_ASSERT_DEV(IsElementTypeSupported(elementType), "'{}' is not supported as an element type", (plUInt32)elementType);
+
+  m_ElementType = elementType;
+  m_Data.SetCount(uiCount * GetElementSize(elementType));
+}
+
+bool plVariantTypedArray::IsElementTypeSupported(plVariantType::Enum type)
+{
+  return GetElementSize(type) != 0;
+}
+
+plUInt32 plVariantTypedArray::GetElementSize(plVariantType::Enum type)
+{
+  plUInt32 uiSize = 0;
+  plVariantTypedArrayDispatchElement(type, [&](auto p)
+    { uiSize = sizeof(*p); });
+  return uiSize;
+}
+
+plUInt32 plVariantTypedArray::GetElementComponentCount(plVariantType::Enum type)
+{
+  const plUInt32 uiComponentSize = GetElementSize(plVariantTypedArrayGetComponentType(type));
+  return uiComponentSize != 0 ? GetElementSize(type) / uiComponentSize : 0;
+}
+
+bool plVariantTypedArray::CanConvertElements(plVariantType::Enum sourceType, plVariantType::Enum targetType)
+{
+  if (!IsElementTypeSupported(sourceType) || !IsElementTypeSupported(targetType))
+    return false;
+
+  if (sourceType == targetType)
+    return true;
+
+  // numbers can be converted into any other number, vectors only into vectors of the same size
+  const bool bSourceIsVector = plVariantTypedArrayGetComponentType(sourceType) != sourceType;
+  const bool bTargetIsVector = plVariantTypedArrayGetComponentType(targetType) != targetType;
+
+  return bSourceIsVector == bTargetIsVector && GetElementComponentCount(sourceType) == GetElementComponentCount(targetType);
+}
+
+plResult plVariantTypedArray::ConvertElements(plVariantType::Enum sourceType, const void* pSource, plVariantType::Enum targetType, void* pTarget, plUInt32 uiCount)
+{
+  if (!CanConvertElements(sourceType, targetType))
+    return PL_FAILURE;
+
+  if (sourceType == targetType)
+  {
+    plMemoryUtils::CopyOverlapped(static_cast<plUInt8*>(pTarget), static_cast<const plUInt8*>(pSource), static_cast<size_t>(uiCount) * GetElementSize(sourceType));
+    return PL_SUCCESS;
+  }
+
+  // vectors are converted component-wise, so they are treated as arrays of numbers
+  auto func = plVariantTypedArrayGetConvertFunc(plVariantTypedArrayGetComponentType(sourceType), plVariantTypedArrayGetComponentType(targetType));
+  func(pSource, pTarget, uiCount * GetElementComponentCount(sourceType));
+  return PL_SUCCESS;
+}
+
+plResult plVariantTypedArray::ConvertVariants(plArrayPtr<const plVariant> source, plVariantType::Enum targetType, void* pTarget)
+{
+  const plUInt32 uiElementSize = GetElementSize(targetType);
+  if (uiElementSize == 0)
+    return PL_FAILURE;
+
+  const plVariantType::Enum targetComponentType = plVariantTypedArrayGetComponentType(targetType);
+  const plUInt32 uiNumComponents = GetElementComponentCount(targetType);
+
+  // the conversion function is only looked up again when the type of the variants changes
+  plVariantType::Enum lastType = plVariantType::Invalid;
+  plVariantTypedArrayConvertFunc func = nullptr;
+
+  plUInt8* pTargetBytes = static_cast<plUInt8*>(pTarget);
+
+  for (const plVariant& value : source)
+  {
+    const plVariantType::Enum type = value.GetType();
+
+    if (type == targetType)
+    {
+      plMemoryUtils::RawByteCopy(pTargetBytes, value.GetData(), uiElementSize);
+    }
+    else
+    {
+      if (type != lastType)
+      {
+        lastType = type;
+        func = CanConvertElements(type, targetType) ? plVariantTypedArrayGetConvertFunc(plVariantTypedArrayGetComponentType(type), targetComponentType) : nullptr;
+      }
+
+      if (func != nullptr)
+      {
+        func(value.GetData(), pTargetBytes, uiNumComponents);
+      }
+      else
+      {
+        plResult conversionStatus = PL_FAILURE;
+        const plVariant converted = value.ConvertTo(targetType, &conversionStatus);
+        PL_SUCCEED_OR_RETURN(conversionStatus);
+
+        plMemoryUtils::RawByteCopy(pTargetBytes, converted.GetData(), uiElementSize);
+      }
+    }
+
+    pTargetBytes += uiElementSize;
+  }
+
+  return PL_SUCCESS;
+}
+
+plUInt32 plVariantTypedArray::GetCount() const
+{
+  const plUInt32 uiElementSize = GetElementSize(m_ElementType);
+  return uiElementSize != 0 ? m_Data.GetCount() / uiElementSize : 0;
+}
+
+void plVariantTypedArray::SetCount(plUInt32 uiCount)
+{
+  PL_ASSERT_DEV(IsElementTypeSupported(m_ElementType), "The element type needs to be set before the array can be resized");
+  m_Data.SetCount(uiCount * GetElementSize(m_ElementType));
+}
+
+void plVariantTypedArray::Clear(plVariantType::Enum elementType)
+{
+  PL_ASSERT_DEV(elementType == plVariantType::Invalid || IsElementTypeSupported(elementType), "'{}' is not supported as an element type", (plUInt32)elementType);
+
+  m_ElementType = elementType;
+  m_Data.Clear();
+}
+
+plVariant plVariantTypedArray::GetValue(plUInt32 uiIndex) const
+{
+  PL_ASSERT_DEV(uiIndex < GetCount(), "Index {} is out of range, the array has {} elements", uiIndex, GetCount());
+
+  plVariant result;
+  plVariantTypedArrayDispatchElement(m_ElementType, [&](auto p)
+    {
+      using T = std::remove_pointer_t<decltype(p)>;
+      result = reinterpret_cast<const T*>(m_Data.GetData())[uiIndex];
+    });
+  return result;
+}
+
+plResult plVariantTypedArray::SetValue(plUInt32 uiIndex, const plVariant& value)
+{
+  PL_ASSERT_DEV(uiIndex < GetCount(), "Index {} is out of range, the array has {} elements", uiIndex, GetCount());
+
+  const plUInt32 uiElementSize = GetElementSize(m_ElementType);
+  return ConvertVariants(plMakeArrayPtr(&value, 1), m_ElementType, m_Data.GetData() + uiIndex * uiElementSize);
+}
+
+plResult plVariantTypedArray::ConvertTo(plVariantType::Enum targetType, plVariantTypedArray& out_result) const
+{
+  PL_ASSERT_DEV(&out_result != this, "The result can't be stored in the source array");
+
+  if (!CanConvertElements(m_ElementType, targetType))
+    return PL_FAILURE;
+
+  const plUInt32 uiCount = GetCount();
+  out_result.m_ElementType = targetType;
+  out_result.m_Data.SetCountUninitialized(uiCount * GetElementSize(targetType));
+
+  return ConvertElements(m_ElementType, m_Data.GetData(), targetType, out_result.m_Data.GetData(), uiCount);
+}
+
+plResult plVariantTypedArray::SetFromVariantArray(plArrayPtr<const plVariant> source, plVariantType::Enum elementType)
+{
+  if (!IsElementTypeSupported(elementType))
+    return PL_FAILURE;
+
+  m_ElementType = elementType;
+  m_Data.SetCountUninitialized(source.GetCount() * GetElementSize(elementType));
+
+  if (ConvertVariants(source, elementType, m_Data.GetData()).Failed())
+  {
+    m_Data.Clear();
+    return PL_FAILURE;
+  }
+
+  return PL_SUCCESS;
+}
+
+void plVariantTypedArray::ToVariantArray(plVariantArray& out_result) const
+{
+  const plUInt32 uiCount = GetCount();
+  out_result.Clear();
+  out_result.SetCount(uiCount);
+
+  plVariantTypedArrayDispatchElement(m_ElementType, [&](auto p)
+    {
+      using T = std::remove_pointer_t<decltype(p)>;
+      const T* pValues = reinterpret_cast<const T*>(m_Data.GetData());
+
+      for (plUInt32 i = 0; i < uiCount; ++i)
+      {
+        out_result[i] = pValues[i];
+      }
+    });
+}
+
+void plVariantTypedArray::GetComponent(plUInt32 uiComponent, plArrayPtr<double> out_values) const
+{
+  const plUInt32 uiNumComponents = GetElementComponentCount(m_ElementType);
+  PL_ASSERT_DEV(uiComponent < uiNumComponents, "uiComponent out of range");
+  PL_ASSERT_DEV(out_values.GetCount() == GetCount(), "out_values needs to have {} elements", GetCount());
+
+  plVariantTypedArrayDispatchScalar(plVariantTypedArrayGetComponentType(m_ElementType), [&](auto p)
+    {
+      using T = std::remove_pointer_t<decltype(p)>;
+      const T* pComponents = reinterpret_cast<const T*>(m_Data.GetData()) + uiComponent;
+
+      for (plUInt32 i = 0; i < out_values.GetCount(); ++i)
+      {
+        out_values[i] = static_cast<double>(pComponents[i * uiNumComponents]);
+      }
+    });
+}
+
+void plVariantTypedArray::SetComponent(plUInt32 uiComponent, plArrayPtr<const double> values)
+{
+  const plUInt32 uiNumComponents = GetElementComponentCount(m_ElementType);
+  PL_ASSERT_DEV(uiComponent < uiNumComponents, "uiComponent out of range");
+  PL_ASSERT_DEV(values.GetCount() == GetCount(), "values needs to have {} elements", GetCount());
+
+  plVariantTypedArrayDispatchScalar(plVariantTypedArrayGetComponentType(m_ElementType), [&](auto p)
+    {
+      using T = std::remove_pointer_t<decltype(p)>;
+      T* pComponents = reinterpret_cast<T*>(m_Data.GetData()) + uiComponent;
+
+      for (plUInt32 i = 0; i < values.GetCount(); ++i)
+      {
+        pComponents[i * uiNumComponents] = static_cast<T>(values[i]);
+      }
+    });
+}
+
+bool plVariantTypedArray::operator==(const plVariantTypedArray& rhs) const
+{
+  return m_ElementType == rhs.m_ElementType && m_Data == rhs.m_Data;
+}
+
+PL_STATICLINK_FILE(Foundation, Foundation_Types_Implementation_VariantTypedArray);
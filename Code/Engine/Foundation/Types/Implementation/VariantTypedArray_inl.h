@@ -0,0 +1,32 @@
+
+template <typename T>
+plVariantTypedArray::plVariantTypedArray(plArrayPtr<const T> values)
+{
+  static_assert(plVariantTypeDeduction<T>::value != plVariantType::Invalid, "T is not a valid variant type");
+  PL_ASSERT_DEV(IsElementTypeSupported(plVariantTypeDeduction<T>::value), "'{}' is not supported as an element type", (plUInt32)plVariantTypeDeduction<T>::value);
+
+  m_ElementType = plVariantTypeDeduction<T>::value;
+  m_Data.SetCountUninitialized(values.GetCount() * sizeof(T));
+  plMemoryUtils::RawByteCopy(m_Data.GetData(), values.GetPtr(), m_Data.GetCount());
+}
+
+template <typename S, typename T>
+PL_ALWAYS_INLINE plResult plVariantTypedArray::ConvertElements(plArrayPtr<S> source, plArrayPtr<T> target)
+{
+  PL_ASSERT_DEV(source.GetCount() == target.GetCount(), "Source and target need to have the same size");
+  return ConvertElements(plVariantTypeDeduction<std::remove_const_t<S>>::value, source.GetPtr(), plVariantTypeDeduction<T>::value, target.GetPtr(), source.GetCount());
+}
+
+template <typename T>
+plArrayPtr<const T> plVariantTypedArray::GetArray() const
+{
+  PL_ASSERT_DEV(plVariantTypeDeduction<T>::value == m_ElementType, "The array stores elements of type '{}', not '{}'", (plUInt32)m_ElementType.GetValue(), (plUInt32)plVariantTypeDeduction<T>::value);
+  return plArrayPtr<const T>(reinterpret_cast<const T*>(m_Data.GetData()), m_Data.GetCount() / sizeof(T));
+}
+
+template <typename T>
+plArrayPtr<T> plVariantTypedArray::GetArray()
+{
+  PL_ASSERT_DEV(plVariantTypeDeduction<T>::value == m_ElementType, "The array stores elements of type '{}', not '{}'", (plUInt32)m_ElementType.GetValue(), (plUInt32)plVariantTypeDeduction<T>::value);
+  return plArrayPtr<T>(reinterpret_cast<T*>(m_Data.GetData()), m_Data.GetCount() / sizeof(T));
+}
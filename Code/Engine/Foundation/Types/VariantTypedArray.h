@@ -0,0 +1,125 @@
+#pragma once
+
+/// \file
+
+#include <Foundation/Algorithm/HashingUtils.h>
+#include <Foundation/Reflection/Implementation/StaticRTTI.h>
+#include <Foundation/Types/Variant.h>
+
+/// \brief A contiguous array of numbers or vectors that all have the same plVariantType. Can be stored inside an plVariant.
+///
+/// An plVariantArray stores every element as a separate plVariant, so converting or processing large amounts of numeric data pays the
+/// variant overhead for every single value. plVariantTypedArray stores the raw values instead, e.g. a tightly packed array of plVec3.
+/// Supported element types are Bool, all integer types, Float, Double, and all Vector types.
+///
+/// The static ConvertElements() functions convert whole arrays between element types in one go and give the same results as calling
+/// plVariant::ConvertTo() on every element. The common conversions between float, double and 32 bit integers use SSE2, if available.
+struct PL_FOUNDATION_DLL plVariantTypedArray
+{
+  plVariantTypedArray() = default;
+
+  /// \brief Creates an array with uiCount zero-initialized elements of the given type.
+  plVariantTypedArray(plVariantType::Enum elementType, plUInt32 uiCount);
+
+  /// \brief Creates an array with a copy of the given values.
+  template <typename T>
+  explicit plVariantTypedArray(plArrayPtr<const T> values);
+
+  /// \brief Returns whether the given type can be used as the element type.
+  static bool IsElementTypeSupported(plVariantType::Enum type);
+
+  /// \brief Returns the size in bytes of a single element of the given type, or 0 if the type is not supported.
+  static plUInt32 GetElementSize(plVariantType::Enum type);
+
+  /// \brief Returns the number of scalar components of the given type, e.g. 3 for Vector3I and 1 for Float.
+  static plUInt32 GetElementComponentCount(plVariantType::Enum type);
+
+  /// \brief Returns whether ConvertElements() can convert from sourceType to targetType.
+  ///
+  /// Numbers can be converted into each other and vectors can be converted into vectors with the same number of components,
+  /// just like plVariant::CanConvertTo() allows.
+  static bool CanConvertElements(plVariantType::Enum sourceType, plVariantType::Enum targetType);
+
+  /// \brief Converts uiCount elements of type sourceType to targetType. pSource and pTarget must not overlap, unless the types are equal.
+  static plResult ConvertElements(plVariantType::Enum sourceType, const void* pSource, plVariantType::Enum targetType, void* pTarget, plUInt32 uiCount);
+
+  /// \brief Typed version of ConvertElements(). Both arrays must have the same size.
+  template <typename S, typename T>
+  static plResult ConvertElements(plArrayPtr<S> source, plArrayPtr<T> target);
+
+  /// \brief Converts all variants to targetType and writes the results into pTarget, which must have room for source.GetCount() elements.
+  ///
+  /// Variants that already have the target type are copied directly, numbers and vectors are converted without going through plVariant.
+  /// Everything else, e.g. strings, falls back to plVariant::ConvertTo(). Fails if any variant can't be converted.
+  static plResult ConvertVariants(plArrayPtr<const plVariant> source, plVariantType::Enum targetType, void* pTarget);
+
+  /// \brief Returns the type of the elements.
+  plVariantType::Enum GetElementType() const { return m_ElementType; }
+
+  /// \brief Returns the number of elements.
+  plUInt32 GetCount() const;
+
+  bool IsEmpty() const { return m_Data.IsEmpty(); }
+
+  /// \brief Resizes the array. New elements are zero-initialized.
+  void SetCount(plUInt32 uiCount);
+
+  /// \brief Removes all elements and changes the element type.
+  void Clear(plVariantType::Enum elementType = plVariantType::Invalid);
+
+  /// \brief Returns the elements. T must match the element type.
+  template <typename T>
+  plArrayPtr<const T> GetArray() const;
+
+  /// \copydoc GetArray()
+  template <typename T>
+  plArrayPtr<T> GetArray();
+
+  /// \brief Returns the raw bytes of all elements.
+  plArrayPtr<const plUInt8> GetByteArray() const { return m_Data; }
+
+  /// \brief Returns a single element as a variant.
+  plVariant GetValue(plUInt32 uiIndex) const;
+
+  /// \brief Converts the value to the element type and stores it at the given index.
+  plResult SetValue(plUInt32 uiIndex, const plVariant& value);
+
+  /// \brief Converts the array into an array with a different element type.
+  plResult ConvertTo(plVariantType::Enum targetType, plVariantTypedArray& out_result) const;
+
+  /// \brief Replaces the content with the values in source, converted to elementType.
+  plResult SetFromVariantArray(plArrayPtr<const plVariant> source, plVariantType::Enum elementType);
+
+  /// \brief Writes every element as a separate variant into out_result.
+  void ToVariantArray(plVariantArray& out_result) const;
+
+  /// \brief Writes the given component of every vector element into out_values, which must have GetCount() elements.
+  ///
+  /// This is the bulk version of plReflectionUtils::GetComponent().
+  void GetComponent(plUInt32 uiComponent, plArrayPtr<double> out_values) const;
+
+  /// \brief Sets the given component of every vector element. This is the bulk version of plReflectionUtils::SetComponent().
+  void SetComponent(plUInt32 uiComponent, plArrayPtr<const double> values);
+
+  bool operator==(const plVariantTypedArray& rhs) const;
+  bool operator!=(const plVariantTypedArray& rhs) const { return !(*this == rhs); }
+
+  plEnum<plVariantType> m_ElementType;
+  plDataBuffer m_Data;
+};
+
+PL_DECLARE_REFLECTABLE_TYPE(PL_FOUNDATION_DLL, plVariantTypedArray);
+PL_DECLARE_CUSTOM_VARIANT_TYPE(plVariantTypedArray);
+
+template <>
+struct plHashHelper<plVariantTypedArray>
+{
+  PL_ALWAYS_INLINE static plUInt32 Hash(const plVariantTypedArray& value)
+  {
+    return plHashingUtils::xxHash32(value.m_Data.GetData(), value.m_Data.GetCount(), value.GetElementType());
+  }
+
+  PL_ALWAYS_INLINE static bool Equal(const plVariantTypedArray& a, const plVariantTypedArray& b) { return a == b; }
+};
+
+#include <Foundation/Types/Implementation/VariantTypedArray_inl.h>
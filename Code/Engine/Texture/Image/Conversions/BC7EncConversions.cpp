@@ -2,9 +2,9 @@
 
 #if PL_USE_BC7ENC
 
-#  include <bc7enc_rdo/rdo_bc_encoder.h>
+#  include <bc7enc_rdo/bc7enc.h>
 
-#  include <Foundation/System/SystemInformation.h>
+#  include <Foundation/Threading/TaskSystem.h>
 #  include <Texture/Image/ImageConversion.h>
 
 plImageConversionEntry g_BC7EncConversions[] = {
@@ -24,54 +24,55 @@ public:
   }
 
   virtual plResult CompressBlocks(plConstByteBlobPtr source, plByteBlobPtr target, plUInt32 numBlocksX, plUInt32 numBlocksY,
-    plImageFormat::Enum sourceFormat, plImageFormat::Enum targetFormat) const override
+    plImageFormat::Enum sourceFormat, plImageFormat::Enum targetFormat, const plImageConversionSettings& settings) const override
   {
-    plSystemInformation info = plSystemInformation::Get();
-    const plInt32 iCpuCores = info.GetCPUCoreCount();
+    PL_IGNORE_UNUSED(sourceFormat);
+    PL_IGNORE_UNUSED(targetFormat);
+    PL_IGNORE_UNUSED(settings);
 
-    rdo_bc::rdo_bc_params rp;
-    rp.m_rdo_max_threads = plMath::Clamp<plInt32>(iCpuCores - 2, 2, 8);
-    rp.m_status_output = false;
-    rp.m_bc1_quality_level = 18;
-
-    switch (targetFormat)
-    {
-      case plImageFormat::BC7_UNORM:
-      case plImageFormat::BC7_UNORM_SRGB:
-        rp.m_dxgi_format = DXGI_FORMAT_BC7_UNORM;
-        break;
-      case plImageFormat::BC1_UNORM:
-      case plImageFormat::BC1_UNORM_SRGB:
-        rp.m_dxgi_format = DXGI_FORMAT_BC1_UNORM;
-        break;
-      default:
-        PL_ASSERT_NOT_IMPLEMENTED;
-    }
-
-    utils::image_u8 source_image(numBlocksX * 4, numBlocksY * 4);
-    auto& pixels = source_image.get_pixels();
-    plMemoryUtils::Copy<plUInt32>(reinterpret_cast<plUInt32*>(pixels.data()), reinterpret_cast<const plUInt32*>(source.GetPtr()), numBlocksX * 4 * numBlocksY * 4);
-
-    rdo_bc::rdo_bc_encoder encoder;
-    if (!encoder.init(source_image, rp))
+    // The blocks are encoded directly instead of through rdo_bc_encoder. Without RDO, the encoder compresses every block independently
+    // anyway, but it rebuilds the global lookup tables on every call and runs its own OpenMP threads, which oversubscribes the CPU
+    // when many images are converted at the same time (see plTexConvBatch). This way the work runs as tasks on the shared worker threads.
+    static const bc7enc_compress_block_params s_Params = []()
     {
-      plLog::Error("rdo_bc_encoder::init() failed!");
-      return PL_FAILURE;
-    }
+      bc7enc_compress_block_init();
 
-    if (!encoder.encode())
-    {
-      plLog::Error("rdo_bc_encoder::encode() failed!");
-      return PL_FAILURE;
-    }
+      // same settings as the defaults of rdo_bc_params
+      bc7enc_compress_block_params params;
+      bc7enc_compress_block_params_init(&params);
+      bc7enc_compress_block_params_init_linear_weights(&params);
+      params.m_max_partitions = BC7ENC_MAX_PARTITIONS;
+      params.m_uber_level = plMath::Min<plUInt32>(BC7ENC_MAX_UBER_LEVEL, 6);
+      return params;
+    }();
+
+    const plUInt32* pSource = reinterpret_cast<const plUInt32*>(source.GetPtr());
+    plUInt8* pTarget = target.GetPtr();
+    const bc7enc_compress_block_params* pParams = &s_Params;
+
+    plTaskSystem::ParallelForIndexed(
+      0, numBlocksY, [pSource, pTarget, pParams, numBlocksX](plUInt32 uiStartIndex, plUInt32 uiEndIndex)
+      {
+        const plUInt32 uiRowPitch = numBlocksX * 4;
+
+        plUInt32 blockPixels[16];
+
+        for (plUInt32 blockY = uiStartIndex; blockY < uiEndIndex; ++blockY)
+        {
+          for (plUInt32 blockX = 0; blockX < numBlocksX; ++blockX)
+          {
+            const plUInt32* pBlockSource = pSource + blockY * 4 * uiRowPitch + blockX * 4;
+            for (plUInt32 y = 0; y < 4; ++y)
+            {
+              plMemoryUtils::Copy(blockPixels + y * 4, pBlockSource + y * uiRowPitch, 4);
+            }
+
+            bc7enc_compress_block(pTarget + (blockY * numBlocksX + blockX) * 16, blockPixels, pParams);
+          }
+        }
+      },
+      "BC7Enc_Compress");
 
-    const plUInt32 uiTotalBytes = encoder.get_total_blocks_size_in_bytes();
-    if (uiTotalBytes != target.GetCount())
-    {
-      plLog::Error("Encoder output of {} byte does not match the expected size of {} bytes", uiTotalBytes, target.GetCount());
-      return PL_FAILURE;
-    }
-    plMemoryUtils::Copy<plUInt8>(reinterpret_cast<plUInt8*>(target.GetPtr()), reinterpret_cast<const plUInt8*>(encoder.get_blocks()), uiTotalBytes);
     return PL_SUCCESS;
   }
 };
@@ -0,0 +1,1549 @@
+#include <Texture/TexturePCH.h>
+
+#include <Foundation/SimdMath/SimdVec4i.h>
+#include <Foundation/Threading/TaskSystem.h>
+#include <Texture/Image/Conversions/BCnConversions.h>
+#include <Texture/Image/Conversions/DXTConversions.h>
+#include <Texture/Image/ImageConversion.h>
+
+#if PL_SSE_LEVEL >= PL_SSE_41 && PL_SIMD_IMPLEMENTATION == PL_SIMD_IMPLEMENTATION_SSE
+#  define PL_SUPPORTS_BC4_COMPRESSOR_SSE
+
+#  include <emmintrin.h>
+#  include <smmintrin.h>
+#  include <tmmintrin.h>
+#endif
+
+namespace
+{
+  //////////////////////////////////////////////////////////////////////////
+  // BC1 color blocks
+  //////////////////////////////////////////////////////////////////////////
+
+  // Same expansion as plDecompressB5G6R5()
+  PL_ALWAYS_INLINE plInt32 expand5(plInt32 iValue)
+  {
+    return (iValue * 527 + 23) >> 6;
+  }
+
+  PL_ALWAYS_INLINE plInt32 expand6(plInt32 iValue)
+  {
+    return (iValue * 259 + 33) >> 6;
+  }
+
+  PL_ALWAYS_INLINE plUInt16 pack565(plInt32 r, plInt32 g, plInt32 b)
+  {
+    return static_cast<plUInt16>((r << 11) | (g << 5) | b);
+  }
+
+  PL_ALWAYS_INLINE void unpack565(plUInt16 uiColor, plInt32* pRgb)
+  {
+    pRgb[0] = expand5(uiColor >> 11);
+    pRgb[1] = expand6((uiColor >> 5) & 0x3F);
+    pRgb[2] = expand5(uiColor & 0x1F);
+  }
+
+  plUInt16 quantize565(const plVec3& vColor)
+  {
+    const plInt32 r = static_cast<plInt32>(plMath::Clamp(vColor.x, 0.0f, 255.0f) * (31.0f / 255.0f) + 0.5f);
+    const plInt32 g = static_cast<plInt32>(plMath::Clamp(vColor.y, 0.0f, 255.0f) * (63.0f / 255.0f) + 0.5f);
+    const plInt32 b = static_cast<plInt32>(plMath::Clamp(vColor.z, 0.0f, 255.0f) * (31.0f / 255.0f) + 0.5f);
+    return pack565(r, g, b);
+  }
+
+  /// For every 8 bit value, the pair of 5 / 6 bit endpoints whose 2/3 interpolant reproduces the value best.
+  /// Used to encode blocks of a single color, where this is much more precise than quantizing the color directly.
+  struct SolidColorTables
+  {
+    SolidColorTables()
+    {
+      build(m_Match5, 32, expand5);
+      build(m_Match6, 64, expand6);
+    }
+
+    static void build(plUInt8 (*pTable)[2], plInt32 iNumValues, plInt32 (*expand)(plInt32))
+    {
+      for (plInt32 value = 0; value < 256; ++value)
+      {
+        plInt32 iBestError = plMath::MaxValue<plInt32>();
+
+        for (plInt32 e0 = 0; e0 < iNumValues; ++e0)
+        {
+          for (plInt32 e1 = 0; e1 < iNumValues; ++e1)
+          {
+            const plInt32 iError = plMath::Abs((2 * expand(e0) + expand(e1) + 1) / 3 - value);
+
+            if (iError < iBestError)
+            {
+              iBestError = iError;
+              pTable[value][0] = static_cast<plUInt8>(e0);
+              pTable[value][1] = static_cast<plUInt8>(e1);
+            }
+          }
+        }
+      }
+    }
+
+    plUInt8 m_Match5[256][2];
+    plUInt8 m_Match6[256][2];
+  };
+
+  const SolidColorTables& getSolidColorTables()
+  {
+    static SolidColorTables s_Tables;
+    return s_Tables;
+  }
+
+  struct ColorBlock
+  {
+    plInt32 m_Colors[16][3];
+    plUInt32 m_uiTransparentMask = 0;
+
+    // The colors of the opaque pixels, these are the ones the endpoints are fitted to.
+    plVec3 m_Points[16];
+    plUInt32 m_uiNumPoints = 0;
+  };
+
+  void initColorBlock(const plColorBaseUB* pPixels, bool bAllowTransparency, ColorBlock& out_block)
+  {
+    for (plUInt32 i = 0; i < 16; ++i)
+    {
+      out_block.m_Colors[i][0] = pPixels[i].r;
+      out_block.m_Colors[i][1] = pPixels[i].g;
+      out_block.m_Colors[i][2] = pPixels[i].b;
+
+      if (bAllowTransparency && pPixels[i].a < 128)
+      {
+        out_block.m_uiTransparentMask |= 1u << i;
+      }
+      else
+      {
+        out_block.m_Points[out_block.m_uiNumPoints++].Set(pPixels[i].r, pPixels[i].g, pPixels[i].b);
+      }
+    }
+  }
+
+  bool isSolidColor(const plColorBaseUB* pPixels)
+  {
+    for (plUInt32 i = 1; i < 16; ++i)
+    {
+      if (pPixels[i].r != pPixels[0].r || pPixels[i].g != pPixels[0].g || pPixels[i].b != pPixels[0].b)
+        return false;
+    }
+
+    return true;
+  }
+
+  bool hasTransparentPixels(const plColorBaseUB* pPixels)
+  {
+    for (plUInt32 i = 0; i < 16; ++i)
+    {
+      if (pPixels[i].a < 128)
+        return true;
+    }
+
+    return false;
+  }
+
+  struct BC1Candidate
+  {
+    plUInt16 m_uiColor0 = 0;
+    plUInt16 m_uiColor1 = 0;
+    plUInt32 m_uiIndices = 0;
+    plUInt32 m_uiError = plMath::MaxValue<plUInt32>();
+  };
+
+  /// Picks the closest palette entry for every pixel and returns the sum of the squared errors.
+  /// The palette is built exactly like plDecompressBlockBC1() does it, so the error is the true error of the encoded block.
+  plUInt32 computeIndicesBC1(const ColorBlock& block, plUInt16 uiColor0, plUInt16 uiColor1, bool bForceFourColorMode, plUInt32& out_uiIndices)
+  {
+    const bool bFourColors = uiColor0 > uiColor1 || bForceFourColorMode;
+
+    // transparent pixels need the three color mode
+    if (bFourColors && block.m_uiTransparentMask != 0)
+      return plMath::MaxValue<plUInt32>();
+
+    plInt32 palette[4][3];
+    unpack565(uiColor0, palette[0]);
+    unpack565(uiColor1, palette[1]);
+
+    for (plUInt32 c = 0; c < 3; ++c)
+    {
+      if (bFourColors)
+      {
+        palette[2][c] = (2 * palette[0][c] + palette[1][c] + 1) / 3;
+        palette[3][c] = (palette[0][c] + 2 * palette[1][c] + 1) / 3;
+      }
+      else
+      {
+        palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+      }
+    }
+
+    const plUInt32 uiNumColors = bFourColors ? 4 : 3;
+
+    plUInt32 uiError = 0;
+    out_uiIndices = 0;
+
+    for (plUInt32 i = 0; i < 16; ++i)
+    {
+      if (block.m_uiTransparentMask & (1u << i))
+      {
+        out_uiIndices |= 3u << (2 * i);
+        continue;
+      }
+
+      plUInt32 uiBestError = plMath::MaxValue<plUInt32>();
+      plUInt32 uiBestIndex = 0;
+
+      for (plUInt32 k = 0; k < uiNumColors; ++k)
+      {
+        const plInt32 dr = block.m_Colors[i][0] - palette[k][0];
+        const plInt32 dg = block.m_Colors[i][1] - palette[k][1];
+        const plInt32 db = block.m_Colors[i][2] - palette[k][2];
+        const plUInt32 uiDist = static_cast<plUInt32>(dr * dr + dg * dg + db * db);
+
+        if (uiDist < uiBestError)
+        {
+          uiBestError = uiDist;
+          uiBestIndex = k;
+        }
+      }
+
+      uiError += uiBestError;
+      out_uiIndices |= uiBestIndex << (2 * i);
+    }
+
+    return uiError;
+  }
+
+  bool tryEndpointsBC1(const ColorBlock& block, plUInt16 uiColor0, plUInt16 uiColor1, bool bForceFourColorMode, BC1Candidate& ref_best)
+  {
+    plUInt32 uiIndices = 0;
+    const plUInt32 uiError = computeIndicesBC1(block, uiColor0, uiColor1, bForceFourColorMode, uiIndices);
+
+    if (uiError >= ref_best.m_uiError)
+      return false;
+
+    ref_best.m_uiColor0 = uiColor0;
+    ref_best.m_uiColor1 = uiColor1;
+    ref_best.m_uiIndices = uiIndices;
+    ref_best.m_uiError = uiError;
+    return true;
+  }
+
+  /// The order of the endpoints selects the palette mode, so swap them as needed for the requested mode.
+  void tryEndpointsBC1(const ColorBlock& block, plUInt16 uiColor0, plUInt16 uiColor1, bool bFourColors, bool bForceFourColorMode, BC1Candidate& ref_best)
+  {
+    if (bFourColors ? (uiColor0 < uiColor1) : (uiColor0 > uiColor1))
+    {
+      plMath::Swap(uiColor0, uiColor1);
+    }
+
+    tryEndpointsBC1(block, uiColor0, uiColor1, bForceFourColorMode, ref_best);
+  }
+
+  plVec3 computeMean(const ColorBlock& block)
+  {
+    plVec3 vSum = plVec3::MakeZero();
+    for (plUInt32 i = 0; i < block.m_uiNumPoints; ++i)
+    {
+      vSum += block.m_Points[i];
+    }
+
+    return vSum / static_cast<float>(block.m_uiNumPoints);
+  }
+
+  /// Returns the normalized direction of the largest variance, or zero if all points are identical.
+  plVec3 computePrincipalAxis(const ColorBlock& block, const plVec3& vMean)
+  {
+    float xx = 0, xy = 0, xz = 0, yy = 0, yz = 0, zz = 0;
+
+    for (plUInt32 i = 0; i < block.m_uiNumPoints; ++i)
+    {
+      const plVec3 d = block.m_Points[i] - vMean;
+      xx += d.x * d.x;
+      xy += d.x * d.y;
+      xz += d.x * d.z;
+      yy += d.y * d.y;
+      yz += d.y * d.z;
+      zz += d.z * d.z;
+    }
+
+    const plVec3 rows[3] = {plVec3(xx, xy, xz), plVec3(xy, yy, yz), plVec3(xz, yz, zz)};
+
+    // power iteration, starting with the row of the largest diagonal element
+    plVec3 v = rows[0];
+    if (yy > xx && yy >= zz)
+      v = rows[1];
+    else if (zz > xx && zz > yy)
+      v = rows[2];
+
+    for (plUInt32 iteration = 0; iteration < 8; ++iteration)
+    {
+      v.Set(rows[0].Dot(v), rows[1].Dot(v), rows[2].Dot(v));
+
+      const float fMax = plMath::Max(plMath::Abs(v.x), plMath::Abs(v.y), plMath::Abs(v.z));
+      if (fMax <= 0.0f)
+        return plVec3::MakeZero();
+
+      v *= 1.0f / fMax;
+    }
+
+    v.Normalize();
+    return v;
+  }
+
+  void rangeFitBC1(const ColorBlock& block, const plVec3& vMean, const plVec3& vAxis, bool bFourColors, bool bForceFourColorMode, BC1Candidate& ref_best)
+  {
+    float fMin = plMath::MaxValue<float>();
+    float fMax = -plMath::MaxValue<float>();
+
+    for (plUInt32 i = 0; i < block.m_uiNumPoints; ++i)
+    {
+      const float t = (block.m_Points[i] - vMean).Dot(vAxis);
+      fMin = plMath::Min(fMin, t);
+      fMax = plMath::Max(fMax, t);
+    }
+
+    tryEndpointsBC1(block, quantize565(vMean + vAxis * fMax), quantize565(vMean + vAxis * fMin), bFourColors, bForceFourColorMode, ref_best);
+  }
+
+  /// Sorts the points along the axis and computes the least-squares endpoints for every way to split this ordering into
+  /// three or four consecutive clusters. The endpoints are snapped to the 565 grid before their error is estimated.
+  /// Returns true, if this improved the candidate.
+  bool clusterFitBC1(const ColorBlock& block, const plVec3& vAxis, bool bFourColors, bool bForceFourColorMode, BC1Candidate& ref_best)
+  {
+    const plUInt32 n = block.m_uiNumPoints;
+
+    plUInt8 order[16];
+    float dots[16];
+
+    for (plUInt32 i = 0; i < n; ++i)
+    {
+      const float fDot = block.m_Points[i].Dot(vAxis);
+
+      plUInt32 j = i;
+      for (; j > 0 && dots[j - 1] > fDot; --j)
+      {
+        dots[j] = dots[j - 1];
+        order[j] = order[j - 1];
+      }
+
+      dots[j] = fDot;
+      order[j] = static_cast<plUInt8>(i);
+    }
+
+    plVec3 prefix[17];
+    prefix[0].SetZero();
+    for (plUInt32 i = 0; i < n; ++i)
+    {
+      prefix[i + 1] = prefix[i] + block.m_Points[order[i]];
+    }
+
+    const plVec3 vTotal = prefix[n];
+
+    float fBestError = plMath::MaxValue<float>();
+    plVec3 vBestStart = plVec3::MakeZero();
+    plVec3 vBestEnd = plVec3::MakeZero();
+
+    // alpha is the weight of the first endpoint for each point, beta = 1 - alpha the weight of the second one
+    auto evaluate = [&](float fAlpha2, float fBeta2, float fAlphaBeta, const plVec3& vAlphaX)
+    {
+      const float fDet = fAlpha2 * fBeta2 - fAlphaBeta * fAlphaBeta;
+
+      // all points in one cluster
+      if (fDet < 1e-4f)
+        return;
+
+      const plVec3 vBetaX = vTotal - vAlphaX;
+      const float fFactor = 1.0f / fDet;
+
+      plInt32 qa[3], qb[3];
+      unpack565(quantize565((vAlphaX * fBeta2 - vBetaX * fAlphaBeta) * fFactor), qa);
+      unpack565(quantize565((vBetaX * fAlpha2 - vAlphaX * fAlphaBeta) * fFactor), qb);
+
+      const plVec3 a(static_cast<float>(qa[0]), static_cast<float>(qa[1]), static_cast<float>(qa[2]));
+      const plVec3 b(static_cast<float>(qb[0]), static_cast<float>(qb[1]), static_cast<float>(qb[2]));
+
+      // squared error minus the constant sum of the squared points
+      const float fError = a.Dot(a) * fAlpha2 + b.Dot(b) * fBeta2 + 2.0f * (a.Dot(b) * fAlphaBeta - a.Dot(vAlphaX) - b.Dot(vBetaX));
+
+      if (fError < fBestError)
+      {
+        fBestError = fError;
+        vBestStart = a;
+        vBestEnd = b;
+      }
+    };
+
+    if (bFourColors)
+    {
+      for (plUInt32 i = 0; i <= n; ++i)
+      {
+        for (plUInt32 j = i; j <= n; ++j)
+        {
+          for (plUInt32 k = j; k <= n; ++k)
+          {
+            // [0, i) -> 1, [i, j) -> 2/3, [j, k) -> 1/3, [k, n) -> 0
+            const float c1 = static_cast<float>(j - i);
+            const float c2 = static_cast<float>(k - j);
+
+            const float fAlpha2 = static_cast<float>(i) + c1 * (4.0f / 9.0f) + c2 * (1.0f / 9.0f);
+            const float fBeta2 = static_cast<float>(n - k) + c1 * (1.0f / 9.0f) + c2 * (4.0f / 9.0f);
+            const float fAlphaBeta = (c1 + c2) * (2.0f / 9.0f);
+            const plVec3 vAlphaX = prefix[i] + (prefix[j] - prefix[i]) * (2.0f / 3.0f) + (prefix[k] - prefix[j]) * (1.0f / 3.0f);
+
+            evaluate(fAlpha2, fBeta2, fAlphaBeta, vAlphaX);
+          }
+        }
+      }
+    }
+    else
+    {
+      for (plUInt32 i = 0; i <= n; ++i)
+      {
+        for (plUInt32 j = i; j <= n; ++j)
+        {
+          // [0, i) -> 1, [i, j) -> 1/2, [j, n) -> 0
+          const float c1 = static_cast<float>(j - i);
+
+          const float fAlpha2 = static_cast<float>(i) + c1 * 0.25f;
+          const float fBeta2 = static_cast<float>(n - j) + c1 * 0.25f;
+          const float fAlphaBeta = c1 * 0.25f;
+          const plVec3 vAlphaX = prefix[i] + (prefix[j] - prefix[i]) * 0.5f;
+
+          evaluate(fAlpha2, fBeta2, fAlphaBeta, vAlphaX);
+        }
+      }
+    }
+
+    if (fBestError == plMath::MaxValue<float>())
+      return false;
+
+    const plUInt32 uiPrevError = ref_best.m_uiError;
+    tryEndpointsBC1(block, quantize565(vBestStart), quantize565(vBestEnd), bFourColors, bForceFourColorMode, ref_best);
+    return ref_best.m_uiError < uiPrevError;
+  }
+
+  /// Moves each endpoint channel up and down by one step, as long as that reduces the error.
+  void refineEndpointsBC1(const ColorBlock& block, bool bForceFourColorMode, BC1Candidate& ref_best)
+  {
+    static constexpr plUInt32 s_Shifts[3] = {11, 5, 0};
+    static constexpr plInt32 s_MaxValues[3] = {31, 63, 31};
+
+    for (plUInt32 iteration = 0; iteration < 32 && ref_best.m_uiError > 0; ++iteration)
+    {
+      const BC1Candidate start = ref_best;
+
+      for (plUInt32 endpoint = 0; endpoint < 2; ++endpoint)
+      {
+        const plUInt16 uiColor = endpoint == 0 ? start.m_uiColor0 : start.m_uiColor1;
+
+        for (plUInt32 c = 0; c < 3; ++c)
+        {
+          const plInt32 iValue = (uiColor >> s_Shifts[c]) & s_MaxValues[c];
+
+          for (plInt32 iDelta = -1; iDelta <= 1; iDelta += 2)
+          {
+            const plInt32 iNewValue = iValue + iDelta;
+            if (iNewValue < 0 || iNewValue > s_MaxValues[c])
+              continue;
+
+            const plUInt16 uiNewColor = static_cast<plUInt16>((uiColor & ~(s_MaxValues[c] << s_Shifts[c])) | (iNewValue << s_Shifts[c]));
+
+            if (endpoint == 0)
+              tryEndpointsBC1(block, uiNewColor, start.m_uiColor1, bForceFourColorMode, ref_best);
+            else
+              tryEndpointsBC1(block, start.m_uiColor0, uiNewColor, bForceFourColorMode, ref_best);
+          }
+        }
+      }
+
+      if (ref_best.m_uiError == start.m_uiError)
+        break;
+    }
+  }
+
+  void writeBlockBC1(plUInt16 uiColor0, plUInt16 uiColor1, plUInt32 uiIndices, plUInt8* pTarget)
+  {
+    pTarget[0] = static_cast<plUInt8>(uiColor0 & 0xFF);
+    pTarget[1] = static_cast<plUInt8>(uiColor0 >> 8);
+    pTarget[2] = static_cast<plUInt8>(uiColor1 & 0xFF);
+    pTarget[3] = static_cast<plUInt8>(uiColor1 >> 8);
+    pTarget[4] = static_cast<plUInt8>(uiIndices >> 0);
+    pTarget[5] = static_cast<plUInt8>(uiIndices >> 8);
+    pTarget[6] = static_cast<plUInt8>(uiIndices >> 16);
+    pTarget[7] = static_cast<plUInt8>(uiIndices >> 24);
+  }
+
+  /// Encodes a single block. pFourColorFit optionally holds the endpoints of a four color cluster fit that was already computed.
+  void encodeBlockBC1(const plColorBaseUB* pPixels, const ColorBlock& block, plUInt8* pTarget, plBCnEncoderQuality::Enum quality, bool bForceFourColorMode,
+    const plUInt16* pFourColorFit = nullptr)
+  {
+    BC1Candidate best;
+
+    if (block.m_uiNumPoints == 0)
+    {
+      // fully transparent
+      writeBlockBC1(0, 0, 0xFFFFFFFF, pTarget);
+      return;
+    }
+
+    if (block.m_uiTransparentMask == 0 && isSolidColor(pPixels))
+    {
+      const SolidColorTables& tables = getSolidColorTables();
+      const plUInt16 uiColor0 = pack565(tables.m_Match5[pPixels[0].r][0], tables.m_Match6[pPixels[0].g][0], tables.m_Match5[pPixels[0].b][0]);
+      const plUInt16 uiColor1 = pack565(tables.m_Match5[pPixels[0].r][1], tables.m_Match6[pPixels[0].g][1], tables.m_Match5[pPixels[0].b][1]);
+
+      tryEndpointsBC1(block, uiColor0, uiColor1, true, bForceFourColorMode, best);
+      writeBlockBC1(best.m_uiColor0, best.m_uiColor1, best.m_uiIndices, pTarget);
+      return;
+    }
+
+    const bool bTryFourColors = block.m_uiTransparentMask == 0;
+    const bool bTryThreeColors = !bForceFourColorMode;
+
+    const plVec3 vMean = computeMean(block);
+    const plVec3 vAxis = computePrincipalAxis(block, vMean);
+
+    rangeFitBC1(block, vMean, vAxis, bTryFourColors, bForceFourColorMode, best);
+
+    if (quality != plBCnEncoderQuality::RangeFit && !vAxis.IsZero())
+    {
+      if (pFourColorFit != nullptr)
+        tryEndpointsBC1(block, pFourColorFit[0], pFourColorFit[1], true, bForceFourColorMode, best);
+      else if (bTryFourColors)
+        clusterFitBC1(block, vAxis, true, bForceFourColorMode, best);
+
+      if (bTryThreeColors)
+        clusterFitBC1(block, vAxis, false, bForceFourColorMode, best);
+
+      if (quality == plBCnEncoderQuality::Exhaustive)
+      {
+        // iterate the cluster fit along the direction between the current best endpoints
+        for (plUInt32 iteration = 0; iteration < 4 && best.m_uiError > 0; ++iteration)
+        {
+          plInt32 a[3], b[3];
+          unpack565(best.m_uiColor0, a);
+          unpack565(best.m_uiColor1, b);
+
+          plVec3 vNewAxis(static_cast<float>(b[0] - a[0]), static_cast<float>(b[1] - a[1]), static_cast<float>(b[2] - a[2]));
+          if (vNewAxis.NormalizeIfNotZero(plVec3::MakeZero()).Failed())
+            break;
+
+          bool bImproved = false;
+
+          if (bTryFourColors)
+            bImproved |= clusterFitBC1(block, vNewAxis, true, bForceFourColorMode, best);
+
+          if (bTryThreeColors)
+            bImproved |= clusterFitBC1(block, vNewAxis, false, bForceFourColorMode, best);
+
+          if (!bImproved)
+            break;
+        }
+
+        refineEndpointsBC1(block, bForceFourColorMode, best);
+      }
+    }
+
+    writeBlockBC1(best.m_uiColor0, best.m_uiColor1, best.m_uiIndices, pTarget);
+  }
+
+  /// Four color cluster fit of four blocks at once, every SIMD lane processes one block. Only the blocks without transparent pixels
+  /// get a valid result. Same as clusterFitBC1(), but since all blocks have 16 points, the weights of each split are the same for all lanes.
+  void clusterFitFourBlocksBC1(const ColorBlock* pBlocks, const plVec3* pAxes, plUInt16 (*out_pFits)[2])
+  {
+    plSimdVec4f prefix[17][3];
+    {
+      float prefixLanes[17][3][4];
+
+      for (plUInt32 lane = 0; lane < 4; ++lane)
+      {
+        const ColorBlock& block = pBlocks[lane];
+
+        plUInt8 order[16];
+        float dots[16];
+
+        for (plUInt32 i = 0; i < 16; ++i)
+        {
+          const float fDot = (block.m_uiNumPoints == 16 ? block.m_Points[i] : plVec3::MakeZero()).Dot(pAxes[lane]);
+
+          plUInt32 j = i;
+          for (; j > 0 && dots[j - 1] > fDot; --j)
+          {
+            dots[j] = dots[j - 1];
+            order[j] = order[j - 1];
+          }
+
+          dots[j] = fDot;
+          order[j] = static_cast<plUInt8>(i);
+        }
+
+        plVec3 vSum = plVec3::MakeZero();
+        for (plUInt32 i = 0; i <= 16; ++i)
+        {
+          prefixLanes[i][0][lane] = vSum.x;
+          prefixLanes[i][1][lane] = vSum.y;
+          prefixLanes[i][2][lane] = vSum.z;
+
+          if (i < 16)
+          {
+            vSum += block.m_uiNumPoints == 16 ? block.m_Points[order[i]] : plVec3::MakeZero();
+          }
+        }
+      }
+
+      for (plUInt32 i = 0; i <= 16; ++i)
+      {
+        for (plUInt32 c = 0; c < 3; ++c)
+        {
+          prefix[i][c].Load<4>(prefixLanes[i][c]);
+        }
+      }
+    }
+
+    const plSimdVec4f v0(0.0f);
+    const plSimdVec4f v255(255.0f);
+    const plSimdVec4f vHalf(0.5f);
+
+    // 565 quantization and expansion in float, which is exact for this value range
+    const plSimdFloat quantizeScale[3] = {31.0f / 255.0f, 63.0f / 255.0f, 31.0f / 255.0f};
+    const plSimdVec4f expandMul[3] = {plSimdVec4f(527.0f), plSimdVec4f(259.0f), plSimdVec4f(527.0f)};
+    const plSimdVec4f expandAdd[3] = {plSimdVec4f(23.0f), plSimdVec4f(33.0f), plSimdVec4f(23.0f)};
+
+    plSimdVec4f vBestError(plMath::MaxValue<float>());
+    plSimdVec4f vBestStart[3] = {v0, v0, v0};
+    plSimdVec4f vBestEnd[3] = {v0, v0, v0};
+
+    for (plUInt32 i = 0; i <= 16; ++i)
+    {
+      for (plUInt32 j = i; j <= 16; ++j)
+      {
+        for (plUInt32 k = j; k <= 16; ++k)
+        {
+          // [0, i) -> 1, [i, j) -> 2/3, [j, k) -> 1/3, [k, 16) -> 0
+          const float c1 = static_cast<float>(j - i);
+          const float c2 = static_cast<float>(k - j);
+
+          const float fAlpha2 = static_cast<float>(i) + c1 * (4.0f / 9.0f) + c2 * (1.0f / 9.0f);
+          const float fBeta2 = static_cast<float>(16 - k) + c1 * (1.0f / 9.0f) + c2 * (4.0f / 9.0f);
+          const float fAlphaBeta = (c1 + c2) * (2.0f / 9.0f);
+          const float fDet = fAlpha2 * fBeta2 - fAlphaBeta * fAlphaBeta;
+
+          // all points in one cluster
+          if (fDet < 1e-4f)
+            continue;
+
+          const float fFactor = 1.0f / fDet;
+
+          plSimdVec4f vError = v0;
+          plSimdVec4f a[3], b[3];
+
+          for (plUInt32 c = 0; c < 3; ++c)
+          {
+            const plSimdVec4f vAlphaX = prefix[i][c] + (prefix[j][c] - prefix[i][c]) * (2.0f / 3.0f) + (prefix[k][c] - prefix[j][c]) * (1.0f / 3.0f);
+            const plSimdVec4f vBetaX = prefix[16][c] - vAlphaX;
+
+            a[c] = ((vAlphaX * fBeta2 - vBetaX * fAlphaBeta) * fFactor).CompMax(v0).CompMin(v255);
+            b[c] = ((vBetaX * fAlpha2 - vAlphaX * fAlphaBeta) * fFactor).CompMax(v0).CompMin(v255);
+
+            a[c] = plSimdVec4f::MulAdd(plSimdVec4f::MulAdd(a[c], quantizeScale[c], vHalf).Floor(), expandMul[c], expandAdd[c]) * (1.0f / 64.0f);
+            b[c] = plSimdVec4f::MulAdd(plSimdVec4f::MulAdd(b[c], quantizeScale[c], vHalf).Floor(), expandMul[c], expandAdd[c]) * (1.0f / 64.0f);
+            a[c] = a[c].Floor();
+            b[c] = b[c].Floor();
+
+            // squared error minus the constant sum of the squared points
+            vError += a[c].CompMul(a[c] * fAlpha2 + b[c] * (2.0f * fAlphaBeta) - vAlphaX * 2.0f) + b[c].CompMul(b[c] * fBeta2 - vBetaX * 2.0f);
+          }
+
+          const plSimdVec4b bBetter = vError < vBestError;
+          vBestError = plSimdVec4f::Select(bBetter, vError, vBestError);
+
+          for (plUInt32 c = 0; c < 3; ++c)
+          {
+            vBestStart[c] = plSimdVec4f::Select(bBetter, a[c], vBestStart[c]);
+            vBestEnd[c] = plSimdVec4f::Select(bBetter, b[c], vBestEnd[c]);
+          }
+        }
+      }
+    }
+
+    float start[3][4], end[3][4];
+    for (plUInt32 c = 0; c < 3; ++c)
+    {
+      vBestStart[c].Store<4>(start[c]);
+      vBestEnd[c].Store<4>(end[c]);
+    }
+
+    for (plUInt32 lane = 0; lane < 4; ++lane)
+    {
+      out_pFits[lane][0] = quantize565(plVec3(start[0][lane], start[1][lane], start[2][lane]));
+      out_pFits[lane][1] = quantize565(plVec3(end[0][lane], end[1][lane], end[2][lane]));
+    }
+  }
+
+  /// Range fit of four opaque blocks at once, every SIMD lane processes one block.
+  void rangeFitFourBlocksBC1(const plColorBaseUB* const* pBlocks, plUInt8* const* pTargets)
+  {
+    plSimdVec4f r[16], g[16], b[16];
+
+    for (plUInt32 i = 0; i < 16; ++i)
+    {
+      r[i].Set(pBlocks[0][i].r, pBlocks[1][i].r, pBlocks[2][i].r, pBlocks[3][i].r);
+      g[i].Set(pBlocks[0][i].g, pBlocks[1][i].g, pBlocks[2][i].g, pBlocks[3][i].g);
+      b[i].Set(pBlocks[0][i].b, pBlocks[1][i].b, pBlocks[2][i].b, pBlocks[3][i].b);
+    }
+
+    const plSimdVec4f vZero = plSimdVec4f::MakeZero();
+
+    plSimdVec4f meanR = vZero, meanG = vZero, meanB = vZero;
+    for (plUInt32 i = 0; i < 16; ++i)
+    {
+      meanR += r[i];
+      meanG += g[i];
+      meanB += b[i];
+    }
+
+    meanR *= 1.0f / 16.0f;
+    meanG *= 1.0f / 16.0f;
+    meanB *= 1.0f / 16.0f;
+
+    plSimdVec4f xx = vZero, xy = vZero, xz = vZero, yy = vZero, yz = vZero, zz = vZero;
+    for (plUInt32 i = 0; i < 16; ++i)
+    {
+      const plSimdVec4f dr = r[i] - meanR;
+      const plSimdVec4f dg = g[i] - meanG;
+      const plSimdVec4f db = b[i] - meanB;
+
+      xx = plSimdVec4f::MulAdd(dr, dr, xx);
+      xy = plSimdVec4f::MulAdd(dr, dg, xy);
+      xz = plSimdVec4f::MulAdd(dr, db, xz);
+      yy = plSimdVec4f::MulAdd(dg, dg, yy);
+      yz = plSimdVec4f::MulAdd(dg, db, yz);
+      zz = plSimdVec4f::MulAdd(db, db, zz);
+    }
+
+    // power iteration, starting with the row of the largest diagonal element
+    plSimdVec4f vx = xx, vy = xy, vz = xz;
+    {
+      const plSimdVec4b bUseRow1 = yy > xx && yy >= zz;
+      const plSimdVec4b bUseRow2 = zz > xx && zz > yy;
+
+      vx = plSimdVec4f::Select(bUseRow1, xy, plSimdVec4f::Select(bUseRow2, xz, vx));
+      vy = plSimdVec4f::Select(bUseRow1, yy, plSimdVec4f::Select(bUseRow2, yz, vy));
+      vz = plSimdVec4f::Select(bUseRow1, yz, plSimdVec4f::Select(bUseRow2, zz, vz));
+    }
+
+    for (plUInt32 iteration = 0; iteration < 8; ++iteration)
+    {
+      const plSimdVec4f nx = xx.CompMul(vx) + xy.CompMul(vy) + xz.CompMul(vz);
+      const plSimdVec4f ny = xy.CompMul(vx) + yy.CompMul(vy) + yz.CompMul(vz);
+      const plSimdVec4f nz = xz.CompMul(vx) + yz.CompMul(vy) + zz.CompMul(vz);
+
+      const plSimdVec4f vMax = nx.Abs().CompMax(ny.Abs()).CompMax(nz.Abs());
+      const plSimdVec4f vScale = plSimdVec4f::Select(vMax > vZero, plSimdVec4f(1.0f).CompDiv(vMax), vZero);
+
+      vx = nx.CompMul(vScale);
+      vy = ny.CompMul(vScale);
+      vz = nz.CompMul(vScale);
+    }
+
+    {
+      const plSimdVec4f vLenSquared = vx.CompMul(vx) + vy.CompMul(vy) + vz.CompMul(vz);
+      const plSimdVec4f vScale = plSimdVec4f::Select(vLenSquared > vZero, vLenSquared.GetInvSqrt(), vZero);
+
+      vx = vx.CompMul(vScale);
+      vy = vy.CompMul(vScale);
+      vz = vz.CompMul(vScale);
+    }
+
+    plSimdVec4f tMin(plMath::MaxValue<float>());
+    plSimdVec4f tMax(-plMath::MaxValue<float>());
+
+    for (plUInt32 i = 0; i < 16; ++i)
+    {
+      const plSimdVec4f t = (r[i] - meanR).CompMul(vx) + (g[i] - meanG).CompMul(vy) + (b[i] - meanB).CompMul(vz);
+      tMin = tMin.CompMin(t);
+      tMax = tMax.CompMax(t);
+    }
+
+    const plSimdVec4f v0(0.0f);
+    const plSimdVec4f v255(255.0f);
+    const plSimdVec4f vHalf(0.5f);
+
+    auto quantize = [&](const plSimdVec4f& t) -> plSimdVec4i
+    {
+      const plSimdVec4f er = plSimdVec4f::MulAdd(vx, t, meanR).CompMax(v0).CompMin(v255);
+      const plSimdVec4f eg = plSimdVec4f::MulAdd(vy, t, meanG).CompMax(v0).CompMin(v255);
+      const plSimdVec4f eb = plSimdVec4f::MulAdd(vz, t, meanB).CompMax(v0).CompMin(v255);
+
+      const plSimdVec4i r5 = plSimdVec4i::Truncate(plSimdVec4f::MulAdd(er, plSimdFloat(31.0f / 255.0f), vHalf));
+      const plSimdVec4i g6 = plSimdVec4i::Truncate(plSimdVec4f::MulAdd(eg, plSimdFloat(63.0f / 255.0f), vHalf));
+      const plSimdVec4i b5 = plSimdVec4i::Truncate(plSimdVec4f::MulAdd(eb, plSimdFloat(31.0f / 255.0f), vHalf));
+
+      return (r5 << 11) | (g6 << 5) | b5;
+    };
+
+    plSimdVec4i color0 = quantize(tMax);
+    plSimdVec4i color1 = quantize(tMin);
+
+    // the four color mode requires color0 > color1
+    {
+      const plSimdVec4b bSwap = color0 < color1;
+      const plSimdVec4i tmp = color0;
+      color0 = plSimdVec4i::Select(bSwap, color1, color0);
+      color1 = plSimdVec4i::Select(bSwap, tmp, color1);
+    }
+
+    auto expand = [](const plSimdVec4i& c, plSimdVec4f* pRgb)
+    {
+      const plSimdVec4i v63(0x3F);
+      const plSimdVec4i v31(0x1F);
+
+      pRgb[0] = ((((c >> 11) & v31).CompMul(plSimdVec4i(527)) + plSimdVec4i(23)) >> 6).ToFloat();
+      pRgb[1] = ((((c >> 5) & v63).CompMul(plSimdVec4i(259)) + plSimdVec4i(33)) >> 6).ToFloat();
+      pRgb[2] = (((c & v31).CompMul(plSimdVec4i(527)) + plSimdVec4i(23)) >> 6).ToFloat();
+    };
+
+    plSimdVec4f palette[4][3];
+    expand(color0, palette[0]);
+    expand(color1, palette[1]);
+
+    for (plUInt32 c = 0; c < 3; ++c)
+    {
+      // (2 * a + b + 1) / 3 with integer division, the bias keeps the result exact where the division has no remainder
+      const plSimdVec4f vBias(1.0f + 3.0f / 1024.0f);
+      palette[2][c] = ((palette[0][c] + palette[0][c] + palette[1][c] + vBias) * (1.0f / 3.0f)).Floor();
+      palette[3][c] = ((palette[0][c] + palette[1][c] + palette[1][c] + vBias) * (1.0f / 3.0f)).Floor();
+    }
+
+    plSimdVec4i indices = plSimdVec4i::MakeZero();
+
+    for (plUInt32 i = 0; i < 16; ++i)
+    {
+      plSimdVec4f vBestDist;
+      plSimdVec4i vBestIndex = plSimdVec4i::MakeZero();
+
+      for (plUInt32 k = 0; k < 4; ++k)
+      {
+        const plSimdVec4f dr = r[i] - palette[k][0];
+        const plSimdVec4f dg = g[i] - palette[k][1];
+        const plSimdVec4f db = b[i] - palette[k][2];
+        const plSimdVec4f vDist = dr.CompMul(dr) + dg.CompMul(dg) + db.CompMul(db);
+
+        if (k == 0)
+        {
+          vBestDist = vDist;
+        }
+        else
+        {
+          const plSimdVec4b bCloser = vDist < vBestDist;
+          vBestDist = plSimdVec4f::Select(bCloser, vDist, vBestDist);
+          vBestIndex = plSimdVec4i::Select(bCloser, plSimdVec4i(k), vBestIndex);
+        }
+      }
+
+      indices |= vBestIndex << (2 * i);
+    }
+
+    plInt32 color0Lanes[4], color1Lanes[4], indexLanes[4];
+    color0.Store<4>(color0Lanes);
+    color1.Store<4>(color1Lanes);
+    indices.Store<4>(indexLanes);
+
+    for (plUInt32 lane = 0; lane < 4; ++lane)
+    {
+      writeBlockBC1(static_cast<plUInt16>(color0Lanes[lane]), static_cast<plUInt16>(color1Lanes[lane]), static_cast<plUInt32>(indexLanes[lane]), pTargets[lane]);
+    }
+  }
+
+  void encodeBC1(const plColorBaseUB* pSource, plUInt8* pTarget, plUInt32 uiNumBlocks, plUInt32 uiTargetStride, plBCnEncoderQuality::Enum quality,
+    bool bAllowTransparency, bool bForceFourColorMode)
+  {
+    const bool bTransparency = bAllowTransparency && !bForceFourColorMode;
+
+    plUInt32 uiBlock = 0;
+
+    for (; uiBlock + 4 <= uiNumBlocks; uiBlock += 4)
+    {
+      const plColorBaseUB* pBlocks[4];
+      plUInt8* pTargets[4];
+
+      for (plUInt32 lane = 0; lane < 4; ++lane)
+      {
+        pBlocks[lane] = pSource + (uiBlock + lane) * 16;
+        pTargets[lane] = pTarget + (uiBlock + lane) * uiTargetStride;
+      }
+
+      if (quality == plBCnEncoderQuality::RangeFit)
+      {
+        rangeFitFourBlocksBC1(pBlocks, pTargets);
+
+        // blocks with transparent pixels need the three color mode and blocks with a single color are encoded better with the lookup tables
+        for (plUInt32 lane = 0; lane < 4; ++lane)
+        {
+          if ((bTransparency && hasTransparentPixels(pBlocks[lane])) || isSolidColor(pBlocks[lane]))
+          {
+            ColorBlock block;
+            initColorBlock(pBlocks[lane], bTransparency, block);
+            encodeBlockBC1(pBlocks[lane], block, pTargets[lane], quality, bForceFourColorMode);
+          }
+        }
+      }
+      else
+      {
+        ColorBlock blocks[4];
+        plVec3 axes[4];
+
+        for (plUInt32 lane = 0; lane < 4; ++lane)
+        {
+          initColorBlock(pBlocks[lane], bTransparency, blocks[lane]);
+          axes[lane] = blocks[lane].m_uiNumPoints == 16 ? computePrincipalAxis(blocks[lane], computeMean(blocks[lane])) : plVec3::MakeZero();
+        }
+
+        plUInt16 fits[4][2];
+        clusterFitFourBlocksBC1(blocks, axes, fits);
+
+        for (plUInt32 lane = 0; lane < 4; ++lane)
+        {
+          encodeBlockBC1(pBlocks[lane], blocks[lane], pTargets[lane], quality, bForceFourColorMode, blocks[lane].m_uiNumPoints == 16 ? fits[lane] : nullptr);
+        }
+      }
+    }
+
+    for (; uiBlock < uiNumBlocks; ++uiBlock)
+    {
+      ColorBlock block;
+      initColorBlock(pSource + uiBlock * 16, bTransparency, block);
+      encodeBlockBC1(pSource + uiBlock * 16, block, pTarget + uiBlock * uiTargetStride, quality, bForceFourColorMode);
+    }
+  }
+
+  //////////////////////////////////////////////////////////////////////////
+  // BC4 single channel blocks
+  //////////////////////////////////////////////////////////////////////////
+
+#if defined(PL_SUPPORTS_BC4_COMPRESSOR_SSE)
+  plUInt32 findBestPaletteIndexBC4(plInt32 iSourceValue, __m128i p0, __m128i p1)
+  {
+    __m128i source = _mm_set1_epi32(iSourceValue);
+
+    __m128i e0 = _mm_abs_epi32(_mm_sub_epi32(p0, source));
+    __m128i e1 = _mm_abs_epi32(_mm_sub_epi32(p1, source));
+
+    __m128i h0 = _mm_min_epi32(e0, _mm_shuffle_epi32(e0, _MM_SHUFFLE(1, 0, 3, 2)));
+    h0 = _mm_min_epi32(h0, _mm_shuffle_epi32(h0, _MM_SHUFFLE(2, 3, 0, 1)));
+
+    __m128i h1 = _mm_min_epi32(e1, _mm_shuffle_epi32(e1, _MM_SHUFFLE(1, 0, 3, 2)));
+    h1 = _mm_min_epi32(h1, _mm_shuffle_epi32(h1, _MM_SHUFFLE(2, 3, 0, 1)));
+
+    plUInt32 s0 = _mm_cvtsi128_si32(h0);
+    plUInt32 s1 = _mm_cvtsi128_si32(h1);
+
+    uint32_t offset;
+    __m128i min, minH;
+    if (s0 <= s1)
+    {
+      min = e0;
+      minH = h0;
+      offset = 0;
+    }
+    else
+    {
+      min = e1;
+      minH = h1;
+      offset = 4;
+    }
+
+    plUInt32 mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(min, minH)));
+
+    return plMath::FirstBitLow(mask) + offset;
+  }
+
+  void packBlockBC4(const plUInt8* pSourceData, plUInt32 ui0, plUInt32 ui1, plUInt8* pTargetData)
+  {
+    pTargetData[0] = plUInt8(ui0);
+    pTargetData[1] = plUInt8(ui1);
+
+    plUInt32 palette[8];
+    plUnpackPaletteBC4(ui0, ui1, palette);
+
+    __m128i p0, p1;
+    p0 = _mm_loadu_si128(reinterpret_cast<__m128i*>(palette + 0));
+    p1 = _mm_loadu_si128(reinterpret_cast<__m128i*>(palette + 4));
+
+    plUInt64 indices = 0;
+    for (plUInt32 idx = 0; idx < 16; ++idx)
+    {
+      indices |= plUInt64(findBestPaletteIndexBC4(pSourceData[idx], p0, p1)) << (3 * idx);
+    }
+
+    memcpy(pTargetData + 2, &indices, 6);
+  }
+
+  plUInt32 getSquaredErrorBC4_SSE(const plUInt8* pSourceData, const __m128i* pPaletteAndCopy)
+  {
+    // See getSquaredErrorBC4() for what we want to achieve (sum of lowest squared errors).
+    // Instead of converting to 32bit ints and actually computing squares, this function finds lowest absolute differences
+    // (between the input data and a color from the palette) for each input.
+    // Only then it actually expands them to integers, squares them and adds them together.
+
+    // pal0 contains the palette repeated twice.
+    // If we'll perform a vector op between src and pal0, src[0] will correspond to color[0] from the palette, src[1] to color[1], etc.
+    // Since the palette is stored twice, src[8] will correspond to color[0] again, etc.
+    // Below we generate 7 more rotations of this palette so that each input will correspond to each of 8 colors of palettes.
+    const __m128i pal0 = _mm_loadu_si128(pPaletteAndCopy);
+    const __m128i src = _mm_loadu_si128((__m128i*)pSourceData);
+
+    auto makeDiff = [&](__m128i pal) {
+      // Absolute difference is a difference between max and min of two numbers.
+      const __m128i max8 = _mm_max_epu8(src, pal);
+      const __m128i min8 = _mm_min_epu8(src, pal);
+      return _mm_sub_epi8(max8, min8); // Below we treat the result as unsigned.
+    };
+
+    // Unfortunately it can't be a loop, because:
+    // 1. last arg in _mm_alignr_epi8 must be a constant
+    // 2. rotating the result by 1 in each iteration creates a data dependency
+    // 3. VS2015 fails to unroll it properly and generates inefficient code.
+
+    const __m128i diff0 = makeDiff(pal0);
+    const __m128i diff1 = makeDiff(_mm_alignr_epi8(pal0, pal0, 1));
+    const __m128i diff2 = makeDiff(_mm_alignr_epi8(pal0, pal0, 2));
+    const __m128i diff3 = makeDiff(_mm_alignr_epi8(pal0, pal0, 3));
+    const __m128i diff4 = makeDiff(_mm_alignr_epi8(pal0, pal0, 4));
+    const __m128i diff5 = makeDiff(_mm_alignr_epi8(pal0, pal0, 5));
+    const __m128i diff6 = makeDiff(_mm_alignr_epi8(pal0, pal0, 6));
+    const __m128i diff7 = makeDiff(_mm_alignr_epi8(pal0, pal0, 7));
+
+    // Now we have absolute differences between each input and each color in the palette.
+    // We want to find the lowest one for each input.
+
+    const __m128i minDiff01 = _mm_min_epu8(diff0, diff1);
+    const __m128i minDiff23 = _mm_min_epu8(diff2, diff3);
+    const __m128i minDiff45 = _mm_min_epu8(diff4, diff5);
+    const __m128i minDiff67 = _mm_min_epu8(diff6, diff7);
+
+    const __m128i minDiff = _mm_min_epu8(_mm_min_epu8(minDiff01, minDiff23), _mm_min_epu8(minDiff45, minDiff67));
+
+    // Expands bytes to 32bit integers
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i diff16Lo = _mm_unpacklo_epi8(minDiff, zero);
+    const __m128i diff16Hi = _mm_unpackhi_epi8(minDiff, zero);
+
+    auto square = [](__m128i input) { return _mm_mullo_epi32(input, input); };
+
+    const __m128i square0 = square(_mm_unpacklo_epi16(diff16Lo, zero));
+    const __m128i square1 = square(_mm_unpackhi_epi16(diff16Lo, zero));
+    const __m128i square2 = square(_mm_unpacklo_epi16(diff16Hi, zero));
+    const __m128i square3 = square(_mm_unpackhi_epi16(diff16Hi, zero));
+
+    // Adds all 16 squares together.
+    const __m128i sum4 = _mm_add_epi32(_mm_add_epi32(square0, square1), _mm_add_epi32(square2, square3));
+    const __m128i sum2 = _mm_hadd_epi32(sum4, sum4);
+    return _mm_cvtsi128_si32(_mm_hadd_epi32(sum2, sum2));
+  }
+
+  // The order of args is [3], [2], [1], [0]
+  static const __m128i div7_a0LoMultiplier = _mm_setr_epi32(5 * 2341, 6 * 2341, 0 * 2341, 7 * 2341);
+  static const __m128i div7_a0HiMultiplier = _mm_setr_epi32(1 * 2341, 2 * 2341, 3 * 2341, 4 * 2341);
+  static const __m128i div7_a1LoMultiplier = _mm_setr_epi32(2 * 2341, 1 * 2341, 7 * 2341, 0 * 2341);
+  static const __m128i div7_a1HiMultiplier = _mm_setr_epi32(6 * 2341, 5 * 2341, 4 * 2341, 3 * 2341);
+  static const __m128i div7_correctionAdd = _mm_setr_epi32(3 * 2341, 3 * 2341, 3 * 2341, 3 * 2341);
+
+  static const __m128i div5_a0LoMultiplier = _mm_setr_epi32(3 * 1639, 4 * 1639, 0 * 1639, 5 * 1639);
+  static const __m128i div5_a0HiMultiplier = _mm_setr_epi32(0, 0, 1 * 1639, 2 * 1639);
+  static const __m128i div5_a1LoMultiplier = _mm_setr_epi32(2 * 1639, 1 * 1639, 5 * 1639, 0);
+  static const __m128i div5_a1HiMultiplier = _mm_setr_epi32(0, 0, 4 * 1639, 3 * 1639);
+  static const __m128i div5_correctionAdd = _mm_setr_epi32(2 * 1639, 2 * 1639, 2 * 1639, 2 * 1639);
+  static const __m128i lastTwoAlphas_0_255 = _mm_setr_epi32(255, 0, 0, 0);
+
+  // Does the same thing as unpackPaletteBC4(), but stores the 8 result numbers twice as bytes
+  // (low 8 bytes of alphasAndAlphasCopy will be equal to high 8 bytes)
+  // See unpackPaletteBC4 for the explanation regarding magic numbers
+  void unpackPaletteBC4AsBytesTwice(plUInt32 ui0, plUInt32 ui1, __m128i* pAlphasAndAlphasCopy)
+  {
+    const __m128i v0 = _mm_set1_epi32(ui0);
+    const __m128i v1 = _mm_set1_epi32(ui1);
+    if (ui0 > ui1)
+    {
+      __m128i sumLo0 = _mm_mullo_epi32(v0, div7_a0LoMultiplier);
+      __m128i sumLo1 = _mm_mullo_epi32(v1, div7_a1LoMultiplier);
+      __m128i sumHi0 = _mm_mullo_epi32(v0, div7_a0HiMultiplier);
+      __m128i sumHi1 = _mm_mullo_epi32(v1, div7_a1HiMultiplier);
+      sumLo0 = _mm_add_epi32(div7_correctionAdd, sumLo0);
+      sumHi0 = _mm_add_epi32(div7_correctionAdd, sumHi0);
+      const __m128i sumLo = _mm_add_epi32(sumLo0, sumLo1);
+      const __m128i sumHi = _mm_add_epi32(sumHi0, sumHi1);
+      const __m128i resLo = _mm_srli_epi32(sumLo, 14);
+      const __m128i resHi = _mm_srli_epi32(sumHi, 14);
+
+      const __m128i res16 = _mm_packs_epi32(resLo, resHi);
+      _mm_storeu_si128(pAlphasAndAlphasCopy, _mm_packus_epi16(res16, res16));
+    }
+    else
+    {
+      __m128i sumLo0 = _mm_mullo_epi32(v0, div5_a0LoMultiplier);
+      __m128i sumHi0 = _mm_mullo_epi32(v0, div5_a0HiMultiplier);
+      __m128i sumLo1 = _mm_mullo_epi32(v1, div5_a1LoMultiplier);
+      __m128i sumHi1 = _mm_mullo_epi32(v1, div5_a1HiMultiplier);
+      sumLo0 = _mm_add_epi32(div5_correctionAdd, sumLo0);
+      sumHi0 = _mm_add_epi32(div5_correctionAdd, sumHi0);
+      const __m128i sumLo = _mm_add_epi32(sumLo0, sumLo1);
+      const __m128i sumHi = _mm_add_epi32(sumHi0, sumHi1);
+      const __m128i resHiIncomplete = _mm_srli_epi32(sumHi, 13);
+      const __m128i resLo = _mm_srli_epi32(sumLo, 13);
+      const __m128i resHi = _mm_add_epi32(resHiIncomplete, lastTwoAlphas_0_255);
+
+      const __m128i res16 = _mm_packs_epi32(resLo, resHi);
+      _mm_storeu_si128(pAlphasAndAlphasCopy, _mm_packus_epi16(res16, res16));
+    }
+  }
+
+  plUInt32 getSquaredErrorBC4(plUInt32 ui0, plUInt32 ui1, const plUInt8* pSourceData)
+  {
+    __m128i paletteAndCopy;
+    unpackPaletteBC4AsBytesTwice(plUInt8(ui0), plUInt8(ui1), &paletteAndCopy);
+    return getSquaredErrorBC4_SSE(pSourceData, &paletteAndCopy);
+  }
+#else
+  plUInt32 findBestPaletteIndexBC4(plInt32 iSourceValue, const plUInt32* pPalette, plUInt32& out_uiError)
+  {
+    plUInt32 uiBestIndex = 0;
+    out_uiError = plMath::MaxValue<plUInt32>();
+
+    for (plUInt32 i = 0; i < 8; ++i)
+    {
+      const plInt32 iDiff = iSourceValue - static_cast<plInt32>(pPalette[i]);
+      const plUInt32 uiError = static_cast<plUInt32>(iDiff * iDiff);
+
+      if (uiError < out_uiError)
+      {
+        out_uiError = uiError;
+        uiBestIndex = i;
+      }
+    }
+
+    return uiBestIndex;
+  }
+
+  void packBlockBC4(const plUInt8* pSourceData, plUInt32 ui0, plUInt32 ui1, plUInt8* pTargetData)
+  {
+    pTargetData[0] = plUInt8(ui0);
+    pTargetData[1] = plUInt8(ui1);
+
+    plUInt32 palette[8];
+    plUnpackPaletteBC4(ui0, ui1, palette);
+
+    plUInt64 indices = 0;
+    for (plUInt32 idx = 0; idx < 16; ++idx)
+    {
+      plUInt32 uiError;
+      indices |= plUInt64(findBestPaletteIndexBC4(pSourceData[idx], palette, uiError)) << (3 * idx);
+    }
+
+    memcpy(pTargetData + 2, &indices, 6);
+  }
+
+  plUInt32 getSquaredErrorBC4(plUInt32 ui0, plUInt32 ui1, const plUInt8* pSourceData)
+  {
+    plUInt32 palette[8];
+    plUnpackPaletteBC4(ui0, ui1, palette);
+
+    plUInt32 uiSum = 0;
+    for (plUInt32 idx = 0; idx < 16; ++idx)
+    {
+      plUInt32 uiError;
+      findBestPaletteIndexBC4(pSourceData[idx], palette, uiError);
+      uiSum += uiError;
+    }
+
+    return uiSum;
+  }
+#endif
+
+  /// Searches for the endpoints with the lowest error in a window around the minimum and maximum value.
+  /// The window spans iInnerRange values towards the center of the value range and iOuterRange values away from it.
+  void findBestPaletteBC4(const plUInt8* pSourceData, plInt32 iInnerRange, plInt32 iOuterRange, plUInt32& ref_uiBestA0, plUInt32& ref_uiBestA1)
+  {
+    plInt32 minA = 255;
+    plInt32 maxA = 0;
+
+    plInt32 minA_greater8 = 247;
+    plInt32 maxA_less248 = 9;
+
+    for (plUInt32 idx = 0; idx < 16; ++idx)
+    {
+      plUInt32 value = pSourceData[idx];
+      minA = plMath::Min<plUInt32>(minA, value);
+      maxA = plMath::Max<plUInt32>(maxA, value);
+
+      if (value > 8 && value < 248)
+      {
+        minA_greater8 = plMath::Min<plUInt32>(minA_greater8, value);
+        maxA_less248 = plMath::Max<plUInt32>(maxA_less248, value);
+      }
+    }
+
+    // Palette covers range perfectly
+    if (maxA - minA < 8)
+    {
+      ref_uiBestA0 = maxA;
+      ref_uiBestA1 = minA;
+      return;
+    }
+
+    plUInt32 bestError = plUInt32(-1);
+    ref_uiBestA0 = plUInt32(-1);
+    ref_uiBestA1 = plUInt32(-1);
+
+    // Try to find optimal values by searching around min and max
+    {
+      plInt32 minA0 = plMath::Max(1, maxA - iInnerRange);
+      plInt32 maxA0 = plMath::Min(256, maxA + iOuterRange);
+      for (plInt32 a0 = minA0; a0 < maxA0; ++a0)
+      {
+        plInt32 minA1 = plMath::Max(0, minA - iOuterRange);
+        plInt32 maxA1 = plMath::Min(a0, minA + iInnerRange);
+        for (plInt32 a1 = minA1; a1 < maxA1; ++a1)
+        {
+          plUInt32 error = getSquaredErrorBC4(a0, a1, pSourceData);
+
+          if (error < bestError)
+          {
+            bestError = error;
+            ref_uiBestA0 = a0;
+            ref_uiBestA1 = a1;
+
+            if (error == 0)
+            {
+              return;
+            }
+          }
+        }
+      }
+    }
+
+    // If we have any values close to 0 or 255, try the flipped palette versions too, searching around the secondary min/max values
+    if (minA < 8 || maxA > 248)
+    {
+      plInt32 minA1 = maxA_less248 - iInnerRange;
+      plInt32 maxA1 = plMath::Min(256, maxA_less248 + iOuterRange);
+      for (plInt32 a1 = minA1; a1 < maxA1; ++a1)
+      {
+        plInt32 minA0 = plMath::Max(0, minA_greater8 - iOuterRange);
+        plInt32 maxA0 = plMath::Min(a1, minA_greater8 + iInnerRange);
+        for (plInt32 a0 = minA0; a0 < maxA0; ++a0)
+        {
+          plUInt32 error = getSquaredErrorBC4(a0, a1, pSourceData);
+
+          if (error < bestError)
+          {
+            bestError = error;
+            ref_uiBestA0 = a0;
+            ref_uiBestA1 = a1;
+
+            if (error == 0)
+            {
+              return;
+            }
+          }
+        }
+      }
+    }
+  }
+
+  void encodeBlockBC4(const plUInt8* pSourceData, plUInt8* pTargetData, plBCnEncoderQuality::Enum quality)
+  {
+    plUInt32 a0, a1;
+
+    // the fastest level is the search that this encoder always used, so the default output doesn't change
+    switch (quality)
+    {
+      case plBCnEncoderQuality::RangeFit:
+        findBestPaletteBC4(pSourceData, 4, 8, a0, a1);
+        break;
+
+      case plBCnEncoderQuality::ClusterFit:
+        findBestPaletteBC4(pSourceData, 8, 16, a0, a1);
+        break;
+
+      default:
+        findBestPaletteBC4(pSourceData, 16, 32, a0, a1);
+        break;
+    }
+
+    packBlockBC4(pSourceData, a0, a1, pTargetData);
+  }
+
+  /// Encodes single channel blocks. The bias shifts signed data into the unsigned range, so that it can be treated the same way.
+  void encodeBC4(const plUInt8* pSource, plUInt8* pTarget, plUInt32 uiNumBlocks, plUInt32 uiTargetStride, plBCnEncoderQuality::Enum quality, plUInt8 uiBias)
+  {
+    for (plUInt32 uiBlock = 0; uiBlock < uiNumBlocks; ++uiBlock)
+    {
+      plUInt8* pTargetData = pTarget + uiBlock * uiTargetStride;
+      encodeBlockBC4(pSource + uiBlock * 16, pTargetData, quality);
+
+      // Undo biasing for signed formats by shifting palette upper and lower bound back into signed range
+      pTargetData[0] -= uiBias;
+      pTargetData[1] -= uiBias;
+    }
+  }
+
+  void encodeBC3(const plColorBaseUB* pSource, plUInt8* pTarget, plUInt32 uiNumBlocks, plBCnEncoderQuality::Enum quality)
+  {
+    for (plUInt32 uiBlock = 0; uiBlock < uiNumBlocks; ++uiBlock)
+    {
+      plUInt8 alpha[16];
+      for (plUInt32 i = 0; i < 16; ++i)
+      {
+        alpha[i] = pSource[uiBlock * 16 + i].a;
+      }
+
+      encodeBlockBC4(alpha, pTarget + uiBlock * 16, quality);
+    }
+
+    // BC3 always decodes the color block in four color mode
+    encodeBC1(pSource, pTarget + 8, uiNumBlocks, 16, quality, false, true);
+  }
+
+  //////////////////////////////////////////////////////////////////////////
+  // Conversion steps
+  //////////////////////////////////////////////////////////////////////////
+
+  /// Copies one row of 4x4 blocks from a block-aligned RGBA image, so that the pixels of each block are consecutive.
+  void gatherBlockRow(const plUInt8* pSource, plUInt64 uiRowPitch, plUInt32 uiBlockY, plUInt32 uiNumBlocksX, plColorBaseUB* pTarget)
+  {
+    for (plUInt32 y = 0; y < 4; ++y)
+    {
+      const plColorBaseUB* pRow = reinterpret_cast<const plColorBaseUB*>(pSource + (4 * uiBlockY + y) * uiRowPitch);
+
+      for (plUInt32 blockX = 0; blockX < uiNumBlocksX; ++blockX)
+      {
+        plMemoryUtils::Copy(pTarget + 16 * blockX + 4 * y, pRow + 4 * blockX, 4);
+      }
+    }
+  }
+
+  /// Same as gatherBlockRow() for a single channel of a format with uiStride bytes per pixel.
+  void gatherChannelBlockRow(const plUInt8* pSource, plUInt64 uiRowPitch, plUInt32 uiStride, plUInt32 uiChannel, plUInt8 uiBias, plUInt32 uiBlockY,
+    plUInt32 uiNumBlocksX, plUInt8* pTarget)
+  {
+    for (plUInt32 y = 0; y < 4; ++y)
+    {
+      const plUInt8* pRow = pSource + (4 * uiBlockY + y) * uiRowPitch + uiChannel;
+
+      for (plUInt32 blockX = 0; blockX < uiNumBlocksX; ++blockX)
+      {
+        for (plUInt32 x = 0; x < 4; ++x)
+        {
+          pTarget[16 * blockX + 4 * y + x] = pRow[(x + 4 * blockX) * uiStride] + uiBias;
+        }
+      }
+    }
+  }
+} // namespace
+
+class plImageConversion_CompressBC1 : public plImageConversionStepCompressBlocks
+{
+public:
+  virtual plArrayPtr<const plImageConversionEntry> GetSupportedConversions() const override
+  {
+    // Preferred over the DirectXTex CPU encoder, but not over the DirectXTex conversions on Windows.
+    static plImageConversionEntry supportedConversions[] = {
+      plImageConversionEntry(plImageFormat::R8G8B8A8_UNORM, plImageFormat::BC1_UNORM, plImageConversionFlags::Default, 50),
+      plImageConversionEntry(plImageFormat::R8G8B8A8_UNORM_SRGB, plImageFormat::BC1_UNORM_SRGB, plImageConversionFlags::Default, 50),
+    };
+    return supportedConversions;
+  }
+
+  virtual plResult CompressBlocks(plConstByteBlobPtr source, plByteBlobPtr target, plUInt32 numBlocksX, plUInt32 numBlocksY,
+    plImageFormat::Enum sourceFormat, plImageFormat::Enum targetFormat, const plImageConversionSettings& settings) const override
+  {
+    PL_IGNORE_UNUSED(targetFormat);
+
+    const plUInt64 rowPitch = plImageFormat::GetRowPitch(sourceFormat, 4 * numBlocksX);
+    const plBCnEncoderQuality::Enum quality = settings.m_BCnQuality;
+
+    const plUInt8* pSource = source.GetPtr();
+    plUInt8* pTarget = target.GetPtr();
+
+    plTaskSystem::ParallelForIndexed(0, numBlocksY, [pSource, pTarget, rowPitch, numBlocksX, quality](plUInt32 startIndex, plUInt32 endIndex) {
+      plDynamicArray<plColorBaseUB> blocks;
+      blocks.SetCountUninitialized(numBlocksX * 16);
+
+      for (plUInt32 blockY = startIndex; blockY < endIndex; ++blockY)
+      {
+        gatherBlockRow(pSource, rowPitch, blockY, numBlocksX, blocks.GetData());
+        encodeBC1(blocks.GetData(), pTarget + blockY * numBlocksX * 8, numBlocksX, 8, quality, true, false);
+      }
+    });
+
+    return PL_SUCCESS;
+  }
+};
+
+class plImageConversion_CompressBC3 : public plImageConversionStepCompressBlocks
+{
+public:
+  virtual plArrayPtr<const plImageConversionEntry> GetSupportedConversions() const override
+  {
+    static plImageConversionEntry supportedConversions[] = {
+      plImageConversionEntry(plImageFormat::R8G8B8A8_UNORM, plImageFormat::BC3_UNORM, plImageConversionFlags::Default),
+      plImageConversionEntry(plImageFormat::R8G8B8A8_UNORM_SRGB, plImageFormat::BC3_UNORM_SRGB, plImageConversionFlags::Default),
+    };
+    return supportedConversions;
+  }
+
+  virtual plResult CompressBlocks(plConstByteBlobPtr source, plByteBlobPtr target, plUInt32 numBlocksX, plUInt32 numBlocksY,
+    plImageFormat::Enum sourceFormat, plImageFormat::Enum targetFormat, const plImageConversionSettings& settings) const override
+  {
+    PL_IGNORE_UNUSED(targetFormat);
+
+    const plUInt64 rowPitch = plImageFormat::GetRowPitch(sourceFormat, 4 * numBlocksX);
+    const plBCnEncoderQuality::Enum quality = settings.m_BCnQuality;
+
+    const plUInt8* pSource = source.GetPtr();
+    plUInt8* pTarget = target.GetPtr();
+
+    plTaskSystem::ParallelForIndexed(0, numBlocksY, [pSource, pTarget, rowPitch, numBlocksX, quality](plUInt32 startIndex, plUInt32 endIndex) {
+      plDynamicArray<plColorBaseUB> blocks;
+      blocks.SetCountUninitialized(numBlocksX * 16);
+
+      for (plUInt32 blockY = startIndex; blockY < endIndex; ++blockY)
+      {
+        gatherBlockRow(pSource, rowPitch, blockY, numBlocksX, blocks.GetData());
+        encodeBC3(blocks.GetData(), pTarget + blockY * numBlocksX * 16, numBlocksX, quality);
+      }
+    });
+
+    return PL_SUCCESS;
+  }
+};
+
+class plImageConversion_CompressBC4 : public plImageConversionStepCompressBlocks
+{
+public:
+  virtual plArrayPtr<const plImageConversionEntry> GetSupportedConversions() const override
+  {
+    static plImageConversionEntry supportedConversions[] = {
+      plImageConversionEntry(plImageFormat::R8_UNORM, plImageFormat::BC4_UNORM, plImageConversionFlags::Default),
+      plImageConversionEntry(plImageFormat::R8_SNORM, plImageFormat::BC4_SNORM, plImageConversionFlags::Default),
+      plImageConversionEntry(plImageFormat::R8G8_UNORM, plImageFormat::BC4_UNORM, plImageConversionFlags::Default),
+      plImageConversionEntry(plImageFormat::R8G8_SNORM, plImageFormat::BC4_SNORM, plImageConversionFlags::Default),
+      plImageConversionEntry(plImageFormat::R8G8B8A8_UNORM, plImageFormat::BC4_UNORM, plImageConversionFlags::Default),
+      plImageConversionEntry(plImageFormat::R8G8B8A8_SNORM, plImageFormat::BC4_SNORM, plImageConversionFlags::Default),
+    };
+    return supportedConversions;
+  }
+
+  virtual plResult CompressBlocks(plConstByteBlobPtr source, plByteBlobPtr target, plUInt32 numBlocksX, plUInt32 numBlocksY,
+    plImageFormat::Enum sourceFormat, plImageFormat::Enum targetFormat, const plImageConversionSettings& settings) const override
+  {
+    PL_IGNORE_UNUSED(targetFormat);
+
+    const plUInt32 stride = plImageFormat::GetBitsPerPixel(sourceFormat) / 8;
+    const plUInt64 rowPitch = plImageFormat::GetRowPitch(sourceFormat, 4 * numBlocksX);
+    const plBCnEncoderQuality::Enum quality = settings.m_BCnQuality;
+
+    // Bias to shift signed data into unsigned range so we can treat it the same as unsigned
+    const plUInt8 bias = plImageFormat::GetDataType(sourceFormat) == plImageFormatDataType::SNORM ? 128 : 0;
+
+    const plUInt8* pSource = source.GetPtr();
+    plUInt8* pTarget = target.GetPtr();
+
+    plTaskSystem::ParallelForIndexed(0, numBlocksY, [pSource, pTarget, rowPitch, stride, numBlocksX, quality, bias](plUInt32 startIndex, plUInt32 endIndex) {
+      plDynamicArray<plUInt8> blocks;
+      blocks.SetCountUninitialized(numBlocksX * 16);
+
+      for (plUInt32 blockY = startIndex; blockY < endIndex; ++blockY)
+      {
+        gatherChannelBlockRow(pSource, rowPitch, stride, 0, bias, blockY, numBlocksX, blocks.GetData());
+        encodeBC4(blocks.GetData(), pTarget + blockY * numBlocksX * 8, numBlocksX, 8, quality, bias);
+      }
+    });
+
+    return PL_SUCCESS;
+  }
+};
+
+class plImageConversion_CompressBC5 : public plImageConversionStepCompressBlocks
+{
+public:
+  virtual plArrayPtr<const plImageConversionEntry> GetSupportedConversions() const override
+  {
+    static plImageConversionEntry supportedConversions[] = {
+      plImageConversionEntry(plImageFormat::R8G8_UNORM, plImageFormat::BC5_UNORM, plImageConversionFlags::Default),
+      plImageConversionEntry(plImageFormat::R8G8_SNORM, plImageFormat::BC5_SNORM, plImageConversionFlags::Default),
+      plImageConversionEntry(plImageFormat::R8G8B8A8_UNORM, plImageFormat::BC5_UNORM, plImageConversionFlags::Default),
+      plImageConversionEntry(plImageFormat::R8G8B8A8_SNORM, plImageFormat::BC5_SNORM, plImageConversionFlags::Default),
+    };
+    return supportedConversions;
+  }
+
+  virtual plResult CompressBlocks(plConstByteBlobPtr source, plByteBlobPtr target, plUInt32 numBlocksX, plUInt32 numBlocksY,
+    plImageFormat::Enum sourceFormat, plImageFormat::Enum targetFormat, const plImageConversionSettings& settings) const override
+  {
+    PL_IGNORE_UNUSED(targetFormat);
+
+    const plUInt32 stride = plImageFormat::GetBitsPerPixel(sourceFormat) / 8;
+    const plUInt64 rowPitch = plImageFormat::GetRowPitch(sourceFormat, 4 * numBlocksX);
+    const plBCnEncoderQuality::Enum quality = settings.m_BCnQuality;
+
+    // Bias to shift signed data into unsigned range so we can treat it the same as unsigned
+    const plUInt8 bias = plImageFormat::GetDataType(sourceFormat) == plImageFormatDataType::SNORM ? 128 : 0;
+
+    const plUInt8* pSource = source.GetPtr();
+    plUInt8* pTarget = target.GetPtr();
+
+    plTaskSystem::ParallelForIndexed(0, numBlocksY, [pSource, pTarget, rowPitch, stride, numBlocksX, quality, bias](plUInt32 startIndex, plUInt32 endIndex) {
+      plDynamicArray<plUInt8> blocks;
+      blocks.SetCountUninitialized(numBlocksX * 16);
+
+      for (plUInt32 blockY = startIndex; blockY < endIndex; ++blockY)
+      {
+        plUInt8* pTargetRow = pTarget + blockY * numBlocksX * 16;
+
+        gatherChannelBlockRow(pSource, rowPitch, stride, 0, bias, blockY, numBlocksX, blocks.GetData());
+        encodeBC4(blocks.GetData(), pTargetRow, numBlocksX, 16, quality, bias);
+
+        gatherChannelBlockRow(pSource, rowPitch, stride, 1, bias, blockY, numBlocksX, blocks.GetData());
+        encodeBC4(blocks.GetData(), pTargetRow + 8, numBlocksX, 16, quality, bias);
+      }
+    });
+
+    return PL_SUCCESS;
+  }
+};
+
+// PL_STATICLINK_FORCE
+static plImageConversion_CompressBC1 s_conversion_compressBC1;
+static plImageConversion_CompressBC3 s_conversion_compressBC3;
+static plImageConversion_CompressBC4 s_conversion_compressBC4;
+static plImageConversion_CompressBC5 s_conversion_compressBC5;
+
+//////////////////////////////////////////////////////////////////////////
+
+void plBCnEncoder::EncodeBC1(const plColorBaseUB* pSource, plUInt8* pTarget, plUInt32 uiNumBlocks, plBCnEncoderQuality::Enum quality, bool bAllowTransparency)
+{
+  encodeBC1(pSource, pTarget, uiNumBlocks, 8, quality, bAllowTransparency, false);
+}
+
+void plBCnEncoder::EncodeBC3(const plColorBaseUB* pSource, plUInt8* pTarget, plUInt32 uiNumBlocks, plBCnEncoderQuality::Enum quality)
+{
+  encodeBC3(pSource, pTarget, uiNumBlocks, quality);
+}
+
+void plBCnEncoder::EncodeBC4(const plUInt8* pSource, plUInt8* pTarget, plUInt32 uiNumBlocks, plBCnEncoderQuality::Enum quality)
+{
+  encodeBC4(pSource, pTarget, uiNumBlocks, 8, quality, 0);
+}
+
+bool plBCnEncoder::IsNativeConversionStep(const plImageConversionStep* pStep)
+{
+  return pStep == &s_conversion_compressBC1 || pStep == &s_conversion_compressBC3 || pStep == &s_conversion_compressBC4 || pStep == &s_conversion_compressBC5;
+}
+
+PL_STATICLINK_FILE(Texture, Texture_Image_Conversions_BCnConversions);
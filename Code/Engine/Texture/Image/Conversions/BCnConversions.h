@@ -0,0 +1,24 @@
+#pragma once
+
+#include <Texture/Image/ImageConversion.h>
+
+/// \brief Native encoder for the BC1, BC3, BC4 and BC5 block compression formats.
+///
+/// The image conversion steps for these formats use this encoder with the quality from plImageConversionSettings::m_BCnQuality.
+/// All functions take uiNumBlocks blocks of 4x4 pixels each, stored one block after the other in row-major order,
+/// and write the compressed blocks tightly packed into pTarget.
+class PL_TEXTURE_DLL plBCnEncoder
+{
+public:
+  /// \brief Encodes RGBA blocks to BC1. If bAllowTransparency is set, pixels with alpha below 128 are encoded as transparent black.
+  static void EncodeBC1(const plColorBaseUB* pSource, plUInt8* pTarget, plUInt32 uiNumBlocks, plBCnEncoderQuality::Enum quality, bool bAllowTransparency = true);
+
+  /// \brief Encodes RGBA blocks to BC3.
+  static void EncodeBC3(const plColorBaseUB* pSource, plUInt8* pTarget, plUInt32 uiNumBlocks, plBCnEncoderQuality::Enum quality);
+
+  /// \brief Encodes single channel blocks to BC4 (UNORM). For SNORM data, add 128 to the input and subtract it from the two endpoint bytes.
+  static void EncodeBC4(const plUInt8* pSource, plUInt8* pTarget, plUInt32 uiNumBlocks, plBCnEncoderQuality::Enum quality);
+
+  /// \brief Returns whether the given conversion step is one of the BCn compression steps that use this encoder.
+  static bool IsNativeConversionStep(const plImageConversionStep* pStep);
+};
@@ -6,14 +6,6 @@
 #include <Texture/Image/Conversions/PixelConversions.h>
 #include <Texture/Image/ImageConversion.h>
 
-#if PL_SSE_LEVEL >= PL_SSE_41 && PL_SIMD_IMPLEMENTATION == PL_SIMD_IMPLEMENTATION_SSE
-#  define PL_SUPPORTS_BC4_COMPRESSOR
-
-#  include <emmintrin.h>
-#  include <smmintrin.h>
-#  include <tmmintrin.h>
-#endif
-
 void plDecompressBlockBC1(const plUInt8* pSource, plColorBaseUB* pTarget, bool bForceFourColorMode)
 {
   plUInt16 uiColor0 = pSource[0] | (pSource[1] << 8);
@@ -113,281 +105,6 @@ void plUnpackPaletteBC4(plUInt32 ui0, plUInt32 ui1, plUInt32* pAlphas)
 
 namespace
 {
-#if defined(PL_SUPPORTS_BC4_COMPRESSOR)
-  plUInt32 findBestPaletteIndexBC4(plInt32 iSourceValue, __m128i p0, __m128i p1)
-  {
-    __m128i source = _mm_set1_epi32(iSourceValue);
-
-    __m128i e0 = _mm_abs_epi32(_mm_sub_epi32(p0, source));
-    __m128i e1 = _mm_abs_epi32(_mm_sub_epi32(p1, source));
-
-    __m128i h0 = _mm_min_epi32(e0, _mm_shuffle_epi32(e0, _MM_SHUFFLE(1, 0, 3, 2)));
-    h0 = _mm_min_epi32(h0, _mm_shuffle_epi32(h0, _MM_SHUFFLE(2, 3, 0, 1)));
-
-    __m128i h1 = _mm_min_epi32(e1, _mm_shuffle_epi32(e1, _MM_SHUFFLE(1, 0, 3, 2)));
-    h1 = _mm_min_epi32(h1, _mm_shuffle_epi32(h1, _MM_SHUFFLE(2, 3, 0, 1)));
-
-    plUInt32 s0 = _mm_cvtsi128_si32(h0);
-    plUInt32 s1 = _mm_cvtsi128_si32(h1);
-
-    uint32_t offset;
-    __m128i min, minH;
-    if (s0 <= s1)
-    {
-      min = e0;
-      minH = h0;
-      offset = 0;
-    }
-    else
-    {
-      min = e1;
-      minH = h1;
-      offset = 4;
-    }
-
-    plUInt32 mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(min, minH)));
-
-    return plMath::FirstBitLow(mask) + offset;
-  }
-
-  void packBlockBC4(const plUInt8* pSourceData, plUInt32 ui0, plUInt32 ui1, plUInt8* pTargetData)
-  {
-    pTargetData[0] = plUInt8(ui0);
-    pTargetData[1] = plUInt8(ui1);
-
-    plUInt32 palette[8];
-    plUnpackPaletteBC4(ui0, ui1, palette);
-
-    __m128i p0, p1;
-    p0 = _mm_loadu_si128(reinterpret_cast<__m128i*>(palette + 0));
-    p1 = _mm_loadu_si128(reinterpret_cast<__m128i*>(palette + 4));
-
-    plUInt64 indices = 0;
-    for (plUInt32 idx = 0; idx < 16; ++idx)
-    {
-      indices |= plUInt64(findBestPaletteIndexBC4(pSourceData[idx], p0, p1)) << (3 * idx);
-    }
-
-    memcpy(pTargetData + 2, &indices, 6);
-  }
-
-  plUInt32 getSquaredErrorBC4_SSE(const plUInt8* pSourceData, const __m128i* pPaletteAndCopy)
-  {
-    // See getSquaredErrorBC4() for what we want to achieve (sum of lowest squared errors).
-    // Instead of converting to 32bit ints and actually computing squares, this function finds lowest absolute differences
-    // (between the input data and a color from the palette) for each input.
-    // Only then it actually expands them to integers, squares them and adds them together.
-
-    // pal0 contains the palette repeated twice.
-    // If we'll perform a vector op between src and pal0, src[0] will correspond to color[0] from the palette, src[1] to color[1], etc.
-    // Since the palette is stored twice, src[8] will correspond to color[0] again, etc.
-    // Below we generate 7 more rotations of this palette so that each input will correspond to each of 8 colors of palettes.
-    const __m128i pal0 = _mm_loadu_si128(pPaletteAndCopy);
-    const __m128i src = _mm_loadu_si128((__m128i*)pSourceData);
-
-    auto makeDiff = [&](__m128i pal) {
-      // Absolute difference is a difference between max and min of two numbers.
-      const __m128i max8 = _mm_max_epu8(src, pal);
-      const __m128i min8 = _mm_min_epu8(src, pal);
-      return _mm_sub_epi8(max8, min8); // Below we treat the result as unsigned.
-    };
-
-    // Unfortunately it can't be a loop, because:
-    // 1. last arg in _mm_alignr_epi8 must be a constant
-    // 2. rotating the result by 1 in each iteration creates a data dependency
-    // 3. VS2015 fails to unroll it properly and generates inefficient code.
-
-    const __m128i diff0 = makeDiff(pal0);
-    const __m128i diff1 = makeDiff(_mm_alignr_epi8(pal0, pal0, 1));
-    const __m128i diff2 = makeDiff(_mm_alignr_epi8(pal0, pal0, 2));
-    const __m128i diff3 = makeDiff(_mm_alignr_epi8(pal0, pal0, 3));
-    const __m128i diff4 = makeDiff(_mm_alignr_epi8(pal0, pal0, 4));
-    const __m128i diff5 = makeDiff(_mm_alignr_epi8(pal0, pal0, 5));
-    const __m128i diff6 = makeDiff(_mm_alignr_epi8(pal0, pal0, 6));
-    const __m128i diff7 = makeDiff(_mm_alignr_epi8(pal0, pal0, 7));
-
-    // Now we have absolute differences between each input and each color in the palette.
-    // We want to find the lowest one for each input.
-
-    const __m128i minDiff01 = _mm_min_epu8(diff0, diff1);
-    const __m128i minDiff23 = _mm_min_epu8(diff2, diff3);
-    const __m128i minDiff45 = _mm_min_epu8(diff4, diff5);
-    const __m128i minDiff67 = _mm_min_epu8(diff6, diff7);
-
-    const __m128i minDiff = _mm_min_epu8(_mm_min_epu8(minDiff01, minDiff23), _mm_min_epu8(minDiff45, minDiff67));
-
-    // Expands bytes to 32bit integers
-    const __m128i zero = _mm_setzero_si128();
-    const __m128i diff16Lo = _mm_unpacklo_epi8(minDiff, zero);
-    const __m128i diff16Hi = _mm_unpackhi_epi8(minDiff, zero);
-
-    auto square = [](__m128i input) { return _mm_mullo_epi32(input, input); };
-
-    const __m128i square0 = square(_mm_unpacklo_epi16(diff16Lo, zero));
-    const __m128i square1 = square(_mm_unpackhi_epi16(diff16Lo, zero));
-    const __m128i square2 = square(_mm_unpacklo_epi16(diff16Hi, zero));
-    const __m128i square3 = square(_mm_unpackhi_epi16(diff16Hi, zero));
-
-    // Adds all 16 squares together.
-    const __m128i sum4 = _mm_add_epi32(_mm_add_epi32(square0, square1), _mm_add_epi32(square2, square3));
-    const __m128i sum2 = _mm_hadd_epi32(sum4, sum4);
-    return _mm_cvtsi128_si32(_mm_hadd_epi32(sum2, sum2));
-  }
-
-  // The order of args is [3], [2], [1], [0]
-  static const __m128i div7_a0LoMultiplier = _mm_setr_epi32(5 * 2341, 6 * 2341, 0 * 2341, 7 * 2341);
-  static const __m128i div7_a0HiMultiplier = _mm_setr_epi32(1 * 2341, 2 * 2341, 3 * 2341, 4 * 2341);
-  static const __m128i div7_a1LoMultiplier = _mm_setr_epi32(2 * 2341, 1 * 2341, 7 * 2341, 0 * 2341);
-  static const __m128i div7_a1HiMultiplier = _mm_setr_epi32(6 * 2341, 5 * 2341, 4 * 2341, 3 * 2341);
-  static const __m128i div7_correctionAdd = _mm_setr_epi32(3 * 2341, 3 * 2341, 3 * 2341, 3 * 2341);
-
-  static const __m128i div5_a0LoMultiplier = _mm_setr_epi32(3 * 1639, 4 * 1639, 0 * 1639, 5 * 1639);
-  static const __m128i div5_a0HiMultiplier = _mm_setr_epi32(0, 0, 1 * 1639, 2 * 1639);
-  static const __m128i div5_a1LoMultiplier = _mm_setr_epi32(2 * 1639, 1 * 1639, 5 * 1639, 0);
-  static const __m128i div5_a1HiMultiplier = _mm_setr_epi32(0, 0, 4 * 1639, 3 * 1639);
-  static const __m128i div5_correctionAdd = _mm_setr_epi32(2 * 1639, 2 * 1639, 2 * 1639, 2 * 1639);
-  static const __m128i lastTwoAlphas_0_255 = _mm_setr_epi32(255, 0, 0, 0);
-
-  // Does the same thing as unpackPaletteBC4(), but stores the 8 result numbers twice as bytes
-  // (low 8 bytes of alphasAndAlphasCopy will be equal to high 8 bytes)
-  // See unpackPaletteBC4 for the explanation regarding magic numbers
-  void unpackPaletteBC4AsBytesTwice(plUInt32 ui0, plUInt32 ui1, __m128i* pAlphasAndAlphasCopy)
-  {
-    const __m128i v0 = _mm_set1_epi32(ui0);
-    const __m128i v1 = _mm_set1_epi32(ui1);
-    if (ui0 > ui1)
-    {
-      __m128i sumLo0 = _mm_mullo_epi32(v0, div7_a0LoMultiplier);
-      __m128i sumLo1 = _mm_mullo_epi32(v1, div7_a1LoMultiplier);
-      __m128i sumHi0 = _mm_mullo_epi32(v0, div7_a0HiMultiplier);
-      __m128i sumHi1 = _mm_mullo_epi32(v1, div7_a1HiMultiplier);
-      sumLo0 = _mm_add_epi32(div7_correctionAdd, sumLo0);
-      sumHi0 = _mm_add_epi32(div7_correctionAdd, sumHi0);
-      const __m128i sumLo = _mm_add_epi32(sumLo0, sumLo1);
-      const __m128i sumHi = _mm_add_epi32(sumHi0, sumHi1);
-      const __m128i resLo = _mm_srli_epi32(sumLo, 14);
-      const __m128i resHi = _mm_srli_epi32(sumHi, 14);
-
-      const __m128i res16 = _mm_packs_epi32(resLo, resHi);
-      _mm_storeu_si128(pAlphasAndAlphasCopy, _mm_packus_epi16(res16, res16));
-    }
-    else
-    {
-      __m128i sumLo0 = _mm_mullo_epi32(v0, div5_a0LoMultiplier);
-      __m128i sumHi0 = _mm_mullo_epi32(v0, div5_a0HiMultiplier);
-      __m128i sumLo1 = _mm_mullo_epi32(v1, div5_a1LoMultiplier);
-      __m128i sumHi1 = _mm_mullo_epi32(v1, div5_a1HiMultiplier);
-      sumLo0 = _mm_add_epi32(div5_correctionAdd, sumLo0);
-      sumHi0 = _mm_add_epi32(div5_correctionAdd, sumHi0);
-      const __m128i sumLo = _mm_add_epi32(sumLo0, sumLo1);
-      const __m128i sumHi = _mm_add_epi32(sumHi0, sumHi1);
-      const __m128i resHiIncomplete = _mm_srli_epi32(sumHi, 13);
-      const __m128i resLo = _mm_srli_epi32(sumLo, 13);
-      const __m128i resHi = _mm_add_epi32(resHiIncomplete, lastTwoAlphas_0_255);
-
-      const __m128i res16 = _mm_packs_epi32(resLo, resHi);
-      _mm_storeu_si128(pAlphasAndAlphasCopy, _mm_packus_epi16(res16, res16));
-    }
-  }
-
-  plUInt32 getSquaredErrorBC4_SSE(plUInt32 ui0, plUInt32 ui1, const plUInt8* pSourceData)
-  {
-    __m128i paletteAndCopy;
-    unpackPaletteBC4AsBytesTwice(plUInt8(ui0), plUInt8(ui1), &paletteAndCopy);
-    return getSquaredErrorBC4_SSE(pSourceData, &paletteAndCopy);
-  }
-
-  void findBestPaletteBC4(const plUInt8* pSourceData, plUInt32& ref_uiBestA0, plUInt32& ref_uiBestA1)
-  {
-    plInt32 minA = 255;
-    plInt32 maxA = 0;
-
-    plInt32 minA_greater8 = 247;
-    plInt32 maxA_less248 = 9;
-
-    for (plUInt32 idx = 0; idx < 16; ++idx)
-    {
-      plUInt32 value = pSourceData[idx];
-      minA = plMath::Min<plUInt32>(minA, value);
-      maxA = plMath::Max<plUInt32>(maxA, value);
-
-      if (value > 8 && value < 248)
-      {
-        minA_greater8 = plMath::Min<plUInt32>(minA_greater8, value);
-        maxA_less248 = plMath::Max<plUInt32>(maxA_less248, value);
-      }
-    }
-
-    // Palette covers range perfectly
-    if (maxA - minA < 8)
-    {
-      ref_uiBestA0 = maxA;
-      ref_uiBestA1 = minA;
-      return;
-    }
-
-    plUInt32 bestError = plUInt32(-1);
-    ref_uiBestA0 = plUInt32(-1);
-    ref_uiBestA1 = plUInt32(-1);
-
-    // Try to find optimal values by searching around min and max
-    {
-      plInt32 minA0 = plMath::Max(1, maxA - 4);
-      plInt32 maxA0 = plMath::Min(256, maxA + 8);
-      for (plInt32 a0 = minA0; a0 < maxA0; ++a0)
-      {
-        plInt32 minA1 = plMath::Max(0, minA - 8);
-        plInt32 maxA1 = plMath::Min(a0, minA + 4);
-        for (plInt32 a1 = minA1; a1 < maxA1; ++a1)
-        {
-          plUInt32 error = getSquaredErrorBC4_SSE(a0, a1, pSourceData);
-
-          if (error < bestError)
-          {
-            bestError = error;
-            ref_uiBestA0 = a0;
-            ref_uiBestA1 = a1;
-
-            if (error == 0)
-            {
-              return;
-            }
-          }
-        }
-      }
-    }
-
-    // If we have any values close to 0 or 255, try the flipped palette versions too, searching around the secondary min/max values
-    if (minA < 8 || maxA > 248)
-    {
-      plInt32 minA1 = maxA_less248 - 4;
-      plInt32 maxA1 = maxA_less248 + 8;
-      for (plInt32 a1 = minA1; a1 < maxA1; ++a1)
-      {
-        plInt32 minA0 = minA_greater8 - 8;
-        plInt32 maxA0 = plMath::Min(a1, minA_greater8 + 4);
-        for (plInt32 a0 = minA0; a0 < maxA0; ++a0)
-        {
-          plUInt32 error = getSquaredErrorBC4_SSE(a0, a1, pSourceData);
-
-          if (error < bestError)
-          {
-            bestError = error;
-            ref_uiBestA0 = a0;
-            ref_uiBestA1 = a1;
-
-            if (error == 0)
-            {
-              return;
-            }
-          }
-        }
-      }
-    }
-  }
-#endif
-
-
   // The following BC6 + BC7 decompression implementations were adapted from
   // https://github.com/Microsoft/DirectXTex/blob/master/DirectXTex/BC6HBC7.cpp
   static const plUInt32 s_bc67NumPixelsPerBlock = 16;
@@ -2920,147 +2637,6 @@ public:
   }
 };
 
-#if defined(PL_SUPPORTS_BC4_COMPRESSOR)
-class plImageConversion_CompressBC4 : public plImageConversionStepCompressBlocks
-{
-  virtual plArrayPtr<const plImageConversionEntry> GetSupportedConversions() const override
-  {
-    static plImageConversionEntry supportedConversions[] = {
-      plImageConversionEntry(plImageFormat::R8_UNORM, plImageFormat::BC4_UNORM, plImageConversionFlags::Default),
-      plImageConversionEntry(plImageFormat::R8_SNORM, plImageFormat::BC4_SNORM, plImageConversionFlags::Default),
-      plImageConversionEntry(plImageFormat::R8G8_UNORM, plImageFormat::BC4_UNORM, plImageConversionFlags::Default),
-      plImageConversionEntry(plImageFormat::R8G8_SNORM, plImageFormat::BC4_SNORM, plImageConversionFlags::Default),
-      plImageConversionEntry(plImageFormat::R8G8B8A8_UNORM, plImageFormat::BC4_UNORM, plImageConversionFlags::Default),
-      plImageConversionEntry(plImageFormat::R8G8B8A8_SNORM, plImageFormat::BC4_SNORM, plImageConversionFlags::Default),
-    };
-    return supportedConversions;
-  }
-
-  virtual plResult CompressBlocks(plConstByteBlobPtr source, plByteBlobPtr target, plUInt32 numBlocksX, plUInt32 numBlocksY,
-    plImageFormat::Enum sourceFormat, plImageFormat::Enum targetFormat) const override
-  {
-    PL_IGNORE_UNUSED(targetFormat);
-
-    plUInt32 stride = plImageFormat::GetBitsPerPixel(sourceFormat) / 8;
-    plUInt64 rowPitch = plImageFormat::GetRowPitch(sourceFormat, 4 * numBlocksX);
-
-    // Bias to shift signed data into unsigned range so we can treat it the same as unsigned
-    plUInt8 bias = 0;
-    if (plImageFormat::GetDataType(sourceFormat) == plImageFormatDataType::SNORM)
-    {
-      bias = 128;
-    }
-
-    for (plUInt32 blockY = 0; blockY < numBlocksY; ++blockY)
-    {
-      for (plUInt32 blockX = 0; blockX < numBlocksX; ++blockX)
-      {
-        plUInt8 sourceBlock[16];
-
-        for (plUInt32 y = 0; y < 4; ++y)
-        {
-          const plUInt8* sourcePointer = static_cast<const plUInt8*>(source.GetPtr()) + (4 * blockY + y) * rowPitch;
-
-          for (plUInt32 x = 0; x < 4; ++x)
-          {
-            sourceBlock[4 * y + x] = sourcePointer[(x + 4 * blockX) * stride] + bias;
-          }
-        }
-
-        plUInt32 a0, a1;
-        findBestPaletteBC4(sourceBlock, a0, a1);
-
-        plUInt8* targetPointer = static_cast<plUInt8*>(target.GetPtr()) + (blockY * numBlocksX + blockX) * 8;
-        packBlockBC4(sourceBlock, a0, a1, targetPointer);
-
-        targetPointer[0] -= bias;
-        targetPointer[1] -= bias;
-      }
-    }
-
-    return PL_SUCCESS;
-  }
-};
-
-class plImageConversion_CompressBC5 : public plImageConversionStepCompressBlocks
-{
-  virtual plArrayPtr<const plImageConversionEntry> GetSupportedConversions() const override
-  {
-    static plImageConversionEntry supportedConversions[] = {
-      plImageConversionEntry(plImageFormat::R8G8_UNORM, plImageFormat::BC5_UNORM, plImageConversionFlags::Default),
-      plImageConversionEntry(plImageFormat::R8G8_SNORM, plImageFormat::BC5_SNORM, plImageConversionFlags::Default),
-      plImageConversionEntry(plImageFormat::R8G8B8A8_UNORM, plImageFormat::BC5_UNORM, plImageConversionFlags::Default),
-      plImageConversionEntry(plImageFormat::R8G8B8A8_SNORM, plImageFormat::BC5_SNORM, plImageConversionFlags::Default),
-    };
-    return supportedConversions;
-  }
-
-  virtual plResult CompressBlocks(plConstByteBlobPtr source, plByteBlobPtr target, plUInt32 numBlocksX, plUInt32 numBlocksY,
-    plImageFormat::Enum sourceFormat, plImageFormat::Enum targetFormat) const override
-  {
-    PL_IGNORE_UNUSED(targetFormat);
-
-    plUInt32 stride = plImageFormat::GetBitsPerPixel(sourceFormat) / 8;
-    plUInt64 rowPitch = plImageFormat::GetRowPitch(sourceFormat, 4 * numBlocksX);
-
-    // Bias to shift signed data into unsigned range so we can treat it the same as unsigned
-    plUInt8 bias = 0;
-    if (plImageFormat::GetDataType(sourceFormat) == plImageFormatDataType::SNORM)
-    {
-      bias = 128;
-    }
-
-    for (plUInt32 blockY = 0; blockY < numBlocksY; ++blockY)
-    {
-      for (plUInt32 blockX = 0; blockX < numBlocksX; ++blockX)
-      {
-        plUInt8 sourceBlockR[16];
-        plUInt8 sourceBlockG[16];
-
-        for (plUInt32 y = 0; y < 4; ++y)
-        {
-          const plUInt8* sourcePointer = static_cast<const plUInt8*>(source.GetPtr()) + (4 * blockY + y) * rowPitch;
-
-          for (plUInt32 x = 0; x < 4; ++x)
-          {
-            sourceBlockR[4 * y + x] = sourcePointer[(x + 4 * blockX) * stride + 0] + bias;
-            sourceBlockG[4 * y + x] = sourcePointer[(x + 4 * blockX) * stride + 1] + bias;
-          }
-        }
-
-        plUInt8* targetPointer = static_cast<plUInt8*>(target.GetPtr()) + (blockY * numBlocksX + blockX) * 16;
-
-        {
-          plUInt32 a0, a1;
-          findBestPaletteBC4(sourceBlockR, a0, a1);
-          packBlockBC4(sourceBlockR, a0, a1, targetPointer);
-
-          // Undo biasing for signed formats by shifting palette upper and lower bound back into signed range
-          targetPointer[0] -= bias;
-          targetPointer[1] -= bias;
-        }
-
-        {
-          plUInt32 a0, a1;
-          findBestPaletteBC4(sourceBlockG, a0, a1);
-          packBlockBC4(sourceBlockG, a0, a1, targetPointer + 8);
-
-          // Undo biasing for signed formats by shifting palette upper and lower bound back into signed range
-          targetPointer[8] -= bias;
-          targetPointer[9] -= bias;
-        }
-      }
-    }
-
-    return PL_SUCCESS;
-  }
-};
-
-static plImageConversion_CompressBC4 s_conversion_compressBC4;
-static plImageConversion_CompressBC5 s_conversion_compressBC5;
-
-#endif
-
 // PL_STATICLINK_FORCE
 static plImageConversion_BC1_RGBA s_conversion_BC1_RGBA;
 static plImageConversion_BC2_RGBA s_conversion_BC2_RGBA;
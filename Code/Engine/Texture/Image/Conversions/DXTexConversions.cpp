@@ -322,8 +322,10 @@ public:
   }
 
   virtual plResult CompressBlocks(plConstByteBlobPtr source, plByteBlobPtr target, plUInt32 uiNumBlocksX, plUInt32 uiNumBlocksY,
-    plImageFormat::Enum sourceFormat, plImageFormat::Enum targetFormat) const override
+    plImageFormat::Enum sourceFormat, plImageFormat::Enum targetFormat, const plImageConversionSettings& settings) const override
   {
+    PL_IGNORE_UNUSED(settings);
+
     const plUInt32 targetWidth = uiNumBlocksX * plImageFormat::GetBlockWidth(targetFormat);
     const plUInt32 targetHeight = uiNumBlocksY * plImageFormat::GetBlockHeight(targetFormat);
 
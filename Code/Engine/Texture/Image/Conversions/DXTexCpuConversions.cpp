@@ -30,8 +30,10 @@ public:
   }
 
   virtual plResult CompressBlocks(plConstByteBlobPtr source, plByteBlobPtr target, plUInt32 numBlocksX, plUInt32 numBlocksY,
-    plImageFormat::Enum sourceFormat, plImageFormat::Enum targetFormat) const override
+    plImageFormat::Enum sourceFormat, plImageFormat::Enum targetFormat, const plImageConversionSettings& settings) const override
   {
+    PL_IGNORE_UNUSED(settings);
+
     if (targetFormat == plImageFormat::BC7_UNORM || targetFormat == plImageFormat::BC7_UNORM_SRGB)
     {
       const plUInt32 srcStride = numBlocksX * 4 * 4;
@@ -0,0 +1,951 @@
+#include <Texture/TexturePCH.h>
+
+#include <Foundation/Math/Float16.h>
+#include <Foundation/SimdMath/SimdTypes.h>
+#include <Foundation/System/SystemInformation.h>
+#include <Texture/Image/Conversions/PixelConversionKernels.h>
+
+#if PL_ENABLED(PL_PLATFORM_ARCH_X86) && PL_SIMD_IMPLEMENTATION == PL_SIMD_IMPLEMENTATION_SSE && PL_SSE_LEVEL >= PL_SSE_41
+#  define PL_PIXEL_KERNELS_X86 PL_ON
+#  include <immintrin.h>
+#  if PL_ENABLED(PL_COMPILER_MSVC)
+#    define PL_TARGET_AVX2
+#    define PL_TARGET_AVX512
+#  else
+// the AVX2 and AVX-512 kernels are compiled for their instruction set individually, the rest of the engine doesn't require it
+#    define PL_TARGET_AVX2 __attribute__((target("avx2")))
+#    define PL_TARGET_AVX512 __attribute__((target("avx2,avx512f,avx512bw")))
+#  endif
+#else
+#  define PL_PIXEL_KERNELS_X86 PL_OFF
+#endif
+
+using Kernel = plPixelConversionKernels::Kernel;
+using InstructionSet = plPixelConversionKernels::InstructionSet;
+using KernelFunc = plPixelConversionKernels::KernelFunc;
+using ElementType = plPixelConversionKernels::ElementType;
+using KernelInfo = plPixelConversionKernels::KernelInfo;
+
+namespace
+{
+  constexpr KernelInfo s_KernelInfos[] = {
+    {"U8ToF32", ElementType::Byte, 1, 4, 4},
+    {"F32ToU8", ElementType::Float, 4, 1, 4},
+    {"F16ToF32", ElementType::Half, 2, 4, 4},
+    {"F32ToF16", ElementType::Float, 4, 2, 4},
+    {"SrgbToF32", ElementType::Byte, 4, 16, 1},
+    {"F32ToSrgb", ElementType::Float, 16, 4, 1},
+    {"Swizzle2103", ElementType::Byte, 4, 4, 1},
+    {"R10G10B10A2ToF32", ElementType::Byte, 4, 16, 1},
+    {"F32ToR10G10B10A2", ElementType::Float, 16, 4, 1},
+  };
+
+  static_assert(PL_ARRAY_SIZE(s_KernelInfos) == (plUInt32)Kernel::ENUM_COUNT);
+
+  PL_ALWAYS_INLINE plUInt32 ColorFloatToUnorm(float fValue, float fMaxValue)
+  {
+    // same rounding as plMath::ColorFloatToByte
+    if (plMath::IsNaN(fValue))
+      return 0;
+
+    return static_cast<plUInt32>(plMath::Saturate(fValue) * fMaxValue + 0.5f);
+  }
+
+  PL_ALWAYS_INLINE float BitsToFloat(plUInt32 uiBits)
+  {
+    float fResult;
+    plMemoryUtils::RawByteCopy(&fResult, &uiBits, sizeof(float));
+    return fResult;
+  }
+
+  PL_ALWAYS_INLINE plUInt8 LinearToSrgbReference(float fLinear)
+  {
+    return plMath::ColorFloatToByte(plColor::LinearToGamma(fLinear));
+  }
+
+  // linear values below 2^-13 are always converted to zero, above that the buckets subdivide every power of two into 128 parts
+  constexpr plInt32 SrgbBucketMinBits = (127 - 13) << 23;
+  constexpr plUInt32 SrgbBucketShift = 23 - 7;
+  constexpr plUInt32 SrgbNumBuckets = (((127 << 23) - SrgbBucketMinBits) >> SrgbBucketShift) + 1;
+
+  struct SrgbTables
+  {
+    SrgbTables()
+    {
+      for (plUInt32 i = 0; i < 256; ++i)
+      {
+        m_ByteToFloat[i] = plColor::GammaToLinear(plMath::ColorByteToFloat(static_cast<plUInt8>(i)));
+        m_ByteToFloat[256 + i] = plMath::ColorByteToFloat(static_cast<plUInt8>(i));
+      }
+
+      PL_ASSERT_DEV(LinearToSrgbReference(0.0f) == 0 && LinearToSrgbReference(BitsToFloat(SrgbBucketMinBits)) == 0 && LinearToSrgbReference(1.0f) == 255, "Unexpected sRGB conversion result");
+
+      // the conversion is monotonic, so for every byte value search the smallest float in [0; 1] that maps to it
+      float thresholds[257];
+      thresholds[0] = 0.0f;
+      thresholds[256] = plMath::Infinity<float>();
+
+      for (plUInt32 i = 1; i < 256; ++i)
+      {
+        plUInt32 uiLow = 0;           // 0.0f
+        plUInt32 uiHigh = 0x3F800000; // 1.0f
+
+        while (uiLow < uiHigh)
+        {
+          const plUInt32 uiMid = uiLow + (uiHigh - uiLow) / 2;
+
+          if (LinearToSrgbReference(BitsToFloat(uiMid)) >= i)
+            uiHigh = uiMid;
+          else
+            uiLow = uiMid + 1;
+        }
+
+        thresholds[i] = BitsToFloat(uiLow);
+      }
+
+      // each bucket is narrow enough to contain at most one step to the next byte value
+      plUInt32 uiByte = 0;
+      for (plUInt32 uiBucket = 0; uiBucket < SrgbNumBuckets; ++uiBucket)
+      {
+        const float fBucketStart = BitsToFloat(SrgbBucketMinBits + (uiBucket << SrgbBucketShift));
+        while (fBucketStart >= thresholds[uiByte + 1])
+        {
+          ++uiByte;
+        }
+
+        const float fBucketEnd = BitsToFloat(SrgbBucketMinBits + ((uiBucket + 1) << SrgbBucketShift) - 1);
+        PL_ASSERT_DEV(uiByte == 255 || uiBucket + 1 == SrgbNumBuckets || fBucketEnd < thresholds[uiByte + 2], "sRGB bucket is too wide");
+        PL_IGNORE_UNUSED(fBucketEnd);
+
+        m_BucketBase[uiBucket] = static_cast<plInt32>(uiByte);
+        m_BucketThreshold[uiBucket] = thresholds[uiByte + 1];
+      }
+    }
+
+    /// [0; 255] maps sRGB bytes to linear floats, [256; 511] maps UNORM bytes to floats (for alpha)
+    float m_ByteToFloat[512];
+
+    /// The sRGB byte at the start of each bucket and the linear value at which the next byte starts.
+    plInt32 m_BucketBase[SrgbNumBuckets];
+    float m_BucketThreshold[SrgbNumBuckets];
+  };
+
+  const SrgbTables& GetSrgbTables()
+  {
+    static SrgbTables s_Tables;
+    return s_Tables;
+  }
+
+  PL_ALWAYS_INLINE plUInt8 LinearToSrgb(float fLinear, const SrgbTables& tables)
+  {
+    // NaN, negative values and -0 end up as +0 and everything above one as 255, just like with the reference conversion
+    fLinear = (fLinear > 0.0f) ? plMath::Min(fLinear, 1.0f) : 0.0f;
+
+    plInt32 iBits;
+    plMemoryUtils::RawByteCopy(&iBits, &fLinear, sizeof(float));
+
+    const plUInt32 uiBucket = static_cast<plUInt32>(plMath::Max(iBits - SrgbBucketMinBits, 0)) >> SrgbBucketShift;
+    return static_cast<plUInt8>(tables.m_BucketBase[uiBucket] + (fLinear >= tables.m_BucketThreshold[uiBucket] ? 1 : 0));
+  }
+
+  //////////////////////////////////////////////////////////////////////////
+  // Scalar
+
+  void U8ToF32_Scalar(const void* pSource, void* pTarget, plUInt64 uiNumElements)
+  {
+    const plUInt8* pSrc = static_cast<const plUInt8*>(pSource);
+    float* pDst = static_cast<float*>(pTarget);
+
+    for (plUInt64 i = 0; i < uiNumElements; ++i)
+    {
+      pDst[i] = plMath::ColorByteToFloat(pSrc[i]);
+    }
+  }
+
+  void F32ToU8_Scalar(const void* pSource, void* pTarget, plUInt64 uiNumElements)
+  {
+    const float* pSrc = static_cast<const float*>(pSource);
+    plUInt8* pDst = static_cast<plUInt8*>(pTarget);
+
+    for (plUInt64 i = 0; i < uiNumElements; ++i)
+    {
+      pDst[i] = plMath::ColorFloatToByte(pSrc[i]);
+    }
+  }
+
+  void F16ToF32_Scalar(const void* pSource, void* pTarget, plUInt64 uiNumElements)
+  {
+    const plFloat16* pSrc = static_cast<const plFloat16*>(pSource);
+    float* pDst = static_cast<float*>(pTarget);
+
+    for (plUInt64 i = 0; i < uiNumElements; ++i)
+    {
+      pDst[i] = pSrc[i];
+    }
+  }
+
+  void F32ToF16_Scalar(const void* pSource, void* pTarget, plUInt64 uiNumElements)
+  {
+    const float* pSrc = static_cast<const float*>(pSource);
+    plFloat16* pDst = static_cast<plFloat16*>(pTarget);
+
+    for (plUInt64 i = 0; i < uiNumElements; ++i)
+    {
+      pDst[i] = pSrc[i];
+    }
+  }
+
+  void SrgbToF32_Scalar(const void* pSource, void* pTarget, plUInt64 uiNumElements)
+  {
+    const float* pTable = GetSrgbTables().m_ByteToFloat;
+    const plUInt8* pSrc = static_cast<const plUInt8*>(pSource);
+    float* pDst = static_cast<float*>(pTarget);
+
+    for (plUInt64 i = 0; i < uiNumElements; ++i, pSrc += 4, pDst += 4)
+    {
+      pDst[0] = pTable[pSrc[0]];
+      pDst[1] = pTable[pSrc[1]];
+      pDst[2] = pTable[pSrc[2]];
+      pDst[3] = pTable[256 + pSrc[3]];
+    }
+  }
+
+  void F32ToSrgb_Scalar(const void* pSource, void* pTarget, plUInt64 uiNumElements)
+  {
+    const SrgbTables& tables = GetSrgbTables();
+    const float* pSrc = static_cast<const float*>(pSource);
+    plUInt8* pDst = static_cast<plUInt8*>(pTarget);
+
+    for (plUInt64 i = 0; i < uiNumElements; ++i, pSrc += 4, pDst += 4)
+    {
+      pDst[0] = LinearToSrgb(pSrc[0], tables);
+      pDst[1] = LinearToSrgb(pSrc[1], tables);
+      pDst[2] = LinearToSrgb(pSrc[2], tables);
+      pDst[3] = plMath::ColorFloatToByte(pSrc[3]);
+    }
+  }
+
+  void Swizzle2103_Scalar(const void* pSource, void* pTarget, plUInt64 uiNumElements)
+  {
+    const plUInt8* pSrc = static_cast<const plUInt8*>(pSource);
+    plUInt8* pDst = static_cast<plUInt8*>(pTarget);
+
+    for (plUInt64 i = 0; i < uiNumElements; ++i, pSrc += 4, pDst += 4)
+    {
+      const plUInt8 a = pSrc[2];
+      const plUInt8 b = pSrc[1];
+      const plUInt8 c = pSrc[0];
+      const plUInt8 d = pSrc[3];
+      pDst[0] = a;
+      pDst[1] = b;
+      pDst[2] = c;
+      pDst[3] = d;
+    }
+  }
+
+  void R10G10B10A2ToF32_Scalar(const void* pSource, void* pTarget, plUInt64 uiNumElements)
+  {
+    const plUInt8* pSrc = static_cast<const plUInt8*>(pSource);
+    float* pDst = static_cast<float*>(pTarget);
+
+    for (plUInt64 i = 0; i < uiNumElements; ++i, pSrc += 4, pDst += 4)
+    {
+      plUInt32 uiPixel;
+      plMemoryUtils::RawByteCopy(&uiPixel, pSrc, sizeof(plUInt32));
+
+      pDst[0] = static_cast<float>(uiPixel & 0x3FF) * (1.0f / 1023.0f);
+      pDst[1] = static_cast<float>((uiPixel >> 10) & 0x3FF) * (1.0f / 1023.0f);
+      pDst[2] = static_cast<float>((uiPixel >> 20) & 0x3FF) * (1.0f / 1023.0f);
+      pDst[3] = static_cast<float>(uiPixel >> 30) * (1.0f / 3.0f);
+    }
+  }
+
+  void F32ToR10G10B10A2_Scalar(const void* pSource, void* pTarget, plUInt64 uiNumElements)
+  {
+    const float* pSrc = static_cast<const float*>(pSource);
+    plUInt8* pDst = static_cast<plUInt8*>(pTarget);
+
+    for (plUInt64 i = 0; i < uiNumElements; ++i, pSrc += 4, pDst += 4)
+    {
+      const plUInt32 uiPixel = ColorFloatToUnorm(pSrc[0], 1023.0f) | (ColorFloatToUnorm(pSrc[1], 1023.0f) << 10) |
+                               (ColorFloatToUnorm(pSrc[2], 1023.0f) << 20) | (ColorFloatToUnorm(pSrc[3], 3.0f) << 30);
+
+      plMemoryUtils::RawByteCopy(pDst, &uiPixel, sizeof(plUInt32));
+    }
+  }
+
+#if PL_ENABLED(PL_PIXEL_KERNELS_X86)
+
+  //////////////////////////////////////////////////////////////////////////
+  // SSE4.1
+
+  void U8ToF32_SSE41(const void* pSource, void* pTarget, plUInt64 uiNumElements)
+  {
+    const plUInt8* pSrc = static_cast<const plUInt8*>(pSource);
+    float* pDst = static_cast<float*>(pTarget);
+
+    const __m128 scale = _mm_set1_ps(1.0f / 255.0f);
+
+    for (; uiNumElements >= 16; uiNumElements -= 16, pSrc += 16, pDst += 16)
+    {
+      const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc));
+
+      _mm_storeu_ps(pDst + 0, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(bytes)), scale));
+      _mm_storeu_ps(pDst + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(bytes, 4))), scale));
+      _mm_storeu_ps(pDst + 8, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(bytes, 8))), scale));
+      _mm_storeu_ps(pDst + 12, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(bytes, 12))), scale));
+    }
+
+    U8ToF32_Scalar(pSrc, pDst, uiNumElements);
+  }
+
+  PL_ALWAYS_INLINE __m128i FloatToUnorm_SSE41(__m128 value, __m128 scale)
+  {
+    const __m128 zero = _mm_setzero_ps();
+
+    // Clamp NaN to zero
+    value = _mm_and_ps(_mm_cmpord_ps(value, zero), value);
+
+    // Saturate
+    value = _mm_max_ps(zero, _mm_min_ps(_mm_set1_ps(1.0f), value));
+
+    // Add 0.5f and truncate for rounding as required by D3D spec
+    return _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(value, scale), _mm_set1_ps(0.5f)));
+  }
+
+  void F32ToU8_SSE41(const void* pSource, void* pTarget, plUInt64 uiNumElements)
+  {
+    const float* pSrc = static_cast<const float*>(pSource);
+    plUInt8* pDst = static_cast<plUInt8*>(pTarget);
+
+    const __m128 scale = _mm_set1_ps(255.0f);
+
+    for (; uiNumElements >= 16; uiNumElements -= 16, pSrc += 16, pDst += 16)
+    {
+      const __m128i int0 = FloatToUnorm_SSE41(_mm_loadu_ps(pSrc + 0), scale);
+      const __m128i int1 = FloatToUnorm_SSE41(_mm_loadu_ps(pSrc + 4), scale);
+      const __m128i int2 = FloatToUnorm_SSE41(_mm_loadu_ps(pSrc + 8), scale);
+      const __m128i int3 = FloatToUnorm_SSE41(_mm_loadu_ps(pSrc + 12), scale);
+
+      const __m128i short0 = _mm_packs_epi32(int0, int1);
+      const __m128i short1 = _mm_packs_epi32(int2, int3);
+
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst), _mm_packus_epi16(short0, short1));
+    }
+
+    F32ToU8_Scalar(pSrc, pDst, uiNumElements);
+  }
+
+  void F16ToF32_SSE41(const void* pSource, void* pTarget, plUInt64 uiNumElements)
+  {
+    const plUInt16* pSrc = static_cast<const plUInt16*>(pSource);
+    float* pDst = static_cast<float*>(pTarget);
+
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i infExponent = _mm_set1_epi32(0x7C00);
+    const __m128i exponentBias = _mm_set1_epi32((127 - 15) << 23);
+
+    for (; uiNumElements >= 4; uiNumElements -= 4, pSrc += 4, pDst += 4)
+    {
+      const __m128i half = _mm_cvtepu16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(pSrc)));
+      const __m128i sign = _mm_slli_epi32(_mm_and_si128(half, _mm_set1_epi32(0x8000)), 16);
+      const __m128i abs = _mm_and_si128(half, _mm_set1_epi32(0x7FFF));
+      const __m128i exponent = _mm_and_si128(half, infExponent);
+
+      const __m128i isZero = _mm_cmpeq_epi32(abs, zero);
+      const __m128i isNormal = _mm_andnot_si128(_mm_or_si128(_mm_cmpeq_epi32(exponent, zero), _mm_cmpeq_epi32(exponent, infExponent)), _mm_set1_epi32(-1));
+
+      // denormals, infinity and NaN are rare, let the scalar code deal with them
+      if (_mm_movemask_ps(_mm_castsi128_ps(_mm_or_si128(isZero, isNormal))) != 0xF)
+      {
+        F16ToF32_Scalar(pSrc, pDst, 4);
+        continue;
+      }
+
+      const __m128i magnitude = _mm_andnot_si128(isZero, _mm_add_epi32(_mm_slli_epi32(abs, 13), exponentBias));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst), _mm_or_si128(sign, magnitude));
+    }
+
+    F16ToF32_Scalar(pSrc, pDst, uiNumElements);
+  }
+
+  void F32ToF16_SSE41(const void* pSource, void* pTarget, plUInt64 uiNumElements)
+  {
+    const float* pSrc = static_cast<const float*>(pSource);
+    plUInt16* pDst = static_cast<plUInt16*>(pTarget);
+
+    const __m128i normalMin = _mm_set1_epi32((113 << 23) - 1);
+    const __m128i normalMax = _mm_set1_epi32(143 << 23);
+    const __m128i flushMax = _mm_set1_epi32(102 << 23);
+    const __m128i exponentBias = _mm_set1_epi32((127 - 15) << 10);
+
+    for (; uiNumElements >= 4; uiNumElements -= 4, pSrc += 4, pDst += 4)
+    {
+      const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc));
+      const __m128i abs = _mm_and_si128(value, _mm_set1_epi32(0x7FFFFFFF));
+      const __m128i sign = _mm_and_si128(_mm_srli_epi32(value, 16), _mm_set1_epi32(0x8000));
+
+      // values that are representable as normalized halfs, and values that are so small that they are flushed to zero
+      const __m128i isNormal = _mm_and_si128(_mm_cmpgt_epi32(abs, normalMin), _mm_cmplt_epi32(abs, normalMax));
+      const __m128i isFlushed = _mm_cmplt_epi32(abs, flushMax);
+
+      // denormals, overflow, infinity and NaN take the scalar path
+      if (_mm_movemask_ps(_mm_castsi128_ps(_mm_or_si128(isNormal, isFlushed))) != 0xF)
+      {
+        F32ToF16_Scalar(pSrc, pDst, 4);
+        continue;
+      }
+
+      const __m128i half = _mm_andnot_si128(isFlushed, _mm_or_si128(sign, _mm_sub_epi32(_mm_srli_epi32(abs, 13), exponentBias)));
+      _mm_storel_epi64(reinterpret_cast<__m128i*>(pDst), _mm_packus_epi32(half, half));
+    }
+
+    F32ToF16_Scalar(pSrc, pDst, uiNumElements);
+  }
+
+  void Swizzle2103_SSE41(const void* pSource, void* pTarget, plUInt64 uiNumElements)
+  {
+    const plUInt8* pSrc = static_cast<const plUInt8*>(pSource);
+    plUInt8* pDst = static_cast<plUInt8*>(pTarget);
+
+    // Intel optimization manual, Color Pixel Format Conversion Using SSE3
+    const __m128i shuffleMask = _mm_set_epi8(15, 12, 13, 14, 11, 8, 9, 10, 7, 4, 5, 6, 3, 0, 1, 2);
+
+    for (; uiNumElements >= 8; uiNumElements -= 8, pSrc += 32, pDst += 32)
+    {
+      const __m128i in0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc) + 0);
+      const __m128i in1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc) + 1);
+
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst) + 0, _mm_shuffle_epi8(in0, shuffleMask));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst) + 1, _mm_shuffle_epi8(in1, shuffleMask));
+    }
+
+    Swizzle2103_Scalar(pSrc, pDst, uiNumElements);
+  }
+
+  //////////////////////////////////////////////////////////////////////////
+  // AVX2
+
+  PL_TARGET_AVX2 void U8ToF32_AVX2(const void* pSource, void* pTarget, plUInt64 uiNumElements)
+  {
+    const plUInt8* pSrc = static_cast<const plUInt8*>(pSource);
+    float* pDst = static_cast<float*>(pTarget);
+
+    const __m256 scale = _mm256_set1_ps(1.0f / 255.0f);
+
+    for (; uiNumElements >= 16; uiNumElements -= 16, pSrc += 16, pDst += 16)
+    {
+      const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc));
+
+      _mm256_storeu_ps(pDst + 0, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(bytes)), scale));
+      _mm256_storeu_ps(pDst + 8, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(bytes, 8))), scale));
+    }
+
+    U8ToF32_Scalar(pSrc, pDst, uiNumElements);
+  }
+
+  PL_TARGET_AVX2 PL_ALWAYS_INLINE __m256i FloatToUnorm_AVX2(__m256 value, __m256 scale)
+  {
+    const __m256 zero = _mm256_setzero_ps();
+
+    value = _mm256_and_ps(_mm256_cmp_ps(value, zero, _CMP_ORD_Q), value);
+    value = _mm256_max_ps(zero, _mm256_min_ps(_mm256_set1_ps(1.0f), value));
+
+    return _mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(value, scale), _mm256_set1_ps(0.5f)));
+  }
+
+  PL_TARGET_AVX2 void F32ToU8_AVX2(const void* pSource, void* pTarget, plUInt64 uiNumElements)
+  {
+    const float* pSrc = static_cast<const float*>(pSource);
+    plUInt8* pDst = static_cast<plUInt8*>(pTarget);
+
+    const __m256 scale = _mm256_set1_ps(255.0f);
+
+    // the packs work per 128 bit lane, this restores the original element order
+    const __m256i laneOrder = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+    for (; uiNumElements >= 32; uiNumElements -= 32, pSrc += 32, pDst += 32)
+    {
+      const __m256i int0 = FloatToUnorm_AVX2(_mm256_loadu_ps(pSrc + 0), scale);
+      const __m256i int1 = FloatToUnorm_AVX2(_mm256_loadu_ps(pSrc + 8), scale);
+      const __m256i int2 = FloatToUnorm_AVX2(_mm256_loadu_ps(pSrc + 16), scale);
+      const __m256i int3 = FloatToUnorm_AVX2(_mm256_loadu_ps(pSrc + 24), scale);
+
+      const __m256i short0 = _mm256_packs_epi32(int0, int1);
+      const __m256i short1 = _mm256_packs_epi32(int2, int3);
+
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(pDst), _mm256_permutevar8x32_epi32(_mm256_packus_epi16(short0, short1), laneOrder));
+    }
+
+    F32ToU8_SSE41(pSrc, pDst, uiNumElements);
+  }
+
+  PL_TARGET_AVX2 void F16ToF32_AVX2(const void* pSource, void* pTarget, plUInt64 uiNumElements)
+  {
+    const plUInt16* pSrc = static_cast<const plUInt16*>(pSource);
+    float* pDst = static_cast<float*>(pTarget);
+
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i infExponent = _mm256_set1_epi32(0x7C00);
+    const __m256i exponentBias = _mm256_set1_epi32((127 - 15) << 23);
+
+    for (; uiNumElements >= 8; uiNumElements -= 8, pSrc += 8, pDst += 8)
+    {
+      const __m256i half = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc)));
+      const __m256i sign = _mm256_slli_epi32(_mm256_and_si256(half, _mm256_set1_epi32(0x8000)), 16);
+      const __m256i abs = _mm256_and_si256(half, _mm256_set1_epi32(0x7FFF));
+      const __m256i exponent = _mm256_and_si256(half, infExponent);
+
+      const __m256i isZero = _mm256_cmpeq_epi32(abs, zero);
+      const __m256i isSpecial = _mm256_or_si256(_mm256_cmpeq_epi32(exponent, zero), _mm256_cmpeq_epi32(exponent, infExponent));
+
+      if (_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_andnot_si256(isZero, isSpecial))) != 0)
+      {
+        F16ToF32_Scalar(pSrc, pDst, 8);
+        continue;
+      }
+
+      const __m256i magnitude = _mm256_andnot_si256(isZero, _mm256_add_epi32(_mm256_slli_epi32(abs, 13), exponentBias));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(pDst), _mm256_or_si256(sign, magnitude));
+    }
+
+    F16ToF32_SSE41(pSrc, pDst, uiNumElements);
+  }
+
+  PL_TARGET_AVX2 void F32ToF16_AVX2(const void* pSource, void* pTarget, plUInt64 uiNumElements)
+  {
+    const float* pSrc = static_cast<const float*>(pSource);
+    plUInt16* pDst = static_cast<plUInt16*>(pTarget);
+
+    const __m256i normalMin = _mm256_set1_epi32((113 << 23) - 1);
+    const __m256i normalMax = _mm256_set1_epi32(143 << 23);
+    const __m256i flushMax = _mm256_set1_epi32(102 << 23);
+    const __m256i exponentBias = _mm256_set1_epi32((127 - 15) << 10);
+
+    for (; uiNumElements >= 8; uiNumElements -= 8, pSrc += 8, pDst += 8)
+    {
+      const __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSrc));
+      const __m256i abs = _mm256_and_si256(value, _mm256_set1_epi32(0x7FFFFFFF));
+      const __m256i sign = _mm256_and_si256(_mm256_srli_epi32(value, 16), _mm256_set1_epi32(0x8000));
+
+      const __m256i isNormal = _mm256_and_si256(_mm256_cmpgt_epi32(abs, normalMin), _mm256_cmpgt_epi32(normalMax, abs));
+      const __m256i isFlushed = _mm256_cmpgt_epi32(flushMax, abs);
+
+      if (_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_or_si256(isNormal, isFlushed))) != 0xFF)
+      {
+        F32ToF16_Scalar(pSrc, pDst, 8);
+        continue;
+      }
+
+      const __m256i half = _mm256_andnot_si256(isFlushed, _mm256_or_si256(sign, _mm256_sub_epi32(_mm256_srli_epi32(abs, 13), exponentBias)));
+      const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(half, half), 0x08);
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst), _mm256_castsi256_si128(packed));
+    }
+
+    F32ToF16_SSE41(pSrc, pDst, uiNumElements);
+  }
+
+  PL_TARGET_AVX2 void SrgbToF32_AVX2(const void* pSource, void* pTarget, plUInt64 uiNumElements)
+  {
+    const float* pTable = GetSrgbTables().m_ByteToFloat;
+    const plUInt8* pSrc = static_cast<const plUInt8*>(pSource);
+    float* pDst = static_cast<float*>(pTarget);
+
+    // alpha is looked up in the second half of the table, which holds the plain UNORM values
+    const __m256i alphaOffset = _mm256_setr_epi32(0, 0, 0, 256, 0, 0, 0, 256);
+
+    for (; uiNumElements >= 2; uiNumElements -= 2, pSrc += 8, pDst += 8)
+    {
+      const __m256i indices = _mm256_add_epi32(_mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(pSrc))), alphaOffset);
+      _mm256_storeu_ps(pDst, _mm256_i32gather_ps(pTable, indices, 4));
+    }
+
+    SrgbToF32_Scalar(pSrc, pDst, uiNumElements);
+  }
+
+  PL_TARGET_AVX2 void F32ToSrgb_AVX2(const void* pSource, void* pTarget, plUInt64 uiNumElements)
+  {
+    const SrgbTables& tables = GetSrgbTables();
+    const float* pSrc = static_cast<const float*>(pSource);
+    plUInt8* pDst = static_cast<plUInt8*>(pTarget);
+
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 scale = _mm256_set1_ps(255.0f);
+    const __m256i bucketMinBits = _mm256_set1_epi32(SrgbBucketMinBits);
+    const __m256i alphaMask = _mm256_setr_epi32(0, 0, 0, -1, 0, 0, 0, -1);
+
+    for (; uiNumElements >= 2; uiNumElements -= 2, pSrc += 8, pDst += 8)
+    {
+      __m256 value = _mm256_loadu_ps(pSrc);
+      value = _mm256_and_ps(_mm256_cmp_ps(value, zero, _CMP_ORD_Q), value);
+      // max returns its second operand for -0, which has to be +0 for the bucket computation
+      value = _mm256_max_ps(_mm256_min_ps(_mm256_set1_ps(1.0f), value), zero);
+
+      const __m256i bucket = _mm256_srli_epi32(_mm256_max_epi32(_mm256_sub_epi32(_mm256_castps_si256(value), bucketMinBits), _mm256_setzero_si256()), SrgbBucketShift);
+      const __m256i base = _mm256_i32gather_epi32(tables.m_BucketBase, bucket, 4);
+      const __m256 threshold = _mm256_i32gather_ps(tables.m_BucketThreshold, bucket, 4);
+
+      // the comparison mask is -1 where the value reaches the next byte
+      const __m256i index = _mm256_sub_epi32(base, _mm256_castps_si256(_mm256_cmp_ps(value, threshold, _CMP_GE_OQ)));
+
+      const __m256i alpha = _mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(value, scale), _mm256_set1_ps(0.5f)));
+      const __m256i result = _mm256_blendv_epi8(index, alpha, alphaMask);
+
+      __m256i packed = _mm256_packus_epi32(result, result);
+      packed = _mm256_packus_epi16(packed, packed);
+
+      const plUInt32 uiPixel0 = static_cast<plUInt32>(_mm_cvtsi128_si32(_mm256_castsi256_si128(packed)));
+      const plUInt32 uiPixel1 = static_cast<plUInt32>(_mm_cvtsi128_si32(_mm256_extracti128_si256(packed, 1)));
+      plMemoryUtils::RawByteCopy(pDst + 0, &uiPixel0, sizeof(plUInt32));
+      plMemoryUtils::RawByteCopy(pDst + 4, &uiPixel1, sizeof(plUInt32));
+    }
+
+    F32ToSrgb_Scalar(pSrc, pDst, uiNumElements);
+  }
+
+  PL_TARGET_AVX2 void Swizzle2103_AVX2(const void* pSource, void* pTarget, plUInt64 uiNumElements)
+  {
+    const plUInt8* pSrc = static_cast<const plUInt8*>(pSource);
+    plUInt8* pDst = static_cast<plUInt8*>(pTarget);
+
+    const __m256i shuffleMask = _mm256_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15, 2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+
+    for (; uiNumElements >= 16; uiNumElements -= 16, pSrc += 64, pDst += 64)
+    {
+      const __m256i in0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSrc) + 0);
+      const __m256i in1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSrc) + 1);
+
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(pDst) + 0, _mm256_shuffle_epi8(in0, shuffleMask));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(pDst) + 1, _mm256_shuffle_epi8(in1, shuffleMask));
+    }
+
+    Swizzle2103_SSE41(pSrc, pDst, uiNumElements);
+  }
+
+  PL_TARGET_AVX2 void R10G10B10A2ToF32_AVX2(const void* pSource, void* pTarget, plUInt64 uiNumElements)
+  {
+    const plUInt8* pSrc = static_cast<const plUInt8*>(pSource);
+    float* pDst = static_cast<float*>(pTarget);
+
+    const __m256i broadcast = _mm256_setr_epi32(0, 0, 0, 0, 1, 1, 1, 1);
+    const __m256i shift = _mm256_setr_epi32(0, 10, 20, 30, 0, 10, 20, 30);
+    const __m256i mask = _mm256_setr_epi32(0x3FF, 0x3FF, 0x3FF, 0x3, 0x3FF, 0x3FF, 0x3FF, 0x3);
+    const __m256 scale = _mm256_setr_ps(1.0f / 1023.0f, 1.0f / 1023.0f, 1.0f / 1023.0f, 1.0f / 3.0f, 1.0f / 1023.0f, 1.0f / 1023.0f, 1.0f / 1023.0f, 1.0f / 3.0f);
+
+    for (; uiNumElements >= 2; uiNumElements -= 2, pSrc += 8, pDst += 8)
+    {
+      const __m256i pixels = _mm256_permutevar8x32_epi32(_mm256_castsi128_si256(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(pSrc))), broadcast);
+      const __m256i channels = _mm256_and_si256(_mm256_srlv_epi32(pixels, shift), mask);
+
+      _mm256_storeu_ps(pDst, _mm256_mul_ps(_mm256_cvtepi32_ps(channels), scale));
+    }
+
+    R10G10B10A2ToF32_Scalar(pSrc, pDst, uiNumElements);
+  }
+
+  PL_TARGET_AVX2 void F32ToR10G10B10A2_AVX2(const void* pSource, void* pTarget, plUInt64 uiNumElements)
+  {
+    const float* pSrc = static_cast<const float*>(pSource);
+    plUInt8* pDst = static_cast<plUInt8*>(pTarget);
+
+    const __m256i shift = _mm256_setr_epi32(0, 10, 20, 30, 0, 10, 20, 30);
+    const __m256 scale = _mm256_setr_ps(1023.0f, 1023.0f, 1023.0f, 3.0f, 1023.0f, 1023.0f, 1023.0f, 3.0f);
+
+    for (; uiNumElements >= 2; uiNumElements -= 2, pSrc += 8, pDst += 8)
+    {
+      __m256i channels = _mm256_sllv_epi32(FloatToUnorm_AVX2(_mm256_loadu_ps(pSrc), scale), shift);
+
+      // combine the four channels of each pixel into its first element
+      channels = _mm256_or_si256(channels, _mm256_shuffle_epi32(channels, _MM_SHUFFLE(2, 3, 0, 1)));
+      channels = _mm256_or_si256(channels, _mm256_shuffle_epi32(channels, _MM_SHUFFLE(1, 0, 3, 2)));
+
+      const plUInt32 uiPixel0 = static_cast<plUInt32>(_mm_cvtsi128_si32(_mm256_castsi256_si128(channels)));
+      const plUInt32 uiPixel1 = static_cast<plUInt32>(_mm_cvtsi128_si32(_mm256_extracti128_si256(channels, 1)));
+      plMemoryUtils::RawByteCopy(pDst + 0, &uiPixel0, sizeof(plUInt32));
+      plMemoryUtils::RawByteCopy(pDst + 4, &uiPixel1, sizeof(plUInt32));
+    }
+
+    F32ToR10G10B10A2_Scalar(pSrc, pDst, uiNumElements);
+  }
+
+  //////////////////////////////////////////////////////////////////////////
+  // AVX-512
+
+  PL_TARGET_AVX512 void U8ToF32_AVX512(const void* pSource, void* pTarget, plUInt64 uiNumElements)
+  {
+    const plUInt8* pSrc = static_cast<const plUInt8*>(pSource);
+    float* pDst = static_cast<float*>(pTarget);
+
+    const __m512 scale = _mm512_set1_ps(1.0f / 255.0f);
+
+    for (; uiNumElements >= 32; uiNumElements -= 32, pSrc += 32, pDst += 32)
+    {
+      const __m128i bytes0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc) + 0);
+      const __m128i bytes1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc) + 1);
+
+      _mm512_storeu_ps(pDst + 0, _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(bytes0)), scale));
+      _mm512_storeu_ps(pDst + 16, _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(bytes1)), scale));
+    }
+
+    U8ToF32_AVX2(pSrc, pDst, uiNumElements);
+  }
+
+  PL_TARGET_AVX512 void F32ToU8_AVX512(const void* pSource, void* pTarget, plUInt64 uiNumElements)
+  {
+    const float* pSrc = static_cast<const float*>(pSource);
+    plUInt8* pDst = static_cast<plUInt8*>(pTarget);
+
+    const __m512 zero = _mm512_setzero_ps();
+    const __m512 one = _mm512_set1_ps(1.0f);
+    const __m512 scale = _mm512_set1_ps(255.0f);
+    const __m512 half = _mm512_set1_ps(0.5f);
+
+    for (; uiNumElements >= 16; uiNumElements -= 16, pSrc += 16, pDst += 16)
+    {
+      __m512 value = _mm512_loadu_ps(pSrc);
+      value = _mm512_maskz_mov_ps(_mm512_cmp_ps_mask(value, zero, _CMP_ORD_Q), value);
+      value = _mm512_max_ps(zero, _mm512_min_ps(one, value));
+
+      // the explicitly rounded operations keep the compiler from fusing them into an FMA, which would round differently
+      value = _mm512_mul_round_ps(value, scale, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+      value = _mm512_add_round_ps(value, half, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst), _mm512_cvtepi32_epi8(_mm512_cvttps_epi32(value)));
+    }
+
+    F32ToU8_AVX2(pSrc, pDst, uiNumElements);
+  }
+
+  PL_TARGET_AVX512 void F16ToF32_AVX512(const void* pSource, void* pTarget, plUInt64 uiNumElements)
+  {
+    const plUInt16* pSrc = static_cast<const plUInt16*>(pSource);
+    float* pDst = static_cast<float*>(pTarget);
+
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i infExponent = _mm512_set1_epi32(0x7C00);
+    const __m512i exponentBias = _mm512_set1_epi32((127 - 15) << 23);
+
+    for (; uiNumElements >= 16; uiNumElements -= 16, pSrc += 16, pDst += 16)
+    {
+      const __m512i half = _mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSrc)));
+      const __m512i sign = _mm512_slli_epi32(_mm512_and_si512(half, _mm512_set1_epi32(0x8000)), 16);
+      const __m512i abs = _mm512_and_si512(half, _mm512_set1_epi32(0x7FFF));
+      const __m512i exponent = _mm512_and_si512(half, infExponent);
+
+      const __mmask16 isZero = _mm512_cmpeq_epi32_mask(abs, zero);
+      const __mmask16 isNormal = _mm512_cmpneq_epi32_mask(exponent, zero) & _mm512_cmpneq_epi32_mask(exponent, infExponent);
+
+      if (static_cast<plUInt16>(isZero | isNormal) != 0xFFFF)
+      {
+        F16ToF32_Scalar(pSrc, pDst, 16);
+        continue;
+      }
+
+      const __m512i magnitude = _mm512_maskz_add_epi32(isNormal, _mm512_slli_epi32(abs, 13), exponentBias);
+      _mm512_storeu_si512(pDst, _mm512_or_si512(sign, magnitude));
+    }
+
+    F16ToF32_AVX2(pSrc, pDst, uiNumElements);
+  }
+
+  PL_TARGET_AVX512 void F32ToF16_AVX512(const void* pSource, void* pTarget, plUInt64 uiNumElements)
+  {
+    const float* pSrc = static_cast<const float*>(pSource);
+    plUInt16* pDst = static_cast<plUInt16*>(pTarget);
+
+    const __m512i normalMin = _mm512_set1_epi32(113 << 23);
+    const __m512i normalMax = _mm512_set1_epi32(143 << 23);
+    const __m512i flushMax = _mm512_set1_epi32(102 << 23);
+    const __m512i exponentBias = _mm512_set1_epi32((127 - 15) << 10);
+
+    for (; uiNumElements >= 16; uiNumElements -= 16, pSrc += 16, pDst += 16)
+    {
+      const __m512i value = _mm512_loadu_si512(pSrc);
+      const __m512i abs = _mm512_and_si512(value, _mm512_set1_epi32(0x7FFFFFFF));
+      const __m512i sign = _mm512_and_si512(_mm512_srli_epi32(value, 16), _mm512_set1_epi32(0x8000));
+
+      const __mmask16 isNormal = _mm512_cmpge_epi32_mask(abs, normalMin) & _mm512_cmplt_epi32_mask(abs, normalMax);
+      const __mmask16 isFlushed = _mm512_cmplt_epi32_mask(abs, flushMax);
+
+      if (static_cast<plUInt16>(isNormal | isFlushed) != 0xFFFF)
+      {
+        F32ToF16_Scalar(pSrc, pDst, 16);
+        continue;
+      }
+
+      const __m512i half = _mm512_maskz_or_epi32(isNormal, sign, _mm512_sub_epi32(_mm512_srli_epi32(abs, 13), exponentBias));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(pDst), _mm512_cvtepi32_epi16(half));
+    }
+
+    F32ToF16_AVX2(pSrc, pDst, uiNumElements);
+  }
+
+  PL_TARGET_AVX512 void Swizzle2103_AVX512(const void* pSource, void* pTarget, plUInt64 uiNumElements)
+  {
+    const plUInt8* pSrc = static_cast<const plUInt8*>(pSource);
+    plUInt8* pDst = static_cast<plUInt8*>(pTarget);
+
+    const __m512i shuffleMask = _mm512_broadcast_i32x4(_mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15));
+
+    for (; uiNumElements >= 16; uiNumElements -= 16, pSrc += 64, pDst += 64)
+    {
+      _mm512_storeu_si512(pDst, _mm512_shuffle_epi8(_mm512_loadu_si512(pSrc), shuffleMask));
+    }
+
+    Swizzle2103_SSE41(pSrc, pDst, uiNumElements);
+  }
+
+#endif
+
+  //////////////////////////////////////////////////////////////////////////
+
+  struct KernelDispatch
+  {
+    KernelDispatch()
+    {
+      auto Register = [this](Kernel kernel, InstructionSet instructionSet, KernelFunc func)
+      { m_Implementations[(plUInt32)kernel][(plUInt32)instructionSet] = func; };
+
+      Register(Kernel::U8ToF32, InstructionSet::Scalar, &U8ToF32_Scalar);
+      Register(Kernel::F32ToU8, InstructionSet::Scalar, &F32ToU8_Scalar);
+      Register(Kernel::F16ToF32, InstructionSet::Scalar, &F16ToF32_Scalar);
+      Register(Kernel::F32ToF16, InstructionSet::Scalar, &F32ToF16_Scalar);
+      Register(Kernel::SrgbToF32, InstructionSet::Scalar, &SrgbToF32_Scalar);
+      Register(Kernel::F32ToSrgb, InstructionSet::Scalar, &F32ToSrgb_Scalar);
+      Register(Kernel::Swizzle2103, InstructionSet::Scalar, &Swizzle2103_Scalar);
+      Register(Kernel::R10G10B10A2ToF32, InstructionSet::Scalar, &R10G10B10A2ToF32_Scalar);
+      Register(Kernel::F32ToR10G10B10A2, InstructionSet::Scalar, &F32ToR10G10B10A2_Scalar);
+
+      m_Supported = InstructionSet::Scalar;
+
+#if PL_ENABLED(PL_PIXEL_KERNELS_X86)
+      Register(Kernel::U8ToF32, InstructionSet::SSE41, &U8ToF32_SSE41);
+      Register(Kernel::F32ToU8, InstructionSet::SSE41, &F32ToU8_SSE41);
+      Register(Kernel::F16ToF32, InstructionSet::SSE41, &F16ToF32_SSE41);
+      Register(Kernel::F32ToF16, InstructionSet::SSE41, &F32ToF16_SSE41);
+      Register(Kernel::Swizzle2103, InstructionSet::SSE41, &Swizzle2103_SSE41);
+
+      Register(Kernel::U8ToF32, InstructionSet::AVX2, &U8ToF32_AVX2);
+      Register(Kernel::F32ToU8, InstructionSet::AVX2, &F32ToU8_AVX2);
+      Register(Kernel::F16ToF32, InstructionSet::AVX2, &F16ToF32_AVX2);
+      Register(Kernel::F32ToF16, InstructionSet::AVX2, &F32ToF16_AVX2);
+      Register(Kernel::SrgbToF32, InstructionSet::AVX2, &SrgbToF32_AVX2);
+      Register(Kernel::F32ToSrgb, InstructionSet::AVX2, &F32ToSrgb_AVX2);
+      Register(Kernel::Swizzle2103, InstructionSet::AVX2, &Swizzle2103_AVX2);
+      Register(Kernel::R10G10B10A2ToF32, InstructionSet::AVX2, &R10G10B10A2ToF32_AVX2);
+      Register(Kernel::F32ToR10G10B10A2, InstructionSet::AVX2, &F32ToR10G10B10A2_AVX2);
+
+      Register(Kernel::U8ToF32, InstructionSet::AVX512, &U8ToF32_AVX512);
+      Register(Kernel::F32ToU8, InstructionSet::AVX512, &F32ToU8_AVX512);
+      Register(Kernel::F16ToF32, InstructionSet::AVX512, &F16ToF32_AVX512);
+      Register(Kernel::F32ToF16, InstructionSet::AVX512, &F32ToF16_AVX512);
+      Register(Kernel::Swizzle2103, InstructionSet::AVX512, &Swizzle2103_AVX512);
+
+      // the build already requires SSE4.1
+      m_Supported = InstructionSet::SSE41;
+
+      const plCpuFeatures& features = plSystemInformation::Get().GetCpuFeatures();
+
+      if (features.IsAvx2Available())
+      {
+        m_Supported = InstructionSet::AVX2;
+
+        if (features.OS_AVX512 && features.HW_AVX512_F && features.HW_AVX512_BW)
+        {
+          m_Supported = InstructionSet::AVX512;
+        }
+      }
+#endif
+
+      Select(m_Supported);
+    }
+
+    void Select(InstructionSet maxInstructionSet)
+    {
+      m_Max = plMath::Min(maxInstructionSet, m_Supported);
+
+      for (plUInt32 k = 0; k < (plUInt32)Kernel::ENUM_COUNT; ++k)
+      {
+        // not every kernel has an implementation for every instruction set, fall back to the next best one
+        for (plInt32 i = (plInt32)m_Max; i >= 0; --i)
+        {
+          if (m_Implementations[k][i] != nullptr)
+          {
+            m_Selected[k] = m_Implementations[k][i];
+            break;
+          }
+        }
+      }
+    }
+
+    InstructionSet m_Supported = InstructionSet::Scalar;
+    InstructionSet m_Max = InstructionSet::Scalar;
+    KernelFunc m_Implementations[(plUInt32)Kernel::ENUM_COUNT][(plUInt32)InstructionSet::ENUM_COUNT] = {};
+    KernelFunc m_Selected[(plUInt32)Kernel::ENUM_COUNT] = {};
+  };
+
+  KernelDispatch& GetDispatch()
+  {
+    static KernelDispatch s_Dispatch;
+    return s_Dispatch;
+  }
+} // namespace
+
+plPixelConversionKernels::KernelFunc plPixelConversionKernels::GetKernel(Kernel kernel)
+{
+  return GetDispatch().m_Selected[(plUInt32)kernel];
+}
+
+plPixelConversionKernels::KernelFunc plPixelConversionKernels::GetKernel(Kernel kernel, InstructionSet instructionSet)
+{
+  const KernelDispatch& dispatch = GetDispatch();
+
+  if (instructionSet > dispatch.m_Supported)
+    return nullptr;
+
+  return dispatch.m_Implementations[(plUInt32)kernel][(plUInt32)instructionSet];
+}
+
+plPixelConversionKernels::InstructionSet plPixelConversionKernels::GetSupportedInstructionSet()
+{
+  return GetDispatch().m_Supported;
+}
+
+void plPixelConversionKernels::SetMaxInstructionSet(InstructionSet instructionSet)
+{
+  GetDispatch().Select(instructionSet);
+}
+
+plPixelConversionKernels::InstructionSet plPixelConversionKernels::GetMaxInstructionSet()
+{
+  return GetDispatch().m_Max;
+}
+
+const plPixelConversionKernels::KernelInfo& plPixelConversionKernels::GetKernelInfo(Kernel kernel)
+{
+  return s_KernelInfos[(plUInt32)kernel];
+}
+
+const char* plPixelConversionKernels::GetKernelName(Kernel kernel)
+{
+  return s_KernelInfos[(plUInt32)kernel].m_szName;
+}
+
+const char* plPixelConversionKernels::GetInstructionSetName(InstructionSet instructionSet)
+{
+  switch (instructionSet)
+  {
+    case InstructionSet::Scalar:
+      return "Scalar";
+    case InstructionSet::SSE41:
+      return "SSE4.1";
+    case InstructionSet::AVX2:
+      return "AVX2";
+    case InstructionSet::AVX512:
+      return "AVX-512";
+
+      PL_DEFAULT_CASE_NOT_IMPLEMENTED;
+  }
+
+  return "";
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <Texture/TextureDLL.h>
+
+/// \brief Bulk conversion routines for the most common uncompressed pixel formats.
+///
+/// Each kernel exists as a portable scalar implementation and, on x86, additionally as SSE4.1, AVX2 and / or AVX-512 versions.
+/// The fastest version that the CPU supports is selected once, the first time any kernel is requested.
+/// All versions of a kernel produce bit-identical results, so the selected instruction set never changes the output.
+///
+/// The image conversion steps in PixelConversions.cpp use these kernels, so usually there is no need to call them directly.
+class PL_TEXTURE_DLL plPixelConversionKernels
+{
+public:
+  /// \brief The available kernels. The comment states what a single element is for the respective kernel.
+  enum class Kernel : plUInt8
+  {
+    U8ToF32,          ///< One channel, UNORM byte to float.
+    F32ToU8,          ///< One channel, float to UNORM byte.
+    F16ToF32,         ///< One channel, half to float.
+    F32ToF16,         ///< One channel, float to half.
+    SrgbToF32,        ///< One pixel, R8G8B8A8_UNORM_SRGB to linear R32G32B32A32_FLOAT.
+    F32ToSrgb,        ///< One pixel, linear R32G32B32A32_FLOAT to R8G8B8A8_UNORM_SRGB.
+    Swizzle2103,      ///< One pixel, swaps the first and third byte (RGBA8 <-> BGRA8). Source and target may be identical.
+    R10G10B10A2ToF32, ///< One pixel, R10G10B10A2_UNORM to R32G32B32A32_FLOAT.
+    F32ToR10G10B10A2, ///< One pixel, R32G32B32A32_FLOAT to R10G10B10A2_UNORM.
+
+    ENUM_COUNT
+  };
+
+  enum class InstructionSet : plUInt8
+  {
+    Scalar,
+    SSE41,
+    AVX2,
+    AVX512,
+
+    ENUM_COUNT
+  };
+
+  /// \brief The type of the values that a kernel reads.
+  enum class ElementType : plUInt8
+  {
+    Byte,
+    Half,
+    Float,
+  };
+
+  /// \brief Describes the elements that a kernel converts.
+  struct KernelInfo
+  {
+    const char* m_szName;
+    ElementType m_SourceType;
+    plUInt8 m_uiSourceSize;       ///< The size of a single source element in bytes.
+    plUInt8 m_uiTargetSize;       ///< The size of a single target element in bytes.
+    plUInt8 m_uiElementsPerPixel; ///< The number of elements in one RGBA pixel, i.e. 4 for the single channel kernels.
+  };
+
+  /// \brief Converts uiNumElements elements from pSource to pTarget. Neither pointer needs to be aligned.
+  using KernelFunc = void (*)(const void* pSource, void* pTarget, plUInt64 uiNumElements);
+
+  /// \brief Returns the fastest implementation of the kernel for this CPU.
+  static KernelFunc GetKernel(Kernel kernel);
+
+  /// \brief Returns the implementation of the kernel that uses exactly the given instruction set.
+  ///
+  /// Returns nullptr, if there is no such implementation or the CPU doesn't support the instruction set.
+  static KernelFunc GetKernel(Kernel kernel, InstructionSet instructionSet);
+
+  /// \brief Returns the best instruction set that is supported by the CPU and the build.
+  static InstructionSet GetSupportedInstructionSet();
+
+  /// \brief Restricts the implementations returned by GetKernel() to the given instruction set and below.
+  ///
+  /// This is meant for debugging and profiling and must not be called while conversions are running on other threads.
+  static void SetMaxInstructionSet(InstructionSet instructionSet);
+
+  /// \brief Returns the instruction set that GetKernel() currently picks from.
+  static InstructionSet GetMaxInstructionSet();
+
+  static const KernelInfo& GetKernelInfo(Kernel kernel);
+  static const char* GetKernelName(Kernel kernel);
+  static const char* GetInstructionSetName(InstructionSet instructionSet);
+};
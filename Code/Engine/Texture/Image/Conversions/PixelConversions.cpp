@@ -1,6 +1,7 @@
 #include <Texture/TexturePCH.h>
 
 #include <Foundation/Math/Float16.h>
+#include <Texture/Image/Conversions/PixelConversionKernels.h>
 #include <Texture/Image/Conversions/PixelConversions.h>
 #include <Texture/Image/ImageConversion.h>
 
@@ -8,10 +9,6 @@
 #  include <emmintrin.h>
 #endif
 
-#if PL_SIMD_IMPLEMENTATION == PL_SIMD_IMPLEMENTATION_SSE && PL_SSE_LEVEL >= PL_SSE_30
-#  include <tmmintrin.h>
-#endif
-
 namespace
 {
   // 3D vector: 11/11/10 floating-point components
@@ -281,74 +278,8 @@ struct plImageSwizzleConversion32_2103 : public plImageConversionStepLinear
   {
     PL_IGNORE_UNUSED(sourceFormat);
     PL_IGNORE_UNUSED(targetFormat);
-    plUInt32 sourceStride = 4;
-    plUInt32 targetStride = 4;
-
-    const void* sourcePointer = source.GetPtr();
-    void* targetPointer = target.GetPtr();
-
-#if PL_SIMD_IMPLEMENTATION == PL_SIMD_IMPLEMENTATION_SSE
-    if (IsAligned(sourcePointer) && IsAligned(targetPointer))
-    {
-#  if PL_SSE_LEVEL >= PL_SSE_30
-      const plUInt32 elementsPerBatch = 8;
-
-      __m128i shuffleMask = _mm_set_epi8(15, 12, 13, 14, 11, 8, 9, 10, 7, 4, 5, 6, 3, 0, 1, 2);
-
-      // Intel optimization manual, Color Pixel Format Conversion Using SSE3
-      while (uiNumElements >= elementsPerBatch)
-      {
-        __m128i in0 = reinterpret_cast<const __m128i*>(sourcePointer)[0];
-        __m128i in1 = reinterpret_cast<const __m128i*>(sourcePointer)[1];
-
-        reinterpret_cast<__m128i*>(targetPointer)[0] = _mm_shuffle_epi8(in0, shuffleMask);
-        reinterpret_cast<__m128i*>(targetPointer)[1] = _mm_shuffle_epi8(in1, shuffleMask);
-
-        sourcePointer = plMemoryUtils::AddByteOffset(sourcePointer, sourceStride * elementsPerBatch);
-        targetPointer = plMemoryUtils::AddByteOffset(targetPointer, targetStride * elementsPerBatch);
-        uiNumElements -= elementsPerBatch;
-      }
-#  else
-      const plUInt32 elementsPerBatch = 8;
 
-      __m128i mask1 = _mm_set1_epi32(0xff00ff00);
-      __m128i mask2 = _mm_set1_epi32(0x00ff00ff);
-
-      // Intel optimization manual, Color Pixel Format Conversion Using SSE2
-      while (numElements >= elementsPerBatch)
-      {
-        __m128i in0 = reinterpret_cast<const __m128i*>(sourcePointer)[0];
-        __m128i in1 = reinterpret_cast<const __m128i*>(sourcePointer)[1];
-
-        reinterpret_cast<__m128i*>(targetPointer)[0] =
-          _mm_or_si128(_mm_and_si128(in0, mask1), _mm_and_si128(_mm_or_si128(_mm_slli_epi32(in0, 16), _mm_srli_epi32(in0, 16)), mask2));
-        reinterpret_cast<__m128i*>(targetPointer)[1] =
-          _mm_or_si128(_mm_and_si128(in1, mask1), _mm_and_si128(_mm_or_si128(_mm_slli_epi32(in1, 16), _mm_srli_epi32(in1, 16)), mask2));
-
-        sourcePointer = plMemoryUtils::AddByteOffset(sourcePointer, sourceStride * elementsPerBatch);
-        targetPointer = plMemoryUtils::AddByteOffset(targetPointer, targetStride * elementsPerBatch);
-        numElements -= elementsPerBatch;
-      }
-#  endif
-    }
-#endif
-
-    while (uiNumElements)
-    {
-      plUInt8 a, b, c, d;
-      a = reinterpret_cast<const plUInt8*>(sourcePointer)[2];
-      b = reinterpret_cast<const plUInt8*>(sourcePointer)[1];
-      c = reinterpret_cast<const plUInt8*>(sourcePointer)[0];
-      d = reinterpret_cast<const plUInt8*>(sourcePointer)[3];
-      reinterpret_cast<plUInt8*>(targetPointer)[0] = a;
-      reinterpret_cast<plUInt8*>(targetPointer)[1] = b;
-      reinterpret_cast<plUInt8*>(targetPointer)[2] = c;
-      reinterpret_cast<plUInt8*>(targetPointer)[3] = d;
-
-      sourcePointer = plMemoryUtils::AddByteOffset(sourcePointer, sourceStride);
-      targetPointer = plMemoryUtils::AddByteOffset(targetPointer, targetStride);
-      uiNumElements--;
-    }
+    plPixelConversionKernels::GetKernel(plPixelConversionKernels::Kernel::Swizzle2103)(source.GetPtr(), target.GetPtr(), uiNumElements);
 
     return PL_SUCCESS;
   }
@@ -440,77 +371,7 @@ public:
     // Work with single channels instead of pixels
     uiNumElements *= plImageFormat::GetBitsPerPixel(targetFormat) / 8;
 
-    plUInt32 sourceStride = 4;
-    plUInt32 targetStride = 1;
-
-    const void* sourcePointer = source.GetPtr();
-    void* targetPointer = target.GetPtr();
-
-#if PL_SIMD_IMPLEMENTATION == PL_SIMD_IMPLEMENTATION_SSE && PL_SSE_LEVEL >= PL_SSE_20
-    {
-      const plUInt32 elementsPerBatch = 16;
-
-      __m128 zero = _mm_setzero_ps();
-      __m128 one = _mm_set1_ps(1.0f);
-      __m128 scale = _mm_set1_ps(255.0f);
-      __m128 half = _mm_set1_ps(0.5f);
-
-      while (uiNumElements >= elementsPerBatch)
-      {
-        __m128 float0 = _mm_loadu_ps(static_cast<const float*>(sourcePointer) + 0);
-        __m128 float1 = _mm_loadu_ps(static_cast<const float*>(sourcePointer) + 4);
-        __m128 float2 = _mm_loadu_ps(static_cast<const float*>(sourcePointer) + 8);
-        __m128 float3 = _mm_loadu_ps(static_cast<const float*>(sourcePointer) + 12);
-
-        // Clamp NaN to zero
-        float0 = _mm_and_ps(_mm_cmpord_ps(float0, zero), float0);
-        float1 = _mm_and_ps(_mm_cmpord_ps(float1, zero), float1);
-        float2 = _mm_and_ps(_mm_cmpord_ps(float2, zero), float2);
-        float3 = _mm_and_ps(_mm_cmpord_ps(float3, zero), float3);
-
-        // Saturate
-        float0 = _mm_max_ps(zero, _mm_min_ps(one, float0));
-        float1 = _mm_max_ps(zero, _mm_min_ps(one, float1));
-        float2 = _mm_max_ps(zero, _mm_min_ps(one, float2));
-        float3 = _mm_max_ps(zero, _mm_min_ps(one, float3));
-
-        float0 = _mm_mul_ps(float0, scale);
-        float1 = _mm_mul_ps(float1, scale);
-        float2 = _mm_mul_ps(float2, scale);
-        float3 = _mm_mul_ps(float3, scale);
-
-        // Add 0.5f and truncate for rounding as required by D3D spec
-        float0 = _mm_add_ps(float0, half);
-        float1 = _mm_add_ps(float1, half);
-        float2 = _mm_add_ps(float2, half);
-        float3 = _mm_add_ps(float3, half);
-
-        __m128i int0 = _mm_cvttps_epi32(float0);
-        __m128i int1 = _mm_cvttps_epi32(float1);
-        __m128i int2 = _mm_cvttps_epi32(float2);
-        __m128i int3 = _mm_cvttps_epi32(float3);
-
-        __m128i short0 = _mm_packs_epi32(int0, int1);
-        __m128i short1 = _mm_packs_epi32(int2, int3);
-
-        _mm_storeu_si128(reinterpret_cast<__m128i*>(targetPointer), _mm_packus_epi16(short0, short1));
-
-        sourcePointer = plMemoryUtils::AddByteOffset(sourcePointer, sourceStride * elementsPerBatch);
-        targetPointer = plMemoryUtils::AddByteOffset(targetPointer, targetStride * elementsPerBatch);
-        uiNumElements -= elementsPerBatch;
-      }
-    }
-#endif
-
-    while (uiNumElements)
-    {
-
-      *reinterpret_cast<plUInt8*>(targetPointer) = plMath::ColorFloatToByte(*reinterpret_cast<const float*>(sourcePointer));
-
-      sourcePointer = plMemoryUtils::AddByteOffset(sourcePointer, sourceStride);
-      targetPointer = plMemoryUtils::AddByteOffset(targetPointer, targetStride);
-      uiNumElements--;
-    }
+    plPixelConversionKernels::GetKernel(plPixelConversionKernels::Kernel::F32ToU8)(source.GetPtr(), target.GetPtr(), uiNumElements);
 
     return PL_SUCCESS;
   }
@@ -533,20 +394,7 @@ public:
     PL_IGNORE_UNUSED(sourceFormat);
     PL_IGNORE_UNUSED(targetFormat);
 
-    plUInt32 sourceStride = 16;
-    plUInt32 targetStride = 4;
-
-    const void* sourcePointer = source.GetPtr();
-    void* targetPointer = target.GetPtr();
-
-    while (uiNumElements)
-    {
-      *reinterpret_cast<plColorGammaUB*>(targetPointer) = *reinterpret_cast<const plColor*>(sourcePointer);
-
-      sourcePointer = plMemoryUtils::AddByteOffset(sourcePointer, sourceStride);
-      targetPointer = plMemoryUtils::AddByteOffset(targetPointer, targetStride);
-      uiNumElements--;
-    }
+    plPixelConversionKernels::GetKernel(plPixelConversionKernels::Kernel::F32ToSrgb)(source.GetPtr(), target.GetPtr(), uiNumElements);
 
     return PL_SUCCESS;
   }
@@ -615,21 +463,7 @@ public:
     // Work with single channels instead of pixels
     uiNumElements *= plImageFormat::GetBitsPerPixel(targetFormat) / 16;
 
-    plUInt32 sourceStride = 4;
-    plUInt32 targetStride = 2;
-
-    const void* sourcePointer = source.GetPtr();
-    void* targetPointer = target.GetPtr();
-
-    while (uiNumElements)
-    {
-
-      *reinterpret_cast<plFloat16*>(targetPointer) = *reinterpret_cast<const float*>(sourcePointer);
-
-      sourcePointer = plMemoryUtils::AddByteOffset(sourcePointer, sourceStride);
-      targetPointer = plMemoryUtils::AddByteOffset(targetPointer, targetStride);
-      uiNumElements--;
-    }
+    plPixelConversionKernels::GetKernel(plPixelConversionKernels::Kernel::F32ToF16)(source.GetPtr(), target.GetPtr(), uiNumElements);
 
     return PL_SUCCESS;
   }
@@ -699,20 +533,7 @@ public:
     // Work with single channels instead of pixels
     uiNumElements *= plImageFormat::GetBitsPerPixel(targetFormat) / 32;
 
-    plUInt32 sourceStride = 1;
-    plUInt32 targetStride = 4;
-
-    const void* sourcePointer = source.GetPtr();
-    void* targetPointer = target.GetPtr();
-
-    while (uiNumElements)
-    {
-      *reinterpret_cast<float*>(targetPointer) = plMath::ColorByteToFloat(*reinterpret_cast<const plUInt8*>(sourcePointer));
-
-      sourcePointer = plMemoryUtils::AddByteOffset(sourcePointer, sourceStride);
-      targetPointer = plMemoryUtils::AddByteOffset(targetPointer, targetStride);
-      uiNumElements--;
-    }
+    plPixelConversionKernels::GetKernel(plPixelConversionKernels::Kernel::U8ToF32)(source.GetPtr(), target.GetPtr(), uiNumElements);
 
     return PL_SUCCESS;
   }
@@ -735,20 +556,7 @@ public:
     PL_IGNORE_UNUSED(sourceFormat);
     PL_IGNORE_UNUSED(targetFormat);
 
-    plUInt32 sourceStride = 4;
-    plUInt32 targetStride = 16;
-
-    const void* sourcePointer = source.GetPtr();
-    void* targetPointer = target.GetPtr();
-
-    while (uiNumElements)
-    {
-      *reinterpret_cast<plColor*>(targetPointer) = *reinterpret_cast<const plColorGammaUB*>(sourcePointer);
-
-      sourcePointer = plMemoryUtils::AddByteOffset(sourcePointer, sourceStride);
-      targetPointer = plMemoryUtils::AddByteOffset(targetPointer, targetStride);
-      uiNumElements--;
-    }
+    plPixelConversionKernels::GetKernel(plPixelConversionKernels::Kernel::SrgbToF32)(source.GetPtr(), target.GetPtr(), uiNumElements);
 
     return PL_SUCCESS;
   }
@@ -856,20 +664,53 @@ public:
     // Work with single channels instead of pixels
     uiNumElements *= plImageFormat::GetBitsPerPixel(targetFormat) / 32;
 
-    plUInt32 sourceStride = 2;
-    plUInt32 targetStride = 4;
+    plPixelConversionKernels::GetKernel(plPixelConversionKernels::Kernel::F16ToF32)(source.GetPtr(), target.GetPtr(), uiNumElements);
 
-    const void* sourcePointer = source.GetPtr();
-    void* targetPointer = target.GetPtr();
+    return PL_SUCCESS;
+  }
+};
 
-    while (uiNumElements)
-    {
-      *reinterpret_cast<float*>(targetPointer) = *reinterpret_cast<const plFloat16*>(sourcePointer);
+class plImageConversion_R10G10B10A2_F32 : public plImageConversionStepLinear
+{
+public:
+  virtual plArrayPtr<const plImageConversionEntry> GetSupportedConversions() const override
+  {
+    static plImageConversionEntry supportedConversions[] = {
+      plImageConversionEntry(plImageFormat::R10G10B10A2_UNORM, plImageFormat::R32G32B32A32_FLOAT, plImageConversionFlags::Default),
+    };
+    return supportedConversions;
+  }
 
-      sourcePointer = plMemoryUtils::AddByteOffset(sourcePointer, sourceStride);
-      targetPointer = plMemoryUtils::AddByteOffset(targetPointer, targetStride);
-      uiNumElements--;
-    }
+  virtual plResult ConvertPixels(plConstByteBlobPtr source, plByteBlobPtr target, plUInt64 uiNumElements, plImageFormat::Enum sourceFormat,
+    plImageFormat::Enum targetFormat) const override
+  {
+    PL_IGNORE_UNUSED(sourceFormat);
+    PL_IGNORE_UNUSED(targetFormat);
+
+    plPixelConversionKernels::GetKernel(plPixelConversionKernels::Kernel::R10G10B10A2ToF32)(source.GetPtr(), target.GetPtr(), uiNumElements);
+
+    return PL_SUCCESS;
+  }
+};
+
+class plImageConversion_F32_R10G10B10A2 : public plImageConversionStepLinear
+{
+public:
+  virtual plArrayPtr<const plImageConversionEntry> GetSupportedConversions() const override
+  {
+    static plImageConversionEntry supportedConversions[] = {
+      plImageConversionEntry(plImageFormat::R32G32B32A32_FLOAT, plImageFormat::R10G10B10A2_UNORM, plImageConversionFlags::Default),
+    };
+    return supportedConversions;
+  }
+
+  virtual plResult ConvertPixels(plConstByteBlobPtr source, plByteBlobPtr target, plUInt64 uiNumElements, plImageFormat::Enum sourceFormat,
+    plImageFormat::Enum targetFormat) const override
+  {
+    PL_IGNORE_UNUSED(sourceFormat);
+    PL_IGNORE_UNUSED(targetFormat);
+
+    plPixelConversionKernels::GetKernel(plPixelConversionKernels::Kernel::F32ToR10G10B10A2)(source.GetPtr(), target.GetPtr(), uiNumElements);
 
     return PL_SUCCESS;
   }
@@ -1611,6 +1452,8 @@ static plImageConversion_U16_F32 s_conversion_U16_F32;
 static plImageConversion_S16_F32 s_conversion_S16_F32;
 static plImageConversion_F16_F32 s_conversion_F16_F32;
 static plImageConversion_S8_F32 s_conversion_S8_F32;
+static plImageConversion_R10G10B10A2_F32 s_conversion_R10G10B10A2_F32;
+static plImageConversion_F32_R10G10B10A2 s_conversion_F32_R10G10B10A2;
 static plImageConversion_UINT8_F32 s_conversion_UINT8_F32;
 static plImageConversion_SINT8_F32 s_conversion_SINT8_F32;
 static plImageConversion_UINT16_F32 s_conversion_UINT16_F32;
@@ -123,8 +123,10 @@ struct plDdsCaps2
 static const plUInt32 plDdsMagic = 0x20534444;
 static const plUInt32 plDdsDxt10FourCc = 0x30315844;
 
-static plResult ReadImageData(plStreamReader& inout_stream, plImageHeader& ref_imageHeader, plDdsHeader& ref_ddsHeader)
+static plResult ReadImageData(plStreamReader& inout_stream, plImageHeader& ref_imageHeader, plDdsHeader& ref_ddsHeader, plUInt32& out_uiHeaderSize)
 {
+  out_uiHeaderSize = sizeof(plDdsHeader);
+
   if (inout_stream.ReadBytes(&ref_ddsHeader, sizeof(plDdsHeader)) != sizeof(plDdsHeader))
   {
     plLog::Error("Failed to read file header.");
@@ -204,8 +206,15 @@ static plResult ReadImageData(plStreamReader& inout_stream, plImageHeader& ref_i
         return PL_FAILURE;
       }
 
+      out_uiHeaderSize += sizeof(plDdsHeaderDxt10);
+
       format = plImageFormatMappings::FromDxgiFormat(headerDxt10.m_uiDxgiFormat);
 
+      if (headerDxt10.m_uiArraySize > 1)
+      {
+        ref_imageHeader.SetNumArrayIndices(headerDxt10.m_uiArraySize);
+      }
+
       if (format == plImageFormat::UNKNOWN)
       {
         plLog::Error("The DXGI format {0} has no equivalent image format.", headerDxt10.m_uiDxgiFormat);
@@ -268,7 +277,8 @@ plResult plDdsFileFormat::ReadImageHeader(plStreamReader& inout_stream, plImageH
   PL_PROFILE_SCOPE("plDdsFileFormat::ReadImageHeader");
 
   plDdsHeader ddsHeader;
-  return ReadImageData(inout_stream, ref_header, ddsHeader);
+  plUInt32 uiHeaderSize = 0;
+  return ReadImageData(inout_stream, ref_header, ddsHeader, uiHeaderSize);
 }
 
 plResult plDdsFileFormat::ReadImage(plStreamReader& inout_stream, plImage& ref_image, plStringView sFileExtension) const
@@ -276,30 +286,12 @@ plResult plDdsFileFormat::ReadImage(plStreamReader& inout_stream, plImage& ref_i
   PL_IGNORE_UNUSED(sFileExtension);
   PL_PROFILE_SCOPE("plDdsFileFormat::ReadImage");
 
-  plImageHeader imageHeader;
-  plDdsHeader ddsHeader;
-  PL_SUCCEED_OR_RETURN(ReadImageData(inout_stream, imageHeader, ddsHeader));
-
-  ref_image.ResetAndAlloc(imageHeader);
-
-  const bool bPitch = (ddsHeader.m_uiFlags & plDdsdFlags::PITCH) != 0;
-
-  // If pitch is specified, it must match the computed value
-  if (bPitch && ref_image.GetRowPitch(0) != ddsHeader.m_uiPitchOrLinearSize)
-  {
-    plLog::Error("The row pitch specified in the header doesn't match the expected pitch.");
-    return PL_FAILURE;
-  }
-
-  plUInt64 uiDataSize = ref_image.GetByteBlobPtr().GetCount();
+  plDdsProgressiveReader reader;
+  PL_SUCCEED_OR_RETURN(reader.ReadHeader(inout_stream));
 
-  if (inout_stream.ReadBytes(ref_image.GetByteBlobPtr().GetPtr(), uiDataSize) != uiDataSize)
-  {
-    plLog::Error("Failed to read image data.");
-    return PL_FAILURE;
-  }
+  ref_image.ResetAndAlloc(reader.GetHeader());
 
-  return PL_SUCCESS;
+  return reader.ReadMipLevels(inout_stream, 0, reader.GetHeader().GetNumMipLevels(), ref_image);
 }
 
 plResult plDdsFileFormat::WriteImage(plStreamWriter& inout_stream, const plImageView& image, plStringView sFileExtension) const
@@ -529,5 +521,100 @@ bool plDdsFileFormat::CanWriteFileType(plStringView sExtension) const
 
 
 
-PL_STATICLINK_FILE(Texture, Texture_Image_Formats_DdsFileFormat);
+plResult plDdsProgressiveReader::ReadHeader(plStreamReader& inout_stream)
+{
+  PL_PROFILE_SCOPE("plDdsProgressiveReader::ReadHeader");
+
+  m_Header.Clear();
+
+  plDdsHeader ddsHeader;
+  PL_SUCCEED_OR_RETURN(ReadImageData(inout_stream, m_Header, ddsHeader, m_uiDataOffset));
+
+  // If pitch is specified, it must match the computed value
+  if ((ddsHeader.m_uiFlags & plDdsdFlags::PITCH) != 0 && m_Header.GetRowPitch(0) != ddsHeader.m_uiPitchOrLinearSize)
+  {
+    plLog::Error("The row pitch specified in the header doesn't match the expected pitch.");
+    return PL_FAILURE;
+  }
 
+  // DDS files store the full mip chain of every face (and array slice) one after the other, which is the same layout that plImage uses
+  m_MipOffsets.Clear();
+
+  plUInt64 uiOffset = 0;
+  for (plUInt32 uiMipLevel = 0; uiMipLevel < m_Header.GetNumMipLevels(); ++uiMipLevel)
+  {
+    m_MipOffsets.PushBack(uiOffset);
+
+    for (plUInt32 uiPlaneIndex = 0; uiPlaneIndex < m_Header.GetPlaneCount(); ++uiPlaneIndex)
+    {
+      uiOffset += m_Header.GetDepthPitch(uiMipLevel, uiPlaneIndex) * m_Header.GetDepth(uiMipLevel);
+    }
+  }
+
+  m_MipOffsets.PushBack(uiOffset);
+
+  return PL_SUCCESS;
+}
+
+void plDdsProgressiveReader::GetSubImageRange(plUInt32 uiMipLevel, plUInt32 uiFace, plUInt32 uiArrayIndex, plUInt64& out_uiOffset, plUInt64& out_uiSize) const
+{
+  PL_ASSERT_DEV(uiMipLevel < m_Header.GetNumMipLevels() && uiFace < m_Header.GetNumFaces() && uiArrayIndex < m_Header.GetNumArrayIndices(), "Invalid sub-image");
+
+  const plUInt64 uiChainSize = m_MipOffsets.PeekBack();
+
+  out_uiOffset = m_uiDataOffset + (uiArrayIndex * m_Header.GetNumFaces() + uiFace) * uiChainSize + m_MipOffsets[uiMipLevel];
+  out_uiSize = m_MipOffsets[uiMipLevel + 1] - m_MipOffsets[uiMipLevel];
+}
+
+plResult plDdsProgressiveReader::ReadMipLevels(plStreamReader& inout_stream, plUInt32 uiFirstMipLevel, plUInt32 uiNumMipLevels, plImage& inout_image) const
+{
+  PL_PROFILE_SCOPE("plDdsProgressiveReader::ReadMipLevels");
+
+  if (inout_image.GetHeader() != m_Header)
+  {
+    plLog::Error("The image was not allocated with the header of the DDS file.");
+    return PL_FAILURE;
+  }
+
+  if (uiNumMipLevels == 0 || uiFirstMipLevel + uiNumMipLevels > m_Header.GetNumMipLevels())
+  {
+    plLog::Error("Invalid mip level range [{}, {}), the file has {} mip levels.", uiFirstMipLevel, uiFirstMipLevel + uiNumMipLevels, m_Header.GetNumMipLevels());
+    return PL_FAILURE;
+  }
+
+  const plUInt64 uiChainSize = m_MipOffsets.PeekBack();
+  const plUInt64 uiRangeStart = m_MipOffsets[uiFirstMipLevel];
+  const plUInt64 uiRangeSize = m_MipOffsets[uiFirstMipLevel + uiNumMipLevels] - uiRangeStart;
+
+  // the requested mip levels are contiguous in every mip chain, in the file as well as in the image
+  plUInt64 uiStreamPos = 0;
+
+  for (plUInt32 uiArrayIndex = 0; uiArrayIndex < m_Header.GetNumArrayIndices(); ++uiArrayIndex)
+  {
+    for (plUInt32 uiFace = 0; uiFace < m_Header.GetNumFaces(); ++uiFace)
+    {
+      const plUInt64 uiChainStart = (uiArrayIndex * m_Header.GetNumFaces() + uiFace) * uiChainSize;
+      const plUInt64 uiSkip = uiChainStart + uiRangeStart - uiStreamPos;
+
+      if (uiSkip > 0 && inout_stream.SkipBytes(uiSkip) != uiSkip)
+      {
+        plLog::Error("Failed to read image data.");
+        return PL_FAILURE;
+      }
+
+      plUInt8* pTarget = inout_image.GetPixelPointer<plUInt8>(uiFirstMipLevel, uiFace, uiArrayIndex);
+
+      if (inout_stream.ReadBytes(pTarget, uiRangeSize) != uiRangeSize)
+      {
+        plLog::Error("Failed to read image data.");
+        return PL_FAILURE;
+      }
+
+      uiStreamPos = uiChainStart + uiRangeStart + uiRangeSize;
+    }
+  }
+
+  return PL_SUCCESS;
+}
+
+PL_STATICLINK_FILE(Texture, Texture_Image_Formats_DdsFileFormat);
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <Foundation/Containers/HybridArray.h>
 #include <Texture/Image/Formats/ImageFileFormat.h>
+#include <Texture/Image/ImageHeader.h>
 
 class PL_TEXTURE_DLL plDdsFileFormat : public plImageFileFormat
 {
@@ -12,3 +14,39 @@ public:
   virtual bool CanReadFileType(plStringView sExtension) const override;
   virtual bool CanWriteFileType(plStringView sExtension) const override;
 };
+
+/// \brief Reads the image data of a DDS file in parts, e.g. to load the small mip levels of a streamed texture first.
+///
+/// ReadHeader() only parses the header. Afterwards the position and size of every sub-image in the file is known, and ReadMipLevels()
+/// reads a range of mip levels of all faces and array slices into an image that was allocated with the full header, skipping all
+/// other data. The remaining mip levels can be read into the same image later.
+///
+/// .plTex files store a plTexFormat header in front of the DDS data, so call plTexFormat::ReadHeader() on the stream first.
+class PL_TEXTURE_DLL plDdsProgressiveReader
+{
+public:
+  /// \brief Parses the DDS header. Afterwards the stream is positioned at the start of the image data.
+  plResult ReadHeader(plStreamReader& inout_stream);
+
+  const plImageHeader& GetHeader() const { return m_Header; }
+
+  /// \brief The size of the DDS header, i.e. the offset of the image data from the start of the DDS data.
+  plUInt32 GetDataOffset() const { return m_uiDataOffset; }
+
+  /// \brief Returns the byte range of one sub-image, relative to the start of the DDS data.
+  void GetSubImageRange(plUInt32 uiMipLevel, plUInt32 uiFace, plUInt32 uiArrayIndex, plUInt64& out_uiOffset, plUInt64& out_uiSize) const;
+
+  /// \brief Reads the mip levels [uiFirstMipLevel, uiFirstMipLevel + uiNumMipLevels) of all faces and array slices into inout_image.
+  ///
+  /// The image must have been allocated with GetHeader(). The stream must be positioned at the start of the image data, where ReadHeader()
+  /// leaves it. To read more mip levels later, open the file again and skip GetDataOffset() bytes (plus the size of a plTexFormat header).
+  /// To read the N smallest mip levels, pass GetHeader().GetNumMipLevels() - N as the first mip level.
+  plResult ReadMipLevels(plStreamReader& inout_stream, plUInt32 uiFirstMipLevel, plUInt32 uiNumMipLevels, plImage& inout_image) const;
+
+private:
+  plImageHeader m_Header;
+  plUInt32 m_uiDataOffset = 0;
+
+  // offsets of the mip levels inside the mip chain of one face, plus the size of the whole chain as the last element
+  plHybridArray<plUInt64, 16> m_MipOffsets;
+};
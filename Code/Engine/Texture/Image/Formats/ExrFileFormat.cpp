@@ -8,13 +8,14 @@
 #  include <Foundation/IO/MemoryStream.h>
 #  include <Foundation/IO/StreamUtils.h>
 #  include <Foundation/Profiling/Profiling.h>
+#  include <Foundation/Threading/TaskSystem.h>
 
 #  include <tinyexr/tinyexr.h>
 
 // PL_STATICLINK_FORCE
 plExrFileFormat g_ExrFileFormat;
 
-plResult ReadImageData(plStreamReader& ref_stream, plDynamicArray<plUInt8>& ref_fileBuffer, plImageHeader& ref_header, EXRHeader& ref_exrHeader, EXRImage& ref_exrImage)
+static plResult ReadImageData(plStreamReader& ref_stream, plDynamicArray<plUInt8>& ref_fileBuffer, plImageHeader& ref_header, EXRHeader& ref_exrHeader)
 {
   // read the entire file to memory
   plStreamUtils::ReadAllAndAppend(ref_stream, ref_fileBuffer);
@@ -52,15 +53,6 @@ plResult ReadImageData(plStreamReader& ref_stream, plDynamicArray<plUInt8>& ref_
     }
   }
 
-  if (LoadEXRImageFromMemory(&ref_exrImage, &ref_exrHeader, ref_fileBuffer.GetData(), ref_fileBuffer.GetCount(), &err) != 0)
-  {
-    plLog::Error("Invalid EXR file: '{0}'", err);
-
-    FreeEXRHeader(&ref_exrHeader);
-    FreeEXRErrorMessage(err);
-    return PL_FAILURE;
-  }
-
   plImageFormat::Enum imageFormat = plImageFormat::UNKNOWN;
 
   switch (ref_exrHeader.num_channels)
@@ -152,8 +144,8 @@ plResult ReadImageData(plStreamReader& ref_stream, plDynamicArray<plUInt8>& ref_
     return PL_FAILURE;
   }
 
-  ref_header.SetWidth(ref_exrImage.width);
-  ref_header.SetHeight(ref_exrImage.height);
+  ref_header.SetWidth(ref_exrHeader.data_window.max_x - ref_exrHeader.data_window.min_x + 1);
+  ref_header.SetHeight(ref_exrHeader.data_window.max_y - ref_exrHeader.data_window.min_y + 1);
   ref_header.SetImageFormat(imageFormat);
 
   ref_header.SetNumMipLevels(1);
@@ -173,12 +165,9 @@ plResult plExrFileFormat::ReadImageHeader(plStreamReader& ref_stream, plImageHea
   InitEXRHeader(&exrHeader);
   PL_SCOPE_EXIT(FreeEXRHeader(&exrHeader));
 
-  EXRImage exrImage;
-  InitEXRImage(&exrImage);
-  PL_SCOPE_EXIT(FreeEXRImage(&exrImage));
-
+  // only the header is parsed, the pixel data isn't decoded
   plDynamicArray<plUInt8> fileBuffer;
-  return ReadImageData(ref_stream, fileBuffer, ref_header, exrHeader, exrImage);
+  return ReadImageData(ref_stream, fileBuffer, ref_header, exrHeader);
 }
 
 static void CopyChannel(plUInt8* pDst, const plUInt8* pSrc, plUInt32 uiNumElements, plUInt32 uiElementSize, plUInt32 uiDstStride)
@@ -201,11 +190,67 @@ static void CopyChannel(plUInt8* pDst, const plUInt8* pSrc, plUInt32 uiNumElemen
   }
 }
 
+static void ExrParallelRun(int iCount, void (*func)(void* pUserData), void* pUserData)
+{
+  plParallelForParams params;
+  params.m_uiBinSize = 1;
+
+  plTaskSystem::ParallelForIndexed(
+    0, static_cast<plUInt32>(iCount), [func, pUserData](plUInt32 uiStartIndex, plUInt32 uiEndIndex)
+    {
+      for (plUInt32 i = uiStartIndex; i < uiEndIndex; ++i)
+      {
+        func(pUserData);
+      }
+    },
+    "ExrDecode", plTaskNesting::Never, params);
+}
+
+/// Copies the channels of one block of pixels from the planar EXR data into the interleaved image.
+/// EXR sorts the channels alphabetically, so the source channels are in ABGR order.
+static void CopyExrPixels(plImage& ref_image, unsigned char* const* pSrcChannels, plUInt32 uiNumSrcChannels, plUInt32 uiSrcRowPitch, plUInt32 uiElementSize, plUInt32 uiX, plUInt32 uiY, plUInt32 uiWidth, plUInt32 uiHeight)
+{
+  const plUInt32 uiNumDstChannels = plImageFormat::GetNumChannels(ref_image.GetImageFormat());
+
+  // src and dst element size is always identical, we only copy from float->float, half->half or uint->uint
+  // however data is interleaved in dst, but not interleaved in src
+  const plUInt32 uiDstStride = uiElementSize * uiNumDstChannels;
+
+  for (plUInt32 y = 0; y < uiHeight; ++y)
+  {
+    plUInt8* pDstBytes = ref_image.GetPixelPointer<plUInt8>(0, 0, 0, uiX, uiY + y);
+
+    if (uiNumDstChannels > uiNumSrcChannels)
+    {
+      // if we have more dst channels, than in the input data, fill everything with white
+      plMemoryUtils::PatternFill(pDstBytes, 0xFF, uiDstStride * uiWidth);
+    }
+
+    for (plUInt32 c = 0; c < uiNumSrcChannels; ++c)
+    {
+      const plUInt32 uiDstChannel = uiNumSrcChannels - 1 - c;
+
+      if (uiDstChannel < uiNumDstChannels)
+      {
+        CopyChannel(pDstBytes + uiDstChannel * uiElementSize, pSrcChannels[c] + y * uiSrcRowPitch, uiWidth, uiElementSize, uiDstStride);
+      }
+    }
+  }
+}
+
 plResult plExrFileFormat::ReadImage(plStreamReader& ref_stream, plImage& ref_image, plStringView sFileExtension) const
 {
   PL_IGNORE_UNUSED(sFileExtension);
   PL_PROFILE_SCOPE("plExrFileFormat::ReadImage");
 
+  // decode the tiles and scanline blocks on the worker threads, instead of having tinyexr create threads for every image
+  static const bool s_bParallelRunSet = []()
+  {
+    SetEXRParallelRunFunction(&ExrParallelRun);
+    return true;
+  }();
+  PL_IGNORE_UNUSED(s_bParallelRunSet);
+
   EXRHeader exrHeader;
   InitEXRHeader(&exrHeader);
   PL_SCOPE_EXIT(FreeEXRHeader(&exrHeader));
@@ -217,89 +262,73 @@ plResult plExrFileFormat::ReadImage(plStreamReader& ref_stream, plImage& ref_ima
   plImageHeader header;
   plDynamicArray<plUInt8> fileBuffer;
 
-  PL_SUCCEED_OR_RETURN(ReadImageData(ref_stream, fileBuffer, header, exrHeader, exrImage));
+  PL_SUCCEED_OR_RETURN(ReadImageData(ref_stream, fileBuffer, header, exrHeader));
 
-  ref_image.ResetAndAlloc(header);
+  const char* err = nullptr;
+  if (LoadEXRImageFromMemory(&exrImage, &exrHeader, fileBuffer.GetData(), fileBuffer.GetCount(), &err) != 0)
+  {
+    plLog::Error("Invalid EXR file: '{0}'", err);
+    FreeEXRErrorMessage(err);
+    return PL_FAILURE;
+  }
 
-  const plUInt32 uiPixelCount = header.GetWidth() * header.GetHeight();
-  const plUInt32 uiNumDstChannels = plImageFormat::GetNumChannels(header.GetImageFormat());
-  const plUInt32 uiNumSrcChannels = exrHeader.num_channels;
+  ref_image.ResetAndAlloc(header);
 
-  plUInt32 uiSrcStride = 0;
+  plUInt32 uiElementSize = 0;
   switch (exrHeader.pixel_types[0])
   {
     case TINYEXR_PIXELTYPE_FLOAT:
-      uiSrcStride = sizeof(float);
+      uiElementSize = sizeof(float);
       break;
 
     case TINYEXR_PIXELTYPE_HALF:
-      uiSrcStride = sizeof(float) / 2;
+      uiElementSize = sizeof(float) / 2;
       break;
 
     case TINYEXR_PIXELTYPE_UINT:
-      uiSrcStride = sizeof(plUInt32);
+      uiElementSize = sizeof(plUInt32);
       break;
 
       PL_DEFAULT_CASE_NOT_IMPLEMENTED;
   }
 
+  const plUInt32 uiNumSrcChannels = exrHeader.num_channels;
+  const EXRImage* pExrImage = &exrImage;
+  plImage* pImage = &ref_image;
 
-  // src and dst element size is always identical, we only copy from float->float, half->half or uint->uint
-  // however data is interleaved in dst, but not interleaved in src
-
-  const plUInt32 uiDstStride = uiSrcStride * uiNumDstChannels;
-  plUInt8* pDstBytes = ref_image.GetBlobPtr<plUInt8>().GetPtr();
-
-  if (uiNumDstChannels > uiNumSrcChannels)
-  {
-    // if we have more dst channels, than in the input data, fill everything with white
-    plMemoryUtils::PatternFill(pDstBytes, 0xFF, uiDstStride * uiPixelCount);
-  }
-
-  plUInt32 c = 0;
-
-  if (uiNumSrcChannels >= 4)
-  {
-    const plUInt8* pSrcBytes = exrImage.images[c++];
-
-    if (uiNumDstChannels >= 4)
-    {
-      // copy to alpha
-      CopyChannel(pDstBytes + 3 * uiSrcStride, pSrcBytes, uiPixelCount, uiSrcStride, uiDstStride);
-    }
-  }
-
-  if (uiNumSrcChannels >= 3)
-  {
-    const plUInt8* pSrcBytes = exrImage.images[c++];
-
-    if (uiNumDstChannels >= 3)
-    {
-      // copy to blue
-      CopyChannel(pDstBytes + 2 * uiSrcStride, pSrcBytes, uiPixelCount, uiSrcStride, uiDstStride);
-    }
-  }
-
-  if (uiNumSrcChannels >= 2)
+  if (exrHeader.tiled)
   {
-    const plUInt8* pSrcBytes = exrImage.images[c++];
+    const plUInt32 uiTileSizeX = exrHeader.tile_size_x;
+    const plUInt32 uiTileSizeY = exrHeader.tile_size_y;
 
-    if (uiNumDstChannels >= 2)
-    {
-      // copy to green
-      CopyChannel(pDstBytes + uiSrcStride, pSrcBytes, uiPixelCount, uiSrcStride, uiDstStride);
-    }
+    plTaskSystem::ParallelForIndexed(
+      0, static_cast<plUInt32>(exrImage.num_tiles), [pExrImage, pImage, uiNumSrcChannels, uiElementSize, uiTileSizeX, uiTileSizeY](plUInt32 uiStartIndex, plUInt32 uiEndIndex)
+      {
+        for (plUInt32 i = uiStartIndex; i < uiEndIndex; ++i)
+        {
+          const EXRTile& tile = pExrImage->tiles[i];
+          CopyExrPixels(*pImage, tile.images, uiNumSrcChannels, uiTileSizeX * uiElementSize, uiElementSize, tile.offset_x * uiTileSizeX, tile.offset_y * uiTileSizeY, tile.width, tile.height);
+        }
+      },
+      "ExrCopyTiles");
   }
-
-  if (uiNumSrcChannels >= 1)
+  else
   {
-    const plUInt8* pSrcBytes = exrImage.images[c++];
+    const plUInt32 uiWidth = header.GetWidth();
 
-    if (uiNumDstChannels >= 1)
-    {
-      // copy to red
-      CopyChannel(pDstBytes, pSrcBytes, uiPixelCount, uiSrcStride, uiDstStride);
-    }
+    plTaskSystem::ParallelForIndexed(
+      0, header.GetHeight(), [pExrImage, pImage, uiNumSrcChannels, uiElementSize, uiWidth](plUInt32 uiStartIndex, plUInt32 uiEndIndex)
+      {
+        // the image format only allows up to four channels
+        unsigned char* channels[4];
+        for (plUInt32 c = 0; c < uiNumSrcChannels; ++c)
+        {
+          channels[c] = pExrImage->images[c] + plUInt64(uiStartIndex) * uiWidth * uiElementSize;
+        }
+
+        CopyExrPixels(*pImage, channels, uiNumSrcChannels, uiWidth * uiElementSize, uiElementSize, 0, uiStartIndex, uiWidth, uiEndIndex - uiStartIndex);
+      },
+      "ExrCopyRows");
   }
 
   return PL_SUCCESS;
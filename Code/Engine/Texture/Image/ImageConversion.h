@@ -5,6 +5,7 @@
 #include <Foundation/Utilities/EnumerableClass.h>
 
 #include <Texture/Image/Image.h>
+#include <Texture/Image/ImageEnums.h>
 
 PL_DECLARE_FLAGS(plUInt8, plImageConversionFlags, InPlace);
 
@@ -29,6 +30,15 @@ struct plImageConversionEntry
   float m_additionalPenalty = 0.0f;
 };
 
+/// \brief Options that are passed along to every step of a single conversion.
+///
+/// They are passed per call, so that conversions with different settings can run at the same time.
+struct plImageConversionSettings
+{
+  /// \brief The quality that the native BC1, BC3, BC4 and BC5 encoder uses, see plBCnEncoder.
+  plBCnEncoderQuality::Enum m_BCnQuality = plBCnEncoderQuality::Default;
+};
+
 /// \brief Interface for a single image conversion step.
 ///
 /// The actual functionality is implemented as either plImageConversionStepLinear or plImageConversionStepDecompressBlocks.
@@ -73,7 +83,7 @@ class PL_TEXTURE_DLL plImageConversionStepCompressBlocks : public plImageConvers
 public:
   /// \brief Compresses the given number of blocks.
   virtual plResult CompressBlocks(plConstByteBlobPtr source, plByteBlobPtr target, plUInt32 uiNumBlocksX, plUInt32 uiNumBlocksY,
-    plImageFormat::Enum sourceFormat, plImageFormat::Enum targetFormat) const = 0;
+    plImageFormat::Enum sourceFormat, plImageFormat::Enum targetFormat, const plImageConversionSettings& settings) const = 0;
 };
 
 /// \brief Interface for a single image conversion step from a linear to a planar format.
@@ -137,10 +147,14 @@ public:
     plHybridArray<ConversionPathNode, 16>& ref_path_out, plUInt32& ref_uiNumScratchBuffers_out);
 
   /// \brief  Converts the source image into a target image with the given format. Source and target may be the same.
-  static plResult Convert(const plImageView& source, plImage& ref_target, plImageFormat::Enum targetFormat);
+  static plResult Convert(const plImageView& source, plImage& ref_target, plImageFormat::Enum targetFormat, const plImageConversionSettings& settings = {});
 
   /// \brief Converts the source image into a target image using a precomputed conversion path.
-  static plResult Convert(const plImageView& source, plImage& ref_target, plArrayPtr<ConversionPathNode> path, plUInt32 uiNumScratchBuffers);
+  ///
+  /// Paths with multiple steps between linear and block compressed formats are executed band by band: every task runs a few rows
+  /// through all steps, so the intermediate results stay in small per-thread buffers instead of images as large as the source.
+  static plResult Convert(const plImageView& source, plImage& ref_target, plArrayPtr<ConversionPathNode> path, plUInt32 uiNumScratchBuffers,
+    const plImageConversionSettings& settings = {});
 
   /// \brief Converts the raw source data into a target data buffer with the given format. Source and target may be the same.
   static plResult ConvertRaw(
@@ -154,13 +168,17 @@ private:
   plImageConversion();
   plImageConversion(const plImageConversion&);
 
-  static plResult ConvertSingleStep(const plImageConversionStep* pStep, const plImageView& source, plImage& target, plImageFormat::Enum targetFormat);
+  static plResult ConvertFused(const plImageView& source, plImage& ref_target, plArrayPtr<ConversionPathNode> path, plUInt32 uiBlockWidth, plUInt32 uiBlockHeight,
+    const plImageConversionSettings& settings);
+
+  static plResult ConvertSingleStep(const plImageConversionStep* pStep, const plImageView& source, plImage& target, plImageFormat::Enum targetFormat,
+    const plImageConversionSettings& settings);
 
   static plResult ConvertSingleStepDecompress(const plImageView& source, plImage& target, plImageFormat::Enum sourceFormat,
     plImageFormat::Enum targetFormat, const plImageConversionStep* pStep);
 
   static plResult ConvertSingleStepCompress(const plImageView& source, plImage& target, plImageFormat::Enum sourceFormat,
-    plImageFormat::Enum targetFormat, const plImageConversionStep* pStep);
+    plImageFormat::Enum targetFormat, const plImageConversionStep* pStep, const plImageConversionSettings& settings);
 
     static plResult ConvertSingleStepDeplanarize(const plImageView& source, plImage& target, plImageFormat::Enum sourceFormat,
     plImageFormat::Enum targetFormat, const plImageConversionStep* pStep);
@@ -52,3 +52,25 @@ struct PL_TEXTURE_DLL plTextureFilterSetting
 };
 
 PL_DECLARE_REFLECTABLE_TYPE(PL_TEXTURE_DLL, plTextureFilterSetting);
+
+//////////////////////////////////////////////////////////////////////////
+// plBCnEncoderQuality
+//////////////////////////////////////////////////////////////////////////
+
+/// \brief Selects the trade-off between speed and quality for plBCnEncoder.
+///
+/// The descriptions refer to the color blocks of BC1 and BC3. For the single channel blocks of BC3, BC4 and BC5 the levels search
+/// increasingly large ranges of endpoints around the minimum and maximum value.
+struct PL_TEXTURE_DLL plBCnEncoderQuality
+{
+  using StorageType = plUInt8;
+
+  enum Enum : plUInt8
+  {
+    RangeFit,   ///< Endpoints are the extents of the pixels along their principal axis. Processes four blocks at once.
+    ClusterFit, ///< Least-squares endpoints for every ordering of the pixels along the principal axis. Much slower than RangeFit.
+    Exhaustive, ///< Iterated cluster fit, followed by a search through all neighboring endpoints until the error doesn't improve anymore.
+
+    Default = RangeFit
+  };
+};
@@ -84,12 +84,28 @@ public:
     const plColor& borderColor = plColor::Black);
 
   /// Scales the image.
+  ///
+  /// The filter passes are split into rows and tiles that are processed in parallel through plTaskSystem.
+  /// The result does not depend on the number of worker threads.
   static plResult Scale3D(const plImageView& source, plImage& ref_target, plUInt32 uiWidth, plUInt32 uiHeight, plUInt32 uiDepth,
     const plImageFilter* pFilter = nullptr, plImageAddressMode::Enum addressModeU = plImageAddressMode::Clamp,
     plImageAddressMode::Enum addressModeV = plImageAddressMode::Clamp, plImageAddressMode::Enum addressModeW = plImageAddressMode::Clamp,
     const plColor& borderColor = plColor::Black);
 
-  /// Genererates the mip maps for the image. The input texture must be in plImageFormat::R32_G32_B32_A32_FLOAT
+  /// Scales a 2D image the same way as converting it to plImageFormat::R32G32B32A32_FLOAT and calling Scale() on it would, but without
+  /// ever materializing the full-resolution float image.
+  ///
+  /// The source is converted and filtered in bands of rows, using roughly uiScratchMemoryBudget bytes in addition to the source and
+  /// target images. The target is always in plImageFormat::R32G32B32A32_FLOAT. Compressed formats, volume textures, cubemaps and arrays
+  /// are not supported.
+  static plResult ScaleInBands(const plImageView& source, plImage& ref_target, plUInt32 uiWidth, plUInt32 uiHeight, plUInt64 uiScratchMemoryBudget,
+    const plImageFilter* pFilter = nullptr, plImageAddressMode::Enum addressModeU = plImageAddressMode::Clamp,
+    plImageAddressMode::Enum addressModeV = plImageAddressMode::Clamp, const plColor& borderColor = plColor::Black);
+
+  /// Genererates the mip maps for the image.
+  ///
+  /// Filtering is done in plImageFormat::R32G32B32A32_FLOAT. Input in any other (convertible) format is converted to that first and the
+  /// resulting mip chain is converted back to the input format.
   static void GenerateMipMaps(const plImageView& source, plImage& ref_target, const MipMapOptions& options);
 
   /// Assumes that the Red and Green components of an image contain XY of an unit length normal and reconstructs the Z component into B
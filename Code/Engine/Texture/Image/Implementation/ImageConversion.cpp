@@ -3,6 +3,8 @@
 #include <Foundation/Containers/HashTable.h>
 #include <Foundation/Math/Math.h>
 #include <Foundation/Profiling/Profiling.h>
+#include <Foundation/Threading/AtomicInteger.h>
+#include <Foundation/Threading/TaskSystem.h>
 #include <Texture/Image/ImageConversion.h>
 
 PL_ENUMERABLE_CLASS_IMPLEMENTATION(plImageConversionStep);
@@ -371,7 +373,7 @@ void plImageConversion::RebuildConversionTable()
   s_conversionTableValid = true;
 }
 
-plResult plImageConversion::Convert(const plImageView& source, plImage& ref_target, plImageFormat::Enum targetFormat)
+plResult plImageConversion::Convert(const plImageView& source, plImage& ref_target, plImageFormat::Enum targetFormat, const plImageConversionSettings& settings)
 {
   PL_PROFILE_SCOPE("plImageConversion::Convert");
 
@@ -395,14 +397,248 @@ plResult plImageConversion::Convert(const plImageView& source, plImage& ref_targ
     return PL_FAILURE;
   }
 
-  return Convert(source, ref_target, path, numScratchBuffers);
+  return Convert(source, ref_target, path, numScratchBuffers, settings);
 }
 
-plResult plImageConversion::Convert(const plImageView& source, plImage& ref_target, plArrayPtr<ConversionPathNode> path, plUInt32 uiNumScratchBuffers)
+namespace
+{
+  /// The approximate size of the data that one band holds in each format along the path, small enough to stay in the cache.
+  constexpr plUInt64 FusedBandBytes = 256 * 1024;
+
+  /// A range of rows of one slice of a sub-image that is run through the whole conversion path at once.
+  struct FusedBand
+  {
+    PL_DECLARE_POD_TYPE();
+
+    plUInt32 m_uiMipLevel;
+    plUInt32 m_uiFace;
+    plUInt32 m_uiArrayIndex;
+    plUInt32 m_uiSlice;
+    plUInt32 m_uiFirstRow; ///< In pixels, a multiple of the block height.
+    plUInt32 m_uiNumRows;  ///< In pixels, a multiple of the block height. May extend past the bottom of the image.
+  };
+
+  struct FusedConversion
+  {
+    const plImageView* m_pSource = nullptr;
+    plImage* m_pTarget = nullptr;
+    plArrayPtr<const plImageConversion::ConversionPathNode> m_Path;
+    plDynamicArray<FusedBand> m_Bands;
+    plUInt32 m_uiBlockWidth = 1;
+    plUInt32 m_uiBlockHeight = 1;
+    plUInt64 m_uiScratchBytesPerFormat = 0;
+    plImageConversionSettings m_Settings;
+    plAtomicInteger32 m_iFailed;
+  };
+
+  /// Returns false if the path contains steps that can't be executed band by band. Otherwise returns the block size that the
+  /// bands have to be aligned to.
+  bool isFusable(plArrayPtr<const plImageConversion::ConversionPathNode> path, plUInt32& out_uiBlockWidth, plUInt32& out_uiBlockHeight)
+  {
+    out_uiBlockWidth = 1;
+    out_uiBlockHeight = 1;
+
+    for (const plImageConversion::ConversionPathNode& node : path)
+    {
+      // copy steps only occur in in-place paths
+      if (node.m_step == nullptr)
+        return false;
+
+      for (plImageFormat::Enum format : {node.m_sourceFormat, node.m_targetFormat})
+      {
+        switch (plImageFormat::GetType(format))
+        {
+          case plImageFormatType::LINEAR:
+            if (plImageFormat::GetBitsPerPixel(format) % 8 != 0)
+              return false;
+            break;
+
+          case plImageFormatType::BLOCK_COMPRESSED:
+          {
+            const plUInt32 uiBlockWidth = plImageFormat::GetBlockWidth(format);
+            const plUInt32 uiBlockHeight = plImageFormat::GetBlockHeight(format);
+
+            if (plImageFormat::GetBlockDepth(format) != 1)
+              return false;
+
+            // all compressed formats along the path have to agree on the block size, otherwise the bands can't be aligned to all of them
+            if ((out_uiBlockWidth != 1 && out_uiBlockWidth != uiBlockWidth) || (out_uiBlockHeight != 1 && out_uiBlockHeight != uiBlockHeight))
+              return false;
+
+            out_uiBlockWidth = uiBlockWidth;
+            out_uiBlockHeight = uiBlockHeight;
+            break;
+          }
+
+          default:
+            return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
+  /// Runs one band through the whole path. The intermediate results only live in the given scratch memory, which holds
+  /// GetCount() + 2 regions of m_uiScratchBytesPerFormat bytes each.
+  plResult convertFusedBand(const FusedConversion& conversion, const FusedBand& band, plUInt8* pScratch)
+  {
+    const plImageView& source = *conversion.m_pSource;
+    plImage& target = *conversion.m_pTarget;
+    const plArrayPtr<const plImageConversion::ConversionPathNode>& path = conversion.m_Path;
+
+    const plUInt32 uiBlockWidth = conversion.m_uiBlockWidth;
+    const plUInt32 uiBlockHeight = conversion.m_uiBlockHeight;
+
+    const plUInt32 uiWidth = source.GetWidth(band.m_uiMipLevel);
+    const plUInt32 uiHeight = source.GetHeight(band.m_uiMipLevel);
+    const plUInt32 uiPaddedWidth = (uiWidth + uiBlockWidth - 1) / uiBlockWidth * uiBlockWidth;
+    const plUInt32 uiNumBlocksX = uiPaddedWidth / uiBlockWidth;
+    const plUInt32 uiNumBlockRows = band.m_uiNumRows / uiBlockHeight;
+
+    // linear data can be read from and written to the images directly, if no padding is necessary
+    const bool bLinearDirect = uiPaddedWidth == uiWidth && band.m_uiFirstRow + band.m_uiNumRows <= uiHeight;
+    const plUInt32 uiNumValidRows = plMath::Min(band.m_uiNumRows, uiHeight - band.m_uiFirstRow);
+
+    auto getScratch = [&](plUInt32 uiIndex)
+    { return pScratch + uiIndex * conversion.m_uiScratchBytesPerFormat; };
+
+    const plImageFormat::Enum sourceFormat = path[0].m_sourceFormat;
+    const plUInt8* pStepSource = nullptr;
+
+    if (plImageFormat::IsCompressed(sourceFormat))
+    {
+      pStepSource = source.GetPixelPointer<plUInt8>(band.m_uiMipLevel, band.m_uiFace, band.m_uiArrayIndex, 0, band.m_uiFirstRow / uiBlockHeight, band.m_uiSlice);
+    }
+    else if (bLinearDirect)
+    {
+      pStepSource = source.GetPixelPointer<plUInt8>(band.m_uiMipLevel, band.m_uiFace, band.m_uiArrayIndex, 0, band.m_uiFirstRow, band.m_uiSlice);
+    }
+    else
+    {
+      // pad to the block size by repeating the last column and row, same as ConvertSingleStepCompress()
+      const plUInt32 uiBytesPerPixel = plImageFormat::GetBitsPerPixel(sourceFormat) / 8;
+      plUInt8* pPadded = getScratch(0);
+
+      for (plUInt32 y = 0; y < band.m_uiNumRows; ++y)
+      {
+        const plUInt32 uiSourceY = plMath::Min(band.m_uiFirstRow + y, uiHeight - 1);
+        const plUInt8* pSourceRow = source.GetPixelPointer<plUInt8>(band.m_uiMipLevel, band.m_uiFace, band.m_uiArrayIndex, 0, uiSourceY, band.m_uiSlice);
+        plUInt8* pPaddedRow = pPadded + plUInt64(y) * uiPaddedWidth * uiBytesPerPixel;
+
+        memcpy(pPaddedRow, pSourceRow, plUInt64(uiWidth) * uiBytesPerPixel);
+
+        for (plUInt32 x = uiWidth; x < uiPaddedWidth; ++x)
+        {
+          memcpy(pPaddedRow + x * uiBytesPerPixel, pSourceRow + (uiWidth - 1) * uiBytesPerPixel, uiBytesPerPixel);
+        }
+      }
+
+      pStepSource = pPadded;
+    }
+
+    for (plUInt32 i = 0; i < path.GetCount(); ++i)
+    {
+      const plImageFormat::Enum stepSourceFormat = path[i].m_sourceFormat;
+      const plImageFormat::Enum stepTargetFormat = path[i].m_targetFormat;
+      const bool bLastStep = i + 1 == path.GetCount();
+
+      const plUInt64 uiSourceBytes = plImageFormat::GetDepthPitch(stepSourceFormat, uiPaddedWidth, band.m_uiNumRows);
+      const plUInt64 uiTargetBytes = plImageFormat::GetDepthPitch(stepTargetFormat, uiPaddedWidth, band.m_uiNumRows);
+
+      const bool bTargetCompressed = plImageFormat::IsCompressed(stepTargetFormat);
+      const bool bWriteDirectly = bLastStep && (bTargetCompressed || bLinearDirect);
+
+      plUInt8* pStepTarget = getScratch(i + 1);
+      if (bWriteDirectly)
+      {
+        const plUInt32 uiTargetRow = bTargetCompressed ? band.m_uiFirstRow / uiBlockHeight : band.m_uiFirstRow;
+        pStepTarget = target.GetPixelPointer<plUInt8>(band.m_uiMipLevel, band.m_uiFace, band.m_uiArrayIndex, 0, uiTargetRow, band.m_uiSlice);
+      }
+
+      switch (MakeTypeKey(plImageFormat::GetType(stepSourceFormat), plImageFormat::GetType(stepTargetFormat)))
+      {
+        case MakeTypeKey(plImageFormatType::LINEAR, plImageFormatType::LINEAR):
+        {
+          PL_SUCCEED_OR_RETURN(static_cast<const plImageConversionStepLinear*>(path[i].m_step)
+                                 ->ConvertPixels(plConstByteBlobPtr(pStepSource, uiSourceBytes), plByteBlobPtr(pStepTarget, uiTargetBytes),
+                                   plUInt64(uiPaddedWidth) * band.m_uiNumRows, stepSourceFormat, stepTargetFormat));
+          break;
+        }
+
+        case MakeTypeKey(plImageFormatType::BLOCK_COMPRESSED, plImageFormatType::LINEAR):
+        {
+          const plUInt64 uiSourceRowPitch = plImageFormat::GetRowPitch(stepSourceFormat, uiPaddedWidth);
+          const plUInt32 uiBytesPerPixel = plImageFormat::GetBitsPerPixel(stepTargetFormat) / 8;
+          const plUInt32 uiBlockBytes = uiBlockWidth * uiBlockHeight * uiBytesPerPixel;
+          plUInt8* pBlocks = getScratch(path.GetCount() + 1);
+
+          for (plUInt32 blockY = 0; blockY < uiNumBlockRows; ++blockY)
+          {
+            PL_SUCCEED_OR_RETURN(static_cast<const plImageConversionStepDecompressBlocks*>(path[i].m_step)
+                                   ->DecompressBlocks(plConstByteBlobPtr(pStepSource + blockY * uiSourceRowPitch, uiSourceRowPitch),
+                                     plByteBlobPtr(pBlocks, plUInt64(uiNumBlocksX) * uiBlockBytes), uiNumBlocksX, stepSourceFormat, stepTargetFormat));
+
+            // the decompressed blocks are stored one after the other, rearrange them into rows
+            for (plUInt32 blockX = 0; blockX < uiNumBlocksX; ++blockX)
+            {
+              for (plUInt32 row = 0; row < uiBlockHeight; ++row)
+              {
+                const plUInt64 uiTargetOffset = (plUInt64(blockY * uiBlockHeight + row) * uiPaddedWidth + blockX * uiBlockWidth) * uiBytesPerPixel;
+                memcpy(pStepTarget + uiTargetOffset, pBlocks + blockX * uiBlockBytes + row * uiBlockWidth * uiBytesPerPixel, uiBlockWidth * uiBytesPerPixel);
+              }
+            }
+          }
+          break;
+        }
+
+        case MakeTypeKey(plImageFormatType::LINEAR, plImageFormatType::BLOCK_COMPRESSED):
+        {
+          PL_SUCCEED_OR_RETURN(static_cast<const plImageConversionStepCompressBlocks*>(path[i].m_step)
+                                 ->CompressBlocks(plConstByteBlobPtr(pStepSource, uiSourceBytes), plByteBlobPtr(pStepTarget, uiTargetBytes), uiNumBlocksX,
+                                   uiNumBlockRows, stepSourceFormat, stepTargetFormat, conversion.m_Settings));
+          break;
+        }
+
+        default:
+          PL_ASSERT_NOT_IMPLEMENTED;
+          return PL_FAILURE;
+      }
+
+      if (bLastStep && !bWriteDirectly)
+      {
+        // crop the padding
+        const plUInt32 uiBytesPerPixel = plImageFormat::GetBitsPerPixel(stepTargetFormat) / 8;
+
+        for (plUInt32 y = 0; y < uiNumValidRows; ++y)
+        {
+          memcpy(target.GetPixelPointer<plUInt8>(band.m_uiMipLevel, band.m_uiFace, band.m_uiArrayIndex, 0, band.m_uiFirstRow + y, band.m_uiSlice),
+            pStepTarget + plUInt64(y) * uiPaddedWidth * uiBytesPerPixel, plUInt64(uiWidth) * uiBytesPerPixel);
+        }
+      }
+
+      pStepSource = pStepTarget;
+    }
+
+    return PL_SUCCESS;
+  }
+} // namespace
+
+plResult plImageConversion::Convert(
+  const plImageView& source, plImage& ref_target, plArrayPtr<ConversionPathNode> path, plUInt32 uiNumScratchBuffers, const plImageConversionSettings& settings)
 {
   PL_ASSERT_DEV(path.GetCount() > 0, "Invalid conversion path");
   PL_ASSERT_DEV(path[0].m_sourceFormat == source.GetImageFormat(), "Invalid conversion path");
 
+  if (path.GetCount() > 1 && &source != &ref_target)
+  {
+    plUInt32 uiBlockWidth, uiBlockHeight;
+    if (isFusable(path, uiBlockWidth, uiBlockHeight))
+    {
+      return ConvertFused(source, ref_target, path, uiBlockWidth, uiBlockHeight, settings);
+    }
+  }
+
   plHybridArray<plImage, 16> intermediates;
   intermediates.SetCount(uiNumScratchBuffers);
 
@@ -414,7 +650,7 @@ plResult plImageConversion::Convert(const plImageView& source, plImage& ref_targ
 
     plImage* pTarget = targetIndex == 0 ? &ref_target : &intermediates[targetIndex - 1];
 
-    if (ConvertSingleStep(path[i].m_step, *pSource, *pTarget, path[i].m_targetFormat).Failed())
+    if (ConvertSingleStep(path[i].m_step, *pSource, *pTarget, path[i].m_targetFormat, settings).Failed())
     {
       return PL_FAILURE;
     }
@@ -425,6 +661,84 @@ plResult plImageConversion::Convert(const plImageView& source, plImage& ref_targ
   return PL_SUCCESS;
 }
 
+plResult plImageConversion::ConvertFused(const plImageView& source, plImage& ref_target, plArrayPtr<ConversionPathNode> path, plUInt32 uiBlockWidth,
+  plUInt32 uiBlockHeight, const plImageConversionSettings& settings)
+{
+  PL_PROFILE_SCOPE("plImageConversion::ConvertFused");
+
+  plImageHeader header = source.GetHeader();
+  header.SetImageFormat(path[path.GetCount() - 1].m_targetFormat);
+  ref_target.ResetAndAlloc(header);
+
+  FusedConversion conversion;
+  conversion.m_pSource = &source;
+  conversion.m_pTarget = &ref_target;
+  conversion.m_Path = path;
+  conversion.m_uiBlockWidth = uiBlockWidth;
+  conversion.m_uiBlockHeight = uiBlockHeight;
+  conversion.m_Settings = settings;
+
+  for (plUInt32 arrayIndex = 0; arrayIndex < source.GetNumArrayIndices(); arrayIndex++)
+  {
+    for (plUInt32 face = 0; face < source.GetNumFaces(); face++)
+    {
+      for (plUInt32 mipLevel = 0; mipLevel < source.GetNumMipLevels(); mipLevel++)
+      {
+        const plUInt32 uiPaddedWidth = (source.GetWidth(mipLevel) + uiBlockWidth - 1) / uiBlockWidth * uiBlockWidth;
+        const plUInt32 uiPaddedHeight = (source.GetHeight(mipLevel) + uiBlockHeight - 1) / uiBlockHeight * uiBlockHeight;
+
+        // the widest format along the path determines how many rows fit into a band
+        plUInt64 uiMaxBytesPerBlockRow = 0;
+        for (const ConversionPathNode& node : path)
+        {
+          uiMaxBytesPerBlockRow = plMath::Max(uiMaxBytesPerBlockRow, plImageFormat::GetDepthPitch(node.m_sourceFormat, uiPaddedWidth, uiBlockHeight));
+          uiMaxBytesPerBlockRow = plMath::Max(uiMaxBytesPerBlockRow, plImageFormat::GetDepthPitch(node.m_targetFormat, uiPaddedWidth, uiBlockHeight));
+        }
+
+        const plUInt32 uiBandRows = uiBlockHeight * static_cast<plUInt32>(plMath::Clamp<plUInt64>(FusedBandBytes / uiMaxBytesPerBlockRow, 1, uiPaddedHeight / uiBlockHeight));
+        conversion.m_uiScratchBytesPerFormat = plMath::Max(conversion.m_uiScratchBytesPerFormat, uiMaxBytesPerBlockRow * (uiBandRows / uiBlockHeight));
+
+        for (plUInt32 slice = 0; slice < source.GetDepth(mipLevel); slice++)
+        {
+          for (plUInt32 y = 0; y < uiPaddedHeight; y += uiBandRows)
+          {
+            FusedBand& band = conversion.m_Bands.ExpandAndGetRef();
+            band.m_uiMipLevel = mipLevel;
+            band.m_uiFace = face;
+            band.m_uiArrayIndex = arrayIndex;
+            band.m_uiSlice = slice;
+            band.m_uiFirstRow = y;
+            band.m_uiNumRows = plMath::Min(uiBandRows, uiPaddedHeight - y);
+          }
+        }
+      }
+    }
+  }
+
+  const FusedConversion* pConversion = &conversion;
+
+  // the steps may use parallel loops themselves, e.g. the block compressors
+  plTaskSystem::ParallelForIndexed(
+    0, conversion.m_Bands.GetCount(), [pConversion](plUInt32 uiStartIndex, plUInt32 uiEndIndex)
+    {
+      // one region per format along the path, plus one for rearranging decompressed blocks
+      plDynamicArray<plUInt8> scratch;
+      scratch.SetCountUninitialized(static_cast<plUInt32>(pConversion->m_uiScratchBytesPerFormat * (pConversion->m_Path.GetCount() + 2)));
+
+      for (plUInt32 bandIndex = uiStartIndex; bandIndex < uiEndIndex; ++bandIndex)
+      {
+        if (pConversion->m_iFailed != 0 || convertFusedBand(*pConversion, pConversion->m_Bands[bandIndex], scratch.GetData()).Failed())
+        {
+          const_cast<plAtomicInteger32&>(pConversion->m_iFailed).Set(1);
+          return;
+        }
+      }
+    },
+    "plImageConversion::ConvertFused", plTaskNesting::Maybe);
+
+  return conversion.m_iFailed == 0 ? PL_SUCCESS : PL_FAILURE;
+}
+
 plResult plImageConversion::ConvertRaw(
   plConstByteBlobPtr source, plByteBlobPtr target, plUInt32 uiNumElements, plImageFormat::Enum sourceFormat, plImageFormat::Enum targetFormat)
 {
@@ -512,7 +826,7 @@ plResult plImageConversion::ConvertRaw(
 }
 
 plResult plImageConversion::ConvertSingleStep(
-  const plImageConversionStep* pStep, const plImageView& source, plImage& target, plImageFormat::Enum targetFormat)
+  const plImageConversionStep* pStep, const plImageView& source, plImage& target, plImageFormat::Enum targetFormat, const plImageConversionSettings& settings)
 {
   if (!pStep)
   {
@@ -537,7 +851,7 @@ plResult plImageConversion::ConvertSingleStep(
     }
 
     case MakeTypeKey(plImageFormatType::LINEAR, plImageFormatType::BLOCK_COMPRESSED):
-      return ConvertSingleStepCompress(source, target, sourceFormat, targetFormat, pStep);
+      return ConvertSingleStepCompress(source, target, sourceFormat, targetFormat, pStep, settings);
 
     case MakeTypeKey(plImageFormatType::LINEAR, plImageFormatType::PLANAR):
       return ConvertSingleStepPlanarize(source, target, sourceFormat, targetFormat, pStep);
@@ -617,8 +931,8 @@ plResult plImageConversion::ConvertSingleStepDecompress(
   return PL_SUCCESS;
 }
 
-plResult plImageConversion::ConvertSingleStepCompress(
-  const plImageView& source, plImage& target, plImageFormat::Enum sourceFormat, plImageFormat::Enum targetFormat, const plImageConversionStep* pStep)
+plResult plImageConversion::ConvertSingleStepCompress(const plImageView& source, plImage& target, plImageFormat::Enum sourceFormat,
+  plImageFormat::Enum targetFormat, const plImageConversionStep* pStep, const plImageConversionSettings& settings)
 {
   for (plUInt32 arrayIndex = 0; arrayIndex < source.GetNumArrayIndices(); arrayIndex++)
   {
@@ -664,7 +978,7 @@ plResult plImageConversion::ConvertSingleStepCompress(
           }
 
           plResult result = static_cast<const plImageConversionStepCompressBlocks*>(pStep)->CompressBlocks(paddedSlice.GetByteBlobPtr(),
-            target.GetSliceView(mipLevel, face, arrayIndex, slice).GetByteBlobPtr(), numBlocksX, numBlocksY, sourceFormat, targetFormat);
+            target.GetSliceView(mipLevel, face, arrayIndex, slice).GetByteBlobPtr(), numBlocksX, numBlocksY, sourceFormat, targetFormat, settings);
 
           if (result.Failed())
           {
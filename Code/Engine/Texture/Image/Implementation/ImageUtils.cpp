@@ -5,6 +5,7 @@
 #include <Foundation/IO/MemoryStream.h>
 #include <Foundation/Profiling/Profiling.h>
 #include <Foundation/SimdMath/SimdVec4f.h>
+#include <Foundation/Threading/TaskSystem.h>
 #include <Foundation/Time/Timestamp.h>
 #include <Texture/Image/ImageConversion.h>
 #include <Texture/Image/ImageEnums.h>
@@ -738,6 +739,78 @@ inline static void FilterLine(
   }
 }
 
+/// Number of neighboring pixels that FilterTile processes together.
+static constexpr plUInt32 FilterTileWidth = 64;
+
+/// Filters a tile of up to FilterTileWidth neighboring lines at once, along an axis where consecutive samples are uiStride pixels apart
+/// (the vertical and the depth pass). Walking the lines one by one, like FilterLine does, touches a new cache line for every sample,
+/// whereas here every source row is consumed at once while it is in the cache.
+/// The weights are accumulated in exactly the same order as in FilterLine, so the result is bit-identical.
+static void FilterTile(plUInt32 uiNumSourceElements, const plSimdVec4f* __restrict pSourceBegin, plSimdVec4f* __restrict pTargetBegin, plUInt32 uiStride, plUInt32 uiTileWidth, const plImageFilterWeights& weights, plArrayPtr<const plInt32> firstSampleIndices, plImageAddressMode::Enum addressMode, const plSimdVec4f& vBorderColor)
+{
+  PL_ASSERT_DEBUG(uiTileWidth <= FilterTileWidth, "Invalid tile width {}", uiTileWidth);
+
+  const plUInt32 numWeights = weights.GetNumWeights();
+  const auto weightsView = weights.ViewWeights();
+  const float* __restrict nextWeightPtr = weightsView.GetPtr();
+
+  plSimdVec4f total[FilterTileWidth];
+
+  for (plInt32 firstSourceIdx : firstSampleIndices)
+  {
+    for (plUInt32 x = 0; x < uiTileWidth; ++x)
+    {
+      total[x].SetZero();
+    }
+
+    plInt32 sourceIdx = firstSourceIdx;
+    for (plUInt32 weightIdx = 0; weightIdx < numWeights; ++weightIdx)
+    {
+      const plSimdVec4f weight(*nextWeightPtr++);
+
+      bool useBorderColor = false;
+      const plUInt32 sourceRow = plImageUtils::GetSampleIndex(uiNumSourceElements, sourceIdx++, addressMode, useBorderColor);
+
+      if (useBorderColor)
+      {
+        for (plUInt32 x = 0; x < uiTileWidth; ++x)
+        {
+          total[x] = plSimdVec4f::MulAdd(vBorderColor, weight, total[x]);
+        }
+      }
+      else
+      {
+        const plSimdVec4f* __restrict sourcePtr = pSourceBegin + sourceRow * uiStride;
+        for (plUInt32 x = 0; x < uiTileWidth; ++x)
+        {
+          total[x] = plSimdVec4f::MulAdd(sourcePtr[x], weight, total[x]);
+        }
+      }
+    }
+
+    if (nextWeightPtr == weightsView.GetEndPtr())
+    {
+      nextWeightPtr = weightsView.GetPtr();
+    }
+
+    for (plUInt32 x = 0; x < uiTileWidth; ++x)
+    {
+      pTargetBegin[x] = total[x];
+    }
+    pTargetBegin += uiStride;
+  }
+}
+
+/// Makes sure that small images (e.g. the lower mip levels) are not split up into tasks that do hardly any work.
+static plParallelForParams GetFilterParallelForParams(plUInt32 uiPixelsPerItem)
+{
+  constexpr plUInt32 uiMinPixelsPerTask = 16 * 1024;
+
+  plParallelForParams params;
+  params.m_uiBinSize = plMath::Max(1u, uiMinPixelsPerTask / plMath::Max(1u, uiPixelsPerItem));
+  return params;
+}
+
 static void DownScaleFastLine(plUInt32 uiPixelStride, const plUInt8* pSrc, plUInt8* pDest, plUInt32 uiLengthIn, plUInt32 uiStrideIn, plUInt32 uiLengthOut, plUInt32 uiStrideOut)
 {
   const plUInt32 downScaleFactor = uiLengthIn / uiLengthOut;
@@ -1005,6 +1078,8 @@ plResult plImageUtils::Scale3D(const plImageView& source, plImage& ref_target, p
   plHybridArray<plInt32, 256> firstSampleIndices;
   firstSampleIndices.Reserve(plMath::Max(uiWidth, uiHeight, uiDepth));
 
+  const plSimdVec4f vBorderColor(borderColor.r, borderColor.g, borderColor.b, borderColor.a);
+
   if (uiWidth != originalWidth)
   {
     plImageFilterWeights weights(*pFilter, originalWidth, uiWidth);
@@ -1028,21 +1103,25 @@ plResult plImageUtils::Scale3D(const plImageView& source, plImage& ref_target, p
     stepHeader.SetWidth(uiWidth);
     stepTarget->ResetAndAlloc(stepHeader);
 
-    for (plUInt32 arrayIndex = 0; arrayIndex < numArrayElements; ++arrayIndex)
-    {
-      for (plUInt32 face = 0; face < numFaces; ++face)
+    // every row is filtered independently
+    const plUInt32 numRows = numArrayElements * numFaces * originalDepth * originalHeight;
+
+    plTaskSystem::ParallelForIndexed(
+      0, numRows, [&](plUInt32 uiStartIndex, plUInt32 uiEndIndex)
       {
-        for (plUInt32 z = 0; z < originalDepth; ++z)
+        for (plUInt32 row = uiStartIndex; row < uiEndIndex; ++row)
         {
-          for (plUInt32 y = 0; y < originalHeight; ++y)
-          {
-            const plSimdVec4f* filterSource = stepSource->GetPixelPointer<plSimdVec4f>(0, face, arrayIndex, 0, y, z);
-            plSimdVec4f* filterTarget = stepTarget->GetPixelPointer<plSimdVec4f>(0, face, arrayIndex, 0, y, z);
-            FilterLine(originalWidth, filterSource, filterTarget, 1, weights, firstSampleIndices, addressModeU, plSimdVec4f(borderColor.r, borderColor.g, borderColor.b, borderColor.a));
-          }
+          const plUInt32 y = row % originalHeight;
+          const plUInt32 z = (row / originalHeight) % originalDepth;
+          const plUInt32 face = (row / (originalHeight * originalDepth)) % numFaces;
+          const plUInt32 arrayIndex = row / (originalHeight * originalDepth * numFaces);
+
+          const plSimdVec4f* filterSource = stepSource->GetPixelPointer<plSimdVec4f>(0, face, arrayIndex, 0, y, z);
+          plSimdVec4f* filterTarget = stepTarget->GetPixelPointer<plSimdVec4f>(0, face, arrayIndex, 0, y, z);
+          FilterLine(originalWidth, filterSource, filterTarget, 1, weights, firstSampleIndices, addressModeU, vBorderColor);
         }
-      }
-    }
+      },
+      "Scale3D_Horizontal", plTaskNesting::Never, GetFilterParallelForParams(originalWidth + uiWidth));
 
     releaseScratch(*stepSource);
     stepSource = stepTarget;
@@ -1071,21 +1150,26 @@ plResult plImageUtils::Scale3D(const plImageView& source, plImage& ref_target, p
     stepHeader.SetHeight(uiHeight);
     stepTarget->ResetAndAlloc(stepHeader);
 
-    for (plUInt32 arrayIndex = 0; arrayIndex < numArrayElements; ++arrayIndex)
-    {
-      for (plUInt32 face = 0; face < numFaces; ++face)
+    // every tile of columns in every slice is filtered independently
+    const plUInt32 numTilesX = (uiWidth + FilterTileWidth - 1) / FilterTileWidth;
+    const plUInt32 numTiles = numArrayElements * numFaces * originalDepth * numTilesX;
+
+    plTaskSystem::ParallelForIndexed(
+      0, numTiles, [&](plUInt32 uiStartIndex, plUInt32 uiEndIndex)
       {
-        for (plUInt32 z = 0; z < originalDepth; ++z)
+        for (plUInt32 tile = uiStartIndex; tile < uiEndIndex; ++tile)
         {
-          for (plUInt32 x = 0; x < uiWidth; ++x)
-          {
-            const plSimdVec4f* filterSource = stepSource->GetPixelPointer<plSimdVec4f>(0, face, arrayIndex, x, 0, z);
-            plSimdVec4f* filterTarget = stepTarget->GetPixelPointer<plSimdVec4f>(0, face, arrayIndex, x, 0, z);
-            FilterLine(originalHeight, filterSource, filterTarget, uiWidth, weights, firstSampleIndices, addressModeV, plSimdVec4f(borderColor.r, borderColor.g, borderColor.b, borderColor.a));
-          }
+          const plUInt32 x = (tile % numTilesX) * FilterTileWidth;
+          const plUInt32 z = (tile / numTilesX) % originalDepth;
+          const plUInt32 face = (tile / (numTilesX * originalDepth)) % numFaces;
+          const plUInt32 arrayIndex = tile / (numTilesX * originalDepth * numFaces);
+
+          const plSimdVec4f* filterSource = stepSource->GetPixelPointer<plSimdVec4f>(0, face, arrayIndex, x, 0, z);
+          plSimdVec4f* filterTarget = stepTarget->GetPixelPointer<plSimdVec4f>(0, face, arrayIndex, x, 0, z);
+          FilterTile(originalHeight, filterSource, filterTarget, uiWidth, plMath::Min(FilterTileWidth, uiWidth - x), weights, firstSampleIndices, addressModeV, vBorderColor);
         }
-      }
-    }
+      },
+      "Scale3D_Vertical", plTaskNesting::Never, GetFilterParallelForParams(plMath::Min(FilterTileWidth, uiWidth) * (originalHeight + uiHeight)));
 
     releaseScratch(*stepSource);
     stepSource = stepTarget;
@@ -1114,21 +1198,26 @@ plResult plImageUtils::Scale3D(const plImageView& source, plImage& ref_target, p
     stepHeader.SetDepth(uiDepth);
     stepTarget->ResetAndAlloc(stepHeader);
 
-    for (plUInt32 arrayIndex = 0; arrayIndex < numArrayElements; ++arrayIndex)
-    {
-      for (plUInt32 face = 0; face < numFaces; ++face)
+    // every tile of columns in every row is filtered independently, the samples along the depth axis are one slice apart
+    const plUInt32 numTilesX = (uiWidth + FilterTileWidth - 1) / FilterTileWidth;
+    const plUInt32 numTiles = numArrayElements * numFaces * uiHeight * numTilesX;
+
+    plTaskSystem::ParallelForIndexed(
+      0, numTiles, [&](plUInt32 uiStartIndex, plUInt32 uiEndIndex)
       {
-        for (plUInt32 y = 0; y < uiHeight; ++y)
+        for (plUInt32 tile = uiStartIndex; tile < uiEndIndex; ++tile)
         {
-          for (plUInt32 x = 0; x < uiWidth; ++x)
-          {
-            const plSimdVec4f* filterSource = stepSource->GetPixelPointer<plSimdVec4f>(0, face, arrayIndex, x, y, 0);
-            plSimdVec4f* filterTarget = stepTarget->GetPixelPointer<plSimdVec4f>(0, face, arrayIndex, x, y, 0);
-            FilterLine(originalHeight, filterSource, filterTarget, uiWidth * uiHeight, weights, firstSampleIndices, addressModeW, plSimdVec4f(borderColor.r, borderColor.g, borderColor.b, borderColor.a));
-          }
+          const plUInt32 x = (tile % numTilesX) * FilterTileWidth;
+          const plUInt32 y = (tile / numTilesX) % uiHeight;
+          const plUInt32 face = (tile / (numTilesX * uiHeight)) % numFaces;
+          const plUInt32 arrayIndex = tile / (numTilesX * uiHeight * numFaces);
+
+          const plSimdVec4f* filterSource = stepSource->GetPixelPointer<plSimdVec4f>(0, face, arrayIndex, x, y, 0);
+          plSimdVec4f* filterTarget = stepTarget->GetPixelPointer<plSimdVec4f>(0, face, arrayIndex, x, y, 0);
+          FilterTile(originalDepth, filterSource, filterTarget, uiWidth * uiHeight, plMath::Min(FilterTileWidth, uiWidth - x), weights, firstSampleIndices, addressModeW, vBorderColor);
         }
-      }
-    }
+      },
+      "Scale3D_Depth", plTaskNesting::Never, GetFilterParallelForParams(plMath::Min(FilterTileWidth, uiWidth) * (originalDepth + uiDepth)));
 
     releaseScratch(*stepSource);
     stepSource = stepTarget;
@@ -1138,14 +1227,288 @@ plResult plImageUtils::Scale3D(const plImageView& source, plImage& ref_target, p
   return plImageConversion::Convert(*stepSource, ref_target, format);
 }
 
+plResult plImageUtils::ScaleInBands(const plImageView& source, plImage& ref_target, plUInt32 uiWidth, plUInt32 uiHeight, plUInt64 uiScratchMemoryBudget, const plImageFilter* pFilter /*= nullptr*/,
+  plImageAddressMode::Enum addressModeU /*= plImageAddressMode::Clamp*/, plImageAddressMode::Enum addressModeV /*= plImageAddressMode::Clamp*/, const plColor& borderColor /*= plColors::Black*/)
+{
+  PL_PROFILE_SCOPE("plImageUtils::ScaleInBands");
+
+  const plImageFormat::Enum format = source.GetImageFormat();
+
+  if (plImageFormat::IsCompressed(format) || source.GetDepth() != 1 || source.GetNumFaces() != 1 || source.GetNumArrayIndices() != 1)
+  {
+    return PL_FAILURE;
+  }
+
+  plImageHeader targetHeader;
+  targetHeader.SetImageFormat(plImageFormat::R32G32B32A32_FLOAT);
+
+  if (uiWidth == 0 || uiHeight == 0)
+  {
+    ref_target.ResetAndAlloc(targetHeader);
+    return PL_SUCCESS;
+  }
+
+  const plUInt32 originalWidth = source.GetWidth();
+  const plUInt32 originalHeight = source.GetHeight();
+
+  // the source rows are converted one at a time, with a path that is only built once
+  plHybridArray<plImageConversion::ConversionPathNode, 16> conversionPath;
+  plUInt32 uiNumConversionScratchBuffers = 0;
+  if (format != plImageFormat::R32G32B32A32_FLOAT)
+  {
+    PL_SUCCEED_OR_RETURN(plImageConversion::BuildPath(format, plImageFormat::R32G32B32A32_FLOAT, false, conversionPath, uiNumConversionScratchBuffers));
+  }
+
+  // Fallback to default filter
+  plImageFilterTriangle defaultFilter;
+  if (!pFilter)
+  {
+    pFilter = &defaultFilter;
+  }
+
+  const bool bScaleX = uiWidth != originalWidth;
+  const bool bScaleY = uiHeight != originalHeight;
+
+  const plImageFilterWeights weightsX(*pFilter, originalWidth, uiWidth);
+  const plImageFilterWeights weightsY(*pFilter, originalHeight, uiHeight);
+
+  plDynamicArray<plInt32> firstSampleIndicesX;
+  firstSampleIndicesX.SetCountUninitialized(uiWidth);
+  for (plUInt32 x = 0; x < uiWidth; ++x)
+  {
+    firstSampleIndicesX[x] = weightsX.GetFirstSourceSampleIndex(x);
+  }
+
+  const plSimdVec4f vBorderColor(borderColor.r, borderColor.g, borderColor.b, borderColor.a);
+
+  targetHeader.SetWidth(uiWidth);
+  targetHeader.SetHeight(uiHeight);
+  ref_target.ResetAndAlloc(targetHeader);
+
+  // Converts a single source row to float and filters it horizontally.
+  auto prepareRow = [&](plUInt32 uiSourceRow, plImage& ref_rowScratch, plSimdVec4f* pTarget)
+  {
+    const plSimdVec4f* pRow = nullptr;
+
+    if (conversionPath.IsEmpty())
+    {
+      pRow = source.GetPixelPointer<plSimdVec4f>(0, 0, 0, 0, uiSourceRow);
+    }
+    else
+    {
+      const plUInt64 uiSourceRowPitch = source.GetRowPitch();
+      const plConstByteBlobPtr sourceRow(source.GetPixelPointer<plUInt8>(0, 0, 0, 0, uiSourceRow), uiSourceRowPitch);
+
+      if (plImageConversion::ConvertRaw(sourceRow, ref_rowScratch.GetByteBlobPtr(), originalWidth, conversionPath, uiNumConversionScratchBuffers).Failed())
+        return false;
+
+      pRow = ref_rowScratch.GetPixelPointer<plSimdVec4f>();
+    }
+
+    if (bScaleX)
+    {
+      FilterLine(originalWidth, pRow, pTarget, 1, weightsX, firstSampleIndicesX, addressModeU, vBorderColor);
+    }
+    else
+    {
+      plMemoryUtils::Copy(pTarget, pRow, originalWidth);
+    }
+
+    return true;
+  };
+
+  plImageHeader rowScratchHeader;
+  rowScratchHeader.SetWidth(originalWidth);
+  rowScratchHeader.SetImageFormat(plImageFormat::R32G32B32A32_FLOAT);
+
+  plAtomicInteger32 iNumFailedRows = 0;
+
+  if (!bScaleY)
+  {
+    // without vertical filtering every source row goes straight into its target row
+    plTaskSystem::ParallelForIndexed(
+      0, uiHeight, [&](plUInt32 uiStartIndex, plUInt32 uiEndIndex)
+      {
+        plImage rowScratch;
+        rowScratch.ResetAndAlloc(rowScratchHeader);
+
+        for (plUInt32 y = uiStartIndex; y < uiEndIndex; ++y)
+        {
+          if (!prepareRow(y, rowScratch, ref_target.GetPixelPointer<plSimdVec4f>(0, 0, 0, 0, y)))
+            iNumFailedRows.Increment();
+        }
+      },
+      "ScaleInBands_Rows", plTaskNesting::Never, GetFilterParallelForParams(originalWidth + uiWidth));
+
+    return iNumFailedRows == 0 ? PL_SUCCESS : PL_FAILURE;
+  }
+
+  // Everything is processed in bands of target rows. Each band first prepares all the source rows that it needs (converted and
+  // horizontally filtered) and then filters those vertically. A band grows until the prepared rows don't fit into the budget anymore,
+  // rows that are shared by neighboring bands are prepared again.
+  const plUInt32 numWeightsY = weightsY.GetNumWeights();
+  const plUInt64 uiBandRowSize = plUInt64(uiWidth) * sizeof(plSimdVec4f);
+  const plUInt32 uiMaxBandRows = static_cast<plUInt32>(plMath::Clamp<plUInt64>(uiScratchMemoryBudget / uiBandRowSize, plMath::Min(numWeightsY, originalHeight), originalHeight));
+
+  plImageHeader bandHeader;
+  bandHeader.SetWidth(uiWidth);
+  bandHeader.SetHeight(uiMaxBandRows);
+  bandHeader.SetImageFormat(plImageFormat::R32G32B32A32_FLOAT);
+
+  plImage band;
+  band.ResetAndAlloc(bandHeader);
+
+  // maps a source row to the band row that holds its prepared data
+  plDynamicArray<plUInt32> sourceRowToBandRow;
+  sourceRowToBandRow.SetCount(originalHeight, plInvalidIndex);
+
+  plDynamicArray<plUInt32> bandSourceRows;
+  plHybridArray<plUInt32, 32> newSourceRows;
+
+  const auto weightsViewY = weightsY.ViewWeights();
+  const plUInt32 uiNumWeightSetsY = weightsViewY.GetCount() / numWeightsY;
+  const plUInt32 numTilesX = (uiWidth + FilterTileWidth - 1) / FilterTileWidth;
+
+  plUInt32 uiEndTargetRow = 0;
+  for (plUInt32 uiFirstTargetRow = 0; uiFirstTargetRow < uiHeight; uiFirstTargetRow = uiEndTargetRow)
+  {
+    for (plUInt32 uiSourceRow : bandSourceRows)
+    {
+      sourceRowToBandRow[uiSourceRow] = plInvalidIndex;
+    }
+    bandSourceRows.Clear();
+
+    // add target rows to the band, as long as the source rows they need still fit
+    for (uiEndTargetRow = uiFirstTargetRow; uiEndTargetRow < uiHeight; ++uiEndTargetRow)
+    {
+      const plInt32 firstSourceIdx = weightsY.GetFirstSourceSampleIndex(uiEndTargetRow);
+
+      newSourceRows.Clear();
+      for (plUInt32 weightIdx = 0; weightIdx < numWeightsY; ++weightIdx)
+      {
+        bool bUseBorderColor = false;
+        const plUInt32 uiSourceRow = GetSampleIndex(originalHeight, firstSourceIdx + weightIdx, addressModeV, bUseBorderColor);
+
+        if (!bUseBorderColor && sourceRowToBandRow[uiSourceRow] == plInvalidIndex && !newSourceRows.Contains(uiSourceRow))
+        {
+          newSourceRows.PushBack(uiSourceRow);
+        }
+      }
+
+      // a single target row always fits, since the band can hold at least numWeightsY rows
+      if (bandSourceRows.GetCount() + newSourceRows.GetCount() > uiMaxBandRows)
+        break;
+
+      for (plUInt32 uiSourceRow : newSourceRows)
+      {
+        sourceRowToBandRow[uiSourceRow] = bandSourceRows.GetCount();
+        bandSourceRows.PushBack(uiSourceRow);
+      }
+    }
+
+    plTaskSystem::ParallelForIndexed(
+      0, bandSourceRows.GetCount(), [&](plUInt32 uiStartIndex, plUInt32 uiEndIndex)
+      {
+        plImage rowScratch;
+        rowScratch.ResetAndAlloc(rowScratchHeader);
+
+        for (plUInt32 i = uiStartIndex; i < uiEndIndex; ++i)
+        {
+          if (!prepareRow(bandSourceRows[i], rowScratch, band.GetPixelPointer<plSimdVec4f>(0, 0, 0, 0, i)))
+            iNumFailedRows.Increment();
+        }
+      },
+      "ScaleInBands_Horizontal", plTaskNesting::Never, GetFilterParallelForParams(originalWidth + uiWidth));
+
+    if (iNumFailedRows > 0)
+      return PL_FAILURE;
+
+    // same accumulation order as FilterTile, so the result is identical to Scale3D
+    plTaskSystem::ParallelForIndexed(
+      0, (uiEndTargetRow - uiFirstTargetRow) * numTilesX, [&](plUInt32 uiStartIndex, plUInt32 uiEndIndex)
+      {
+        plSimdVec4f total[FilterTileWidth];
+
+        for (plUInt32 tile = uiStartIndex; tile < uiEndIndex; ++tile)
+        {
+          const plUInt32 y = uiFirstTargetRow + tile / numTilesX;
+          const plUInt32 x0 = (tile % numTilesX) * FilterTileWidth;
+          const plUInt32 uiTileWidth = plMath::Min(FilterTileWidth, uiWidth - x0);
+
+          for (plUInt32 x = 0; x < uiTileWidth; ++x)
+          {
+            total[x].SetZero();
+          }
+
+          const float* pWeights = weightsViewY.GetPtr() + (y % uiNumWeightSetsY) * numWeightsY;
+          const plInt32 firstSourceIdx = weightsY.GetFirstSourceSampleIndex(y);
+
+          for (plUInt32 weightIdx = 0; weightIdx < numWeightsY; ++weightIdx)
+          {
+            const plSimdVec4f weight(pWeights[weightIdx]);
+
+            bool bUseBorderColor = false;
+            const plUInt32 uiSourceRow = GetSampleIndex(originalHeight, firstSourceIdx + weightIdx, addressModeV, bUseBorderColor);
+
+            if (bUseBorderColor)
+            {
+              for (plUInt32 x = 0; x < uiTileWidth; ++x)
+              {
+                total[x] = plSimdVec4f::MulAdd(vBorderColor, weight, total[x]);
+              }
+            }
+            else
+            {
+              const plSimdVec4f* __restrict sourcePtr = band.GetPixelPointer<plSimdVec4f>(0, 0, 0, x0, sourceRowToBandRow[uiSourceRow]);
+              for (plUInt32 x = 0; x < uiTileWidth; ++x)
+              {
+                total[x] = plSimdVec4f::MulAdd(sourcePtr[x], weight, total[x]);
+              }
+            }
+          }
+
+          plSimdVec4f* pTarget = ref_target.GetPixelPointer<plSimdVec4f>(0, 0, 0, x0, y);
+          for (plUInt32 x = 0; x < uiTileWidth; ++x)
+          {
+            pTarget[x] = total[x];
+          }
+        }
+      },
+      "ScaleInBands_Vertical", plTaskNesting::Never, GetFilterParallelForParams(plMath::Min(FilterTileWidth, uiWidth) * numWeightsY));
+  }
+
+  return PL_SUCCESS;
+}
+
 void plImageUtils::GenerateMipMaps(const plImageView& source, plImage& ref_target, const MipMapOptions& options)
 {
   PL_PROFILE_SCOPE("plImageUtils::GenerateMipMaps");
 
-  plImageHeader header = source.GetHeader();
-  PL_ASSERT_DEV(header.GetImageFormat() == plImageFormat::R32G32B32A32_FLOAT, "The source image must be a RGBA 32-bit float format.");
   PL_ASSERT_DEV(&source != &ref_target, "Source and target must not be the same image.");
 
+  if (source.GetImageFormat() != plImageFormat::R32G32B32A32_FLOAT)
+  {
+    // filter in float and convert the entire mip chain back at the end, rather than converting every single mip level back and forth
+    plImage floatSource;
+    if (plImageConversion::Convert(source, floatSource, plImageFormat::R32G32B32A32_FLOAT).Failed())
+    {
+      plLog::Error("Failed to convert the source image from '{}' to RGBA 32-bit float for mipmap generation.", plImageFormat::GetName(source.GetImageFormat()));
+      return;
+    }
+
+    plImage floatTarget;
+    GenerateMipMaps(floatSource, floatTarget, options);
+
+    if (plImageConversion::Convert(floatTarget, ref_target, source.GetImageFormat()).Failed())
+    {
+      plLog::Error("Failed to convert the generated mipmaps back to '{}'.", plImageFormat::GetName(source.GetImageFormat()));
+    }
+
+    return;
+  }
+
+  plImageHeader header = source.GetHeader();
+
   // Make a local copy to be able to tweak some of the options
   plImageUtils::MipMapOptions mipMapOptions = options;
 
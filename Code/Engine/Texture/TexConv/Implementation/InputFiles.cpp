@@ -1,6 +1,7 @@
 #include <Texture/TexturePCH.h>
 
 #include <Foundation/Profiling/Profiling.h>
+#include <Foundation/Threading/TaskSystem.h>
 #include <Texture/Image/ImageUtils.h>
 #include <Texture/TexConv/TexConvProcessor.h>
 
@@ -34,16 +35,49 @@ plResult plTexConvProcessor::LoadInputImages()
   }
   else
   {
-    m_Descriptor.m_InputImages.Reserve(m_Descriptor.m_InputFiles.GetCount());
+    const plUInt32 uiNumFiles = m_Descriptor.m_InputFiles.GetCount();
+    m_Descriptor.m_InputImages.SetCount(uiNumFiles);
 
-    for (const auto& file : m_Descriptor.m_InputFiles)
+    plHybridArray<plTime, 8> loadTimes;
+    plHybridArray<bool, 8> loadSucceeded;
+    loadTimes.SetCount(uiNumFiles);
+    loadSucceeded.SetCount(uiNumFiles);
+
+    struct LoadContext
+    {
+      plTexConvDesc* m_pDesc;
+      plTime* m_pLoadTimes;
+      bool* m_pLoadSucceeded;
+    };
+
+    LoadContext ctx{&m_Descriptor, loadTimes.GetData(), loadSucceeded.GetData()};
+    const LoadContext* pCtx = &ctx;
+
+    plParallelForParams params;
+    params.m_uiBinSize = 1;
+
+    // Decoding is mostly serial per file, so the files are loaded at the same time. The decoders may run nested parallel loops (EXR).
+    plTaskSystem::ParallelForIndexed(
+      0, uiNumFiles, [pCtx](plUInt32 uiStartIndex, plUInt32 uiEndIndex)
+      {
+        for (plUInt32 i = uiStartIndex; i < uiEndIndex; ++i)
+        {
+          const plTime tStart = plTime::Now();
+          pCtx->m_pLoadSucceeded[i] = pCtx->m_pDesc->m_InputImages[i].LoadFrom(pCtx->m_pDesc->m_InputFiles[i]).Succeeded();
+          pCtx->m_pLoadTimes[i] = plTime::Now() - tStart;
+        }
+      },
+      "LoadInputImages", plTaskNesting::Maybe, params);
+
+    for (plUInt32 i = 0; i < uiNumFiles; ++i)
     {
-      auto& img = m_Descriptor.m_InputImages.ExpandAndGetRef();
-      if (img.LoadFrom(file).Failed())
+      if (!loadSucceeded[i])
       {
-        plLog::Error("Could not load input file '{0}'.", plArgSensitive(file, "File"));
+        plLog::Error("Could not load input file '{0}'.", plArgSensitive(m_Descriptor.m_InputFiles[i], "File"));
         return PL_FAILURE;
       }
+
+      plLog::Dev("Loaded '{}' in {}", plArgSensitive(m_Descriptor.m_InputFiles[i], "File"), loadTimes[i]);
     }
   }
 
@@ -61,25 +95,46 @@ plResult plTexConvProcessor::LoadInputImages()
   return PL_SUCCESS;
 }
 
-plResult plTexConvProcessor::ConvertAndScaleImage(plStringView sImageName, plImage& inout_Image, plUInt32 uiResolutionX, plUInt32 uiResolutionY, plEnum<plTexConvUsage> usage)
+plResult plTexConvProcessor::ConvertAndScaleImage(plStringView sImageName, plImage& inout_Image, plUInt32 uiResolutionX, plUInt32 uiResolutionY, plEnum<plTexConvUsage> usage, plUInt64 uiMemoryBudget)
 {
   const bool bSingleChannel = plImageFormat::GetNumChannels(inout_Image.GetImageFormat()) == 1;
 
-  if (inout_Image.Convert(plImageFormat::R32G32B32A32_FLOAT).Failed())
+  const plUInt64 uiFloatImageSize = plUInt64(inout_Image.GetWidth()) * inout_Image.GetHeight() * inout_Image.GetDepth() * inout_Image.GetNumFaces() * inout_Image.GetNumArrayIndices() * sizeof(plColor);
+
+  if (uiMemoryBudget > 0 && uiFloatImageSize > uiMemoryBudget && inout_Image.GetNumMipLevels() == 1 && !plImageFormat::IsCompressed(inout_Image.GetImageFormat()) &&
+      inout_Image.GetDepth() == 1 && inout_Image.GetNumFaces() == 1 && inout_Image.GetNumArrayIndices() == 1)
   {
-    plLog::Error("Could not convert '{}' to RGBA 32-Bit Float format.", sImageName);
-    return PL_FAILURE;
-  }
+    // the full resolution float image would not fit into the budget, so convert and scale in bands, giving the scratch rows whatever is
+    // left after the (scaled) result
+    const plUInt64 uiTargetSize = plUInt64(uiResolutionX) * uiResolutionY * sizeof(plColor);
+    const plUInt64 uiScratchBudget = uiMemoryBudget > uiTargetSize ? uiMemoryBudget - uiTargetSize : 0;
 
-  // some scale operations fail when they are done in place, so use a scratch image as destination for now
-  plImage scratch;
-  if (plImageUtils::Scale(inout_Image, scratch, uiResolutionX, uiResolutionY, nullptr, plImageAddressMode::Clamp, plImageAddressMode::Clamp).Failed())
+    plImage scaled;
+    if (plImageUtils::ScaleInBands(inout_Image, scaled, uiResolutionX, uiResolutionY, uiScratchBudget, nullptr, plImageAddressMode::Clamp, plImageAddressMode::Clamp).Failed())
+    {
+      plLog::Error("Could not convert and resize '{}' to {}x{} within the memory budget.", sImageName, uiResolutionX, uiResolutionY);
+      return PL_FAILURE;
+    }
+
+    inout_Image.ResetAndMove(std::move(scaled));
+  }
+  else if (inout_Image.Convert(plImageFormat::R32G32B32A32_FLOAT).Failed())
   {
-    plLog::Error("Could not resize '{}' to {}x{}", sImageName, uiResolutionX, uiResolutionY);
+    plLog::Error("Could not convert '{}' to RGBA 32-Bit Float format.", sImageName);
     return PL_FAILURE;
   }
+  else
+  {
+    // some scale operations fail when they are done in place, so use a scratch image as destination for now
+    plImage scratch;
+    if (plImageUtils::Scale(inout_Image, scratch, uiResolutionX, uiResolutionY, nullptr, plImageAddressMode::Clamp, plImageAddressMode::Clamp).Failed())
+    {
+      plLog::Error("Could not resize '{}' to {}x{}", sImageName, uiResolutionX, uiResolutionY);
+      return PL_FAILURE;
+    }
 
-  inout_Image.ResetAndMove(std::move(scratch));
+    inout_Image.ResetAndMove(std::move(scratch));
+  }
 
   if (usage == plTexConvUsage::Color && bSingleChannel)
   {
@@ -100,7 +155,7 @@ plResult plTexConvProcessor::ConvertAndScaleInputImages(plUInt32 uiResolutionX,
     auto& img = m_Descriptor.m_InputImages[idx];
     plStringView sName = m_Descriptor.m_InputFiles[idx];
 
-    PL_SUCCEED_OR_RETURN(ConvertAndScaleImage(sName, img, uiResolutionX, uiResolutionY, usage));
+    PL_SUCCEED_OR_RETURN(ConvertAndScaleImage(sName, img, uiResolutionX, uiResolutionY, usage, m_Descriptor.m_uiMemoryBudget));
   }
 
   return PL_SUCCESS;
@@ -2,7 +2,9 @@
 
 #include <Foundation/Profiling/Profiling.h>
 #include <Foundation/Reflection/ReflectionUtils.h>
+#include <Texture/Image/ImageConversion.h>
 #include <Texture/Image/ImageUtils.h>
+#include <Texture/TexConv/TexConvCache.h>
 #include <Texture/TexConv/TexConvProcessor.h>
 
 // clang-format off
@@ -34,6 +36,16 @@ plResult plTexConvProcessor::Process()
   }
   else
   {
+    // the key has to be computed before anything modifies the descriptor
+    plUInt64 uiCacheKey = 0;
+    const bool bUseCache = !m_Descriptor.m_sCacheDirectory.IsEmpty() && plTexConvCache::ComputeKey(m_Descriptor, uiCacheKey).Succeeded();
+
+    if (bUseCache && plTexConvCache::Load(m_Descriptor.m_sCacheDirectory, uiCacheKey, m_OutputImage, m_LowResOutputImage, m_ThumbnailOutputImage).Succeeded())
+    {
+      plLog::Info("Output was read from the cache.");
+      return PL_SUCCESS;
+    }
+
     PL_SUCCEED_OR_RETURN(LoadInputImages());
 
     PL_SUCCEED_OR_RETURN(AdjustUsage(m_Descriptor.m_InputFiles[0], m_Descriptor.m_InputImages[0], m_Descriptor.m_Usage));
@@ -89,17 +101,30 @@ plResult plTexConvProcessor::Process()
       PL_SUCCEED_OR_RETURN(Assemble3DTexture(assembledImg));
     }
 
+    if (m_Descriptor.m_uiMemoryBudget > 0)
+    {
+      // everything from here on only works on the assembled image, don't keep the inputs around while generating the mipmaps
+      m_Descriptor.m_InputImages.Clear();
+    }
+
     PL_SUCCEED_OR_RETURN(AdjustHdrExposure(assembledImg));
 
     PL_SUCCEED_OR_RETURN(GenerateMipmaps(assembledImg, 0, uiNumChannelsUsed == 1 ? MipmapChannelMode::SingleChannel : MipmapChannelMode::AllChannels));
 
     PL_SUCCEED_OR_RETURN(PremultiplyAlpha(assembledImg));
 
-    PL_SUCCEED_OR_RETURN(GenerateOutput(std::move(assembledImg), m_OutputImage, OutputImageFormat));
+    PL_SUCCEED_OR_RETURN(GenerateOutput(std::move(assembledImg), m_OutputImage, OutputImageFormat, m_Descriptor.m_BCnQuality));
 
     PL_SUCCEED_OR_RETURN(GenerateThumbnailOutput(m_OutputImage, m_ThumbnailOutputImage, m_Descriptor.m_uiThumbnailOutputResolution));
 
     PL_SUCCEED_OR_RETURN(GenerateLowResOutput(m_OutputImage, m_LowResOutputImage, m_Descriptor.m_uiLowResMipmaps));
+
+    if (bUseCache && plTexConvCache::Store(m_Descriptor.m_sCacheDirectory, uiCacheKey, m_OutputImage, m_LowResOutputImage, m_ThumbnailOutputImage,
+                       m_Descriptor.m_uiCacheSizeLimit)
+                       .Failed())
+    {
+      plLog::Warning("Failed to store the output in the cache directory '{}'.", m_Descriptor.m_sCacheDirectory);
+    }
   }
 
   return PL_SUCCESS;
@@ -188,13 +213,16 @@ plResult plTexConvProcessor::DetectNumChannels(plArrayPtr<const plTexConvSliceCh
   return PL_SUCCESS;
 }
 
-plResult plTexConvProcessor::GenerateOutput(plImage&& src, plImage& dst, plEnum<plImageFormat> format)
+plResult plTexConvProcessor::GenerateOutput(plImage&& src, plImage& dst, plEnum<plImageFormat> format, plEnum<plBCnEncoderQuality> bcnQuality)
 {
   PL_PROFILE_SCOPE("GenerateOutput");
 
   dst.ResetAndMove(std::move(src));
 
-  if (dst.Convert(format).Failed())
+  plImageConversionSettings settings;
+  settings.m_BCnQuality = bcnQuality;
+
+  if (plImageConversion::Convert(dst, dst, format, settings).Failed())
   {
     plLog::Error("Failed to convert result image to output format '{}'", plImageFormat::GetName(format));
     return PL_FAILURE;
@@ -0,0 +1,98 @@
+#include <Texture/TexturePCH.h>
+
+#include <Foundation/Profiling/Profiling.h>
+#include <Foundation/Threading/AtomicInteger.h>
+#include <Foundation/Threading/TaskSystem.h>
+#include <Texture/TexConv/TexConvBatch.h>
+
+plTexConvBatch::plTexConvBatch() = default;
+plTexConvBatch::~plTexConvBatch() = default;
+
+plTexConvProcessor& plTexConvBatch::AddConversion()
+{
+  Conversion& conversion = m_Conversions.ExpandAndGetRef();
+  conversion.m_pProcessor = PL_DEFAULT_NEW(plTexConvProcessor);
+  return *conversion.m_pProcessor;
+}
+
+plResult plTexConvBatch::Process()
+{
+  PL_PROFILE_SCOPE("plTexConvBatch::Process");
+
+  const plUInt32 uiNumConversions = m_Conversions.GetCount();
+  if (uiNumConversions == 0)
+    return PL_SUCCESS;
+
+  const plUInt32 uiNumWorkers = plMath::Max(1u, plTaskSystem::GetWorkerThreadCount(plWorkerThreadType::ShortTasks));
+  const plUInt32 uiMaxConcurrent = plMath::Min(m_uiMaxConcurrentConversions == 0 ? uiNumWorkers : m_uiMaxConcurrentConversions, uiNumConversions);
+
+  for (Conversion& conversion : m_Conversions)
+  {
+    conversion.m_Result = PL_FAILURE;
+  }
+
+  // Conversions take very different amounts of time, so instead of assigning a fixed range to every task,
+  // each task keeps taking the next conversion that nobody has started yet.
+  plAtomicInteger32 iNextConversion;
+
+  struct Context
+  {
+    plTexConvBatch* m_pBatch;
+    plAtomicInteger32* m_pNextConversion;
+    plUInt32 m_uiNumConversions;
+  };
+
+  Context ctx{this, &iNextConversion, uiNumConversions};
+  const Context* pCtx = &ctx;
+
+  plParallelForParams params;
+  params.m_uiBinSize = 1;
+  params.m_uiMaxTasksPerThread = (uiMaxConcurrent + uiNumWorkers - 1) / uiNumWorkers;
+
+  // the conversions run nested parallel loops, so the tasks must be allowed to wait
+  plTaskSystem::ParallelForIndexed(
+    0, uiMaxConcurrent, [pCtx](plUInt32, plUInt32)
+    {
+      while (true)
+      {
+        const plUInt32 uiIndex = static_cast<plUInt32>(pCtx->m_pNextConversion->PostIncrement());
+        if (uiIndex >= pCtx->m_uiNumConversions)
+          return;
+
+        pCtx->m_pBatch->RunConversion(uiIndex);
+      }
+    },
+    "plTexConvBatch", plTaskNesting::Maybe, params);
+
+  for (const Conversion& conversion : m_Conversions)
+  {
+    if (conversion.m_Result.Failed())
+      return PL_FAILURE;
+  }
+
+  return PL_SUCCESS;
+}
+
+void plTexConvBatch::RunConversion(plUInt32 uiIndex)
+{
+  Conversion& conversion = m_Conversions[uiIndex];
+  plTexConvProcessor& processor = *conversion.m_pProcessor;
+
+  plStringView sName = processor.m_Descriptor.m_InputFiles.IsEmpty() ? plStringView("<image>") : plStringView(processor.m_Descriptor.m_InputFiles[0]);
+
+  {
+    PL_LOG_BLOCK("Texture Conversion", sName);
+
+    conversion.m_Result = processor.Process();
+
+    if (conversion.m_Result.Failed())
+    {
+      plLog::Error("Conversion {} of the batch failed.", uiIndex);
+    }
+  }
+
+  if (m_OnConversionFinished.IsValid())
+  {
+    m_OnConversionFinished(uiIndex, processor, conversion.m_Result);
+  }
+}
@@ -0,0 +1,384 @@
+#include <Texture/TexturePCH.h>
+
+#include <Foundation/Algorithm/HashStream.h>
+#include <Foundation/Algorithm/Sorting.h>
+#include <Foundation/IO/FileSystem/FileReader.h>
+#include <Foundation/IO/MemoryStream.h>
+#include <Foundation/IO/OSFile.h>
+#include <Foundation/Profiling/Profiling.h>
+#include <Foundation/Types/Uuid.h>
+#include <Texture/TexConv/TexConvCache.h>
+
+namespace
+{
+  // increase this whenever the processing changes in a way that produces different output, to invalidate all existing entries
+  constexpr plUInt64 CacheKeyVersion = 1;
+
+  constexpr plUInt32 EntryMagic = 0x43545450; // 'PTTC'
+  constexpr plUInt8 EntryVersion = 1;
+
+  // every entry is a folder, so that it can be created and deleted atomically
+  constexpr plStringView DataFileName = "Data.plTexConvCache"_plsv;
+  constexpr plStringView UsedMarkerFileName = "LastUse.plTexConvCache"_plsv;
+
+  // temporary folders of entries that are still being written are never this old, unless the writing process crashed
+  constexpr plTime TempFolderMaxAge = plTime::MakeFromHours(1);
+
+  void getEntryFolder(plStringView sCacheDirectory, plUInt64 uiKey, plStringBuilder& out_sPath)
+  {
+    out_sPath = plOSFile::MakePathAbsoluteWithCWD(sCacheDirectory);
+    out_sPath.AppendFormat("/{}", plArgU(uiKey, 16, true, 16));
+    out_sPath.MakeCleanPath();
+  }
+
+  /// Reading an entry rewrites its marker file, the modification time of the marker is the time of the last use.
+  /// The current time is written into it, because not every file system updates the modification time when an empty file is truncated.
+  void markEntryAsUsed(plStringView sEntryFolder)
+  {
+    plStringBuilder sPath = sEntryFolder;
+    sPath.AppendPath(UsedMarkerFileName);
+
+    plOSFile file;
+    if (file.Open(sPath, plFileOpenMode::Write).Succeeded())
+    {
+      const plInt64 iNow = plTimestamp::CurrentTimestamp().GetInt64(plSIUnitOfTime::Second);
+      file.Write(&iNow, sizeof(iNow)).IgnoreResult();
+      file.Close();
+    }
+  }
+
+  void hashImage(plStreamWriter& inout_stream, const plImageView& image)
+  {
+    inout_stream << image.GetWidth() << image.GetHeight() << image.GetDepth() << image.GetNumMipLevels() << image.GetNumFaces() << image.GetNumArrayIndices();
+    inout_stream << static_cast<plUInt32>(image.GetImageFormat());
+    inout_stream.WriteBytes(image.GetByteBlobPtr().GetPtr(), image.GetByteBlobPtr().GetCount()).AssertSuccess();
+  }
+
+  plResult writeImage(plOSFile& inout_file, const plImageView& image)
+  {
+    const bool bValid = image.GetImageFormat() != plImageFormat::UNKNOWN && image.GetWidth() > 0;
+
+    plUInt32 header[8] = {};
+    header[0] = bValid ? 1 : 0;
+
+    if (bValid)
+    {
+      header[1] = image.GetWidth();
+      header[2] = image.GetHeight();
+      header[3] = image.GetDepth();
+      header[4] = image.GetNumMipLevels();
+      header[5] = image.GetNumFaces();
+      header[6] = image.GetNumArrayIndices();
+      header[7] = static_cast<plUInt32>(image.GetImageFormat());
+    }
+
+    PL_SUCCEED_OR_RETURN(inout_file.Write(header, sizeof(header)));
+
+    if (bValid)
+    {
+      const plUInt64 uiDataSize = image.GetByteBlobPtr().GetCount();
+      PL_SUCCEED_OR_RETURN(inout_file.Write(&uiDataSize, sizeof(uiDataSize)));
+      PL_SUCCEED_OR_RETURN(inout_file.Write(image.GetByteBlobPtr().GetPtr(), uiDataSize));
+    }
+
+    return PL_SUCCESS;
+  }
+
+  plResult readImage(plRawMemoryStreamReader& inout_reader, plImage& out_image)
+  {
+    plUInt32 header[8];
+    if (inout_reader.ReadBytes(header, sizeof(header)) != sizeof(header))
+      return PL_FAILURE;
+
+    if (header[0] == 0)
+    {
+      out_image.Clear();
+      return PL_SUCCESS;
+    }
+
+    if (header[7] == plImageFormat::UNKNOWN || header[7] >= plImageFormat::NUM_FORMATS)
+      return PL_FAILURE;
+
+    plImageHeader imageHeader;
+    imageHeader.SetWidth(header[1]);
+    imageHeader.SetHeight(header[2]);
+    imageHeader.SetDepth(header[3]);
+    imageHeader.SetNumMipLevels(header[4]);
+    imageHeader.SetNumFaces(header[5]);
+    imageHeader.SetNumArrayIndices(header[6]);
+    imageHeader.SetImageFormat(static_cast<plImageFormat::Enum>(header[7]));
+
+    plUInt64 uiDataSize = 0;
+    inout_reader >> uiDataSize;
+
+    // don't allocate anything before the header is known to match the data
+    if (uiDataSize != imageHeader.ComputeDataSize() || uiDataSize > inout_reader.GetByteCount() - inout_reader.GetReadPosition())
+      return PL_FAILURE;
+
+    out_image.ResetAndAlloc(imageHeader);
+
+    if (inout_reader.ReadBytes(out_image.GetByteBlobPtr().GetPtr(), uiDataSize) != uiDataSize)
+      return PL_FAILURE;
+
+    return PL_SUCCESS;
+  }
+} // namespace
+
+plResult plTexConvCache::ComputeKey(const plTexConvDesc& desc, plUInt64& out_uiKey)
+{
+  PL_PROFILE_SCOPE("plTexConvCache::ComputeKey");
+
+  // the atlas inputs are listed in the atlas description file, not in the descriptor
+  if (desc.m_OutputType == plTexConvOutputType::Atlas)
+    return PL_FAILURE;
+
+  plHashStreamWriter64 stream(CacheKeyVersion);
+
+  // the file name is part of the key, because the usage may be detected from it
+  stream << desc.m_InputFiles.GetCount();
+  for (const plString& sFile : desc.m_InputFiles)
+  {
+    stream << plPathUtils::GetFileNameAndExtension(sFile);
+
+    plFileReader file;
+    if (file.Open(sFile).Failed())
+      return PL_FAILURE;
+
+    plUInt8 buffer[1024 * 64];
+    while (const plUInt64 uiRead = file.ReadBytes(buffer, PL_ARRAY_SIZE(buffer)))
+    {
+      PL_SUCCEED_OR_RETURN(stream.WriteBytes(buffer, uiRead));
+    }
+  }
+
+  stream << desc.m_InputImages.GetCount();
+  for (const plImage& image : desc.m_InputImages)
+  {
+    hashImage(stream, image);
+  }
+
+  stream << desc.m_ChannelMappings.GetCount();
+  for (const plTexConvSliceChannelMapping& mapping : desc.m_ChannelMappings)
+  {
+    for (const plTexConvChannelMapping& channel : mapping.m_Channel)
+    {
+      stream << channel.m_iInputImageIndex << static_cast<plUInt32>(channel.m_ChannelValue);
+    }
+  }
+
+  stream << desc.m_OutputType << desc.m_TargetPlatform;
+  stream << desc.m_uiLowResMipmaps << desc.m_uiThumbnailOutputResolution;
+  stream << desc.m_Usage << desc.m_CompressionMode << desc.m_BCnQuality;
+  stream << desc.m_uiMinResolution << desc.m_uiMaxResolution << desc.m_uiDownscaleSteps;
+  stream << desc.m_MipmapMode << desc.m_FilterMode << desc.m_AddressModeU << desc.m_AddressModeV << desc.m_AddressModeW;
+  stream << desc.m_bPreserveMipmapCoverage << desc.m_fMipmapAlphaThreshold;
+  stream << desc.m_uiDilateColor << desc.m_bFlipHorizontal << desc.m_bPremultiplyAlpha << desc.m_fHdrExposureBias << desc.m_fMaxValue;
+  stream << desc.m_uiMemoryBudget;
+  stream << desc.m_uiAssetHash << desc.m_uiAssetVersion;
+  stream << desc.m_BumpMapFilter;
+
+  out_uiKey = stream.GetHashValue();
+  return PL_SUCCESS;
+}
+
+plResult plTexConvCache::Load(plStringView sCacheDirectory, plUInt64 uiKey, plImage& out_output, plImage& out_lowResOutput, plImage& out_thumbnailOutput)
+{
+  PL_PROFILE_SCOPE("plTexConvCache::Load");
+
+  plStringBuilder sEntryFolder;
+  getEntryFolder(sCacheDirectory, uiKey, sEntryFolder);
+
+  plStringBuilder sPath = sEntryFolder;
+  sPath.AppendPath(DataFileName);
+
+  plDynamicArray<plUInt8> content;
+  {
+    plOSFile file;
+    if (file.Open(sPath, plFileOpenMode::Read).Failed())
+      return PL_FAILURE;
+
+    file.ReadAll(content);
+  }
+
+  plRawMemoryStreamReader reader(content);
+
+  plUInt32 uiMagic = 0;
+  plUInt8 uiVersion = 0;
+  reader >> uiMagic;
+  reader >> uiVersion;
+
+  if (uiMagic != EntryMagic || uiVersion != EntryVersion)
+    return PL_FAILURE;
+
+  if (readImage(reader, out_output).Failed() || readImage(reader, out_lowResOutput).Failed() || readImage(reader, out_thumbnailOutput).Failed())
+  {
+    plLog::Warning("Texture cache entry '{}' is corrupt.", sPath);
+    return PL_FAILURE;
+  }
+
+  markEntryAsUsed(sEntryFolder);
+  return PL_SUCCESS;
+}
+
+plResult plTexConvCache::Store(plStringView sCacheDirectory, plUInt64 uiKey, const plImageView& output, const plImageView& lowResOutput,
+  const plImageView& thumbnailOutput, plUInt64 uiMaxCacheSize)
+{
+  PL_PROFILE_SCOPE("plTexConvCache::Store");
+
+  plStringBuilder sEntryFolder;
+  getEntryFolder(sCacheDirectory, uiKey, sEntryFolder);
+
+  // write into a temporary folder first, so that other processes never see incomplete entries
+  plUInt64 uiUniqueHigh, uiUniqueLow;
+  plUuid::MakeUuid().GetValues(uiUniqueHigh, uiUniqueLow);
+
+  plStringBuilder sTempFolder = sEntryFolder;
+  sTempFolder.AppendFormat("-{}{}.tmp", plArgU(uiUniqueHigh, 16, true, 16), plArgU(uiUniqueLow, 16, true, 16));
+
+  PL_SUCCEED_OR_RETURN(plOSFile::CreateDirectoryStructure(sTempFolder));
+
+  plResult result = PL_FAILURE;
+  {
+    plStringBuilder sPath = sTempFolder;
+    sPath.AppendPath(DataFileName);
+
+    plOSFile file;
+    if (file.Open(sPath, plFileOpenMode::Write).Succeeded())
+    {
+      result = file.Write(&EntryMagic, sizeof(EntryMagic));
+
+      if (result.Succeeded())
+        result = file.Write(&EntryVersion, sizeof(EntryVersion));
+
+      if (result.Succeeded())
+        result = writeImage(file, output);
+
+      if (result.Succeeded())
+        result = writeImage(file, lowResOutput);
+
+      if (result.Succeeded())
+        result = writeImage(file, thumbnailOutput);
+    }
+  }
+
+  if (result.Succeeded() && plOSFile::MoveFileOrDirectory(sTempFolder, sEntryFolder).Failed())
+  {
+    // another process may have stored the same entry in the meantime
+    if (!plOSFile::ExistsDirectory(sEntryFolder))
+      result = PL_FAILURE;
+  }
+
+  if (plOSFile::ExistsDirectory(sTempFolder))
+  {
+    plOSFile::DeleteFolder(sTempFolder).IgnoreResult();
+  }
+
+  PL_SUCCEED_OR_RETURN(result);
+
+  markEntryAsUsed(sEntryFolder);
+
+  Trim(sCacheDirectory, uiMaxCacheSize);
+  return PL_SUCCESS;
+}
+
+void plTexConvCache::Trim(plStringView sCacheDirectory, plUInt64 uiMaxCacheSize)
+{
+#if PL_ENABLED(PL_SUPPORTS_FILE_ITERATORS)
+  PL_PROFILE_SCOPE("plTexConvCache::Trim");
+
+  struct Entry
+  {
+    plUInt64 m_uiKey = 0;
+    plUInt64 m_uiSize = 0;
+    plTimestamp m_LastUse;
+  };
+
+  const plString sDirectory = plOSFile::MakePathAbsoluteWithCWD(sCacheDirectory);
+
+  plDynamicArray<plFileStats> folders;
+  plOSFile::GatherAllItemsInFolder(folders, sDirectory, plFileSystemIteratorFlags::ReportFolders);
+
+  plDynamicArray<Entry> entries;
+  plUInt64 uiTotalSize = 0;
+
+  const plTimestamp now = plTimestamp::CurrentTimestamp();
+
+  plStringBuilder sPath;
+  for (const plFileStats& folder : folders)
+  {
+    if (!folder.m_bIsDirectory)
+      continue;
+
+    plFileStats stats;
+
+    if (folder.m_sName.EndsWith(".tmp"))
+    {
+      // the folder is only modified when the data file is created, so check the data file as well
+      plTimestamp lastWrite = folder.m_LastModificationTime;
+
+      folder.GetFullPath(sPath);
+      sPath.AppendPath(DataFileName);
+      if (plOSFile::GetFileStats(sPath, stats).Succeeded() && stats.m_LastModificationTime.Compare(lastWrite, plTimestamp::CompareMode::Newer))
+      {
+        lastWrite = stats.m_LastModificationTime;
+      }
+
+      if (lastWrite.IsValid() && now - lastWrite > TempFolderMaxAge)
+      {
+        folder.GetFullPath(sPath);
+        plOSFile::DeleteFolder(sPath).IgnoreResult();
+      }
+
+      continue;
+    }
+
+    // entry folders are named after the 16 digit key, ConvertHexStringToUInt() would ignore anything after that and accept a '0x' prefix
+    Entry entry;
+    plUInt32 uiParsed = 0;
+    if (folder.m_sName.GetElementCount() != 16 || folder.m_sName.StartsWith_NoCase("0x") ||
+        plConversionUtils::ConvertHexStringToUInt(folder.m_sName, entry.m_uiKey, 16, &uiParsed).Failed() || uiParsed != 16)
+      continue;
+
+    folder.GetFullPath(sPath);
+    sPath.AppendPath(DataFileName);
+    if (plOSFile::GetFileStats(sPath, stats).Succeeded())
+    {
+      entry.m_uiSize = stats.m_uiFileSize;
+      entry.m_LastUse = stats.m_LastModificationTime;
+    }
+
+    // the newer of the data and the marker file is the time of the last use
+    folder.GetFullPath(sPath);
+    sPath.AppendPath(UsedMarkerFileName);
+    if (plOSFile::GetFileStats(sPath, stats).Succeeded() && (!entry.m_LastUse.IsValid() || stats.m_LastModificationTime.Compare(entry.m_LastUse, plTimestamp::CompareMode::Newer)))
+    {
+      entry.m_LastUse = stats.m_LastModificationTime;
+    }
+
+    uiTotalSize += entry.m_uiSize;
+    entries.PushBack(entry);
+  }
+
+  if (uiTotalSize <= uiMaxCacheSize)
+    return;
+
+  entries.Sort([](const Entry& a, const Entry& b)
+    { return b.m_LastUse.Compare(a.m_LastUse, plTimestamp::CompareMode::Newer); });
+
+  for (const Entry& entry : entries)
+  {
+    if (uiTotalSize <= uiMaxCacheSize)
+      break;
+
+    // entries that are currently read by another process may fail to be deleted, they stay until the next trim
+    getEntryFolder(sCacheDirectory, entry.m_uiKey, sPath);
+    if (plOSFile::DeleteFolder(sPath).Succeeded())
+    {
+      uiTotalSize -= entry.m_uiSize;
+    }
+  }
+#else
+  PL_IGNORE_UNUSED(sCacheDirectory);
+  PL_IGNORE_UNUSED(uiMaxCacheSize);
+#endif
+}
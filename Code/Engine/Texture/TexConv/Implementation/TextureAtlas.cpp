@@ -1,6 +1,8 @@
 #include <Texture/TexturePCH.h>
 
 #include <Foundation/IO/FileSystem/DeferredFileWriter.h>
+#include <Foundation/Threading/AtomicInteger.h>
+#include <Foundation/Threading/TaskSystem.h>
 #include <Texture/Image/Formats/DdsFileFormat.h>
 #include <Texture/Image/ImageUtils.h>
 #include <Texture/TexConv/TexConvProcessor.h>
@@ -96,7 +98,7 @@ plResult plTexConvProcessor::LoadAtlasInputs(const plTextureAtlasCreationDesc& a
         plUInt32 uiResX = 0, uiResY = 0;
         PL_SUCCEED_OR_RETURN(DetermineTargetResolution(item.m_InputImage[layer], plImageFormat::UNKNOWN, uiResX, uiResY));
 
-        PL_SUCCEED_OR_RETURN(ConvertAndScaleImage(srcItem.m_sLayerInput[layer], item.m_InputImage[layer], uiResX, uiResY, atlasDesc.m_Layers[layer].m_Usage));
+        PL_SUCCEED_OR_RETURN(ConvertAndScaleImage(srcItem.m_sLayerInput[layer], item.m_InputImage[layer], uiResX, uiResY, atlasDesc.m_Layers[layer].m_Usage, m_Descriptor.m_uiMemoryBudget));
       }
     }
 
@@ -114,11 +116,11 @@ plResult plTexConvProcessor::LoadAtlasInputs(const plTextureAtlasCreationDesc& a
       plUInt32 uiResX = 0, uiResY = 0;
       PL_SUCCEED_OR_RETURN(DetermineTargetResolution(alphaImg, plImageFormat::UNKNOWN, uiResX, uiResY));
 
-      PL_SUCCEED_OR_RETURN(ConvertAndScaleImage(srcItem.m_sAlphaInput, alphaImg, uiResX, uiResY, plTexConvUsage::Linear));
+      PL_SUCCEED_OR_RETURN(ConvertAndScaleImage(srcItem.m_sAlphaInput, alphaImg, uiResX, uiResY, plTexConvUsage::Linear, m_Descriptor.m_uiMemoryBudget));
 
 
       // layer 0 must have the exact same size as the alpha texture
-      PL_SUCCEED_OR_RETURN(ConvertAndScaleImage(srcItem.m_sLayerInput[0], item.m_InputImage[0], uiResX, uiResY, plTexConvUsage::Linear));
+      PL_SUCCEED_OR_RETURN(ConvertAndScaleImage(srcItem.m_sLayerInput[0], item.m_InputImage[0], uiResX, uiResY, plTexConvUsage::Linear, m_Descriptor.m_uiMemoryBudget));
 
       // copy alpha channel into layer 0
       PL_SUCCEED_OR_RETURN(plImageUtils::CopyChannel(item.m_InputImage[0], 3, alphaImg, 0));
@@ -129,7 +131,7 @@ plResult plTexConvProcessor::LoadAtlasInputs(const plTextureAtlasCreationDesc& a
         if (item.m_InputImage[layer].GetWidth() <= uiResX && item.m_InputImage[layer].GetHeight() <= uiResY)
           continue;
 
-        PL_SUCCEED_OR_RETURN(ConvertAndScaleImage(srcItem.m_sLayerInput[layer], item.m_InputImage[layer], uiResX, uiResY, plTexConvUsage::Linear));
+        PL_SUCCEED_OR_RETURN(ConvertAndScaleImage(srcItem.m_sLayerInput[layer], item.m_InputImage[layer], uiResX, uiResY, plTexConvUsage::Linear, m_Descriptor.m_uiMemoryBudget));
       }
     }
   }
@@ -198,37 +200,56 @@ plResult plTexConvProcessor::TrySortItemsIntoAtlas(plDynamicArray<TextureAtlasIt
 
 plResult plTexConvProcessor::SortItemsIntoAtlas(plDynamicArray<TextureAtlasItem>& items, plUInt32& out_ResX, plUInt32& out_ResY, plInt32 layer)
 {
-  for (plUInt32 power = 8; power < 14; ++power)
-  {
-    const plUInt32 halfRes = 1 << (power - 1);
-    const plUInt32 resolution = 1 << power;
-    const plUInt32 resDivCellSize = resolution / uiAtlasCellSize;
-    const plUInt32 halfResDivCellSize = halfRes / uiAtlasCellSize;
+  constexpr plUInt32 uiMinPower = 8;
+  constexpr plUInt32 uiMaxPower = 13;
 
-    if (TrySortItemsIntoAtlas(items, resDivCellSize, halfResDivCellSize, layer).Succeeded())
-    {
-      out_ResX = resolution;
-      out_ResY = halfRes;
-      return PL_SUCCESS;
-    }
+  // If the items fit into a square atlas, they also fit into every larger one, so the smallest fitting square is found by bisection.
+  // Only then the two atlases with half the height or half the width are tried, which lie between that square and the next smaller one.
+  plUInt32 uiLow = uiMinPower;
+  plUInt32 uiHigh = uiMaxPower + 1;
 
-    if (TrySortItemsIntoAtlas(items, halfResDivCellSize, resDivCellSize, layer).Succeeded())
-    {
-      out_ResX = halfRes;
-      out_ResY = resolution;
-      return PL_SUCCESS;
-    }
+  while (uiLow < uiHigh)
+  {
+    const plUInt32 power = (uiLow + uiHigh) / 2;
+    const plUInt32 resDivCellSize = (1 << power) / uiAtlasCellSize;
 
     if (TrySortItemsIntoAtlas(items, resDivCellSize, resDivCellSize, layer).Succeeded())
-    {
-      out_ResX = resolution;
-      out_ResY = resolution;
-      return PL_SUCCESS;
-    }
+      uiHigh = power;
+    else
+      uiLow = power + 1;
+  }
+
+  if (uiLow > uiMaxPower)
+  {
+    plLog::Error("Could not sort items into texture atlas. Too many too large textures.");
+    return PL_FAILURE;
+  }
+
+  const plUInt32 resolution = 1 << uiLow;
+  const plUInt32 halfRes = resolution / 2;
+  const plUInt32 resDivCellSize = resolution / uiAtlasCellSize;
+  const plUInt32 halfResDivCellSize = halfRes / uiAtlasCellSize;
+
+  if (TrySortItemsIntoAtlas(items, resDivCellSize, halfResDivCellSize, layer).Succeeded())
+  {
+    out_ResX = resolution;
+    out_ResY = halfRes;
+    return PL_SUCCESS;
   }
 
-  plLog::Error("Could not sort items into texture atlas. Too many too large textures.");
-  return PL_FAILURE;
+  if (TrySortItemsIntoAtlas(items, halfResDivCellSize, resDivCellSize, layer).Succeeded())
+  {
+    out_ResX = halfRes;
+    out_ResY = resolution;
+    return PL_SUCCESS;
+  }
+
+  // the last attempt of the bisection may have been a smaller, failed one, so the items have to be placed again
+  PL_SUCCEED_OR_RETURN(TrySortItemsIntoAtlas(items, resDivCellSize, resDivCellSize, layer));
+
+  out_ResX = resolution;
+  out_ResY = resolution;
+  return PL_SUCCESS;
 }
 
 plResult plTexConvProcessor::CreateAtlasTexture(plDynamicArray<TextureAtlasItem>& items, plUInt32 uiResX, plUInt32 uiResY, plImage& atlas, plInt32 layer)
@@ -245,71 +266,116 @@ plResult plTexConvProcessor::CreateAtlasTexture(plDynamicArray<TextureAtlasItem>
     plMemoryUtils::ZeroFill(pixelData.GetPtr(), static_cast<size_t>(pixelData.GetCount()));
   }
 
-  for (auto& item : items)
-  {
-    if (item.m_InputImage[layer].IsValid())
+  // the items don't overlap, so they can be copied in parallel
+  plAtomicInteger32 iFailed;
+  plAtomicInteger32* pFailed = &iFailed;
+  plImage* pAtlas = &atlas;
+  TextureAtlasItem* pItems = items.GetData();
+
+  plTaskSystem::ParallelForIndexed(
+    0, items.GetCount(), [pItems, pAtlas, pFailed, layer](plUInt32 uiStartIndex, plUInt32 uiEndIndex)
     {
-      plImage& itemImage = item.m_InputImage[layer];
+      for (plUInt32 i = uiStartIndex; i < uiEndIndex; ++i)
+      {
+        const TextureAtlasItem& item = pItems[i];
+
+        if (item.m_InputImage[layer].IsValid())
+        {
+          const plImage& itemImage = item.m_InputImage[layer];
+
+          plRectU32 r;
+          r.x = 0;
+          r.y = 0;
+          r.width = itemImage.GetWidth();
+          r.height = itemImage.GetHeight();
+
+          if (plImageUtils::Copy(itemImage, r, *pAtlas, plVec3U32(item.m_AtlasRect[layer].x, item.m_AtlasRect[layer].y, 0)).Failed())
+          {
+            pFailed->Set(1);
+          }
+        }
+      }
+    },
+    "CreateAtlasTexture");
 
-      plRectU32 r;
-      r.x = 0;
-      r.y = 0;
-      r.width = itemImage.GetWidth();
-      r.height = itemImage.GetHeight();
+  return iFailed == 0 ? PL_SUCCESS : PL_FAILURE;
+}
 
-      PL_SUCCEED_OR_RETURN(plImageUtils::Copy(itemImage, r, atlas, plVec3U32(item.m_AtlasRect[layer].x, item.m_AtlasRect[layer].y, 0)));
+static void FillAtlasItemBorder(const plRectU32& itemRect, plImage& atlas, plUInt32 uiMipLevel)
+{
+  const plUInt32 uiBorderPixels = 2;
+
+  const plUInt32 uiRectX = itemRect.x >> uiMipLevel;
+  const plUInt32 uiRectY = itemRect.y >> uiMipLevel;
+  const plUInt32 uiWidth = plMath::Max(1u, itemRect.width >> uiMipLevel);
+  const plUInt32 uiHeight = plMath::Max(1u, itemRect.height >> uiMipLevel);
+
+  // fill the border of the item rect with alpha 0 to prevent bleeding into other decals in the atlas
+  if (uiWidth <= 2 * uiBorderPixels || uiHeight <= 2 * uiBorderPixels)
+  {
+    for (plUInt32 y = 0; y < uiHeight; ++y)
+    {
+      for (plUInt32 x = 0; x < uiWidth; ++x)
+      {
+        const plUInt32 xClamped = plMath::Min(uiRectX + x, atlas.GetWidth(uiMipLevel));
+        const plUInt32 yClamped = plMath::Min(uiRectY + y, atlas.GetHeight(uiMipLevel));
+        atlas.GetPixelPointer<plColor>(uiMipLevel, 0, 0, xClamped, yClamped)->a = 0.0f;
+      }
     }
   }
+  else
+  {
+    for (plUInt32 i = 0; i < uiBorderPixels; ++i)
+    {
+      for (plUInt32 y = 0; y < uiHeight; ++y)
+      {
+        atlas.GetPixelPointer<plColor>(uiMipLevel, 0, 0, uiRectX + i, uiRectY + y)->a = 0.0f;
+        atlas.GetPixelPointer<plColor>(uiMipLevel, 0, 0, uiRectX + uiWidth - 1 - i, uiRectY + y)->a = 0.0f;
+      }
 
-  return PL_SUCCESS;
+      for (plUInt32 x = 0; x < uiWidth; ++x)
+      {
+        atlas.GetPixelPointer<plColor>(uiMipLevel, 0, 0, uiRectX + x, uiRectY + i)->a = 0.0f;
+        atlas.GetPixelPointer<plColor>(uiMipLevel, 0, 0, uiRectX + x, uiRectY + uiHeight - 1 - i)->a = 0.0f;
+      }
+    }
+  }
 }
 
 plResult plTexConvProcessor::FillAtlasBorders(plDynamicArray<TextureAtlasItem>& items, plImage& atlas, plInt32 layer)
 {
-  const plUInt32 uiBorderPixels = 2;
+  // Item rects are aligned to the cell size, so they stay disjoint in all mip levels in which a cell is at least one pixel large.
+  // Those are processed in parallel, the remaining tiny mip levels serially.
+  const plUInt32 uiNumDisjointMipmaps = plMath::Log2i(uiAtlasCellSize) + 1;
 
   const plUInt32 uiNumMipmaps = atlas.GetHeader().GetNumMipLevels();
   for (plUInt32 uiMipLevel = 0; uiMipLevel < uiNumMipmaps; ++uiMipLevel)
   {
-    for (auto& item : items)
+    if (uiMipLevel < uiNumDisjointMipmaps)
     {
-      if (!item.m_InputImage[layer].IsValid())
-        continue;
-
-      plRectU32& itemRect = item.m_AtlasRect[layer];
-      const plUInt32 uiRectX = itemRect.x >> uiMipLevel;
-      const plUInt32 uiRectY = itemRect.y >> uiMipLevel;
-      const plUInt32 uiWidth = plMath::Max(1u, itemRect.width >> uiMipLevel);
-      const plUInt32 uiHeight = plMath::Max(1u, itemRect.height >> uiMipLevel);
+      const TextureAtlasItem* pItems = items.GetData();
+      plImage* pAtlas = &atlas;
 
-      // fill the border of the item rect with alpha 0 to prevent bleeding into other decals in the atlas
-      if (uiWidth <= 2 * uiBorderPixels || uiHeight <= 2 * uiBorderPixels)
-      {
-        for (plUInt32 y = 0; y < uiHeight; ++y)
+      plTaskSystem::ParallelForIndexed(
+        0, items.GetCount(), [pItems, pAtlas, layer, uiMipLevel](plUInt32 uiStartIndex, plUInt32 uiEndIndex)
         {
-          for (plUInt32 x = 0; x < uiWidth; ++x)
+          for (plUInt32 i = uiStartIndex; i < uiEndIndex; ++i)
           {
-            const plUInt32 xClamped = plMath::Min(uiRectX + x, atlas.GetWidth(uiMipLevel));
-            const plUInt32 yClamped = plMath::Min(uiRectY + y, atlas.GetHeight(uiMipLevel));
-            atlas.GetPixelPointer<plColor>(uiMipLevel, 0, 0, xClamped, yClamped)->a = 0.0f;
+            if (pItems[i].m_InputImage[layer].IsValid())
+            {
+              FillAtlasItemBorder(pItems[i].m_AtlasRect[layer], *pAtlas, uiMipLevel);
+            }
           }
-        }
-      }
-      else
+        },
+        "FillAtlasBorders");
+    }
+    else
+    {
+      for (auto& item : items)
       {
-        for (plUInt32 i = 0; i < uiBorderPixels; ++i)
+        if (item.m_InputImage[layer].IsValid())
         {
-          for (plUInt32 y = 0; y < uiHeight; ++y)
-          {
-            atlas.GetPixelPointer<plColor>(uiMipLevel, 0, 0, uiRectX + i, uiRectY + y)->a = 0.0f;
-            atlas.GetPixelPointer<plColor>(uiMipLevel, 0, 0, uiRectX + uiWidth - 1 - i, uiRectY + y)->a = 0.0f;
-          }
-
-          for (plUInt32 x = 0; x < uiWidth; ++x)
-          {
-            atlas.GetPixelPointer<plColor>(uiMipLevel, 0, 0, uiRectX + x, uiRectY + i)->a = 0.0f;
-            atlas.GetPixelPointer<plColor>(uiMipLevel, 0, 0, uiRectX + x, uiRectY + uiHeight - 1 - i)->a = 0.0f;
-          }
+          FillAtlasItemBorder(item.m_AtlasRect[layer], atlas, uiMipLevel);
         }
       }
     }
@@ -340,7 +406,7 @@ plResult plTexConvProcessor::CreateAtlasLayerTexture(const plTextureAtlasCreatio
 
   PL_SUCCEED_OR_RETURN(ChooseOutputFormat(OutputImageFormat, atlasDesc.m_Layers[layer].m_Usage, atlasDesc.m_Layers[layer].m_uiNumChannels));
 
-  PL_SUCCEED_OR_RETURN(GenerateOutput(std::move(atlasImg), dstImg, OutputImageFormat));
+  PL_SUCCEED_OR_RETURN(GenerateOutput(std::move(atlasImg), dstImg, OutputImageFormat, m_Descriptor.m_BCnQuality));
 
   return PL_SUCCESS;
 }
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <Foundation/Types/UniquePtr.h>
+#include <Texture/TexConv/TexConvProcessor.h>
+
+/// \brief Processes many texture conversions at once, sharing the worker threads of the plTaskSystem between them.
+///
+/// Every conversion is a regular plTexConvProcessor that is set up through AddConversion(). Process() runs up to
+/// m_uiMaxConcurrentConversions of them at the same time. The parallel loops inside the conversions (image conversion, mipmap
+/// generation, compression) run on the same worker threads, so while one conversion waits on a serial step, like decoding its input
+/// file, the others keep the threads busy.
+///
+/// Failing conversions don't stop the others. Their results can be queried afterwards through GetConversionResult().
+class PL_TEXTURE_DLL plTexConvBatch
+{
+  PL_DISALLOW_COPY_AND_ASSIGN(plTexConvBatch);
+
+public:
+  plTexConvBatch();
+  ~plTexConvBatch();
+
+  /// \brief Adds a conversion to the batch. Fill out the descriptor of the returned processor before calling Process().
+  plTexConvProcessor& AddConversion();
+
+  plUInt32 GetConversionCount() const { return m_Conversions.GetCount(); }
+  plTexConvProcessor& GetConversion(plUInt32 uiIndex) { return *m_Conversions[uiIndex].m_pProcessor; }
+
+  /// \brief Returns whether the conversion succeeded in the last call to Process().
+  plResult GetConversionResult(plUInt32 uiIndex) const { return m_Conversions[uiIndex].m_Result; }
+
+  /// \brief Runs all conversions. Returns PL_FAILURE if any of them failed.
+  plResult Process();
+
+  /// \brief Called on the thread that ran the conversion, as soon as it is finished.
+  ///
+  /// Use this to write the output files and to free the processor's images, so that the memory of a large batch stays bounded.
+  plDelegate<void(plUInt32 uiIndex, plTexConvProcessor& ref_processor, plResult result)> m_OnConversionFinished;
+
+  /// \brief How many conversions run at the same time. 0 means one per worker thread.
+  ///
+  /// Every running conversion holds its images in memory, so lower this for batches of very large textures.
+  plUInt32 m_uiMaxConcurrentConversions = 0;
+
+private:
+  struct Conversion
+  {
+    plUniquePtr<plTexConvProcessor> m_pProcessor;
+    plResult m_Result = PL_FAILURE;
+  };
+
+  void RunConversion(plUInt32 uiIndex);
+
+  plDynamicArray<Conversion> m_Conversions;
+};
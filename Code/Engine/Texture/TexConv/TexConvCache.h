@@ -0,0 +1,31 @@
+#pragma once
+
+#include <Texture/TexConv/TexConvDesc.h>
+
+/// \brief On-disk cache for the results of plTexConvProcessor.
+///
+/// Every entry is addressed by a hash over the content of all input files (or input images) and all settings of the plTexConvDesc,
+/// and stores the output image, the low-res output and the thumbnail output. Every entry is a folder that is written and deleted
+/// atomically, so multiple processes may share the same cache directory.
+///
+/// When the cache grows beyond its size limit, the entries that were used least recently are deleted.
+class PL_TEXTURE_DLL plTexConvCache
+{
+public:
+  /// \brief Computes the cache key for the given descriptor. Fails if the descriptor can't be cached (e.g. for atlases) or an input file can't be read.
+  static plResult ComputeKey(const plTexConvDesc& desc, plUInt64& out_uiKey);
+
+  /// \brief Reads the entry with the given key. Fails if there is no such entry or it is corrupt.
+  ///
+  /// On success the entry is marked as used, so that Trim() deletes it last.
+  static plResult Load(plStringView sCacheDirectory, plUInt64 uiKey, plImage& out_output, plImage& out_lowResOutput, plImage& out_thumbnailOutput);
+
+  /// \brief Writes the entry with the given key and then trims the cache to uiMaxCacheSize bytes.
+  static plResult Store(plStringView sCacheDirectory, plUInt64 uiKey, const plImageView& output, const plImageView& lowResOutput,
+    const plImageView& thumbnailOutput, plUInt64 uiMaxCacheSize);
+
+  /// \brief Deletes the least recently used entries until the cache takes up no more than uiMaxCacheSize bytes.
+  ///
+  /// Also deletes temporary folders that were left behind by processes that crashed while storing an entry.
+  static void Trim(plStringView sCacheDirectory, plUInt64 uiMaxCacheSize);
+};
@@ -52,6 +52,7 @@ public:
   // Format / Compression
   plEnum<plTexConvUsage> m_Usage;
   plEnum<plTexConvCompressionMode> m_CompressionMode;
+  plEnum<plBCnEncoderQuality> m_BCnQuality; // only used by the native BC1, BC3, BC4 and BC5 encoder
 
   // resolution clamp and downscale
   plUInt32 m_uiMinResolution = 16;
@@ -74,6 +75,15 @@ public:
   float m_fHdrExposureBias = 0.0f;
   float m_fMaxValue = 64000.f;
 
+  // Memory budget in bytes, 0 for unlimited. Input images whose RGBA 32-bit float version would exceed it, are converted and scaled in
+  // bands of rows, and the input images are released as soon as the output has been assembled from them.
+  plUInt64 m_uiMemoryBudget = 0;
+
+  // Output cache. If a directory is set, the outputs are read from there when the input data and all other settings match an earlier
+  // run, and are stored there otherwise. The least recently used entries are deleted once the cache grows beyond the size limit.
+  plString m_sCacheDirectory;
+  plUInt64 m_uiCacheSizeLimit = plUInt64(4) * 1024 * 1024 * 1024;
+
   // pl specific
   plUInt64 m_uiAssetHash = 0;
   plUInt16 m_uiAssetVersion = 0;
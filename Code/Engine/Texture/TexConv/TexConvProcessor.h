@@ -60,12 +60,12 @@ private:
   //////////////////////////////////////////////////////////////////////////
   // Purely functional
   static plResult AdjustUsage(plStringView sFilename, const plImage& srcImg, plEnum<plTexConvUsage>& inout_Usage);
-  static plResult ConvertAndScaleImage(plStringView sImageName, plImage& inout_Image, plUInt32 uiResolutionX, plUInt32 uiResolutionY, plEnum<plTexConvUsage> usage);
+  static plResult ConvertAndScaleImage(plStringView sImageName, plImage& inout_Image, plUInt32 uiResolutionX, plUInt32 uiResolutionY, plEnum<plTexConvUsage> usage, plUInt64 uiMemoryBudget);
 
   //////////////////////////////////////////////////////////////////////////
   // Output Generation
 
-  static plResult GenerateOutput(plImage&& src, plImage& dst, plEnum<plImageFormat> format);
+  static plResult GenerateOutput(plImage&& src, plImage& dst, plEnum<plImageFormat> format, plEnum<plBCnEncoderQuality> bcnQuality);
   static plResult GenerateThumbnailOutput(const plImage& srcImg, plImage& dstImg, plUInt32 uiTargetRes);
   static plResult GenerateLowResOutput(const plImage& srcImg, plImage& dstImg, plUInt32 uiLowResMip);
 
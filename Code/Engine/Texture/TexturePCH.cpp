@@ -6,6 +6,7 @@ PL_STATICLINK_LIBRARY(Texture)
     return;
 
   PL_STATICLINK_REFERENCE(Texture_Image_Conversions_BC7EncConversions);
+  PL_STATICLINK_REFERENCE(Texture_Image_Conversions_BCnConversions);
   PL_STATICLINK_REFERENCE(Texture_Image_Conversions_DXTConversions);
   PL_STATICLINK_REFERENCE(Texture_Image_Conversions_DXTexConversions);
   PL_STATICLINK_REFERENCE(Texture_Image_Conversions_DXTexCpuConversions);
@@ -14,9 +14,8 @@ void plTexturePacker::SetTextureSize(plUInt32 uiWidth, plUInt32 uiHeight, plUInt
   m_Textures.Clear();
   m_Textures.Reserve(uiReserveTextures);
 
-  // initializes all values to false
-  m_Grid.Clear();
-  m_Grid.SetCount(m_uiWidth * m_uiHeight);
+  m_FreeRects.Clear();
+  m_FreeRects.PushBack({0, 0, m_uiWidth, m_uiHeight});
 }
 
 void plTexturePacker::AddTexture(plUInt32 uiWidth, plUInt32 uiHeight)
@@ -57,63 +56,122 @@ plResult plTexturePacker::PackTextures()
   return PL_SUCCESS;
 }
 
-plUInt32 plTexturePacker::PosToIndex(plUInt32 x, plUInt32 y) const
+namespace
 {
-  return (y * m_uiWidth + x);
-}
+  template <typename RECT>
+  PL_ALWAYS_INLINE bool IsContainedIn(const RECT& a, const RECT& b)
+  {
+    return a.x >= b.x && a.y >= b.y && a.x + a.width <= b.x + b.width && a.y + a.height <= b.y + b.height;
+  }
+} // namespace
 
 bool plTexturePacker::TryPlaceTexture(plUInt32 idx)
 {
   Texture& tex = m_Textures[idx];
 
-  for (plUInt32 y = 0; y < m_uiHeight; ++y)
+  // best short side fit: prefer the free rect where the smaller leftover side is smallest
+  plUInt32 uiBestShortSide = plMath::MaxValue<plUInt32>();
+  plUInt32 uiBestLongSide = plMath::MaxValue<plUInt32>();
+  plUInt32 uiBestRect = plInvalidIndex;
+
+  for (plUInt32 i = 0; i < m_FreeRects.GetCount(); ++i)
   {
-    for (plUInt32 x = 0; x < m_uiWidth; ++x)
-    {
-      if (!TryPlaceAt(plVec2U32(x, y), tex.m_Size))
-        continue;
+    const FreeRect& fr = m_FreeRects[i];
 
-      tex.m_Position.Set(x, y);
-      return true;
+    if (fr.width < tex.m_Size.x || fr.height < tex.m_Size.y)
+      continue;
+
+    const plUInt32 uiLeftoverX = fr.width - tex.m_Size.x;
+    const plUInt32 uiLeftoverY = fr.height - tex.m_Size.y;
+    const plUInt32 uiShortSide = plMath::Min(uiLeftoverX, uiLeftoverY);
+    const plUInt32 uiLongSide = plMath::Max(uiLeftoverX, uiLeftoverY);
+
+    if (uiShortSide < uiBestShortSide || (uiShortSide == uiBestShortSide && uiLongSide < uiBestLongSide))
+    {
+      uiBestShortSide = uiShortSide;
+      uiBestLongSide = uiLongSide;
+      uiBestRect = i;
     }
   }
 
-  return false;
+  if (uiBestRect == plInvalidIndex)
+    return false;
+
+  tex.m_Position.Set(m_FreeRects[uiBestRect].x, m_FreeRects[uiBestRect].y);
+
+  SplitFreeRects({tex.m_Position.x, tex.m_Position.y, tex.m_Size.x, tex.m_Size.y});
+  return true;
 }
 
-bool plTexturePacker::CanPlaceAt(plVec2U32 pos, plVec2U32 size)
+void plTexturePacker::SplitFreeRects(const FreeRect& used)
 {
-  if (pos.x + size.x > m_uiWidth)
-    return false;
-  if (pos.y + size.y > m_uiHeight)
-    return false;
+  m_NewFreeRects.Clear();
 
-  for (plUInt32 y = 0; y < size.y; ++y)
+  // replace every free rect that overlaps the used rect by the (up to four) maximal rects that remain of it
+  for (plUInt32 i = 0; i < m_FreeRects.GetCount();)
   {
-    for (plUInt32 x = 0; x < size.x; ++x)
+    const FreeRect fr = m_FreeRects[i];
+
+    if (used.x >= fr.x + fr.width || used.x + used.width <= fr.x || used.y >= fr.y + fr.height || used.y + used.height <= fr.y)
     {
-      if (m_Grid[PosToIndex(pos.x + x, pos.y + y)])
-        return false;
+      ++i;
+      continue;
     }
-  }
 
-  return true;
-}
+    if (used.x > fr.x)
+      m_NewFreeRects.PushBack({fr.x, fr.y, used.x - fr.x, fr.height});
 
-bool plTexturePacker::TryPlaceAt(plVec2U32 pos, plVec2U32 size)
-{
-  if (!CanPlaceAt(pos, size))
-    return false;
+    if (used.x + used.width < fr.x + fr.width)
+      m_NewFreeRects.PushBack({used.x + used.width, fr.y, fr.x + fr.width - (used.x + used.width), fr.height});
+
+    if (used.y > fr.y)
+      m_NewFreeRects.PushBack({fr.x, fr.y, fr.width, used.y - fr.y});
+
+    if (used.y + used.height < fr.y + fr.height)
+      m_NewFreeRects.PushBack({fr.x, used.y + used.height, fr.width, fr.y + fr.height - (used.y + used.height)});
 
-  for (plUInt32 y = 0; y < size.y; ++y)
+    m_FreeRects.RemoveAtAndSwap(i);
+  }
+
+  // The remaining free rects don't contain each other, and none of them can be contained in a new rect,
+  // because every new rect lies inside of a removed one. So only the new rects have to be checked.
+  for (plUInt32 i = 0; i < m_NewFreeRects.GetCount(); ++i)
   {
-    for (plUInt32 x = 0; x < size.x; ++x)
+    for (plUInt32 j = i + 1; j < m_NewFreeRects.GetCount(); ++j)
     {
-      m_Grid[PosToIndex(pos.x + x, pos.y + y)] = true;
+      if (IsContainedIn(m_NewFreeRects[i], m_NewFreeRects[j]))
+      {
+        m_NewFreeRects.RemoveAtAndCopy(i);
+        --i;
+        break;
+      }
+
+      if (IsContainedIn(m_NewFreeRects[j], m_NewFreeRects[i]))
+      {
+        m_NewFreeRects.RemoveAtAndCopy(j);
+        --j;
+      }
     }
   }
 
-  return true;
-}
+  const plUInt32 uiNumOldRects = m_FreeRects.GetCount();
 
+  for (const FreeRect& newRect : m_NewFreeRects)
+  {
+    bool bContained = false;
+
+    for (plUInt32 i = 0; i < uiNumOldRects; ++i)
+    {
+      if (IsContainedIn(newRect, m_FreeRects[i]))
+      {
+        bContained = true;
+        break;
+      }
+    }
 
+    if (!bContained)
+    {
+      m_FreeRects.PushBack(newRect);
+    }
+  }
+}
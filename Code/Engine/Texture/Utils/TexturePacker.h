@@ -4,6 +4,11 @@
 #include <Foundation/Math/Vec2.h>
 #include <Texture/TextureDLL.h>
 
+/// \brief Packs rectangles into a fixed size area, using the MaxRects algorithm.
+///
+/// The packer keeps a list of the maximal free rectangles of the area and puts every texture into the free rectangle that it fills best
+/// (best short side fit). Textures are placed in the order of their priority, largest first. The cost depends on the number of textures
+/// and free rectangles, not on the size of the area, so packing thousands of textures is fast.
 class PL_TEXTURE_DLL plTexturePacker
 {
 public:
@@ -25,17 +30,27 @@ public:
 
   const plDynamicArray<Texture>& GetTextures() const { return m_Textures; }
 
+  /// \brief Places all textures. Fails if they don't fit into the area.
   plResult PackTextures();
 
 private:
-  bool CanPlaceAt(plVec2U32 pos, plVec2U32 size);
-  bool TryPlaceAt(plVec2U32 pos, plVec2U32 size);
-  plUInt32 PosToIndex(plUInt32 x, plUInt32 y) const;
+  struct FreeRect
+  {
+    PL_DECLARE_POD_TYPE();
+
+    plUInt32 x;
+    plUInt32 y;
+    plUInt32 width;
+    plUInt32 height;
+  };
+
   bool TryPlaceTexture(plUInt32 idx);
+  void SplitFreeRects(const FreeRect& used);
 
   plUInt32 m_uiWidth = 0;
   plUInt32 m_uiHeight = 0;
 
   plDynamicArray<Texture> m_Textures;
-  plDynamicArray<bool> m_Grid;
+  plDynamicArray<FreeRect> m_FreeRects;
+  plDynamicArray<FreeRect> m_NewFreeRects;
 };
@@ -483,6 +483,14 @@ extern int LoadEXRImageFromMemory(EXRImage *image, const EXRHeader *header,
                                   const unsigned char *memory,
                                   const size_t size, const char **err);
 
+// [pl] Sets a function that calls `func(user_data)` `count` times in parallel
+// and returns when all calls have finished. When set, it is used instead of
+// creating threads for decoding tiles and scanline blocks, so that the work
+// can run on an existing job system. Pass NULL to restore the default.
+// Only has an effect when TINYEXR_USE_THREAD is enabled.
+typedef void (*TinyEXRParallelRunFunction)(int count, void (*func)(void *user_data), void *user_data);
+extern void SetEXRParallelRunFunction(TinyEXRParallelRunFunction func);
+
 // Loads multi-part OpenEXR image from a file.
 // Application must setup `ParseEXRMultipartHeaderFromFile` before calling this
 // function.
@@ -641,6 +649,7 @@ extern int LoadEXRFromMemory(float **out_rgba, int *width, int *height,
 #if TINYEXR_USE_THREAD
 #include <atomic>
 #include <thread>
+#include <type_traits>
 #endif
 
 #else  // __cplusplus > 199711L
@@ -686,6 +695,28 @@ extern "C" unsigned char *stbi_zlib_compress(unsigned char *data, int data_len,
 
 namespace tinyexr {
 
+static TinyEXRParallelRunFunction g_parallel_run_function = NULL;
+
+#if TINYEXR_HAS_CXX11 && (TINYEXR_USE_THREAD > 0)
+// [pl] Calls `worker` from `num_threads` threads at the same time and waits for all of them.
+template <typename Worker>
+static void RunWorkers(int num_threads, Worker &&worker) {
+  if (g_parallel_run_function) {
+    g_parallel_run_function(num_threads, [](void *user_data) { (*static_cast<typename std::remove_reference<Worker>::type *>(user_data))(); }, &worker);
+    return;
+  }
+
+  std::vector<std::thread> workers;
+  for (int t = 0; t < num_threads; t++) {
+    workers.emplace_back(std::thread([&worker]() { worker(); }));
+  }
+
+  for (auto &t : workers) {
+    t.join();
+  }
+}
+#endif
+
 #if __cplusplus > 199711L
 // C++11
 typedef uint64_t tinyexr_uint64;
@@ -4860,7 +4891,6 @@ static int DecodeTiledLevel(EXRImage* exr_image, const EXRHeader* exr_header,
     calloc(sizeof(EXRTile), static_cast<size_t>(num_tiles)));
 
 #if TINYEXR_HAS_CXX11 && (TINYEXR_USE_THREAD > 0)
-  std::vector<std::thread> workers;
   std::atomic<int> tile_count(0);
 
   int num_threads = std::max(1, int(std::thread::hardware_concurrency()));
@@ -4868,8 +4898,7 @@ static int DecodeTiledLevel(EXRImage* exr_image, const EXRHeader* exr_header,
     num_threads = int(num_tiles);
   }
 
-  for (int t = 0; t < num_threads; t++) {
-    workers.emplace_back(std::thread([&]()
+  RunWorkers(num_threads, [&]()
       {
         int tile_idx = 0;
         while ((tile_idx = tile_count++) < num_tiles) {
@@ -4967,12 +4996,7 @@ static int DecodeTiledLevel(EXRImage* exr_image, const EXRHeader* exr_header,
 
 #if TINYEXR_HAS_CXX11 && (TINYEXR_USE_THREAD > 0)
   }
-        }));
-    }  // num_thread loop
-
-    for (auto& t : workers) {
-      t.join();
-    }
+        });
 
 #else
   } // parallel for
@@ -5185,7 +5209,6 @@ static int DecodeChunk(EXRImage *exr_image, const EXRHeader *exr_header,
     }
 
 #if TINYEXR_HAS_CXX11 && (TINYEXR_USE_THREAD > 0)
-    std::vector<std::thread> workers;
     std::atomic<int> y_count(0);
 
     int num_threads = std::max(1, int(std::thread::hardware_concurrency()));
@@ -5193,8 +5216,7 @@ static int DecodeChunk(EXRImage *exr_image, const EXRHeader *exr_header,
       num_threads = int(num_blocks);
     }
 
-    for (int t = 0; t < num_threads; t++) {
-      workers.emplace_back(std::thread([&]() {
+    RunWorkers(num_threads, [&]() {
         int y = 0;
         while ((y = y_count++) < int(num_blocks)) {
 
@@ -5287,12 +5309,7 @@ static int DecodeChunk(EXRImage *exr_image, const EXRHeader *exr_header,
 
 #if TINYEXR_HAS_CXX11 && (TINYEXR_USE_THREAD > 0)
         }
-      }));
-    }
-
-    for (auto &t : workers) {
-      t.join();
-    }
+      });
 #else
     }  // omp parallel
 #endif
@@ -6754,6 +6771,10 @@ int LoadEXRImageFromFile(EXRImage *exr_image, const EXRHeader *exr_header,
                                 err);
 }
 
+void SetEXRParallelRunFunction(TinyEXRParallelRunFunction func) {
+  tinyexr::g_parallel_run_function = func;
+}
+
 int LoadEXRImageFromMemory(EXRImage *exr_image, const EXRHeader *exr_header,
                            const unsigned char *memory, const size_t size,
                            const char **err) {
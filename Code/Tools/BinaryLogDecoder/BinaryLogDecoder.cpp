@@ -0,0 +1,242 @@
+#include <Foundation/Application/Application.h>
+#include <Foundation/IO/OSFile.h>
+#include <Foundation/Logging/BinaryWriter.h>
+#include <Foundation/Logging/ConsoleWriter.h>
+#include <Foundation/Logging/Log.h>
+#include <Foundation/Strings/StringBuilder.h>
+#include <Foundation/Utilities/CommandLineUtils.h>
+
+/// \brief Converts log files that were written with plLogWriter::Binary to text or JSON.
+///
+/// Usage: BinaryLogDecoder -in <file> [-out <file>] [-format text|json] [-level Error|SeriousWarning|Warning|Success|Info|Dev|Debug|All]
+///                         [-thread <index>] [-from <seconds>] [-to <seconds>] [-groups on|off]
+///
+/// The times are relative to the start of the log. Without -out the result is printed to the console.
+/// JSON output has one object per line.
+class plBinaryLogDecoderApp : public plApplication
+{
+public:
+  using SUPER = plApplication;
+
+  plBinaryLogDecoderApp()
+    : plApplication("BinaryLogDecoder")
+  {
+  }
+
+  virtual void AfterCoreSystemsStartup() override
+  {
+    plGlobalLog::AddLogWriter(plLogWriter::Console::LogMessageHandler);
+  }
+
+  virtual void BeforeCoreSystemsShutdown() override
+  {
+    plGlobalLog::RemoveLogWriter(plLogWriter::Console::LogMessageHandler);
+  }
+
+  virtual Execution Run() override
+  {
+    if (Decode().Failed())
+    {
+      SetReturnCode(1);
+    }
+
+    return Execution::Quit;
+  }
+
+private:
+  plResult ParseFilter(plBinaryLogFilter& out_filter)
+  {
+    const plCommandLineUtils* pCmd = plCommandLineUtils::GetGlobalInstance();
+
+    const plStringView sLevel = pCmd->GetStringOption("-level", 0, "All");
+    const char* szLevels[] = {"Error", "SeriousWarning", "Warning", "Success", "Info", "Dev", "Debug", "All"};
+
+    bool bFound = false;
+    for (plUInt32 i = 0; i < PL_ARRAY_SIZE(szLevels); ++i)
+    {
+      if (sLevel.IsEqual_NoCase(szLevels[i]))
+      {
+        out_filter.m_LogLevel = static_cast<plLogMsgType::Enum>(plLogMsgType::ErrorMsg + i);
+        bFound = true;
+      }
+    }
+
+    if (!bFound)
+    {
+      plLog::Error("Unknown log level '{}'.", sLevel);
+      return PL_FAILURE;
+    }
+
+    out_filter.m_uiThreadIndex = pCmd->GetUIntOption("-thread", 0);
+    out_filter.m_StartTime = plTime::MakeFromSeconds(pCmd->GetFloatOption("-from", 0.0));
+    out_filter.m_EndTime = plTime::MakeFromSeconds(pCmd->GetFloatOption("-to", out_filter.m_EndTime.GetSeconds()));
+    out_filter.m_bIncludeGroups = pCmd->GetBoolOption("-groups", true);
+
+    return PL_SUCCESS;
+  }
+
+  static plStringView GetTypeName(plLogMsgType::Enum type)
+  {
+    switch (type)
+    {
+      case plLogMsgType::BeginGroup:
+        return "BeginGroup";
+      case plLogMsgType::EndGroup:
+        return "EndGroup";
+      case plLogMsgType::ErrorMsg:
+        return "Error";
+      case plLogMsgType::SeriousWarningMsg:
+        return "SeriousWarning";
+      case plLogMsgType::WarningMsg:
+        return "Warning";
+      case plLogMsgType::SuccessMsg:
+        return "Success";
+      case plLogMsgType::InfoMsg:
+        return "Info";
+      case plLogMsgType::DevMsg:
+        return "Dev";
+      case plLogMsgType::DebugMsg:
+        return "Debug";
+      default:
+        return "Unknown";
+    }
+  }
+
+  static void AppendJsonString(plStringBuilder& inout_sLine, plStringView sText)
+  {
+    inout_sLine.Append("\"");
+
+    for (const char* szChar = sText.GetStartPointer(); szChar < sText.GetEndPointer(); ++szChar)
+    {
+      const char c = *szChar;
+
+      if (c == '"' || c == '\\')
+        inout_sLine.AppendFormat("\\{}", plArgC(c));
+      else if (c == '\n')
+        inout_sLine.Append("\\n");
+      else if (c == '\r')
+        inout_sLine.Append("\\r");
+      else if (c == '\t')
+        inout_sLine.Append("\\t");
+      else if (static_cast<plUInt8>(c) < 0x20)
+        inout_sLine.AppendFormat("\\u{}", plArgI(c, 4, true, 16));
+      else
+        inout_sLine.Append(plStringView(szChar, 1));
+    }
+
+    inout_sLine.Append("\"");
+  }
+
+  void FormatText(const plBinaryLogEntry& entry, plStringBuilder& out_sLine) const
+  {
+    const plDateTime dateTime = plDateTime::MakeFromTimestamp(m_Reader.GetStartTimestamp() + entry.m_Time);
+
+    plStringBuilder sIndentation;
+    for (plUInt32 i = 0; i < entry.m_uiIndentation; ++i)
+      sIndentation.Append(" ");
+
+    out_sLine.SetFormat("[{}] [{}s] [T{}] {}", plArgDateTime(dateTime, plArgDateTime::ShowDate | plArgDateTime::ShowMilliseconds | plArgDateTime::ShowTimeZone),
+      plArgF(entry.m_Time.GetSeconds(), 6), entry.m_uiThreadIndex, sIndentation);
+
+    switch (entry.m_EventType)
+    {
+      case plLogMsgType::BeginGroup:
+        out_sLine.AppendFormat("+++++ {} ({}) +++++\n", entry.m_sText, entry.m_sTag);
+        break;
+      case plLogMsgType::EndGroup:
+        out_sLine.AppendFormat("----- {} ({} sec) -----\n", entry.m_sText, plArgF(entry.m_fSeconds, 6));
+        break;
+      default:
+        if (entry.m_sTag.IsEmpty())
+          out_sLine.AppendFormat("{}: {}\n", GetTypeName(entry.m_EventType), entry.m_sText);
+        else
+          out_sLine.AppendFormat("{}: [{}] {}\n", GetTypeName(entry.m_EventType), entry.m_sTag, entry.m_sText);
+        break;
+    }
+  }
+
+  void FormatJson(const plBinaryLogEntry& entry, plStringBuilder& out_sLine) const
+  {
+    const plDateTime dateTime = plDateTime::MakeFromTimestamp(m_Reader.GetStartTimestamp() + entry.m_Time);
+
+    out_sLine.SetFormat("{\"time\":\"{}\",\"offset\":{},\"thread\":{},\"type\":\"{}\",\"indentation\":{},\"tag\":",
+      plArgDateTime(dateTime, plArgDateTime::ShowDate | plArgDateTime::ShowMilliseconds | plArgDateTime::ShowTimeZone), plArgF(entry.m_Time.GetSeconds(), 6),
+      entry.m_uiThreadIndex, GetTypeName(entry.m_EventType), entry.m_uiIndentation);
+
+    AppendJsonString(out_sLine, entry.m_sTag);
+    out_sLine.Append(",\"text\":");
+    AppendJsonString(out_sLine, entry.m_sText);
+
+    if (entry.m_EventType == plLogMsgType::EndGroup)
+    {
+      out_sLine.AppendFormat(",\"seconds\":{}", plArgF(entry.m_fSeconds, 6));
+    }
+
+    out_sLine.Append("}\n");
+  }
+
+  plResult Decode()
+  {
+    const plCommandLineUtils* pCmd = plCommandLineUtils::GetGlobalInstance();
+
+    const plString sInput = pCmd->GetAbsolutePathOption("-in");
+    const plString sOutput = pCmd->GetAbsolutePathOption("-out");
+    const bool bJson = pCmd->GetStringOption("-format", 0, "text").IsEqual_NoCase("json");
+
+    if (sInput.IsEmpty())
+    {
+      plLog::Error("Usage: BinaryLogDecoder -in <file> [-out <file>] [-format text|json] [-level <level>] [-thread <index>] [-from <seconds>] [-to <seconds>] [-groups on|off]");
+      return PL_FAILURE;
+    }
+
+    plBinaryLogFilter filter;
+    PL_SUCCEED_OR_RETURN(ParseFilter(filter));
+
+    PL_SUCCEED_OR_RETURN(m_Reader.Open(sInput));
+
+    plOSFile outFile;
+    if (!sOutput.IsEmpty() && outFile.Open(sOutput, plFileOpenMode::Write).Failed())
+    {
+      plLog::Error("Could not open '{}' for writing.", sOutput);
+      return PL_FAILURE;
+    }
+
+    plStringBuilder sLine;
+    plResult writeResult = PL_SUCCESS;
+
+    const plResult readResult = m_Reader.ReadEntries(filter, [&](const plBinaryLogEntry& entry)
+      {
+        if (bJson)
+          FormatJson(entry, sLine);
+        else
+          FormatText(entry, sLine);
+
+        if (outFile.IsOpen())
+        {
+          if (outFile.Write(sLine.GetData(), sLine.GetElementCount()).Failed())
+            writeResult = PL_FAILURE;
+        }
+        else
+        {
+          fwrite(sLine.GetData(), 1, sLine.GetElementCount(), stdout);
+        }
+      });
+
+    if (writeResult.Failed())
+    {
+      plLog::Error("Failed to write to '{}'.", sOutput);
+      return PL_FAILURE;
+    }
+
+    plUInt32 uiReadBlocks = 0;
+    plUInt32 uiSkippedBlocks = 0;
+    m_Reader.GetBlockStats(uiReadBlocks, uiSkippedBlocks);
+    plLog::Dev("Decoded {} blocks, skipped {} blocks.", uiReadBlocks, uiSkippedBlocks);
+
+    return readResult;
+  }
+
+  plBinaryLogReader m_Reader;
+};
+
+PL_CONSOLEAPP_ENTRY_POINT(plBinaryLogDecoderApp);
@@ -0,0 +1,366 @@
+#include <Foundation/Application/Application.h>
+#include <Foundation/IO/FileSystem/FileSystem.h>
+#include <Foundation/Logging/ConsoleWriter.h>
+#include <Foundation/Logging/Log.h>
+#include <Foundation/Math/Float16.h>
+#include <Foundation/Time/Stopwatch.h>
+#include <Foundation/Utilities/CommandLineUtils.h>
+#include <Texture/Image/Conversions/BCnConversions.h>
+#include <Texture/Image/Conversions/PixelConversionKernels.h>
+#include <Texture/Image/Image.h>
+#include <Texture/TexConv/TexComparer.h>
+
+/// \brief Measures the performance of the texture conversion code.
+///
+/// Usage:
+///   TextureBenchmark -kernels [-pixels <count>] [-iterations <count>]
+///   TextureBenchmark -compare <image file> -format <BC format>
+///
+/// -kernels runs every available implementation of every pixel conversion kernel and logs the throughput in MPixels/s.
+/// The results of all implementations are compared against the scalar version and differences are reported as errors.
+///
+/// -compare compresses the first mip level of the image to the given BC format (e.g. BC1_UNORM) with every quality level of
+/// plBCnEncoder, and with every other registered conversion step that supports the same conversion (e.g. DirectXTex),
+/// and logs the duration and error of each. The error is reported as the mean square error that plTexComparer computes
+/// (the worst 32x32 region), and as the PSNR of the whole image.
+class plTextureBenchmarkApp : public plApplication
+{
+public:
+  using SUPER = plApplication;
+
+  plTextureBenchmarkApp()
+    : plApplication("TextureBenchmark")
+  {
+  }
+
+  virtual void AfterCoreSystemsStartup() override
+  {
+    plGlobalLog::AddLogWriter(plLogWriter::Console::LogMessageHandler);
+
+    // allow loading images from absolute paths
+    plFileSystem::AddDataDirectory("", "", ":", plDataDirUsage::ReadOnly).IgnoreResult();
+  }
+
+  virtual void BeforeCoreSystemsShutdown() override
+  {
+    plGlobalLog::RemoveLogWriter(plLogWriter::Console::LogMessageHandler);
+  }
+
+  virtual Execution Run() override
+  {
+    const plCommandLineUtils* pCmd = plCommandLineUtils::GetGlobalInstance();
+
+    const bool bKernels = pCmd->GetBoolOption("-kernels");
+    const plString sCompareFile = pCmd->GetAbsolutePathOption("-compare");
+
+    if (!bKernels && sCompareFile.IsEmpty())
+    {
+      plLog::Error("Usage: TextureBenchmark -kernels [-pixels <count>] [-iterations <count>]");
+      plLog::Error("       TextureBenchmark -compare <image file> -format <BC format>");
+      SetReturnCode(1);
+      return Execution::Quit;
+    }
+
+    plResult result = PL_SUCCESS;
+
+    if (bKernels && RunKernelBenchmark(pCmd->GetUIntOption("-pixels", 1024 * 1024), pCmd->GetUIntOption("-iterations", 10)).Failed())
+    {
+      result = PL_FAILURE;
+    }
+
+    if (!sCompareFile.IsEmpty() && RunEncoderComparison(sCompareFile, pCmd->GetStringOption("-format")).Failed())
+    {
+      result = PL_FAILURE;
+    }
+
+    SetReturnCode(result.Succeeded() ? 0 : 1);
+    return Execution::Quit;
+  }
+
+private:
+  using Kernels = plPixelConversionKernels;
+
+  static plResult RunKernelBenchmark(plUInt32 uiNumPixels, plUInt32 uiNumIterations)
+  {
+    PL_LOG_BLOCK("Pixel Conversion Kernels");
+
+    plLog::Info("Supported instruction set: {}, selected: {}", Kernels::GetInstructionSetName(Kernels::GetSupportedInstructionSet()),
+      Kernels::GetInstructionSetName(Kernels::GetMaxInstructionSet()));
+
+    uiNumPixels = plMath::Max(uiNumPixels, 1u);
+    uiNumIterations = plMath::Max(uiNumIterations, 1u);
+
+    plDynamicArray<plUInt8> source;
+    plDynamicArray<plUInt8> reference;
+    plDynamicArray<plUInt8> result;
+    source.SetCountUninitialized(uiNumPixels * 16);
+    reference.SetCountUninitialized(uiNumPixels * 16);
+    result.SetCountUninitialized(uiNumPixels * 16);
+
+    bool bAllIdentical = true;
+
+    for (plUInt32 k = 0; k < (plUInt32)Kernels::Kernel::ENUM_COUNT; ++k)
+    {
+      const Kernels::KernelInfo& info = Kernels::GetKernelInfo((Kernels::Kernel)k);
+      const plUInt64 uiNumElements = (plUInt64)uiNumPixels * info.m_uiElementsPerPixel;
+      const plUInt64 uiTargetSize = uiNumElements * info.m_uiTargetSize;
+
+      // deterministic input that covers the whole [0; 1] range, plus some values outside of it
+      plUInt32 uiSeed = 0x12345678u + k;
+      for (plUInt64 e = 0; e < uiNumElements; ++e)
+      {
+        uiSeed = uiSeed * 1664525u + 1013904223u;
+        const float fValue = static_cast<float>(uiSeed >> 8) * (1.5f / 16777216.0f) - 0.25f;
+
+        switch (info.m_SourceType)
+        {
+          case Kernels::ElementType::Byte:
+            plMemoryUtils::RawByteCopy(&source[static_cast<plUInt32>(e * info.m_uiSourceSize)], &uiSeed, info.m_uiSourceSize);
+            break;
+          case Kernels::ElementType::Half:
+            reinterpret_cast<plFloat16*>(source.GetData())[e] = fValue;
+            break;
+          case Kernels::ElementType::Float:
+            reinterpret_cast<float*>(source.GetData())[e] = fValue;
+            break;
+        }
+      }
+
+      Kernels::GetKernel((Kernels::Kernel)k, Kernels::InstructionSet::Scalar)(source.GetData(), reference.GetData(), uiNumElements);
+
+      for (plUInt32 i = 0; i < (plUInt32)Kernels::InstructionSet::ENUM_COUNT; ++i)
+      {
+        const Kernels::KernelFunc func = Kernels::GetKernel((Kernels::Kernel)k, (Kernels::InstructionSet)i);
+        const char* szInstructionSet = Kernels::GetInstructionSetName((Kernels::InstructionSet)i);
+
+        if (func == nullptr)
+          continue;
+
+        plMemoryUtils::ZeroFill(result.GetData(), result.GetCount());
+        func(source.GetData(), result.GetData(), uiNumElements);
+
+        if (plMemoryUtils::Compare(result.GetData(), reference.GetData(), static_cast<size_t>(uiTargetSize)) != 0)
+        {
+          plLog::Error("{} ({}): result differs from the scalar implementation", info.m_szName, szInstructionSet);
+          bAllIdentical = false;
+        }
+
+        const plTime tStart = plTime::Now();
+
+        for (plUInt32 iter = 0; iter < uiNumIterations; ++iter)
+        {
+          func(source.GetData(), result.GetData(), uiNumElements);
+        }
+
+        const double fSeconds = plMath::Max((plTime::Now() - tStart).GetSeconds(), 0.000001);
+        const double fMPixelsPerSecond = (double)uiNumPixels * uiNumIterations / fSeconds / 1000000.0;
+
+        plLog::Info("{} ({}): {} MPixels/s", info.m_szName, szInstructionSet, plArgF(fMPixelsPerSecond, 1));
+      }
+    }
+
+    return bAllIdentical ? PL_SUCCESS : PL_FAILURE;
+  }
+
+  static plResult RunEncoderComparison(plStringView sFile, plStringView sFormat)
+  {
+    plImageFormat::Enum targetFormat = plImageFormat::UNKNOWN;
+
+    for (plUInt32 i = 0; i < plImageFormat::NUM_FORMATS; ++i)
+    {
+      if (sFormat.IsEqual_NoCase(plImageFormat::GetName(static_cast<plImageFormat::Enum>(i))))
+      {
+        targetFormat = static_cast<plImageFormat::Enum>(i);
+        break;
+      }
+    }
+
+    if (targetFormat == plImageFormat::UNKNOWN)
+    {
+      plLog::Error("Unknown image format '{}'.", sFormat);
+      return PL_FAILURE;
+    }
+
+    plImage source;
+    if (source.LoadFrom(sFile).Failed())
+    {
+      plLog::Error("Failed to load image '{}'.", sFile);
+      return PL_FAILURE;
+    }
+
+    return CompareEncoders(source, targetFormat);
+  }
+
+  static plResult CompareEncoders(const plImageView& source, plImageFormat::Enum targetFormat)
+  {
+    PL_LOG_BLOCK("CompareEncoders", plImageFormat::GetName(targetFormat));
+
+    // the format the encoders get as input, and the one that holds the channels the target format preserves
+    plImageFormat::Enum inputFormat = plImageFormat::UNKNOWN;
+    plImageFormat::Enum channelFormat = plImageFormat::UNKNOWN;
+
+    switch (targetFormat)
+    {
+      case plImageFormat::BC1_UNORM:
+      case plImageFormat::BC3_UNORM:
+        inputFormat = plImageFormat::R8G8B8A8_UNORM;
+        channelFormat = inputFormat;
+        break;
+
+      case plImageFormat::BC1_UNORM_SRGB:
+      case plImageFormat::BC3_UNORM_SRGB:
+        inputFormat = plImageFormat::R8G8B8A8_UNORM_SRGB;
+        channelFormat = inputFormat;
+        break;
+
+      case plImageFormat::BC4_UNORM:
+        inputFormat = plImageFormat::R8G8B8A8_UNORM;
+        channelFormat = plImageFormat::R8_UNORM;
+        break;
+
+      case plImageFormat::BC5_UNORM:
+        inputFormat = plImageFormat::R8G8B8A8_UNORM;
+        channelFormat = plImageFormat::R8G8_UNORM;
+        break;
+
+      default:
+        plLog::Error("Unsupported target format '{}'.", plImageFormat::GetName(targetFormat));
+        return PL_FAILURE;
+    }
+
+    plImage input;
+    PL_SUCCEED_OR_RETURN(plImageConversion::Convert(source.GetSubImageView(0, 0, 0), input, inputFormat));
+
+    // the reference only contains the channels that survive the compression
+    plImage reference;
+    PL_SUCCEED_OR_RETURN(plImageConversion::Convert(input, reference, channelFormat));
+    PL_SUCCEED_OR_RETURN(plImageConversion::Convert(reference, reference, inputFormat));
+
+    const plUInt32 uiWidth = input.GetWidth();
+    const plUInt32 uiHeight = input.GetHeight();
+    const plUInt32 uiNumBlocksX = (uiWidth + 3) / 4;
+    const plUInt32 uiNumBlocksY = (uiHeight + 3) / 4;
+    const plUInt32 uiBlockSize = plImageFormat::GetBitsPerBlock(targetFormat) / 8;
+
+    // pad to full blocks by repeating the last row and column
+    plDynamicArray<plColorBaseUB> paddedInput;
+    paddedInput.SetCountUninitialized(uiNumBlocksX * uiNumBlocksY * 16);
+
+    for (plUInt32 y = 0; y < uiNumBlocksY * 4; ++y)
+    {
+      for (plUInt32 x = 0; x < uiNumBlocksX * 4; ++x)
+      {
+        paddedInput[y * uiNumBlocksX * 4 + x] = *input.GetPixelPointer<plColorBaseUB>(0, 0, 0, plMath::Min(x, uiWidth - 1), plMath::Min(y, uiHeight - 1));
+      }
+    }
+
+    struct Encoder
+    {
+      plString m_sName;
+      const plImageConversionStepCompressBlocks* m_pStep = nullptr;
+      plBCnEncoderQuality::Enum m_Quality = plBCnEncoderQuality::Default;
+    };
+
+    plHybridArray<Encoder, 8> encoders;
+
+    for (const plImageConversionStep* pStep = plImageConversionStep::GetFirstInstance(); pStep != nullptr; pStep = pStep->GetNextInstance())
+    {
+      bool bSupported = false;
+      for (const plImageConversionEntry& entry : pStep->GetSupportedConversions())
+      {
+        bSupported |= entry.m_sourceFormat == inputFormat && entry.m_targetFormat == targetFormat;
+      }
+
+      if (!bSupported)
+        continue;
+
+      const plImageConversionStepCompressBlocks* pCompressStep = static_cast<const plImageConversionStepCompressBlocks*>(pStep);
+
+      if (plBCnEncoder::IsNativeConversionStep(pStep))
+      {
+        encoders.PushBack({"Native RangeFit", pCompressStep, plBCnEncoderQuality::RangeFit});
+        encoders.PushBack({"Native ClusterFit", pCompressStep, plBCnEncoderQuality::ClusterFit});
+        encoders.PushBack({"Native Exhaustive", pCompressStep, plBCnEncoderQuality::Exhaustive});
+      }
+      else
+      {
+        plStringBuilder sName;
+        sName.SetFormat("Other encoder {}", encoders.GetCount());
+        encoders.PushBack({sName, pCompressStep});
+      }
+    }
+
+    plResult result = PL_SUCCESS;
+
+    for (const Encoder& encoder : encoders)
+    {
+      plImageConversionSettings settings;
+      settings.m_BCnQuality = encoder.m_Quality;
+
+      plImageHeader header;
+      header.SetWidth(uiWidth);
+      header.SetHeight(uiHeight);
+      header.SetImageFormat(targetFormat);
+
+      plImage compressed;
+      compressed.ResetAndAlloc(header);
+
+      plStopwatch sw;
+
+      if (encoder.m_pStep->CompressBlocks(plConstByteBlobPtr(reinterpret_cast<const plUInt8*>(paddedInput.GetData()), paddedInput.GetCount() * sizeof(plColorBaseUB)),
+            plByteBlobPtr(compressed.GetPixelPointer<plUInt8>(), uiNumBlocksX * uiNumBlocksY * uiBlockSize), uiNumBlocksX, uiNumBlocksY, inputFormat, targetFormat, settings)
+            .Failed())
+      {
+        plLog::Error("{}: Compression failed.", encoder.m_sName);
+        result = PL_FAILURE;
+        continue;
+      }
+
+      const plTime duration = sw.GetRunningTotal();
+
+      plImage actual;
+      if (plImageConversion::Convert(compressed, actual, inputFormat).Failed())
+      {
+        plLog::Error("{}: Decompression failed.", encoder.m_sName);
+        result = PL_FAILURE;
+        continue;
+      }
+
+      // the comparer reports the worst region, additionally compute the error over the whole image
+      plUInt64 uiSquaredError = 0;
+
+      for (plUInt32 y = 0; y < uiHeight; ++y)
+      {
+        const plUInt8* pActual = actual.GetPixelPointer<plUInt8>(0, 0, 0, 0, y);
+        const plUInt8* pReference = reference.GetPixelPointer<plUInt8>(0, 0, 0, 0, y);
+
+        for (plUInt32 i = 0; i < uiWidth * 4; ++i)
+        {
+          const plInt32 iDiff = static_cast<plInt32>(pActual[i]) - static_cast<plInt32>(pReference[i]);
+          uiSquaredError += iDiff * iDiff;
+        }
+      }
+
+      const double fMSE = static_cast<double>(uiSquaredError) / (static_cast<double>(uiWidth) * uiHeight * 4);
+      const float fPSNR = fMSE > 0 ? 10.0f * plMath::Log10(static_cast<float>(255.0 * 255.0 / fMSE)) : 99.0f;
+
+      plTexComparer comparer;
+      comparer.m_Descriptor.m_ExpectedImage.ResetAndCopy(reference);
+      comparer.m_Descriptor.m_ActualImage.ResetAndMove(std::move(actual));
+      comparer.m_Descriptor.m_MeanSquareErrorThreshold = plMath::MaxValue<plUInt32>();
+
+      if (comparer.Compare().Failed())
+      {
+        plLog::Error("{}: Comparison failed.", encoder.m_sName);
+        result = PL_FAILURE;
+        continue;
+      }
+
+      plLog::Info("{}: {} ms, MSE {} (worst region), PSNR {} dB", encoder.m_sName, plArgF(duration.GetMilliseconds(), 1), comparer.m_OutputMSE, plArgF(fPSNR, 2));
+    }
+
+    return result;
+  }
+};
+
+PL_CONSOLEAPP_ENTRY_POINT(plTextureBenchmarkApp);
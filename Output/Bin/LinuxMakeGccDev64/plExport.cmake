@@ -0,0 +1,335 @@
+# Generated by CMake
+
+if("${CMAKE_MAJOR_VERSION}.${CMAKE_MINOR_VERSION}" LESS 2.8)
+   message(FATAL_ERROR "CMake >= 2.8.0 required")
+endif()
+if(CMAKE_VERSION VERSION_LESS "2.8.3")
+   message(FATAL_ERROR "CMake >= 2.8.3 required")
+endif()
+cmake_policy(PUSH)
+cmake_policy(VERSION 2.8.3...3.23)
+#----------------------------------------------------------------
+# Generated CMake target import file.
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Protect against multiple inclusion, which would fail when already imported targets are added once more.
+set(_cmake_targets_defined "")
+set(_cmake_targets_not_defined "")
+set(_cmake_expected_targets "")
+foreach(_cmake_expected_target IN ITEMS Duktape Imgui Lua assimp bc7enc_rdo enet meshoptimizer mikktspace ozz stb_image tinyexr zlib zstd Core Foundation RHI Texture Utilities)
+  list(APPEND _cmake_expected_targets "${_cmake_expected_target}")
+  if(TARGET "${_cmake_expected_target}")
+    list(APPEND _cmake_targets_defined "${_cmake_expected_target}")
+  else()
+    list(APPEND _cmake_targets_not_defined "${_cmake_expected_target}")
+  endif()
+endforeach()
+unset(_cmake_expected_target)
+if(_cmake_targets_defined STREQUAL _cmake_expected_targets)
+  unset(_cmake_targets_defined)
+  unset(_cmake_targets_not_defined)
+  unset(_cmake_expected_targets)
+  unset(CMAKE_IMPORT_FILE_VERSION)
+  cmake_policy(POP)
+  return()
+endif()
+if(NOT _cmake_targets_defined STREQUAL "")
+  string(REPLACE ";" ", " _cmake_targets_defined_text "${_cmake_targets_defined}")
+  string(REPLACE ";" ", " _cmake_targets_not_defined_text "${_cmake_targets_not_defined}")
+  message(FATAL_ERROR "Some (but not all) targets in this export set were already defined.\nTargets Defined: ${_cmake_targets_defined_text}\nTargets not yet defined: ${_cmake_targets_not_defined_text}\n")
+endif()
+unset(_cmake_targets_defined)
+unset(_cmake_targets_not_defined)
+unset(_cmake_expected_targets)
+
+
+# Create imported target Duktape
+add_library(Duktape SHARED IMPORTED)
+
+set_target_properties(Duktape PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "BUILDSYSTEM_COMPILE_ENGINE_AS_DLL;BUILDSYSTEM_BUILDTYPE_\$<IF:\$<STREQUAL:Dev,Debug>,Debug,\$<IF:\$<STREQUAL:Dev,Dev>,Dev,Shipping>>;UNICODE;_UNICODE;BUILDSYSTEM_ENABLE_DUKTAPE_SUPPORT"
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/Code/ThirdParty"
+)
+
+# Create imported target Imgui
+add_library(Imgui SHARED IMPORTED)
+
+set_target_properties(Imgui PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "BUILDSYSTEM_COMPILE_ENGINE_AS_DLL;BUILDSYSTEM_BUILDTYPE_\$<IF:\$<STREQUAL:Dev,Debug>,Debug,\$<IF:\$<STREQUAL:Dev,Dev>,Dev,Shipping>>;UNICODE;_UNICODE;BUILDSYSTEM_ENABLE_IMGUI_SUPPORT"
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/Code/ThirdParty"
+)
+
+# Create imported target Lua
+add_library(Lua SHARED IMPORTED)
+
+set_target_properties(Lua PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "BUILDSYSTEM_COMPILE_ENGINE_AS_DLL;BUILDSYSTEM_BUILDTYPE_\$<IF:\$<STREQUAL:Dev,Debug>,Debug,\$<IF:\$<STREQUAL:Dev,Dev>,Dev,Shipping>>;UNICODE;_UNICODE;BUILDSYSTEM_ENABLE_LUA_SUPPORT"
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/Code/ThirdParty"
+)
+
+# Create imported target assimp
+add_library(assimp SHARED IMPORTED)
+
+set_target_properties(assimp PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "BUILDSYSTEM_COMPILE_ENGINE_AS_DLL;BUILDSYSTEM_BUILDTYPE_\$<IF:\$<STREQUAL:Dev,Debug>,Debug,\$<IF:\$<STREQUAL:Dev,Dev>,Dev,Shipping>>;UNICODE;_UNICODE;BUILDSYSTEM_ENABLE_AI_SUPPORT;ASSIMP_DLL"
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/Code/ThirdParty;/root/repo/Code/ThirdParty/assimp/include"
+)
+
+# Create imported target bc7enc_rdo
+add_library(bc7enc_rdo STATIC IMPORTED)
+
+set_target_properties(bc7enc_rdo PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "BUILDSYSTEM_COMPILE_ENGINE_AS_DLL;BUILDSYSTEM_BUILDTYPE_\$<IF:\$<STREQUAL:Dev,Debug>,Debug,\$<IF:\$<STREQUAL:Dev,Dev>,Dev,Shipping>>;UNICODE;_UNICODE;PL_USE_BC7ENC"
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/Code/ThirdParty"
+  INTERFACE_LINK_LIBRARIES "\$<LINK_ONLY:pthread>;\$<LINK_ONLY:rt>;\$<LINK_ONLY:c>;\$<LINK_ONLY:m>;\$<LINK_ONLY:-lgcc_s>;\$<LINK_ONLY:-lgcc>;OpenMP::OpenMP_CXX"
+)
+
+# Create imported target enet
+add_library(enet SHARED IMPORTED)
+
+set_target_properties(enet PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "BUILDSYSTEM_COMPILE_ENGINE_AS_DLL;BUILDSYSTEM_BUILDTYPE_\$<IF:\$<STREQUAL:Dev,Debug>,Debug,\$<IF:\$<STREQUAL:Dev,Dev>,Dev,Shipping>>;UNICODE;_UNICODE;BUILDSYSTEM_ENABLE_ENET_SUPPORT"
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/Code/ThirdParty"
+)
+
+# Create imported target meshoptimizer
+add_library(meshoptimizer STATIC IMPORTED)
+
+set_target_properties(meshoptimizer PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "BUILDSYSTEM_COMPILE_ENGINE_AS_DLL;BUILDSYSTEM_BUILDTYPE_\$<IF:\$<STREQUAL:Dev,Debug>,Debug,\$<IF:\$<STREQUAL:Dev,Dev>,Dev,Shipping>>;UNICODE;_UNICODE"
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/Code/ThirdParty"
+  INTERFACE_LINK_LIBRARIES "\$<LINK_ONLY:pthread>;\$<LINK_ONLY:rt>;\$<LINK_ONLY:c>;\$<LINK_ONLY:m>;\$<LINK_ONLY:-lgcc_s>;\$<LINK_ONLY:-lgcc>"
+)
+
+# Create imported target mikktspace
+add_library(mikktspace STATIC IMPORTED)
+
+set_target_properties(mikktspace PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "BUILDSYSTEM_COMPILE_ENGINE_AS_DLL;BUILDSYSTEM_BUILDTYPE_\$<IF:\$<STREQUAL:Dev,Debug>,Debug,\$<IF:\$<STREQUAL:Dev,Dev>,Dev,Shipping>>;UNICODE;_UNICODE"
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/Code/ThirdParty"
+  INTERFACE_LINK_LIBRARIES "\$<LINK_ONLY:pthread>;\$<LINK_ONLY:rt>;\$<LINK_ONLY:c>;\$<LINK_ONLY:m>;\$<LINK_ONLY:-lgcc_s>;\$<LINK_ONLY:-lgcc>"
+)
+
+# Create imported target ozz
+add_library(ozz SHARED IMPORTED)
+
+set_target_properties(ozz PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "BUILDSYSTEM_COMPILE_ENGINE_AS_DLL;BUILDSYSTEM_BUILDTYPE_\$<IF:\$<STREQUAL:Dev,Debug>,Debug,\$<IF:\$<STREQUAL:Dev,Dev>,Dev,Shipping>>;UNICODE;_UNICODE;BUILDSYSTEM_ENABLE_OZZ_SUPPORT"
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/Code/ThirdParty"
+)
+
+# Create imported target stb_image
+add_library(stb_image SHARED IMPORTED)
+
+set_target_properties(stb_image PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "BUILDSYSTEM_COMPILE_ENGINE_AS_DLL;BUILDSYSTEM_BUILDTYPE_\$<IF:\$<STREQUAL:Dev,Debug>,Debug,\$<IF:\$<STREQUAL:Dev,Dev>,Dev,Shipping>>;UNICODE;_UNICODE"
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/Code/ThirdParty"
+)
+
+# Create imported target tinyexr
+add_library(tinyexr STATIC IMPORTED)
+
+set_target_properties(tinyexr PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "BUILDSYSTEM_COMPILE_ENGINE_AS_DLL;BUILDSYSTEM_BUILDTYPE_\$<IF:\$<STREQUAL:Dev,Debug>,Debug,\$<IF:\$<STREQUAL:Dev,Dev>,Dev,Shipping>>;UNICODE;_UNICODE"
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/Code/ThirdParty"
+  INTERFACE_LINK_LIBRARIES "\$<LINK_ONLY:pthread>;\$<LINK_ONLY:rt>;\$<LINK_ONLY:c>;\$<LINK_ONLY:m>;\$<LINK_ONLY:-lgcc_s>;\$<LINK_ONLY:-lgcc>"
+)
+
+# Create imported target zlib
+add_library(zlib STATIC IMPORTED)
+
+set_target_properties(zlib PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "BUILDSYSTEM_COMPILE_ENGINE_AS_DLL;BUILDSYSTEM_BUILDTYPE_\$<IF:\$<STREQUAL:Dev,Debug>,Debug,\$<IF:\$<STREQUAL:Dev,Dev>,Dev,Shipping>>;UNICODE;_UNICODE;BUILDSYSTEM_ENABLE_ZLIB_SUPPORT"
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/Code/ThirdParty"
+  INTERFACE_LINK_LIBRARIES "\$<LINK_ONLY:pthread>;\$<LINK_ONLY:rt>;\$<LINK_ONLY:c>;\$<LINK_ONLY:m>;\$<LINK_ONLY:-lgcc_s>;\$<LINK_ONLY:-lgcc>"
+)
+
+# Create imported target zstd
+add_library(zstd SHARED IMPORTED)
+
+set_target_properties(zstd PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "BUILDSYSTEM_COMPILE_ENGINE_AS_DLL;BUILDSYSTEM_BUILDTYPE_\$<IF:\$<STREQUAL:Dev,Debug>,Debug,\$<IF:\$<STREQUAL:Dev,Dev>,Dev,Shipping>>;UNICODE;_UNICODE;BUILDSYSTEM_ENABLE_ZSTD_SUPPORT"
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/Code/ThirdParty"
+)
+
+# Create imported target Core
+add_library(Core SHARED IMPORTED)
+
+set_target_properties(Core PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "BUILDSYSTEM_COMPILE_ENGINE_AS_DLL;BUILDSYSTEM_BUILDTYPE_\$<IF:\$<STREQUAL:Dev,Debug>,Debug,\$<IF:\$<STREQUAL:Dev,Dev>,Dev,Shipping>>;UNICODE;_UNICODE"
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/Code/Engine"
+  INTERFACE_LINK_LIBRARIES "Foundation;Texture;Lua;Duktape"
+)
+
+# Create imported target Foundation
+add_library(Foundation SHARED IMPORTED)
+
+set_target_properties(Foundation PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "BUILDSYSTEM_COMPILE_ENGINE_AS_DLL;BUILDSYSTEM_BUILDTYPE_\$<IF:\$<STREQUAL:Dev,Debug>,Debug,\$<IF:\$<STREQUAL:Dev,Dev>,Dev,Shipping>>;UNICODE;_UNICODE"
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/Code/Engine"
+  INTERFACE_LINK_LIBRARIES "enet;zstd;zlib"
+)
+
+# Create imported target RHI
+add_library(RHI SHARED IMPORTED)
+
+set_target_properties(RHI PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "BUILDSYSTEM_COMPILE_ENGINE_AS_DLL;BUILDSYSTEM_BUILDTYPE_\$<IF:\$<STREQUAL:Dev,Debug>,Debug,\$<IF:\$<STREQUAL:Dev,Dev>,Dev,Shipping>>;UNICODE;_UNICODE"
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/Code/Engine"
+  INTERFACE_LINK_LIBRARIES "Foundation"
+)
+
+# Create imported target Texture
+add_library(Texture SHARED IMPORTED)
+
+set_target_properties(Texture PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "BUILDSYSTEM_COMPILE_ENGINE_AS_DLL;BUILDSYSTEM_BUILDTYPE_\$<IF:\$<STREQUAL:Dev,Debug>,Debug,\$<IF:\$<STREQUAL:Dev,Dev>,Dev,Shipping>>;UNICODE;_UNICODE;BUILDSYSTEM_HAS_TEXTURE"
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/Code/Engine"
+  INTERFACE_LINK_LIBRARIES "Foundation"
+)
+
+# Create imported target Utilities
+add_library(Utilities SHARED IMPORTED)
+
+set_target_properties(Utilities PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "BUILDSYSTEM_COMPILE_ENGINE_AS_DLL;BUILDSYSTEM_BUILDTYPE_\$<IF:\$<STREQUAL:Dev,Debug>,Debug,\$<IF:\$<STREQUAL:Dev,Dev>,Dev,Shipping>>;UNICODE;_UNICODE"
+  INTERFACE_INCLUDE_DIRECTORIES "/root/repo/Code/Engine"
+  INTERFACE_LINK_LIBRARIES "Core"
+)
+
+# Import target "Duktape" for configuration "Dev"
+set_property(TARGET Duktape APPEND PROPERTY IMPORTED_CONFIGURATIONS DEV)
+set_target_properties(Duktape PROPERTIES
+  IMPORTED_LOCATION_DEV "/root/repo/Output/Bin/LinuxMakeGccDev64/Duktape.so"
+  IMPORTED_SONAME_DEV "Duktape.so"
+  )
+
+# Import target "Imgui" for configuration "Dev"
+set_property(TARGET Imgui APPEND PROPERTY IMPORTED_CONFIGURATIONS DEV)
+set_target_properties(Imgui PROPERTIES
+  IMPORTED_LOCATION_DEV "/root/repo/Output/Bin/LinuxMakeGccDev64/Imgui.so"
+  IMPORTED_SONAME_DEV "Imgui.so"
+  )
+
+# Import target "Lua" for configuration "Dev"
+set_property(TARGET Lua APPEND PROPERTY IMPORTED_CONFIGURATIONS DEV)
+set_target_properties(Lua PROPERTIES
+  IMPORTED_LOCATION_DEV "/root/repo/Output/Bin/LinuxMakeGccDev64/Lua.so"
+  IMPORTED_SONAME_DEV "Lua.so"
+  )
+
+# Import target "assimp" for configuration "Dev"
+set_property(TARGET assimp APPEND PROPERTY IMPORTED_CONFIGURATIONS DEV)
+set_target_properties(assimp PROPERTIES
+  IMPORTED_LOCATION_DEV "/root/repo/Output/Bin/LinuxMakeGccDev64/assimp.so"
+  IMPORTED_SONAME_DEV "assimp.so"
+  )
+
+# Import target "bc7enc_rdo" for configuration "Dev"
+set_property(TARGET bc7enc_rdo APPEND PROPERTY IMPORTED_CONFIGURATIONS DEV)
+set_target_properties(bc7enc_rdo PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEV "CXX"
+  IMPORTED_LOCATION_DEV "/root/repo/Output/Lib/LinuxMakeGccDev64/bc7enc_rdo.a"
+  )
+
+# Import target "enet" for configuration "Dev"
+set_property(TARGET enet APPEND PROPERTY IMPORTED_CONFIGURATIONS DEV)
+set_target_properties(enet PROPERTIES
+  IMPORTED_LOCATION_DEV "/root/repo/Output/Bin/LinuxMakeGccDev64/enet.so"
+  IMPORTED_SONAME_DEV "enet.so"
+  )
+
+# Import target "meshoptimizer" for configuration "Dev"
+set_property(TARGET meshoptimizer APPEND PROPERTY IMPORTED_CONFIGURATIONS DEV)
+set_target_properties(meshoptimizer PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEV "CXX"
+  IMPORTED_LOCATION_DEV "/root/repo/Output/Lib/LinuxMakeGccDev64/meshoptimizer.a"
+  )
+
+# Import target "mikktspace" for configuration "Dev"
+set_property(TARGET mikktspace APPEND PROPERTY IMPORTED_CONFIGURATIONS DEV)
+set_target_properties(mikktspace PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEV "C"
+  IMPORTED_LOCATION_DEV "/root/repo/Output/Lib/LinuxMakeGccDev64/mikktspace.a"
+  )
+
+# Import target "ozz" for configuration "Dev"
+set_property(TARGET ozz APPEND PROPERTY IMPORTED_CONFIGURATIONS DEV)
+set_target_properties(ozz PROPERTIES
+  IMPORTED_LOCATION_DEV "/root/repo/Output/Bin/LinuxMakeGccDev64/ozz.so"
+  IMPORTED_SONAME_DEV "ozz.so"
+  )
+
+# Import target "stb_image" for configuration "Dev"
+set_property(TARGET stb_image APPEND PROPERTY IMPORTED_CONFIGURATIONS DEV)
+set_target_properties(stb_image PROPERTIES
+  IMPORTED_LOCATION_DEV "/root/repo/Output/Bin/LinuxMakeGccDev64/stb_image.so"
+  IMPORTED_SONAME_DEV "stb_image.so"
+  )
+
+# Import target "tinyexr" for configuration "Dev"
+set_property(TARGET tinyexr APPEND PROPERTY IMPORTED_CONFIGURATIONS DEV)
+set_target_properties(tinyexr PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEV "C;CXX"
+  IMPORTED_LOCATION_DEV "/root/repo/Output/Lib/LinuxMakeGccDev64/tinyexr.a"
+  )
+
+# Import target "zlib" for configuration "Dev"
+set_property(TARGET zlib APPEND PROPERTY IMPORTED_CONFIGURATIONS DEV)
+set_target_properties(zlib PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEV "C"
+  IMPORTED_LOCATION_DEV "/root/repo/Output/Lib/LinuxMakeGccDev64/zlib.a"
+  )
+
+# Import target "zstd" for configuration "Dev"
+set_property(TARGET zstd APPEND PROPERTY IMPORTED_CONFIGURATIONS DEV)
+set_target_properties(zstd PROPERTIES
+  IMPORTED_LOCATION_DEV "/root/repo/Output/Bin/LinuxMakeGccDev64/zstd.so"
+  IMPORTED_SONAME_DEV "zstd.so"
+  )
+
+# Import target "Core" for configuration "Dev"
+set_property(TARGET Core APPEND PROPERTY IMPORTED_CONFIGURATIONS DEV)
+set_target_properties(Core PROPERTIES
+  IMPORTED_LOCATION_DEV "/root/repo/Output/Bin/LinuxMakeGccDev64/plCore.so"
+  IMPORTED_SONAME_DEV "plCore.so"
+  )
+
+# Import target "Foundation" for configuration "Dev"
+set_property(TARGET Foundation APPEND PROPERTY IMPORTED_CONFIGURATIONS DEV)
+set_target_properties(Foundation PROPERTIES
+  IMPORTED_LOCATION_DEV "/root/repo/Output/Bin/LinuxMakeGccDev64/plFoundation.so"
+  IMPORTED_SONAME_DEV "plFoundation.so"
+  )
+
+# Import target "RHI" for configuration "Dev"
+set_property(TARGET RHI APPEND PROPERTY IMPORTED_CONFIGURATIONS DEV)
+set_target_properties(RHI PROPERTIES
+  IMPORTED_LOCATION_DEV "/root/repo/Output/Bin/LinuxMakeGccDev64/plRHI.so"
+  IMPORTED_SONAME_DEV "plRHI.so"
+  )
+
+# Import target "Texture" for configuration "Dev"
+set_property(TARGET Texture APPEND PROPERTY IMPORTED_CONFIGURATIONS DEV)
+set_target_properties(Texture PROPERTIES
+  IMPORTED_LINK_DEPENDENT_LIBRARIES_DEV "stb_image"
+  IMPORTED_LOCATION_DEV "/root/repo/Output/Bin/LinuxMakeGccDev64/plTexture.so"
+  IMPORTED_SONAME_DEV "plTexture.so"
+  )
+
+# Import target "Utilities" for configuration "Dev"
+set_property(TARGET Utilities APPEND PROPERTY IMPORTED_CONFIGURATIONS DEV)
+set_target_properties(Utilities PROPERTIES
+  IMPORTED_LOCATION_DEV "/root/repo/Output/Bin/LinuxMakeGccDev64/plUtilities.so"
+  IMPORTED_SONAME_DEV "plUtilities.so"
+  )
+
+# This file does not depend on other imported targets which have
+# been exported from the same project but in a separate export set.
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
+cmake_policy(POP)